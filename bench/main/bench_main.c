@@ -0,0 +1,36 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "sdkconfig.h"
+#include "esp_log.h"
+#include "st7789.h"
+#include "st7789_bench.h"
+
+static const char *TAG = "BENCH";
+
+// Repetition multiplier; raise it for steadier numbers on the board
+#ifndef BENCH_SCALE
+#define BENCH_SCALE 1
+#endif
+
+void app_main(void)
+{
+    esp_err_t ret = st7789_init();
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to initialize ST7789 display: %s", esp_err_to_name(ret));
+    } else {
+        // Same suite at both bus depths, so the 12-bit saving shows side by side
+        st7789_bench_config_t config = { .scale = BENCH_SCALE, .only = NULL,
+                                         .color_depth = ST7789_COLOR_16BIT };
+        ret = st7789_bench_run(&config, NULL, 0, NULL);
+        if (ret == ESP_OK) {
+            config.color_depth = ST7789_COLOR_12BIT;
+            ret = st7789_bench_run(&config, NULL, 0, NULL);
+        }
+        ESP_LOGI(TAG, "Benchmark %s", ret == ESP_OK ? "completed" : "failed");
+    }
+
+#if CONFIG_IDF_TARGET_LINUX
+    // On the host the exit status is what CI checks
+    exit(ret == ESP_OK ? EXIT_SUCCESS : EXIT_FAILURE);
+#endif
+}
@@ -1,15 +1,20 @@
 #include "st7789.h"
-#include "driver/gpio.h"
+#include "st7789_priv.h"
+#include "st7789_transport.h"
+#include "esp_attr.h"
 #include "esp_log.h"
 #include "esp_rom_sys.h"
+#include "esp_timer.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/event_groups.h"
+#include <stdatomic.h>
+#include <stdlib.h>
 #include <string.h>
 
 static const char *TAG = "ST7789";
 
 // ST7789 Display Controller Commands
-#define ST7789_SWRESET  0x01  // Software reset
 #define ST7789_SLPOUT   0x11  // Sleep out
 #define ST7789_COLMOD   0x3A  // Color mode
 #define ST7789_MADCTL   0x36  // Memory access control
@@ -20,6 +25,9 @@ static const char *TAG = "ST7789";
 #define ST7789_RASET    0x2B  // Row address set
 #define ST7789_RAMWR    0x2C  // Memory write
 
+#define COLMOD_RGB565   0x55  // 16 bits per pixel
+#define COLMOD_RGB444   0x53  // 12 bits per pixel, two pixels in three bytes
+
 // Color definitions (16-bit RGB565)
 #define RED     0xF800
 #define GREEN   0x07E0
@@ -28,14 +36,6 @@ static const char *TAG = "ST7789";
 #define BLACK   0x0000
 #define YELLOW  0xFFE0
 
-// Font definitions - 8x8 pixel font
-#define FONT_WIDTH  8
-#define FONT_HEIGHT 8
-
-// Large font definitions - 16x16 pixel font
-#define LARGE_FONT_WIDTH  16
-#define LARGE_FONT_HEIGHT 16
-
 // Simple 8x8 bitmap font for basic ASCII characters (32-126)
 static const uint8_t font8x8[95][8] = {
     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // Space (32)
@@ -135,163 +135,6 @@ static const uint8_t font8x8[95][8] = {
     {0x6E, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // ~ (126)
 };
 
-// Large 16x16 font for sensor displays - focused character set
-// Includes: space, digits 0-9, colon, uppercase letters A-Z
-// Character mapping: 32(space), 48-57(0-9), 58(:), 65-90(A-Z)
-static const uint16_t large_font16x16[][16] = {
-    // Space (32)
-    {0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000},
-     
-    // 0 (48)
-    {0x0000, 0x07E0, 0x1FF8, 0x3C3C, 0x701E, 0x600F, 0x600F, 0x600F,
-     0x600F, 0x600F, 0x600F, 0x701E, 0x3C3C, 0x1FF8, 0x07E0, 0x0000},
-     
-    // 1 (49) - Fixed orientation
-    {0x0000, 0x01C0, 0x03C0, 0x07C0, 0x0DC0, 0x01C0, 0x01C0, 0x01C0,
-     0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x7FF0, 0x7FF0, 0x0000},
-     
-    // 2 (50)
-    {0x0000, 0x07E0, 0x1FF8, 0x3C3C, 0x701E, 0x600F, 0x6007, 0x0007,
-     0x000E, 0x001C, 0x0038, 0x0070, 0x00E0, 0x7FFF, 0x7FFF, 0x0000},
-     
-    // 3 (51)
-    {0x0000, 0x07E0, 0x1FF8, 0x3C3C, 0x700E, 0x0007, 0x0007, 0x03FE,
-     0x03FE, 0x0007, 0x0007, 0x700E, 0x3C3C, 0x1FF8, 0x07E0, 0x0000},
-     
-    // 4 (52)
-    {0x0000, 0x000E, 0x001E, 0x003E, 0x006E, 0x00CE, 0x018E, 0x030E,
-     0x060E, 0x7FFF, 0x7FFF, 0x000E, 0x000E, 0x000E, 0x000E, 0x0000},
-     
-    // 5 (53)
-    {0x0000, 0x7FFF, 0x7FFF, 0x7000, 0x7000, 0x7000, 0x7FE0, 0x7FF8,
-     0x003C, 0x000E, 0x0007, 0x700E, 0x3C3C, 0x1FF8, 0x07E0, 0x0000},
-     
-    // 6 (54)
-    {0x0000, 0x07E0, 0x1FF8, 0x3C3C, 0x700E, 0x7007, 0x7000, 0x7FE0,
-     0x7FF8, 0x703C, 0x700E, 0x700E, 0x3C3C, 0x1FF8, 0x07E0, 0x0000},
-     
-    // 7 (55)
-    {0x0000, 0x7FFF, 0x7FFF, 0x0007, 0x000E, 0x000E, 0x001C, 0x001C,
-     0x0038, 0x0038, 0x0070, 0x0070, 0x00E0, 0x00E0, 0x01C0, 0x0000},
-     
-    // 8 (56)
-    {0x0000, 0x07E0, 0x1FF8, 0x3C3C, 0x700E, 0x700E, 0x3C3C, 0x1FF8,
-     0x1FF8, 0x3C3C, 0x700E, 0x700E, 0x3C3C, 0x1FF8, 0x07E0, 0x0000},
-     
-    // 9 (57)
-    {0x0000, 0x07E0, 0x1FF8, 0x3C3C, 0x700E, 0x700E, 0x3C0E, 0x1FFE,
-     0x07FE, 0x0007, 0x0007, 0x700E, 0x3C3C, 0x1FF8, 0x07E0, 0x0000},
-     
-    // : (58)
-    {0x0000, 0x0000, 0x0000, 0x0000, 0x01C0, 0x03E0, 0x03E0, 0x01C0,
-     0x0000, 0x01C0, 0x03E0, 0x03E0, 0x01C0, 0x0000, 0x0000, 0x0000},
-     
-    // A (65)
-    {0x0000, 0x0380, 0x07C0, 0x0EE0, 0x1C70, 0x1C70, 0x3838, 0x381C,
-     0x701C, 0x7FFE, 0x7FFE, 0xE007, 0xE007, 0xE007, 0xE007, 0x0000},
-     
-    // C (67)
-    {0x0000, 0x07E0, 0x1FF8, 0x3C3C, 0x701E, 0x700F, 0x7007, 0x7000,
-     0x7000, 0x7007, 0x700F, 0x701E, 0x3C3C, 0x1FF8, 0x07E0, 0x0000},
-     
-    // D (68)
-    {0x0000, 0x7FE0, 0x7FF8, 0x703C, 0x701E, 0x700F, 0x700F, 0x700F,
-     0x700F, 0x700F, 0x700F, 0x701E, 0x703C, 0x7FF8, 0x7FE0, 0x0000},
-     
-    // E (69)
-    {0x0000, 0x7FFF, 0x7FFF, 0x7000, 0x7000, 0x7000, 0x7FE0, 0x7FE0,
-     0x7FE0, 0x7000, 0x7000, 0x7000, 0x7000, 0x7FFF, 0x7FFF, 0x0000},
-     
-    // H (72)
-    {0x0000, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xFFFF, 0xFFFF,
-     0xFFFF, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0x0000},
-     
-    // I (73)
-    {0x0000, 0x0FF0, 0x0FF0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0,
-     0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x0FF0, 0x0FF0, 0x0000},
-     
-    // M (77)
-    {0x0000, 0xE007, 0xF00F, 0xF81F, 0xFC3F, 0xEE77, 0xE7E7, 0xE3C7,
-     0xE187, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0x0000},
-     
-    // N (78)
-    {0x0000, 0xE007, 0xF007, 0xF807, 0xFC07, 0xEE07, 0xE707, 0xE387,
-     0xE1C7, 0xE0E7, 0xE077, 0xE03F, 0xE01F, 0xE00F, 0xE007, 0x0000},
-     
-    // P (80)
-    {0x0000, 0x7FE0, 0x7FF8, 0x703C, 0x700E, 0x700E, 0x703C, 0x7FF8,
-     0x7FE0, 0x7000, 0x7000, 0x7000, 0x7000, 0x7000, 0x7000, 0x0000},
-     
-    // R (82)
-    {0x0000, 0x7FE0, 0x7FF8, 0x703C, 0x700E, 0x700E, 0x703C, 0x7FF8,
-     0x7FE0, 0x7380, 0x71C0, 0x70E0, 0x7070, 0x7038, 0x701C, 0x0000},
-     
-    // S (83)
-    {0x0000, 0x07E0, 0x1FF8, 0x3C3C, 0x700E, 0x7007, 0x3800, 0x1FE0,
-     0x07F8, 0x001C, 0x700E, 0x700E, 0x3C3C, 0x1FF8, 0x07E0, 0x0000},
-     
-    // T (84)
-    {0x0000, 0x7FFF, 0x7FFF, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0,
-     0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x0000},
-     
-    // U (85)
-    {0x0000, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007,
-     0xE007, 0xE007, 0xE007, 0x700E, 0x3C3C, 0x1FF8, 0x07E0, 0x0000},
-     
-    // Y (89)
-    {0x0000, 0xE007, 0x700E, 0x381C, 0x1C38, 0x0E70, 0x07E0, 0x03C0,
-     0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0000},
-     
-    // . (46) - Period
-    {0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-     0x0000, 0x0000, 0x0000, 0x0000, 0x03C0, 0x07E0, 0x07E0, 0x03C0},
-     
-    // % (37) - Percent
-    {0x0000, 0x7003, 0xF807, 0xDC0E, 0xDC1C, 0xF838, 0x7070, 0x00E0,
-     0x01C0, 0x0380, 0x0700, 0x0E3E, 0x1C7E, 0x387B, 0x707B, 0xE03E},
-};
-
-/**
- * @brief Get array index for large font character
- * 
- * Maps supported characters to their corresponding index in the large_font16x16 array.
- * Returns -1 for unsupported characters to enable graceful error handling.
- * 
- * Supported character mapping:
- * - Space: index 0
- * - Numbers 0-9: indices 1-10  
- * - Colon (:): index 11
- * - Letters A,C,D,E,H,I,M,N,P,R,S,T,U,Y: indices 12-25
- * - Period (.): index 26
- * - Percent (%): index 27
- * 
- * @param c Character to look up
- * @return Array index (0-27) for supported characters, -1 for unsupported
- */
-static int get_large_font_index(char c) {
-    if (c == ' ') return 0;           // Space
-    if (c >= '0' && c <= '9') return 1 + (c - '0');  // Numbers 0-9
-    if (c == ':') return 11;          // Colon
-    if (c == 'A') return 12;          // A
-    if (c == 'C') return 13;          // C  
-    if (c == 'D') return 14;          // D
-    if (c == 'E') return 15;          // E
-    if (c == 'H') return 16;          // H
-    if (c == 'I') return 17;          // I
-    if (c == 'M') return 18;          // M
-    if (c == 'N') return 19;          // N
-    if (c == 'P') return 20;          // P
-    if (c == 'R') return 21;          // R
-    if (c == 'S') return 22;          // S
-    if (c == 'T') return 23;          // T
-    if (c == 'U') return 24;          // U
-    if (c == 'Y') return 25;          // Y
-    if (c == '.') return 26;          // Period
-    if (c == '%') return 27;          // Percent
-    return -1; // Unsupported character
-}
-
 /**
  * @brief Precise millisecond delay using FreeRTOS
  * 
@@ -304,80 +147,35 @@ static void delay_ms(uint32_t ms) {
     vTaskDelay(pdMS_TO_TICKS(ms));
 }
 
-/**
- * @brief Set GPIO pin output level
- * 
- * Helper function for cleaner GPIO control. Provides Arduino-style
- * digitalWrite interface for better code readability.
- * 
- * @param pin GPIO pin number
- * @param value Output level (0 = low, 1 = high)
- */
-static void digitalWrite(int pin, int value) {
-    gpio_set_level((gpio_num_t)pin, value);
-}
-
-/**
- * @brief Send single byte via bit-banging SPI
- * 
- * Implements software SPI transmission for maximum compatibility with ST7789
- * displays that don't have CS pins. Optimized for speed with no delays between
- * clock cycles. Uses SPI Mode 0 (CPOL=0, CPHA=0).
- * 
- * @param data 8-bit data byte to transmit (MSB first)
- */
-static void spi_write_byte_bitbang(uint8_t data) {
-    for (int i = 7; i >= 0; i--) {
-        // Set data bit on MOSI
-        digitalWrite(ST7789_SDA_PIN, (data >> i) & 1);
-        
-        // Clock pulse - maximum speed, no delays
-        digitalWrite(ST7789_SCK_PIN, 0);
-        digitalWrite(ST7789_SCK_PIN, 1);
-    }
-}
-
-static void spi_write_word_bitbang(uint16_t data) {
-    spi_write_byte_bitbang(data >> 8);   // High byte first
-    spi_write_byte_bitbang(data & 0xFF); // Low byte
-}
-
-// Data/Command pin control for ST7789 protocol
-static inline void set_dc_command(void) {
-    gpio_set_level(ST7789_DC_PIN, 0);  // DC low = command mode
-}
-
-static inline void set_dc_data(void) {
-    gpio_set_level(ST7789_DC_PIN, 1);  // DC high = data mode
-}
-
 /**
  * @brief Send command to ST7789 controller
  * 
  * Transmits a command byte to the ST7789 with proper DC pin control.
  * Sets DC low for command mode, sends the command, then switches back
- * to data mode for subsequent data transmission.
+ * to data mode for subsequent data transmission. Build with ST7789_TRACE
+ * to record bus traffic (see st7789_trace_dump()).
  * 
  * @param cmd ST7789 command byte
  */
+static void end_pixels(void);
+
+uint64_t st7789_bus_bytes;   // Advanced by ST7789_BUS_WRITE() in the transports
+
 static void write_command(uint8_t cmd) {
-    ESP_LOGD(TAG, "Sending command: 0x%02X", cmd);
-    set_dc_command();
-    spi_write_byte_bitbang(cmd);
-    set_dc_data();  // Ready for data mode
+    end_pixels();   // A command ends RAMWR, so an odd 12-bit pixel must go first
+    st7789_transport_write_command(cmd);
 }
 
 static void write_data(uint8_t data) {
-    ESP_LOGD(TAG, "Sending data: 0x%02X", data);
-    set_dc_data();
-    spi_write_byte_bitbang(data);
+    st7789_transport_write_data(&data, 1);
 }
 
-static void write_data_word(uint16_t data) {
-    ESP_LOGD(TAG, "Sending 16-bit data: 0x%04X", data);
-    set_dc_data();
-    spi_write_word_bitbang(data);
-}
+// Column and row ranges last sent to the panel, inclusive
+static struct {
+    bool col_valid, row_valid;
+    uint16_t x0, x1, y0, y1;
+} window_state;
+static st7789_window_stats_t window_stats;
 
 /**
  * @brief Set display memory address window
@@ -386,6 +184,10 @@ static void write_data_word(uint16_t data) {
  * Essential for efficient drawing operations as it allows streaming pixel data
  * without individual coordinate commands.
  * 
+ * The controller keeps its column and row ranges across RAMWR, so with
+ * ST7789_WINDOW_CACHE enabled a CASET or RASET matching the last one sent
+ * is skipped. RAMWR is always sent since it rewinds the write pointer.
+ * 
  * @param x Starting X coordinate
  * @param y Starting Y coordinate  
  * @param w Width of the window in pixels
@@ -395,174 +197,672 @@ static void set_address_window(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
     uint16_t x_end = x + w - 1;
     uint16_t y_end = y + h - 1;
     
-    write_command(ST7789_CASET);   // Column address set
-    write_data_word(x);            // X start
-    write_data_word(x_end);        // X end
+    uint8_t params[4];
+    
+    if (ST7789_WINDOW_CACHE && window_state.col_valid &&
+        window_state.x0 == x && window_state.x1 == x_end) {
+        window_stats.caset_skipped++;
+    } else {
+        write_command(ST7789_CASET);   // Column address set
+        put_be16(&params[0], x);       // X start
+        put_be16(&params[2], x_end);   // X end
+        st7789_transport_write_data(params, sizeof(params));
+        window_state.x0 = x;
+        window_state.x1 = x_end;
+        window_state.col_valid = true;
+        window_stats.caset_sent++;
+    }
     
-    write_command(ST7789_RASET);   // Row address set
-    write_data_word(y);            // Y start
-    write_data_word(y_end);        // Y end
+    if (ST7789_WINDOW_CACHE && window_state.row_valid &&
+        window_state.y0 == y && window_state.y1 == y_end) {
+        window_stats.raset_skipped++;
+    } else {
+        write_command(ST7789_RASET);   // Row address set
+        put_be16(&params[0], y);       // Y start
+        put_be16(&params[2], y_end);   // Y end
+        st7789_transport_write_data(params, sizeof(params));
+        window_state.y0 = y;
+        window_state.y1 = y_end;
+        window_state.row_valid = true;
+        window_stats.raset_sent++;
+    }
     
     write_command(ST7789_RAMWR);   // Write to RAM
+    window_stats.windows++;
 }
 
-// Fill rectangular area with specified color - optimized for cooperative multitasking
-static void fill_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
+void st7789_bus_set_window(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
     set_address_window(x, y, w, h);
+}
+
+void st7789_bus_command(uint8_t cmd, const uint8_t *params, size_t len) {
+    write_command(cmd);
+    if (len > 0) {
+        st7789_transport_write_data(params, len);
+    }
+}
+
+static st7789_color_depth_t color_depth = ST7789_COLOR_16BIT;
+
+// 12-bit output: packed pixels staged here, and a pixel waiting for its pair
+static DMA_ATTR uint8_t pack_buf[ST7789_BLIT_BUF_PIXELS / 2 * 3];
+static uint16_t carry_pixel;
+static bool carry_valid;
+
+/**
+ * @brief Pack panel-order RGB565 pixels as RGB444, two pixels per three bytes
+ * 
+ * Keeps the top four bits of each channel. n must be even. dst may be the
+ * same buffer as src: each pair is read before its three bytes are written,
+ * and the output never overtakes the input.
+ * 
+ * @return Bytes written
+ */
+size_t st7789_pack_rgb444(uint8_t *dst, const uint16_t *src, size_t n) {
+    const uint8_t *s = (const uint8_t *)src;
+    uint8_t *d = dst;
+    for (size_t i = 0; i < n; i += 2, s += 4, d += 3) {
+        uint8_t h0 = s[0], l0 = s[1], h1 = s[2], l1 = s[3];
+        uint8_t g0 = ((h0 & 0x07) << 1) | (l0 >> 7);
+        uint8_t g1 = ((h1 & 0x07) << 1) | (l1 >> 7);
+        d[0] = (h0 & 0xF0) | g0;
+        d[1] = ((l0 << 3) & 0xF0) | (h1 >> 4);
+        d[2] = (g1 << 4) | ((l1 >> 1) & 0x0F);
+    }
+    return d - dst;
+}
+
+/**
+ * @brief Send n panel-order RGB565 pixels in the current color depth
+ * 
+ * In 16-bit mode this is a plain transport write. In 12-bit mode pixels are
+ * packed through pack_buf; an odd pixel is held back to pair with the first
+ * one of the next call, so rows of odd width still pack densely.
+ * end_pixels() sends a held pixel on its own.
+ */
+static void write_pixels(const uint16_t *pixels, size_t n) {
+    if (n == 0) return;
+    if (color_depth == ST7789_COLOR_16BIT) {
+        st7789_transport_write_data((const uint8_t *)pixels, n * 2);
+        return;
+    }
     
-    uint32_t pixels = (uint32_t)w * h;
+    size_t used = 0;
+    if (carry_valid) {
+        uint16_t pair[2] = { carry_pixel, pixels[0] };
+        used = st7789_pack_rgb444(pack_buf, pair, 2);
+        carry_valid = false;
+        pixels++;
+        n--;
+    }
+    while (n >= 2) {
+        size_t room = (sizeof(pack_buf) - used) / 3 * 2;
+        size_t chunk = (n & ~(size_t)1) < room ? (n & ~(size_t)1) : room;
+        used += st7789_pack_rgb444(pack_buf + used, pixels, chunk);
+        pixels += chunk;
+        n -= chunk;
+        if (used + 3 > sizeof(pack_buf)) {
+            st7789_transport_write_data(pack_buf, used);
+            used = 0;
+        }
+    }
+    if (used > 0) {
+        st7789_transport_write_data(pack_buf, used);
+    }
+    if (n == 1) {
+        carry_pixel = pixels[0];
+        carry_valid = true;
+    }
+}
+
+// Send a held 12-bit pixel: its 12 bits, padded to two bytes
+static void end_pixels(void) {
+    if (!carry_valid) return;
+    uint16_t pair[2] = { carry_pixel, 0 };
+    uint8_t packed[3];
+    st7789_pack_rgb444(packed, pair, 2);
+    carry_valid = false;
+    st7789_transport_write_data(packed, 2);
+}
+
+void st7789_bus_write_pixels(const uint16_t *pixels, size_t n) {
+    write_pixels(pixels, n);
+}
+
+void st7789_bus_end_pixels(void) {
+    end_pixels();
+}
+
+bool st7789_bus_rgb444(void) {
+    return color_depth == ST7789_COLOR_12BIT;
+}
+
+/**
+ * @brief Choose how many bits per pixel go over the bus
+ * 
+ * The API keeps taking RGB565; in 12-bit mode (COLMOD 0x53) every path
+ * packs pixels to RGB444 on the way out, so each pixel costs 1.5 bytes
+ * instead of 2 and bus time drops by about a quarter. Pixels already in GRAM
+ * are unaffected. st7789_init() selects 16-bit mode.
+ * 
+ * @param depth ST7789_COLOR_16BIT or ST7789_COLOR_12BIT
+ * @return ESP_OK, ESP_ERR_INVALID_ARG, or ESP_ERR_INVALID_STATE during a band render
+ */
+esp_err_t st7789_set_color_depth(st7789_color_depth_t depth) {
+    if (depth != ST7789_COLOR_16BIT && depth != ST7789_COLOR_12BIT) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (st7789_band_active()) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    st7789_async_sync();
+    write_command(ST7789_COLMOD);
+    write_data(depth == ST7789_COLOR_12BIT ? COLMOD_RGB444 : COLMOD_RGB565);
+    color_depth = depth;
+    return ESP_OK;
+}
+
+st7789_color_depth_t st7789_get_color_depth(void) {
+    return color_depth;
+}
+
+// Solid-color run buffer, pre-swapped to panel byte order and reused across fills
+static DMA_ATTR uint32_t fill_buf[ST7789_FILL_BUF_PIXELS / 2];
+static uint16_t fill_buf_color;
+static st7789_color_depth_t fill_buf_depth;
+static bool fill_buf_valid;
+
+/**
+ * @brief Stream count pixels of a single color into the open address window
+ * 
+ * The run buffer is only re-expanded when the color changes, two pixels per
+ * 32-bit store. Pixels then go out in ST7789_FILL_BUF_PIXELS chunks, so a
+ * full-screen clear is a handful of bulk transfers. Yields happen between
+ * chunks rather than inside a per-pixel loop. In 12-bit mode the buffer
+ * holds the color as repeated three-byte pixel pairs instead.
+ * 
+ * @param color 16-bit RGB565 color value
+ * @param count Number of pixels to send
+ */
+static void stream_fill(uint16_t color, uint32_t count) {
+    if (!fill_buf_valid || fill_buf_color != color || fill_buf_depth != color_depth) {
+        uint16_t be_color = to_be16(color);
+        uint32_t pair = ((uint32_t)be_color << 16) | be_color;
+        for (size_t i = 0; i < ST7789_FILL_BUF_PIXELS / 2; i++) {
+            fill_buf[i] = pair;
+        }
+        if (color_depth == ST7789_COLOR_12BIT) {
+            st7789_pack_rgb444((uint8_t *)fill_buf, (const uint16_t *)fill_buf,
+                               ST7789_FILL_BUF_PIXELS);
+        }
+        fill_buf_color = color;
+        fill_buf_depth = color_depth;
+        fill_buf_valid = true;
+    }
     
-    // Set data mode and stream color data to display memory
-    set_dc_data();
-    for (uint32_t i = 0; i < pixels; i++) {
-        spi_write_word_bitbang(color);
+    if (color_depth == ST7789_COLOR_12BIT && (count & 1)) {
+        uint16_t be_color = to_be16(color);
+        write_pixels(&be_color, 1);   // Held back and sent by end_pixels()
+        count--;
+    }
+    while (count > 0) {
+        uint32_t chunk = count < ST7789_FILL_BUF_PIXELS ? count : ST7789_FILL_BUF_PIXELS;
+        size_t bytes = color_depth == ST7789_COLOR_12BIT ? chunk / 2 * 3 : chunk * 2;
+        st7789_transport_write_data((const uint8_t *)fill_buf, bytes);
+        count -= chunk;
         
-        // Yield to other tasks occasionally for large operations (every 500 pixels)
-        if (pixels > 1000 && (i % 500) == 0) {
-            taskYIELD(); // Brief yield without delay
+        // Let other tasks run between bulk transfers of large fills
+        if (count > 0) {
+            ST7789_STATS_YIELD();
+            taskYIELD();
         }
     }
 }
 
+void st7789_bus_write_color(uint16_t color, uint32_t count) {
+    if (count > 0 && carry_valid) {
+        // Pair the held 12-bit pixel first so the packed run stays aligned
+        uint16_t be = to_be16(color);
+        write_pixels(&be, 1);
+        count--;
+    }
+    if (count > 0) {
+        stream_fill(color, count);
+    }
+}
+
+// Fill rectangular area on the panel with specified color
+void st7789_bus_fill_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
+    if (w == 0 || h == 0) return;
+    
+    set_address_window(x, y, w, h);
+    stream_fill(color, (uint32_t)w * h);
+    end_pixels();
+}
+
+// Fill rectangular area, through the framebuffer when one is enabled
+static void fill_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
+    if (st7789_async_fill_rect(x, y, w, h, color)) return;
+    if (st7789_band_fill_rect(x, y, w, h, color)) return;
+    if (st7789_fb_fill_rect(x, y, w, h, color)) return;
+    st7789_bus_fill_rect(x, y, w, h, color);
+}
+
 // Draw a single pixel at specified coordinates
 static void draw_pixel(uint16_t x, uint16_t y, uint16_t color) {
     if (x >= 240 || y >= 240) return;  // Bounds check
+    if (st7789_async_draw_pixel(x, y, color)) return;
+    if (st7789_band_fill_rect(x, y, 1, 1, color)) return;
+    if (st7789_fb_fill_rect(x, y, 1, 1, color)) return;
     
     set_address_window(x, y, 1, 1);
-    write_data_word(color);
+    uint16_t be = to_be16(color);
+    write_pixels(&be, 1);
+    end_pixels();
+}
+
+// Staging buffer for host-endian blits, converted to panel byte order in bulk
+static DMA_ATTR uint32_t blit_buf[ST7789_BLIT_BUF_PIXELS / 2];
+
+/**
+ * @brief Swap n host-endian RGB565 pixels into panel byte order
+ * 
+ * Works on pixel pairs with one 32-bit swap when both pointers allow it,
+ * falling back to 16-bit swaps for the unaligned head and odd tail.
+ */
+void st7789_swap_copy(uint16_t *dst, const uint16_t *src, size_t n) {
+    if ((((uintptr_t)dst | (uintptr_t)src) & 3) == 0) {
+        const uint32_t *s32 = (const uint32_t *)src;
+        uint32_t *d32 = (uint32_t *)dst;
+        for (size_t i = 0; i < n / 2; i++) {
+            uint32_t v = s32[i];
+            d32[i] = ((v & 0x00FF00FFu) << 8) | ((v >> 8) & 0x00FF00FFu);
+        }
+        if (n & 1) {
+            dst[n - 1] = __builtin_bswap16(src[n - 1]);
+        }
+        return;
+    }
+    for (size_t i = 0; i < n; i++) {
+        dst[i] = __builtin_bswap16(src[i]);
+    }
+}
+
+/**
+ * @brief Stream a block of pixels to the panel under a single address window
+ * 
+ * Clips against the 240x240 panel, sets the window once and sends the rows.
+ * Contiguous pre-swapped input goes straight to the transport in one call.
+ * Everything else is staged through blit_buf, packing as many rows per
+ * transfer as fit: host-endian rows are converted on the way in, strided
+ * pre-swapped rows are just copied.
+ * 
+ * @param x X coordinate of top-left corner
+ * @param y Y coordinate of top-left corner
+ * @param w Width of the block in pixels
+ * @param h Height of the block in pixels
+ * @param pixels First pixel of the block
+ * @param stride Distance between rows of pixels, in pixels
+ * @param order Byte order of the source pixels
+ */
+void st7789_bus_blit(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                     const uint16_t *pixels, size_t stride, st7789_pixel_order_t order) {
+    if (pixels == NULL || x >= 240 || y >= 240 || w == 0 || h == 0) return;
+    
+    // Clip right and bottom edges; the source keeps its full stride
+    uint16_t cw = (x + w > 240) ? 240 - x : w;
+    uint16_t ch = (y + h > 240) ? 240 - y : h;
+    
+    set_address_window(x, y, cw, ch);
+    
+    if (order == ST7789_PIXELS_BE && stride == cw) {
+        write_pixels(pixels, (size_t)cw * ch);
+        end_pixels();
+        return;
+    }
+    
+    uint16_t *staging = (uint16_t *)blit_buf;
+    size_t used = 0;
+    for (uint16_t row = 0; row < ch; row++) {
+        const uint16_t *src = pixels + row * stride;
+        size_t left = cw;
+        while (left > 0) {
+            size_t n = ST7789_BLIT_BUF_PIXELS - used;
+            if (n > left) n = left;
+            if (order == ST7789_PIXELS_BE) {
+                memcpy(staging + used, src, n * sizeof(uint16_t));
+            } else {
+                st7789_swap_copy(staging + used, src, n);
+            }
+            used += n;
+            src += n;
+            left -= n;
+            if (used == ST7789_BLIT_BUF_PIXELS) {
+                write_pixels(staging, used);
+                used = 0;
+            }
+        }
+    }
+    write_pixels(staging, used);
+    end_pixels();
+}
+
+// Draw a block of pixels, through the framebuffer when one is enabled
+static void blit(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                 const uint16_t *pixels, size_t stride, st7789_pixel_order_t order) {
+    if (st7789_async_blit(x, y, w, h, pixels, stride, order)) return;
+    if (st7789_band_blit(x, y, w, h, pixels, stride, order)) return;
+    if (st7789_fb_blit(x, y, w, h, pixels, stride, order)) return;
+    st7789_bus_blit(x, y, w, h, pixels, stride, order);
 }
 
 // Draw a single character at specified position - optimized for performance
 static void draw_char(uint16_t x, uint16_t y, char c, uint16_t color, uint16_t bg_color) {
     if (c < 32 || c > 126) return;  // Only printable ASCII characters
+    if (st7789_async_draw_char(ST7789_FONT_8X8, x, y, c, color, bg_color)) return;
     
     uint8_t char_index = c - 32;  // Convert to font array index
     
-    // Set address window for entire character to minimize SPI overhead
-    set_address_window(x, y, FONT_WIDTH, FONT_HEIGHT);
-    set_dc_data();  // Switch to data mode once
+    // Reuse an already expanded image of this glyph and color pair if cached
+    bool hit;
+    uint16_t local[FONT_WIDTH * FONT_HEIGHT];
+    uint16_t *pixels = st7789_glyph_cache_lookup(ST7789_FONT_8X8, c, color, bg_color, &hit);
+    if (pixels == NULL) {
+        pixels = local;
+    }
+    if (hit) {
+        blit(x, y, FONT_WIDTH, FONT_HEIGHT, pixels, FONT_WIDTH, ST7789_PIXELS_BE);
+        return;
+    }
     
-    // Stream entire character as pixel data - fast enough not to need yields
+    // Expand the glyph so the whole character goes out as one data block
+    uint16_t fg_be = to_be16(color);
+    uint16_t bg_be = to_be16(bg_color);
+    uint16_t *p = pixels;
     for (uint8_t row = 0; row < FONT_HEIGHT; row++) {
         uint8_t font_row = font8x8[char_index][row];
         
         for (uint8_t col = 0; col < FONT_WIDTH; col++) {
             // Fix bit order - read from LSB to MSB to correct character reversal
-            if (font_row & (0x01 << col)) {
-                spi_write_word_bitbang(color);     // Foreground
-            } else {
-                spi_write_word_bitbang(bg_color);  // Background
-            }
+            *p++ = (font_row & (0x01 << col)) ? fg_be : bg_be;
         }
     }
+    
+    // Single address window for the entire character
+    blit(x, y, FONT_WIDTH, FONT_HEIGHT, pixels, FONT_WIDTH, ST7789_PIXELS_BE);
 }
 
-// Draw a string at specified position - optimized with minimal task cooperation
-static void draw_string(uint16_t x, uint16_t y, const char* str, uint16_t color, uint16_t bg_color) {
-    uint16_t cur_x = x;
-    uint16_t cur_y = y;
-    uint16_t char_count = 0;
+// Draw a single large character (16x16) at specified position
+static void draw_large_char(uint16_t x, uint16_t y, char c, uint16_t color, uint16_t bg_color) {
+    if (c < 32 || c > 126) return;  // Only printable ASCII characters
+    if (st7789_async_draw_char(ST7789_FONT_16X16, x, y, c, color, bg_color)) return;
     
-    while (*str) {
-        if (*str == '\n') {
-            // New line
-            cur_x = x;
-            cur_y += FONT_HEIGHT + 2;  // Add 2 pixels line spacing
-        } else if (*str == '\r') {
-            // Carriage return
-            cur_x = x;
-        } else {
-            // Bounds check before drawing character
-            if (cur_x + FONT_WIDTH <= 240 && cur_y + FONT_HEIGHT <= 240) {
-                draw_char(cur_x, cur_y, *str, color, bg_color);
+    // Reuse an already expanded image of this glyph and color pair if cached
+    bool hit;
+    uint16_t local[LARGE_FONT_WIDTH * LARGE_FONT_HEIGHT];
+    uint16_t *pixels = st7789_glyph_cache_lookup(ST7789_FONT_16X16, c, color, bg_color, &hit);
+    if (pixels == NULL) {
+        pixels = local;
+    }
+    if (hit) {
+        blit(x, y, LARGE_FONT_WIDTH, LARGE_FONT_HEIGHT, pixels, LARGE_FONT_WIDTH, ST7789_PIXELS_BE);
+        return;
+    }
+    
+    // Expand the glyph so the whole character goes out as one data block
+    uint16_t fg_be = to_be16(color);
+    uint16_t bg_be = to_be16(bg_color);
+    uint16_t *p = pixels;
+    for (uint8_t row = 0; row < LARGE_FONT_HEIGHT; row++) {
+        uint16_t font_row = large_font_row(c, row);
+        
+        for (uint8_t col = 0; col < LARGE_FONT_WIDTH; col++) {
+            // Read bit from font data (MSB first for 16x16)
+            *p++ = (font_row & (0x8000 >> col)) ? fg_be : bg_be;
+        }
+    }
+    
+    // Single address window for the entire character
+    blit(x, y, LARGE_FONT_WIDTH, LARGE_FONT_HEIGHT, pixels, LARGE_FONT_WIDTH, ST7789_PIXELS_BE);
+}
+
+// Longest run of glyphs that fits on one 240-pixel line (8x8 font)
+#define TEXT_RUN_MAX_CHARS ((240 - FONT_WIDTH) / (FONT_WIDTH + FONT_CHAR_SPACING) + 1)
+
+// Glyphs on one line that will go out together under a single address window
+typedef struct {
+    st7789_font_t font;
+    uint8_t scale;            // Integer magnification, 1 for the font's own size
+    uint16_t x, y;
+    uint16_t color, bg_color;
+    uint8_t len;
+    char chars[TEXT_RUN_MAX_CHARS];
+} text_run_t;
+
+_Static_assert(ST7789_BLIT_BUF_PIXELS >= 240, "text runs stage at least one full line");
+
+// Rasterise one pixel row of a text run, spacing columns included
+static void rasterise_run_row(const text_run_t *run, uint8_t row, uint16_t fg_be,
+                              uint16_t bg_be, uint16_t *dst) {
+    for (uint8_t i = 0; i < run->len; i++) {
+        if (i > 0) {
+            uint8_t gap = run->font == ST7789_FONT_16X16 ? LARGE_FONT_CHAR_SPACING : FONT_CHAR_SPACING;
+            for (uint8_t g = 0; g < gap; g++) {
+                *dst++ = bg_be;
             }
-            cur_x += FONT_WIDTH + 1;  // Add 1 pixel character spacing
-            
-            // Wrap to next line if text exceeds display width
-            if (cur_x + FONT_WIDTH > 240) {
-                cur_x = x;
-                cur_y += FONT_HEIGHT + 2;
+        }
+        if (run->font == ST7789_FONT_16X16) {
+            uint16_t font_row = large_font_row(run->chars[i], row);
+            for (uint8_t col = 0; col < LARGE_FONT_WIDTH; col++) {
+                *dst++ = (font_row & (0x8000 >> col)) ? fg_be : bg_be;  // MSB first
+            }
+        } else {
+            uint8_t font_row = font8x8[run->chars[i] - 32][row];
+            for (uint8_t col = 0; col < FONT_WIDTH; col++) {
+                *dst++ = (font_row & (0x01 << col)) ? fg_be : bg_be;    // LSB first
             }
         }
-        str++;
-        char_count++;
-        
-        // Only yield for very long strings (more than 20 characters)
-        if ((char_count % 20) == 0) {
-            taskYIELD(); // Brief yield without delay
+    }
+}
+
+// Widen a rasterised row of w pixels in place, repeating each pixel scale times
+static void scale_run_row(uint16_t *line, uint16_t w, uint8_t scale) {
+    for (int i = w - 1; i >= 0; i--) {
+        uint16_t p = line[i];
+        for (uint8_t k = 0; k < scale; k++) {
+            line[i * scale + k] = p;
         }
-        
-        // Stop if text exceeds display height
-        if (cur_y + FONT_HEIGHT > 240) break;
     }
 }
 
-// Draw a single large character (16x16) at specified position
-static void draw_large_char(uint16_t x, uint16_t y, char c, uint16_t color, uint16_t bg_color) {
-    int char_index = get_large_font_index(c);
-    if (char_index < 0) return;  // Unsupported character
+/**
+ * @brief Send a pending text run as one strip and empty it
+ * 
+ * The strip covers every glyph plus the spacing between them, painted with
+ * the background color. On the panel, rows are rasterised into blit_buf a
+ * few at a time and all stream into the same address window. With a
+ * framebuffer or band render active they are copied in a row at a time from
+ * a line buffer instead, since a band flush triggered by the copy reuses
+ * blit_buf.
+ * 
+ * A scaled run decodes each font row once, widens it, and repeats the
+ * widened line scale times, so magnification adds no per-bit work.
+ */
+static void flush_text_run(text_run_t *run) {
+    if (run->len == 0) return;
     
-    // Set address window for entire character to minimize SPI overhead
-    set_address_window(x, y, LARGE_FONT_WIDTH, LARGE_FONT_HEIGHT);
-    set_dc_data();  // Switch to data mode once
+    bool large = run->font == ST7789_FONT_16X16;
+    uint16_t glyph_w = large ? LARGE_FONT_WIDTH : FONT_WIDTH;
+    uint16_t glyph_h = large ? LARGE_FONT_HEIGHT : FONT_HEIGHT;
+    uint16_t gap = large ? LARGE_FONT_CHAR_SPACING : FONT_CHAR_SPACING;
+    uint8_t scale = run->scale;
+    uint16_t src_w = run->len * (glyph_w + gap) - gap;
+    uint16_t w = src_w * scale;
+    uint16_t fg_be = to_be16(run->color);
+    uint16_t bg_be = to_be16(run->bg_color);
     
-    // Stream entire character as pixel data
-    for (uint8_t row = 0; row < LARGE_FONT_HEIGHT; row++) {
-        uint16_t font_row = large_font16x16[char_index][row];
-        
-        for (uint8_t col = 0; col < LARGE_FONT_WIDTH; col++) {
-            // Read bit from font data (MSB first for 16x16)
-            if (font_row & (0x8000 >> col)) {
-                spi_write_word_bitbang(color);     // Foreground
-            } else {
-                spi_write_word_bitbang(bg_color);  // Background
+    if (st7789_band_active() || st7789_fb_active()) {
+        uint16_t line[ST7789_WIDTH];
+        for (uint16_t row = 0; row < glyph_h; row++) {
+            rasterise_run_row(run, row, fg_be, bg_be, line);
+            scale_run_row(line, src_w, scale);
+            // Stride 0 repeats the line for every scaled row
+            blit(run->x, run->y + row * scale, w, scale, line, 0, ST7789_PIXELS_BE);
+        }
+        run->len = 0;
+        return;
+    }
+    
+    uint16_t *staging = (uint16_t *)blit_buf;
+    set_address_window(run->x, run->y, w, glyph_h * scale);
+    if (scale == 1) {
+        uint16_t rows_per_chunk = ST7789_BLIT_BUF_PIXELS / w;
+        for (uint16_t row0 = 0; row0 < glyph_h; row0 += rows_per_chunk) {
+            uint16_t rows = glyph_h - row0 < rows_per_chunk ? glyph_h - row0 : rows_per_chunk;
+            for (uint16_t r = 0; r < rows; r++) {
+                rasterise_run_row(run, row0 + r, fg_be, bg_be, staging + r * w);
             }
+            write_pixels(staging, (size_t)rows * w);
         }
-        
-        // Reset task occasionally for large characters
-        if ((row % 8) == 0) {
-            taskYIELD();
+    } else {
+        uint16_t copies = ST7789_BLIT_BUF_PIXELS / w;
+        if (copies > scale) copies = scale;
+        for (uint16_t row = 0; row < glyph_h; row++) {
+            rasterise_run_row(run, row, fg_be, bg_be, staging);
+            scale_run_row(staging, src_w, scale);
+            for (uint16_t c = 1; c < copies; c++) {
+                memcpy(staging + c * w, staging, w * sizeof(uint16_t));
+            }
+            for (uint16_t left = scale; left > 0; ) {
+                uint16_t n = left < copies ? left : copies;
+                write_pixels(staging, (size_t)n * w);
+                left -= n;
+            }
         }
     }
+    end_pixels();
+    run->len = 0;
 }
 
-// Draw a string with large font (16x16)
-static void draw_large_string(uint16_t x, uint16_t y, const char* str, uint16_t color, uint16_t bg_color) {
+/**
+ * @brief Draw a string, merging the glyphs of each line into one strip
+ * 
+ * Layout matches the original per-glyph renderer: newline and carriage
+ * return, wrapping at the right edge, and glyphs that do not fully fit are
+ * skipped. Consecutive glyphs on the same line are collected into a run and
+ * sent as a single window, so a line costs one CASET/RASET/RAMWR preamble
+ * instead of one per character, and the spacing between glyphs is painted
+ * with the background color. Characters the font cannot draw end the run
+ * and leave their cell untouched.
+ * 
+ * @param font Font to draw with
+ * @param x X coordinate for text start position
+ * @param y Y coordinate for text start position
+ * @param str Null-terminated string to draw
+ * @param color 16-bit RGB565 foreground color
+ * @param bg_color 16-bit RGB565 background color
+ * @param yield_every Yield to other tasks after this many characters
+ * @param scale Integer magnification of glyphs, spacing and line pitch
+ */
+static void draw_text(st7789_font_t font, uint16_t x, uint16_t y, const char *str,
+                      uint16_t color, uint16_t bg_color, uint16_t yield_every, uint8_t scale) {
+    if (st7789_async_draw_text(font, x, y, str, color, bg_color, scale)) return;
+    
+    bool large = font == ST7789_FONT_16X16;
+    uint16_t glyph_w = (large ? LARGE_FONT_WIDTH : FONT_WIDTH) * scale;
+    uint16_t glyph_h = (large ? LARGE_FONT_HEIGHT : FONT_HEIGHT) * scale;
+    uint16_t pitch = glyph_w + (large ? LARGE_FONT_CHAR_SPACING : FONT_CHAR_SPACING) * scale;
+    uint16_t line_pitch = glyph_h + (large ? LARGE_FONT_LINE_SPACING : FONT_LINE_SPACING) * scale;
     uint16_t cur_x = x;
     uint16_t cur_y = y;
     uint16_t char_count = 0;
+    text_run_t run = { .font = font, .scale = scale, .color = color, .bg_color = bg_color };
     
     while (*str) {
         if (*str == '\n') {
             // New line
             cur_x = x;
-            cur_y += LARGE_FONT_HEIGHT + 4;  // Add 4 pixels line spacing for large font
+            cur_y += line_pitch;
         } else if (*str == '\r') {
             // Carriage return
             cur_x = x;
         } else {
+            bool drawable = *str >= 32 && *str <= 126;
+            
             // Bounds check before drawing character
-            if (cur_x + LARGE_FONT_WIDTH <= 240 && cur_y + LARGE_FONT_HEIGHT <= 240) {
-                draw_large_char(cur_x, cur_y, *str, color, bg_color);
+            if (drawable && cur_x + glyph_w <= 240 && cur_y + glyph_h <= 240) {
+                bool continues = run.len > 0 && run.y == cur_y &&
+                                 run.x + run.len * pitch == cur_x;
+                if (!continues) {
+                    flush_text_run(&run);
+                    run.x = cur_x;
+                    run.y = cur_y;
+                }
+                run.chars[run.len++] = *str;
+            } else {
+                flush_text_run(&run);
             }
-            cur_x += LARGE_FONT_WIDTH + 2;  // Add 2 pixels character spacing for large font
+            cur_x += pitch;
             
             // Wrap to next line if text exceeds display width
-            if (cur_x + LARGE_FONT_WIDTH > 240) {
+            if (cur_x + glyph_w > 240) {
                 cur_x = x;
-                cur_y += LARGE_FONT_HEIGHT + 4;
+                cur_y += line_pitch;
             }
         }
         str++;
         char_count++;
         
-        // Only yield for very long strings
-        if ((char_count % 5) == 0) {
-            taskYIELD(); // Brief yield for large font operations
+        // Only yield for long strings
+        if ((char_count % yield_every) == 0) {
+            ST7789_STATS_YIELD();
+            taskYIELD(); // Brief yield without delay
         }
         
         // Stop if text exceeds display height
-        if (cur_y + LARGE_FONT_HEIGHT > 240) break;
+        if (cur_y + glyph_h > 240) break;
+    }
+    flush_text_run(&run);
+}
+
+// Draw a string at specified position with the 8x8 font
+static void draw_string(uint16_t x, uint16_t y, const char* str, uint16_t color, uint16_t bg_color) {
+    draw_text(ST7789_FONT_8X8, x, y, str, color, bg_color, 20, 1);
+}
+
+// Draw a string with large font (16x16)
+static void draw_large_string(uint16_t x, uint16_t y, const char* str, uint16_t color, uint16_t bg_color) {
+    draw_text(ST7789_FONT_16X16, x, y, str, color, bg_color, 5, 1);
+}
+
+/**
+ * @brief Draw one character cell of the given font
+ * 
+ * Unlike draw_char()/draw_large_char(), a character the font cannot draw
+ * paints the cell with the background color, so callers redrawing a cell
+ * in place never leave the previous glyph behind.
+ * 
+ * @param font Font selecting the cell size
+ * @param x X coordinate of the cell
+ * @param y Y coordinate of the cell
+ * @param c Character to draw
+ * @param color 16-bit RGB565 foreground color
+ * @param bg_color 16-bit RGB565 background color
+ */
+void st7789_draw_glyph(st7789_font_t font, uint16_t x, uint16_t y, char c,
+                       uint16_t color, uint16_t bg_color) {
+    if (font == ST7789_FONT_16X16) {
+        if (c < 32 || c > 126) {
+            fill_rect(x, y, LARGE_FONT_WIDTH, LARGE_FONT_HEIGHT, bg_color);
+        } else {
+            draw_large_char(x, y, c, color, bg_color);
+        }
+    } else {
+        if (c < 32 || c > 126) {
+            fill_rect(x, y, FONT_WIDTH, FONT_HEIGHT, bg_color);
+        } else {
+            draw_char(x, y, c, color, bg_color);
+        }
     }
 }
 
@@ -579,7 +879,9 @@ static void draw_large_string(uint16_t x, uint16_t y, const char* str, uint16_t
  * @param color 16-bit RGB565 color value
  */
 void st7789_draw_pixel(uint16_t x, uint16_t y, uint16_t color) {
+    int64_t start = ST7789_STATS_OP_BEGIN();
     draw_pixel(x, y, color);
+    ST7789_STATS_OP_END(ST7789_OP_DRAW_PIXEL, start);
 }
 
 /**
@@ -595,7 +897,101 @@ void st7789_draw_pixel(uint16_t x, uint16_t y, uint16_t color) {
  * @param color 16-bit RGB565 color value
  */
 void st7789_fill_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
+    int64_t start = ST7789_STATS_OP_BEGIN();
     fill_rect(x, y, w, h, color);
+    ST7789_STATS_OP_END(ST7789_OP_FILL_RECT, start);
+}
+
+/**
+ * @brief Draw a block of host-endian RGB565 pixels
+ * 
+ * Sets the address window once and streams the whole block, converting to
+ * panel byte order in bulk. Blocks crossing the right or bottom edge are
+ * clipped.
+ * 
+ * @param x X coordinate of top-left corner
+ * @param y Y coordinate of top-left corner
+ * @param w Width of the block in pixels
+ * @param h Height of the block in pixels
+ * @param pixels w*h pixels, row-major, native uint16_t RGB565
+ */
+void st7789_blit(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint16_t *pixels) {
+    int64_t start = ST7789_STATS_OP_BEGIN();
+    blit(x, y, w, h, pixels, w, ST7789_PIXELS_HOST);
+    ST7789_STATS_OP_END(ST7789_OP_BLIT, start);
+}
+
+/**
+ * @brief Draw a block of pre-swapped (big-endian) RGB565 pixels
+ * 
+ * The buffer is handed to the transport as-is with no conversion. Keep it in
+ * DMA-capable RAM for true zero-copy transfers; flash-resident data is staged
+ * through the transport's bounce buffers.
+ * 
+ * @param x X coordinate of top-left corner
+ * @param y Y coordinate of top-left corner
+ * @param w Width of the block in pixels
+ * @param h Height of the block in pixels
+ * @param pixels w*h pixels, row-major, already in panel byte order
+ */
+void st7789_blit_be(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint16_t *pixels) {
+    int64_t start = ST7789_STATS_OP_BEGIN();
+    blit(x, y, w, h, pixels, w, ST7789_PIXELS_BE);
+    ST7789_STATS_OP_END(ST7789_OP_BLIT, start);
+}
+
+/**
+ * @brief Draw a block of pixels whose rows are stride pixels apart
+ * 
+ * @param x X coordinate of top-left corner
+ * @param y Y coordinate of top-left corner
+ * @param w Width of the block in pixels
+ * @param h Height of the block in pixels
+ * @param pixels First pixel of the block
+ * @param stride Distance between the starts of consecutive rows, in pixels
+ * @param order Byte order of the source pixels
+ */
+void st7789_blit_stride(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                        const uint16_t *pixels, size_t stride, st7789_pixel_order_t order) {
+    int64_t start = ST7789_STATS_OP_BEGIN();
+    blit(x, y, w, h, pixels, stride, order);
+    ST7789_STATS_OP_END(ST7789_OP_BLIT, start);
+}
+
+/**
+ * @brief Draw a sub-rectangle of a larger image
+ * 
+ * Useful for sprite sheets and partial redraws of a pre-rendered background.
+ * 
+ * @param x X coordinate on the display
+ * @param y Y coordinate on the display
+ * @param image First pixel of the source image
+ * @param image_stride Width of the source image rows, in pixels
+ * @param src_x X offset of the sub-rectangle in the image
+ * @param src_y Y offset of the sub-rectangle in the image
+ * @param w Width of the sub-rectangle in pixels
+ * @param h Height of the sub-rectangle in pixels
+ * @param order Byte order of the source pixels
+ */
+void st7789_blit_sub(uint16_t x, uint16_t y, const uint16_t *image, size_t image_stride,
+                     uint16_t src_x, uint16_t src_y, uint16_t w, uint16_t h,
+                     st7789_pixel_order_t order) {
+    if (image == NULL) return;
+    int64_t start = ST7789_STATS_OP_BEGIN();
+    blit(x, y, w, h, image + (size_t)src_y * image_stride + src_x, image_stride, order);
+    ST7789_STATS_OP_END(ST7789_OP_BLIT, start);
+}
+
+/**
+ * @brief Convert host-endian RGB565 pixels to panel byte order in place
+ * 
+ * Lets callers pre-swap assets once and draw them with st7789_blit_be().
+ * 
+ * @param pixels Pixels to convert
+ * @param count Number of pixels
+ */
+void st7789_swap_pixels(uint16_t *pixels, size_t count) {
+    st7789_swap_copy(pixels, pixels, count);
 }
 
 /**
@@ -611,7 +1007,9 @@ void st7789_fill_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t c
  * @param bg_color 16-bit RGB565 background color
  */
 void st7789_draw_char(uint16_t x, uint16_t y, char c, uint16_t color, uint16_t bg_color) {
+    int64_t start = ST7789_STATS_OP_BEGIN();
     draw_char(x, y, c, color, bg_color);
+    ST7789_STATS_OP_END(ST7789_OP_DRAW_CHAR, start);
 }
 
 /**
@@ -627,7 +1025,33 @@ void st7789_draw_char(uint16_t x, uint16_t y, char c, uint16_t color, uint16_t b
  * @param bg_color 16-bit RGB565 background color
  */
 void st7789_draw_string(uint16_t x, uint16_t y, const char* str, uint16_t color, uint16_t bg_color) {
+    int64_t start = ST7789_STATS_OP_BEGIN();
     draw_string(x, y, str, color, bg_color);
+    ST7789_STATS_OP_END(ST7789_OP_DRAW_STRING, start);
+}
+
+/**
+ * @brief Draw a text string with the 8x8 font magnified by an integer factor
+ * 
+ * Glyphs, the spacing between them and the line pitch all scale, so scale 2
+ * gives 16x16 cells at an 18 px pitch like st7789_draw_large_string().
+ * Each line goes out as one window, and each font row is decoded once and
+ * repeated, so the cost per pixel does not grow with the scale. Wrapping,
+ * newlines and clipping follow st7789_draw_string().
+ * 
+ * @param x X coordinate for text start position
+ * @param y Y coordinate for text start position
+ * @param str Null-terminated string to draw
+ * @param scale Magnification, 1 to 30; 0 draws nothing
+ * @param color 16-bit RGB565 foreground color
+ * @param bg_color 16-bit RGB565 background color
+ */
+void st7789_draw_string_scaled(uint16_t x, uint16_t y, const char *str, uint8_t scale,
+                               uint16_t color, uint16_t bg_color) {
+    if (scale == 0) return;
+    int64_t start = ST7789_STATS_OP_BEGIN();
+    draw_text(ST7789_FONT_8X8, x, y, str, color, bg_color, 5, scale);
+    ST7789_STATS_OP_END(ST7789_OP_DRAW_STRING_SCALED, start);
 }
 
 /**
@@ -639,24 +1063,27 @@ void st7789_draw_string(uint16_t x, uint16_t y, const char* str, uint16_t color,
  * @param color 16-bit RGB565 color value to fill the screen
  */
 void st7789_clear_screen(uint16_t color) {
+    int64_t start = ST7789_STATS_OP_BEGIN();
     fill_rect(0, 0, 240, 240, color);
+    ST7789_STATS_OP_END(ST7789_OP_FILL_RECT, start);
 }
 
 /**
  * @brief Draw a single character using 16x16 large font
  * 
- * Renders a character using the large 16x16 pixel font. Supports a limited
- * character set optimized for sensor displays: numbers, symbols, and select letters.
- * Includes periodic task yields during rendering to maintain system responsiveness.
+ * Renders a character using the large 16x16 pixel font, which covers all
+ * printable ASCII. Other characters draw nothing.
  * 
  * @param x X coordinate for character placement
  * @param y Y coordinate for character placement
- * @param c Character to draw (supported: 0-9, ., %, :, A,C,D,E,H,I,M,N,P,R,S,T,U,Y)
+ * @param c Character to draw (ASCII 32-126)
  * @param color 16-bit RGB565 foreground color
  * @param bg_color 16-bit RGB565 background color
  */
 void st7789_draw_large_char(uint16_t x, uint16_t y, char c, uint16_t color, uint16_t bg_color) {
+    int64_t start = ST7789_STATS_OP_BEGIN();
     draw_large_char(x, y, c, color, bg_color);
+    ST7789_STATS_OP_END(ST7789_OP_DRAW_LARGE_CHAR, start);
 }
 
 /**
@@ -668,112 +1095,212 @@ void st7789_draw_large_char(uint16_t x, uint16_t y, char c, uint16_t color, uint
  * 
  * @param x X coordinate for text start position
  * @param y Y coordinate for text start position
- * @param str Null-terminated string (supported chars: 0-9, ., %, :, A,C,D,E,H,I,M,N,P,R,S,T,U,Y)
+ * @param str Null-terminated string (printable ASCII)
  * @param color 16-bit RGB565 foreground color
  * @param bg_color 16-bit RGB565 background color
  */
 void st7789_draw_large_string(uint16_t x, uint16_t y, const char* str, uint16_t color, uint16_t bg_color) {
+    int64_t start = ST7789_STATS_OP_BEGIN();
     draw_large_string(x, y, str, color, bg_color);
+    ST7789_STATS_OP_END(ST7789_OP_DRAW_LARGE_STRING, start);
+}
+
+/**
+ * @brief Forget the panel's column and row range so the next draw sends both
+ */
+void st7789_window_cache_invalidate(void) {
+    st7789_async_sync();
+    window_state.col_valid = false;
+    window_state.row_valid = false;
+}
+
+void st7789_window_get_stats(st7789_window_stats_t *stats) {
+    *stats = window_stats;
+}
+
+void st7789_window_reset_stats(void) {
+    memset(&window_stats, 0, sizeof(window_stats));
+}
+
+/**
+ * @brief One entry of the panel init table
+ */
+typedef struct {
+    uint8_t cmd;
+    uint8_t len;          // Parameter bytes
+    uint8_t delay_ms;     // Datasheet wait before the next command
+    uint8_t data[2];
+} init_cmd_t;
+
+// Reset timing from the ST7789 datasheet: RESX low for at least 10 us, then
+// up to 120 ms before commands are accepted if reset hit a running panel.
+// A hardware reset is a superset of SWRESET, so no SWRESET follows it.
+#define INIT_RESET_PULSE_US  10
+#define INIT_RESET_WAIT_US   120000
+
+static const init_cmd_t init_table[] = {
+    { ST7789_SLPOUT, 0, 5,  {0} },      // 5 ms before the next command
+    { ST7789_COLMOD, 1, 0,  {COLMOD_RGB565} },
+    { ST7789_MADCTL, 1, 0,  {0x00} },   // Normal scan direction, RGB order
+    { ST7789_INVON,  0, 0,  {0} },      // IPS panels need inversion for true colors
+    { ST7789_NORON,  0, 0,  {0} },
+    { ST7789_DISPON, 0, 0,  {0} },      // Must stay last: the clear runs just before it
+};
+
+#define INIT_TABLE_LEN (sizeof(init_table) / sizeof(init_table[0]))
+
+static st7789_init_config_t init_config;
+static int64_t init_started;
+static atomic_uint init_time_us;      // Read by other tasks while a background init runs
+static int64_t init_stats_start;
+static atomic_bool init_running;      // Background init task alive
+static EventGroupHandle_t init_events;
+
+#define INIT_DONE_BIT BIT0
+
+/**
+ * @brief Sleep until an esp_timer deadline
+ * 
+ * Whole ticks are slept with vTaskDelay(), which never overshoots when given
+ * floor(remaining / tick); the sub-tick remainder is spun, so waits are
+ * neither shorter than the datasheet asks nor rounded up to the tick.
+ */
+static void wait_until(int64_t deadline) {
+    for (;;) {
+        int64_t left = deadline - esp_timer_get_time();
+        if (left <= 0) {
+            return;
+        }
+        TickType_t ticks = left / (portTICK_PERIOD_MS * 1000);
+        if (ticks > 0) {
+            vTaskDelay(ticks);
+        } else {
+            esp_rom_delay_us((uint32_t)left);
+        }
+    }
+}
+
+// Everything after the reset pulse: runs on the caller or on the init task
+static void init_sequence(void) {
+    wait_until(esp_timer_get_time() + INIT_RESET_WAIT_US);
+    color_depth = ST7789_COLOR_16BIT;   // The table selects RGB565
+    
+    int64_t ready_at = 0;
+    for (size_t i = 0; i < INIT_TABLE_LEN; i++) {
+        const init_cmd_t *c = &init_table[i];
+        if (i == INIT_TABLE_LEN - 1 && !init_config.skip_clear) {
+            // Clear while the display is still off so stale GRAM never shows
+            st7789_bus_fill_rect(0, 0, 240, 240, BLACK);
+        }
+        wait_until(ready_at);
+        write_command(c->cmd);
+        for (uint8_t k = 0; k < c->len; k++) {
+            write_data(c->data[k]);
+        }
+        ready_at = esp_timer_get_time() + c->delay_ms * 1000;
+    }
+    
+    uint32_t us = (uint32_t)(esp_timer_get_time() - init_started);
+    atomic_store(&init_time_us, us);
+    ESP_LOGI(TAG, "ST7789 initialization completed in %u us", (unsigned)us);
+    ST7789_STATS_OP_END(ST7789_OP_INIT, init_stats_start);
+}
+
+static void init_task_main(void *arg) {
+    (void)arg;
+    init_sequence();
+    atomic_store(&init_running, false);
+    xEventGroupSetBits(init_events, INIT_DONE_BIT);
+    vTaskDelete(NULL);
 }
 
 /**
  * @brief Initialize the ST7789 240x240 TFT display
  * 
  * Performs complete initialization sequence including GPIO configuration,
- * hardware reset, and ST7789 controller setup. Uses bit-banging SPI for
- * maximum compatibility with displays that don't have CS pins.
+ * hardware reset, and ST7789 controller setup. The bus backend is chosen at
+ * build time with ST7789_TRANSPORT (SPI master + DMA by default).
  * 
  * Initialization sequence:
- * 1. Configure GPIO pins for SPI and control signals
- * 2. Perform hardware reset cycle
- * 3. Send ST7789 initialization commands
- * 4. Configure display for RGB565 color mode
- * 5. Clear display memory
+ * 1. Bring up the transport (SPI bus or GPIOs) and control pins
+ * 2. Pulse the hardware reset and wait for the controller
+ * 3. Send init_table, each entry followed by its datasheet minimum wait
+ * 4. Clear display memory (unless skip_clear), then turn the display on
+ * 
+ * Total time is dominated by the 120 ms reset wait; st7789_init_get_time_us()
+ * reports what the last init took.
  * 
  * @return ESP_OK on successful initialization, ESP_FAIL on error
  */
 esp_err_t st7789_init(void) {
+    return st7789_init_with_config(NULL);
+}
+
+esp_err_t st7789_init_with_config(const st7789_init_config_t *config) {
+    st7789_init_config_t defaults = ST7789_INIT_CONFIG_DEFAULT();
+    if (atomic_load(&init_running)) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    init_config = config ? *config : defaults;
+    init_stats_start = ST7789_STATS_OP_BEGIN();
+    init_started = esp_timer_get_time();
+    atomic_store(&init_time_us, 0);
+    
     ESP_LOGI(TAG, "===========================================");
     ESP_LOGI(TAG, "     ST7789 Display Driver Initialization");
-    ESP_LOGI(TAG, "        Using Bit-banging SPI");
+    ESP_LOGI(TAG, "        Using %s", st7789_transport_name());
     ESP_LOGI(TAG, "===========================================");
     
-    // Configure GPIO pins for bit-banging SPI and display control
-    gpio_config_t io_conf = {};
-    
-    // Configure MOSI pin
-    io_conf.intr_type = GPIO_INTR_DISABLE;
-    io_conf.mode = GPIO_MODE_OUTPUT;
-    io_conf.pin_bit_mask = (1ULL << ST7789_SDA_PIN);
-    io_conf.pull_down_en = GPIO_PULLDOWN_DISABLE;
-    io_conf.pull_up_en = GPIO_PULLUP_DISABLE;
-    gpio_config(&io_conf);
-    
-    // Configure SCLK pin
-    io_conf.pin_bit_mask = (1ULL << ST7789_SCK_PIN);
-    gpio_config(&io_conf);
-    
-    // Configure DC pin
-    io_conf.pin_bit_mask = (1ULL << ST7789_DC_PIN);
-    gpio_config(&io_conf);
-    
-    // Configure RST pin
-    io_conf.pin_bit_mask = (1ULL << ST7789_RST_PIN);
-    gpio_config(&io_conf);
-
-    // Set initial pin states
-    digitalWrite(ST7789_SCK_PIN, 1);  // SPI Mode 0: CLK idle high
-    digitalWrite(ST7789_SDA_PIN, 0);  // MOSI idle low
-    digitalWrite(ST7789_DC_PIN, 1);   // Data mode default
+    // Configure bus and control pins for the selected transport
+    esp_err_t ret = st7789_transport_init();
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Transport initialization failed: %s", esp_err_to_name(ret));
+        return ret;
+    }
     
-    ESP_LOGI(TAG, "GPIO pins configured for bit-banging SPI");
     ESP_LOGI(TAG, "Pin configuration: RST=%d, DC=%d, SDA=%d, SCK=%d",
              ST7789_RST_PIN, ST7789_DC_PIN, ST7789_SDA_PIN, ST7789_SCK_PIN);
     
-    // Perform hardware reset sequence for reliable initialization
-    ESP_LOGI(TAG, "Performing hardware reset sequence...");
-    digitalWrite(ST7789_RST_PIN, 0);  // Assert reset
-    delay_ms(10);                     // Hold reset for 10ms
-    digitalWrite(ST7789_RST_PIN, 1);  // Release reset
-    delay_ms(120);                    // Wait for display stabilization (matching working code)
-    ESP_LOGI(TAG, "Hardware reset sequence completed");
-    
-    // Send ST7789 initialization command sequence (matching working C++ code)
-    ESP_LOGI(TAG, "Sending display initialization commands...");
-    
-    write_command(ST7789_SWRESET);  // Software reset
-    delay_ms(150);                  // Wait for reset completion
-    
-    write_command(ST7789_SLPOUT);   // Exit sleep mode
-    delay_ms(255);                  // Wait for sleep exit - this is the longest delay
-    
-    write_command(ST7789_COLMOD);   // Set color format
-    write_data(0x55);               // 16-bit RGB565 color mode
-    delay_ms(10);                   // Additional delay for stability
-    
-    write_command(ST7789_MADCTL);   // Memory access control
-    write_data(0x00);               // Normal scan direction, RGB order
-    
-    write_command(ST7789_INVON);    // Enable display inversion
-    delay_ms(10);                   // Additional delay for stability
+    st7789_window_cache_invalidate();  // Reset restores the default window
+    st7789_transport_set_reset(0);
+    esp_rom_delay_us(INIT_RESET_PULSE_US);
+    st7789_transport_set_reset(1);
     
-    write_command(ST7789_NORON);    // Normal display mode
-    delay_ms(10);                   // Additional delay for stability
-    
-    write_command(ST7789_DISPON);   // Turn display on
-    delay_ms(100);                  // Allow display to stabilize
-    
-    // Clear display memory to prevent showing previous content
-    ESP_LOGI(TAG, "Clearing display memory...");
-    fill_rect(0, 0, 240, 240, BLACK);
-    delay_ms(50);                   // Allow clear operation to complete
-    
-    ESP_LOGI(TAG, "ST7789 display initialization completed successfully!");
-    ESP_LOGI(TAG, "===========================================");
+    if (!init_config.background) {
+        init_sequence();
+        return ESP_OK;
+    }
     
+    if (init_events == NULL) {
+        init_events = xEventGroupCreate();
+        if (init_events == NULL) {
+            return ESP_ERR_NO_MEM;
+        }
+    }
+    xEventGroupClearBits(init_events, INIT_DONE_BIT);
+    atomic_store(&init_running, true);
+    if (xTaskCreatePinnedToCore(init_task_main, "st7789_init", 3072, NULL, 5,
+                                NULL, tskNO_AFFINITY) != pdPASS) {
+        atomic_store(&init_running, false);
+        xEventGroupSetBits(init_events, INIT_DONE_BIT);
+        return ESP_ERR_NO_MEM;
+    }
     return ESP_OK;
 }
 
+esp_err_t st7789_init_wait(uint32_t timeout_ms) {
+    if (init_events == NULL) {
+        return ESP_OK;
+    }
+    TickType_t ticks = timeout_ms == UINT32_MAX ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+    EventBits_t bits = xEventGroupWaitBits(init_events, INIT_DONE_BIT, pdFALSE, pdFALSE, ticks);
+    return (bits & INIT_DONE_BIT) ? ESP_OK : ESP_ERR_TIMEOUT;
+}
+
+uint32_t st7789_init_get_time_us(void) {
+    return atomic_load(&init_time_us);
+}
+
 /**
  * @brief Run comprehensive display functionality test
  * 
@@ -867,8 +1394,8 @@ void st7789_test(void) {
  * Test sequence:
  * 1. Initial sensor reading display (TEMP, HUMIDITY, DISTANCE)
  * 2. Updated values to show dynamic content capability
- * 3. Validates all supported large font characters including numbers,
- *    symbols (., %, :), and uppercase letters
+ * 3. Validates the large font characters: numbers, symbols (., %, :),
+ *    uppercase and lowercase letters
  */
 void st7789_large_font_test(void) {
     ESP_LOGI(TAG, "Starting large font test...");
@@ -910,4 +1437,63 @@ void st7789_large_font_test(void) {
     delay_ms(3000);
     
     ESP_LOGI(TAG, "Large font test completed successfully!");
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Compare block blits against per-pixel drawing
+ * 
+ * For each block size the same gradient is drawn twice: once pixel by pixel
+ * through draw_pixel() (a full CASET/RASET/RAMWR preamble per pixel) and once
+ * with a single st7789_blit(). Bus bytes are measured at the transport, so
+ * they follow the color depth and the window cache.
+ * 
+ * Block sizes: 16x16, 64x64, 240x240. The full-screen case is skipped with a
+ * warning if its 115 KB source buffer cannot be allocated.
+ */
+void st7789_blit_benchmark(void) {
+    static const uint16_t sizes[] = { 16, 64, 240 };
+    
+    ESP_LOGI(TAG, "Starting blit benchmark...");
+    st7789_async_sync();  // Timings below talk to the bus directly
+    
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        uint16_t n = sizes[i];
+        uint32_t count = (uint32_t)n * n;
+        uint16_t *pixels = malloc(count * sizeof(uint16_t));
+        if (pixels == NULL) {
+            ESP_LOGW(TAG, "Blit benchmark %ux%u skipped: out of memory", n, n);
+            continue;
+        }
+        for (uint16_t row = 0; row < n; row++) {
+            for (uint16_t col = 0; col < n; col++) {
+                pixels[row * n + col] = ((col * 31 / n) << 11) | ((row * 63 / n) << 5) | 0x0F;
+            }
+        }
+        
+        st7789_bus_fill_rect(0, 0, 240, 240, BLACK);
+        uint64_t bytes = st7789_bus_bytes;
+        int64_t start = esp_timer_get_time();
+        for (uint16_t row = 0; row < n; row++) {
+            for (uint16_t col = 0; col < n; col++) {
+                draw_pixel(col, row, pixels[row * n + col]);
+            }
+        }
+        int64_t pixel_us = esp_timer_get_time() - start;
+        uint64_t pixel_bytes = st7789_bus_bytes - bytes;
+        
+        st7789_bus_fill_rect(0, 0, 240, 240, BLACK);
+        bytes = st7789_bus_bytes;
+        start = esp_timer_get_time();
+        st7789_bus_blit(0, 0, n, n, pixels, n, ST7789_PIXELS_HOST);
+        int64_t blit_us = esp_timer_get_time() - start;
+        uint64_t blit_bytes = st7789_bus_bytes - bytes;
+        
+        free(pixels);
+        
+        ESP_LOGI(TAG, "%ux%u: draw_pixel %lld us, %llu bytes | blit %lld us, %llu bytes",
+                 n, n, (long long)pixel_us, (unsigned long long)pixel_bytes,
+                 (long long)blit_us, (unsigned long long)blit_bytes);
+    }
+    
+    ESP_LOGI(TAG, "Blit benchmark completed");
+}
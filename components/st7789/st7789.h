@@ -1,7 +1,11 @@
 #ifndef ST7789_H
 #define ST7789_H
 
+#include "sdkconfig.h"
 #include "esp_err.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 
 /**
  * @file st7789.h
@@ -15,7 +19,424 @@
 #define ST7789_SCK_PIN  18  // SPI clock pin
 #define ST7789_SDA_PIN  23  // SPI data pin (MOSI)
 #define ST7789_RST_PIN  4   // Hardware reset pin (active low)
-#define ST7789_DC_PIN   2   // Data/Command select pin 
+#define ST7789_DC_PIN   2   // Data/Command select pin
+
+// Bus transport backends (see st7789_transport.h)
+#define ST7789_TRANSPORT_SPI      0  // ESP-IDF spi_master with DMA
+#define ST7789_TRANSPORT_BITBANG  1  // Software SPI on plain GPIOs
+#define ST7789_TRANSPORT_MOCK     2  // Host-side capture, no hardware
+
+// Build-time transport selection; override with a compile definition
+#ifndef ST7789_TRANSPORT
+#if CONFIG_IDF_TARGET_LINUX
+#define ST7789_TRANSPORT ST7789_TRANSPORT_MOCK
+#else
+#define ST7789_TRANSPORT ST7789_TRANSPORT_SPI
+#endif
+#endif
+
+// SPI transport settings (ST7789_TRANSPORT_SPI only)
+#ifndef ST7789_SPI_HOST
+#define ST7789_SPI_HOST          SPI3_HOST  // VSPI: GPIO 18/23 are its IOMUX pins
+#endif
+#ifndef ST7789_SPI_CLOCK_HZ
+#define ST7789_SPI_CLOCK_HZ      40000000   // Panel write cycle is 16 ns minimum
+#endif
+#ifndef ST7789_SPI_QUEUE_SIZE
+#define ST7789_SPI_QUEUE_SIZE    3          // Transactions in flight per write
+#endif
+#ifndef ST7789_SPI_MAX_TRANSFER
+#define ST7789_SPI_MAX_TRANSFER  16384      // Largest single DMA transaction (bytes)
+#endif
+#ifndef ST7789_SPI_BOUNCE_SIZE
+#define ST7789_SPI_BOUNCE_SIZE   2048       // Per-slot copy buffer for non-DMA sources
+#endif
+
+// Solid fill run buffer in pixels (2 bytes each); a 240x240 clear is
+// ceil(57600 / ST7789_FILL_BUF_PIXELS) bulk transfers. Must be even.
+#ifndef ST7789_FILL_BUF_PIXELS
+#define ST7789_FILL_BUF_PIXELS   4096
+#endif
+
+// Staging buffer for host-endian blits, in pixels. Must be even.
+#ifndef ST7789_BLIT_BUF_PIXELS
+#define ST7789_BLIT_BUF_PIXELS   1024
+#endif
+
+// Skip CASET/RASET when the panel already holds the requested column/row range
+#ifndef ST7789_WINDOW_CACHE
+#define ST7789_WINDOW_CACHE      1
+#endif
+
+// Framebuffer settings (see st7789_fb_enable())
+#ifndef ST7789_FB_BAND_ROWS
+#define ST7789_FB_BAND_ROWS      40   // Default band height: 240x40 = 19,200 bytes
+#endif
+#ifndef ST7789_FB_MAX_DIRTY
+#define ST7789_FB_MAX_DIRTY      8    // Dirty rectangles kept before forced merging
+#endif
+#ifndef ST7789_FB_MERGE_SLACK
+#define ST7789_FB_MERGE_SLACK    64   // Extra pixels a merge may resend to save a window
+#endif
+
+// Driver counters and per-operation timing (see st7789_get_stats()); 0 compiles them out
+#ifndef ST7789_STATS
+#define ST7789_STATS             1
+#endif
+
+// Binary bus trace (see st7789_trace_dump()); 0 compiles it out entirely
+#ifndef ST7789_TRACE
+#define ST7789_TRACE             0
+#endif
+#ifndef ST7789_TRACE_ENTRIES
+#define ST7789_TRACE_ENTRIES     1024  // Ring size, 16 bytes per entry
+#endif
+#ifndef ST7789_TRACE_MIN_RUN
+#define ST7789_TRACE_MIN_RUN     4     // Shortest pixel run stored as a RUN entry
+#endif
+#ifndef ST7789_TRACE_MAX_SPLIT
+#define ST7789_TRACE_MAX_SPLIT   16    // Most entries one data block is split into
+#endif
+
+// Ping-pong band renderer (see st7789_band_render()): two buffers of this many
+// full-width rows, 480 bytes per row each
+#ifndef ST7789_BAND_ROWS
+#define ST7789_BAND_ROWS         16
+#endif
+#define ST7789_BAND_MAX_BANDS    ((240 + ST7789_BAND_ROWS - 1) / ST7789_BAND_ROWS)
+
+// Async render task defaults (see st7789_async_start())
+#ifndef ST7789_ASYNC_QUEUE_BYTES
+#define ST7789_ASYNC_QUEUE_BYTES 2048  // Command ring size, power of two
+#endif
+#ifndef ST7789_ASYNC_CORE
+#if CONFIG_FREERTOS_UNICORE
+#define ST7789_ASYNC_CORE        0
+#else
+#define ST7789_ASYNC_CORE        1     // app_main runs on core 0
+#endif
+#endif
+#ifndef ST7789_ASYNC_PRIORITY
+#define ST7789_ASYNC_PRIORITY    5
+#endif
+#ifndef ST7789_ASYNC_STACK_SIZE
+#define ST7789_ASYNC_STACK_SIZE  4096
+#endif
+
+/**
+ * @brief Byte order of RGB565 pixel buffers passed to the blit functions
+ */
+typedef enum {
+    ST7789_PIXELS_HOST = 0,  // Native uint16_t values, converted before sending
+    ST7789_PIXELS_BE,        // Already in panel (big-endian) byte order, sent as-is
+} st7789_pixel_order_t;
+
+/**
+ * @brief Built-in fonts
+ */
+typedef enum {
+    ST7789_FONT_8X8 = 0,  // Full printable ASCII, 9 px pitch
+    ST7789_FONT_16X16,    // Full printable ASCII, 18 px pitch
+} st7789_font_t;
+
+// Glyph cache pool: expanded RGB565 glyph images, LRU per font.
+// 8x8 slots are 128 bytes, 16x16 slots 512 bytes; 0 slots disables a pool.
+#ifndef ST7789_GLYPH_CACHE_SMALL_SLOTS
+#define ST7789_GLYPH_CACHE_SMALL_SLOTS 32   // 4 KB
+#endif
+#ifndef ST7789_GLYPH_CACHE_LARGE_SLOTS
+#define ST7789_GLYPH_CACHE_LARGE_SLOTS 16   // 8 KB
+#endif
+
+/**
+ * @brief Glyph cache counters
+ */
+typedef struct {
+    uint32_t hits;        // Glyphs drawn from the cache
+    uint32_t misses;      // Glyphs expanded from the font bitmap
+    uint32_t evictions;   // Misses that replaced a cached glyph
+    uint32_t pool_bytes;  // Static pool size, both fonts
+} st7789_glyph_cache_stats_t;
+
+// Longest text a retained text field can show
+#ifndef ST7789_TEXT_FIELD_MAX_LEN
+#define ST7789_TEXT_FIELD_MAX_LEN 24
+#endif
+
+/**
+ * @brief Retained single-line text field (see st7789_text_field_init())
+ * 
+ * Caller-owned; remembers what is on screen so updates only redraw the
+ * character cells that changed.
+ */
+typedef struct {
+    uint16_t x, y;            // Top-left of the first character cell
+    st7789_font_t font;
+    uint16_t color;
+    uint16_t bg_color;
+    uint8_t len;              // Characters currently shown
+    bool valid;               // false forces a full redraw on the next update
+    char text[ST7789_TEXT_FIELD_MAX_LEN + 1];
+} st7789_text_field_t;
+
+// Longest value a big-digit readout can show
+#ifndef ST7789_DIGITS_MAX_LEN
+#define ST7789_DIGITS_MAX_LEN 8
+#endif
+
+/**
+ * @brief Retained seven-segment readout (see st7789_digits_init())
+ * 
+ * Caller-owned; remembers which segments are lit so updates only fill the
+ * segments that changed.
+ */
+typedef struct {
+    uint16_t x, y;            // Top-left of the first cell
+    uint16_t height;          // Cell height in pixels
+    uint16_t stroke;          // Segment thickness in pixels
+    uint16_t color;
+    uint16_t bg_color;
+    uint16_t width;           // Pixels covered by the cells shown
+    uint8_t len;              // Cells currently shown
+    bool valid;               // false forces a full redraw on the next update
+    uint8_t kind[ST7789_DIGITS_MAX_LEN];       // Cell shape per position
+    uint8_t segments[ST7789_DIGITS_MAX_LEN];   // Lit segments per position
+    uint16_t cell_x[ST7789_DIGITS_MAX_LEN];    // Left edge per position
+} st7789_digits_t;
+
+// Most vertices st7789_fill_polygon() accepts (sets its stack use)
+#ifndef ST7789_POLYGON_MAX_VERTICES
+#define ST7789_POLYGON_MAX_VERTICES 32
+#endif
+
+/**
+ * @brief A pixel position, e.g. a polygon vertex
+ */
+typedef struct {
+    uint16_t x, y;
+} st7789_point_t;
+
+/**
+ * @brief A pixel position with its own color, for st7789_draw_pixels()
+ */
+typedef struct {
+    uint16_t x, y;
+    uint16_t color;           // 16-bit RGB565
+} st7789_pixel_t;
+
+// Points sorted at a time by st7789_draw_pixels(); 6 bytes each of static RAM.
+// Runs only merge and rows only share a RASET within a batch.
+#ifndef ST7789_PIXEL_BATCH
+#define ST7789_PIXEL_BATCH 1024
+#endif
+
+/**
+ * @brief Framebuffer modes for st7789_fb_enable()
+ */
+typedef enum {
+    ST7789_FB_NONE = 0,  // Immediate mode: every draw goes straight to the panel
+    ST7789_FB_FULL,      // Whole 240x240 panel in RAM (115,200 bytes)
+    ST7789_FB_BAND,      // A band of full-width rows that follows the drawing
+    ST7789_FB_INDEXED8,  // Whole panel as 8-bit palette indices (57,600 bytes)
+    ST7789_FB_INDEXED4,  // Whole panel as 4-bit palette indices (28,800 bytes)
+} st7789_fb_mode_t;
+
+#define ST7789_FB_PALETTE_SIZE  256   // Entries; ST7789_FB_INDEXED4 uses the first 16
+
+/**
+ * @brief Framebuffer flush counters
+ */
+typedef struct {
+    uint32_t flushes;            // Flushes performed, explicit and automatic
+    uint32_t last_flush_rects;   // Dirty rectangles sent by the last flush
+    uint32_t last_flush_bytes;   // Bus bytes sent by the last flush
+    uint64_t total_flush_bytes;  // Bus bytes sent by all flushes
+    uint32_t band_moves;         // Band mode: times the band was repositioned
+    uint32_t passthrough_draws;  // Band mode: draws taller than the band, sent directly
+} st7789_fb_stats_t;
+
+/**
+ * @brief Address window counters
+ */
+typedef struct {
+    uint32_t windows;        // Address windows opened (one RAMWR each)
+    uint32_t caset_sent;     // Column ranges sent
+    uint32_t caset_skipped;  // Column ranges already set on the panel
+    uint32_t raset_sent;     // Row ranges sent
+    uint32_t raset_skipped;  // Row ranges already set on the panel
+} st7789_window_stats_t;
+
+/**
+ * @brief Operations timed by the driver counters
+ */
+typedef enum {
+    ST7789_OP_INIT = 0,
+    ST7789_OP_FILL_RECT,        // st7789_fill_rect(), st7789_clear_screen()
+    ST7789_OP_DRAW_PIXEL,
+    ST7789_OP_DRAW_PIXELS,      // st7789_draw_pixels(), st7789_draw_points()
+    ST7789_OP_DRAW_CHAR,
+    ST7789_OP_DRAW_LARGE_CHAR,
+    ST7789_OP_DRAW_STRING,
+    ST7789_OP_DRAW_LARGE_STRING,
+    ST7789_OP_DRAW_STRING_SCALED,
+    ST7789_OP_BLIT,             // All st7789_blit*() variants
+    ST7789_OP_DRAW_IMAGE,
+    ST7789_OP_FLUSH,
+    ST7789_OP_COUNT,
+} st7789_op_t;
+
+/**
+ * @brief Call count and esp_timer time spent in one operation
+ */
+typedef struct {
+    uint32_t calls;
+    uint32_t max_us;
+    uint64_t total_us;
+} st7789_op_stats_t;
+
+/**
+ * @brief Driver counters
+ * 
+ * Operations are timed at the public call, so nested work (a string's
+ * glyphs, a text field's cells) is counted under the outer call. In async
+ * mode the time is spent on the render task, not in the caller.
+ */
+typedef struct {
+    st7789_op_stats_t ops[ST7789_OP_COUNT];
+    uint64_t bytes_sent;       // Command and data bytes handed to the transport
+    uint32_t commands_sent;    // Command bytes (DC low)
+    uint32_t data_writes;      // Data blocks (DC high)
+    uint32_t dc_transitions;   // Switches between command and data mode
+    uint32_t yields;           // taskYIELD() calls inside long draws
+} st7789_stats_t;
+
+/**
+ * @brief Bus trace entry types
+ */
+typedef enum {
+    ST7789_TRACE_CMD = 1,    // Command byte (DC low) in data[0]
+    ST7789_TRACE_DATA,       // Data block: length bytes, the first inline_len in data[]
+    ST7789_TRACE_RUN,        // length repeats of the 16-bit word data[0], data[1]
+    ST7789_TRACE_RESET,      // Reset pin driven to length (0 or 1)
+} st7789_trace_type_t;
+
+/**
+ * @brief One bus trace record, 16 bytes, little-endian fields
+ */
+typedef struct {
+    uint32_t timestamp_us;   // Low 32 bits of esp_timer_get_time()
+    uint32_t length;         // See st7789_trace_type_t
+    uint8_t type;            // st7789_trace_type_t
+    uint8_t inline_len;      // Valid bytes in data[]
+    uint16_t reserved;
+    uint8_t data[4];         // Wire-order bytes
+} st7789_trace_entry_t;
+
+/**
+ * @brief Band renderer callback: draw the scene for rows [band_y, band_y + band_h)
+ * 
+ * Called once per band with the normal draw functions redirected into the
+ * band buffer. Anything outside the band is clipped away, so the simplest
+ * callback redraws the whole scene every time.
+ */
+typedef void (*st7789_band_draw_cb_t)(uint16_t band_y, uint16_t band_h, void *ctx);
+
+/**
+ * @brief Band renderer timings
+ * 
+ * Per-band arrays describe the last frame. A band's stall is the time the
+ * CPU waited for the previous band to leave the bus; stalls near zero mean
+ * rendering is the bottleneck, large stalls mean the bus is.
+ */
+typedef struct {
+    uint32_t frames;                            // Frames rendered
+    uint32_t last_frame_us;                     // Duration of the last frame
+    uint32_t last_bands;                        // Bands in the last frame
+    uint32_t render_us[ST7789_BAND_MAX_BANDS];  // Clearing and drawing the band
+    uint32_t stall_us[ST7789_BAND_MAX_BANDS];   // Waiting before the band could be queued
+    uint32_t send_us[ST7789_BAND_MAX_BANDS];    // Queued until seen complete (upper bound)
+} st7789_band_stats_t;
+
+/**
+ * @brief Bits per pixel sent over the bus (see st7789_set_color_depth())
+ */
+typedef enum {
+    ST7789_COLOR_16BIT = 0,  // RGB565, 2 bytes per pixel (default)
+    ST7789_COLOR_12BIT,      // RGB444, 3 bytes per 2 pixels
+} st7789_color_depth_t;
+
+/**
+ * @brief Settings for st7789_init_with_config()
+ */
+typedef struct {
+    bool skip_clear;     // Leave GRAM uncleared; the first frame must cover the whole panel
+    bool background;     // Run the sequence on a task and return at once
+} st7789_init_config_t;
+
+#define ST7789_INIT_CONFIG_DEFAULT() {   \
+    .skip_clear = false,                 \
+    .background = false,                 \
+}
+
+/**
+ * @brief Layout and colors for st7789_term_init()
+ */
+typedef struct {
+    uint16_t top_fixed;      // Rows at the top that do not scroll (header)
+    uint16_t bottom_fixed;   // Rows at the bottom that do not scroll (status bar)
+    uint16_t fg_color;       // 16-bit RGB565 text color
+    uint16_t bg_color;       // 16-bit RGB565 background color
+} st7789_term_config_t;
+
+#define ST7789_TERM_CONFIG_DEFAULT() {   \
+    .top_fixed = 0,                      \
+    .bottom_fixed = 0,                   \
+    .fg_color = 0xFFFF,                  \
+    .bg_color = 0x0000,                  \
+}
+
+/**
+ * @brief What a draw call does when the async queue is full
+ */
+typedef enum {
+    ST7789_ASYNC_BLOCK = 0,  // Wait up to block_timeout_ms for space, then drop
+    ST7789_ASYNC_DROP,       // Drop the command at once
+} st7789_async_overflow_t;
+
+/**
+ * @brief Render task settings for st7789_async_start()
+ */
+typedef struct {
+    size_t queue_bytes;                // Command ring size, power of two (0 = default)
+    int core;                          // Core the render task is pinned to
+    unsigned priority;                 // Render task priority
+    uint32_t stack_size;               // Render task stack in bytes
+    st7789_async_overflow_t overflow;  // Back-pressure policy
+    uint32_t block_timeout_ms;         // Longest wait for space with ST7789_ASYNC_BLOCK
+} st7789_async_config_t;
+
+#define ST7789_ASYNC_CONFIG_DEFAULT() {         \
+    .queue_bytes = ST7789_ASYNC_QUEUE_BYTES,    \
+    .core = ST7789_ASYNC_CORE,                  \
+    .priority = ST7789_ASYNC_PRIORITY,          \
+    .stack_size = ST7789_ASYNC_STACK_SIZE,      \
+    .overflow = ST7789_ASYNC_BLOCK,             \
+    .block_timeout_ms = 100,                    \
+}
+
+/**
+ * @brief Async queue counters
+ */
+typedef struct {
+    uint32_t submitted;        // Commands queued
+    uint32_t executed;         // Commands run by the render task
+    uint32_t dropped;          // Commands lost to a full queue
+    uint32_t producer_waits;   // Draw calls that had to wait for space
+    uint32_t max_depth_bytes;  // Deepest queue seen by the render task
+    uint32_t queue_bytes;      // Ring size
+    uint32_t max_latency_us;   // Longest submit-to-execute delay
+    uint32_t avg_latency_us;   // Mean submit-to-execute delay
+} st7789_async_stats_t;
 
 /**
  * @brief Initialize the ST7789 display driver
@@ -27,6 +448,56 @@
  */
 esp_err_t st7789_init(void);
 
+/**
+ * @brief Initialize the display with explicit settings
+ * 
+ * Runs the same init table as st7789_init(). With config->background the
+ * transport is brought up and the reset asserted before returning; the
+ * rest of the sequence, including its datasheet waits, runs on a task so
+ * the caller can continue booting. Nothing may be drawn until
+ * st7789_init_wait() returns ESP_OK.
+ * 
+ * @param config Settings, NULL for ST7789_INIT_CONFIG_DEFAULT()
+ * @return ESP_OK, ESP_ERR_INVALID_STATE if a background init is still
+ *         running, ESP_ERR_NO_MEM, or a transport error
+ */
+esp_err_t st7789_init_with_config(const st7789_init_config_t *config);
+
+/**
+ * @brief Wait for a background init to finish
+ * 
+ * Returns ESP_OK at once when no background init is running.
+ * 
+ * @param timeout_ms Maximum wait, UINT32_MAX for no limit
+ * @return ESP_OK, or ESP_ERR_TIMEOUT
+ */
+esp_err_t st7789_init_wait(uint32_t timeout_ms);
+
+/**
+ * @brief Time the last init took, from the call to the display being on
+ * 
+ * @return Microseconds, or 0 while an init is in progress or before the first
+ */
+uint32_t st7789_init_get_time_us(void);
+
+/**
+ * @brief Select 16-bit or 12-bit pixel transfers
+ * 
+ * Colors stay RGB565 in the API. In 12-bit mode (COLMOD 0x53) fills, glyphs,
+ * strings, blits, framebuffer flushes and band renders are packed to RGB444
+ * on the way out, cutting pixel bytes by 25% at the cost of the low color
+ * bits. st7789_init() resets to 16-bit.
+ * 
+ * @param depth ST7789_COLOR_16BIT or ST7789_COLOR_12BIT
+ * @return ESP_OK, ESP_ERR_INVALID_ARG, or ESP_ERR_INVALID_STATE during a band render
+ */
+esp_err_t st7789_set_color_depth(st7789_color_depth_t depth);
+
+/**
+ * @brief Current bus color depth
+ */
+st7789_color_depth_t st7789_get_color_depth(void);
+
 /**
  * @brief Draw a single pixel at specified coordinates
  * 
@@ -36,6 +507,30 @@ esp_err_t st7789_init(void);
  */
 void st7789_draw_pixel(uint16_t x, uint16_t y, uint16_t color);
 
+/**
+ * @brief Draw many scattered pixels, merging neighbours into shared windows
+ * 
+ * Points are sorted by row and column in batches of ST7789_PIXEL_BATCH.
+ * Horizontally adjacent points go out as one run under one address window,
+ * and runs on the same row reuse the panel's row range, so a scatter plot
+ * sends far fewer command bytes than one st7789_draw_pixel() per point.
+ * The result is the same as drawing the points one by one in order:
+ * off-panel points are skipped and a repeated point keeps its last color.
+ * 
+ * @param pixels Positions and colors, in any order
+ * @param count Number of entries
+ */
+void st7789_draw_pixels(const st7789_pixel_t *pixels, size_t count);
+
+/**
+ * @brief Draw many scattered pixels in one color, see st7789_draw_pixels()
+ * 
+ * @param points Positions, in any order
+ * @param count Number of points
+ * @param color 16-bit RGB565 color value
+ */
+void st7789_draw_points(const st7789_point_t *points, size_t count, uint16_t color);
+
 /**
  * @brief Fill a rectangular area with specified color
  * 
@@ -47,6 +542,105 @@ void st7789_draw_pixel(uint16_t x, uint16_t y, uint16_t color);
  */
 void st7789_fill_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
 
+/**
+ * @brief Draw a block of host-endian RGB565 pixels
+ * 
+ * Sets the address window once and streams the buffer, converting it to
+ * panel byte order in bulk. Clipped at the right and bottom edges.
+ * 
+ * @param x X coordinate of top-left corner
+ * @param y Y coordinate of top-left corner
+ * @param w Width of the block in pixels
+ * @param h Height of the block in pixels
+ * @param pixels w*h pixels, row-major
+ */
+void st7789_blit(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint16_t *pixels);
+
+/**
+ * @brief Draw a block of pre-swapped (big-endian) RGB565 pixels without conversion
+ * 
+ * @param x X coordinate of top-left corner
+ * @param y Y coordinate of top-left corner
+ * @param w Width of the block in pixels
+ * @param h Height of the block in pixels
+ * @param pixels w*h pixels, row-major, in panel byte order
+ */
+void st7789_blit_be(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint16_t *pixels);
+
+/**
+ * @brief Draw a block of pixels whose rows are stride pixels apart
+ * 
+ * @param x X coordinate of top-left corner
+ * @param y Y coordinate of top-left corner
+ * @param w Width of the block in pixels
+ * @param h Height of the block in pixels
+ * @param pixels First pixel of the block
+ * @param stride Distance between the starts of consecutive rows, in pixels
+ * @param order Byte order of the source pixels
+ */
+void st7789_blit_stride(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                        const uint16_t *pixels, size_t stride, st7789_pixel_order_t order);
+
+/**
+ * @brief Draw a sub-rectangle of a larger image
+ * 
+ * @param x X coordinate on the display
+ * @param y Y coordinate on the display
+ * @param image First pixel of the source image
+ * @param image_stride Width of the source image rows, in pixels
+ * @param src_x X offset of the sub-rectangle in the image
+ * @param src_y Y offset of the sub-rectangle in the image
+ * @param w Width of the sub-rectangle in pixels
+ * @param h Height of the sub-rectangle in pixels
+ * @param order Byte order of the source pixels
+ */
+void st7789_blit_sub(uint16_t x, uint16_t y, const uint16_t *image, size_t image_stride,
+                     uint16_t src_x, uint16_t src_y, uint16_t w, uint16_t h,
+                     st7789_pixel_order_t order);
+
+/**
+ * @brief Convert host-endian RGB565 pixels to panel byte order in place
+ * 
+ * @param pixels Pixels to convert
+ * @param count Number of pixels
+ */
+void st7789_swap_pixels(uint16_t *pixels, size_t count);
+
+// S7Q image header: "S7Q1", then width and height as little-endian uint16
+#define ST7789_IMAGE_HEADER_SIZE 8
+
+/**
+ * @brief Draw an S7Q compressed image (see tools/st7789_img_encode.py)
+ * 
+ * S7Q is a QOI-style RGB565 format: runs, a 64-entry color index, small
+ * deltas and literals. It decodes through a one-row buffer straight into
+ * a single address window, so no framebuffer is needed, and long runs of
+ * one color go out through the solid-fill path. Clipped at the right and
+ * bottom edges. In async mode the data is read when the command runs, so
+ * it must stay valid until then (images in flash always do).
+ * 
+ * @param x X coordinate of top-left corner
+ * @param y Y coordinate of top-left corner
+ * @param data Image file contents
+ * @param size Length of data in bytes
+ * @return ESP_OK, ESP_ERR_INVALID_ARG if data is not an S7Q image, or
+ *         ESP_ERR_INVALID_SIZE if the data is truncated or corrupt (rows
+ *         before the fault are still drawn)
+ */
+esp_err_t st7789_draw_image(uint16_t x, uint16_t y, const uint8_t *data, size_t size);
+
+/**
+ * @brief Read the width and height of an S7Q image
+ * 
+ * @param data Image file contents
+ * @param size Length of data in bytes
+ * @param width Receives the width in pixels (may be NULL)
+ * @param height Receives the height in pixels (may be NULL)
+ * @return ESP_OK, or ESP_ERR_INVALID_ARG if data is not an S7Q image
+ */
+esp_err_t st7789_image_get_size(const uint8_t *data, size_t size, uint16_t *width,
+                                uint16_t *height);
+
 /**
  * @brief Draw a single character at specified position
  * 
@@ -63,6 +657,8 @@ void st7789_draw_char(uint16_t x, uint16_t y, char c, uint16_t color, uint16_t b
  * 
  * Supports newline (\n) and carriage return (\r) characters.
  * Automatically wraps text to next line if it exceeds display width.
+ * Each line goes out under one address window, with the gaps between
+ * characters painted in the background color.
  * 
  * @param x X coordinate for text start position
  * @param y Y coordinate for text start position
@@ -82,12 +678,12 @@ void st7789_clear_screen(uint16_t color);
 /**
  * @brief Draw a single large character (16x16) at specified position
  * 
- * Supports numbers (0-9), period (.), percent (%), colon (:), and selected uppercase letters (A,C,D,E,H,I,M,N,P,R,S,T,U,Y).
+ * Covers all printable ASCII (32-126); other characters draw nothing.
  * Perfect for displaying sensor readings and labels.
  * 
  * @param x X coordinate for character placement
  * @param y Y coordinate for character placement  
- * @param c Character to draw (supported characters only)
+ * @param c Character to draw
  * @param color 16-bit RGB565 foreground color
  * @param bg_color 16-bit RGB565 background color
  */
@@ -98,16 +694,513 @@ void st7789_draw_large_char(uint16_t x, uint16_t y, char c, uint16_t color, uint
  * 
  * Supports newline (\n) and carriage return (\r) characters.
  * Automatically wraps text to next line if it exceeds display width.
- * Character set includes numbers, period, percent, colon, and selected uppercase letters.
+ * Lines are sent like st7789_draw_string(); characters outside printable
+ * ASCII split the line and leave their cell untouched.
  * 
  * @param x X coordinate for text start position
  * @param y Y coordinate for text start position
- * @param str Null-terminated string to draw (supported characters only)
+ * @param str Null-terminated string to draw
  * @param color 16-bit RGB565 foreground color
  * @param bg_color 16-bit RGB565 background color
  */
 void st7789_draw_large_string(uint16_t x, uint16_t y, const char* str, uint16_t color, uint16_t bg_color);
 
+/**
+ * @brief Draw a text string with the 8x8 font at an integer scale
+ * 
+ * Glyphs, character spacing and line pitch are all multiplied by scale;
+ * scale 2 matches the 16x16 cell and pitch of st7789_draw_large_string().
+ * Lines are sent like st7789_draw_string(), one window per line.
+ * 
+ * @param x X coordinate for text start position
+ * @param y Y coordinate for text start position
+ * @param str Null-terminated string to draw
+ * @param scale Magnification (1-30); 0 draws nothing
+ * @param color 16-bit RGB565 foreground color
+ * @param bg_color 16-bit RGB565 background color
+ */
+void st7789_draw_string_scaled(uint16_t x, uint16_t y, const char *str, uint8_t scale,
+                               uint16_t color, uint16_t bg_color);
+
+/**
+ * @brief Register a single-line text field at a fixed position
+ * 
+ * @param field Caller-owned field state
+ * @param x X coordinate of the first character cell
+ * @param y Y coordinate of the first character cell
+ * @param font Font used for every cell
+ * @param color 16-bit RGB565 foreground color
+ * @param bg_color 16-bit RGB565 background color
+ */
+void st7789_text_field_init(st7789_text_field_t *field, uint16_t x, uint16_t y,
+                            st7789_font_t font, uint16_t color, uint16_t bg_color);
+
+/**
+ * @brief Show new text, redrawing only the character cells that changed
+ * 
+ * Updating "22.5C" to "22.1C" sends one glyph instead of five. Cells left
+ * over from a longer previous value are cleared to the background color.
+ * 
+ * @param field Field registered with st7789_text_field_init()
+ * @param text New null-terminated text (single line)
+ * @return Number of character cells sent to the panel
+ */
+int st7789_text_field_update(st7789_text_field_t *field, const char *text);
+
+/**
+ * @brief Change the field colors; the next update redraws every cell
+ */
+void st7789_text_field_set_colors(st7789_text_field_t *field, uint16_t color, uint16_t bg_color);
+
+/**
+ * @brief Force the next update to redraw every cell, e.g. after a screen clear
+ */
+void st7789_text_field_invalidate(st7789_text_field_t *field);
+
+/**
+ * @brief Register a seven-segment readout for large numerals
+ * 
+ * Digits are drawn as solid segments through st7789_fill_rect(), so any
+ * size costs a handful of rectangle fills instead of a scaled bitmap.
+ * Shows 0-9, '-', '.', ':', '%', ' ', '*' (degree sign) and the letters a
+ * seven-segment display can form (A b C c d E F G H h I J L n O o P q r S t
+ * U u y); other characters leave a blank cell.
+ * 
+ * @param digits Caller-owned readout state
+ * @param x X coordinate of the first cell
+ * @param y Y coordinate of the top of the cells
+ * @param height Cell height in pixels (digit cells are height/2 + stroke wide)
+ * @param stroke Segment thickness, clamped to 1..height/5
+ * @param color 16-bit RGB565 segment color
+ * @param bg_color 16-bit RGB565 background color
+ */
+void st7789_digits_init(st7789_digits_t *digits, uint16_t x, uint16_t y, uint16_t height,
+                        uint16_t stroke, uint16_t color, uint16_t bg_color);
+
+/**
+ * @brief Show a new value, filling only the segments that turned on or off
+ * 
+ * Updating "18.4" to "18.5" fills three segment rectangles. Cells that move
+ * or change shape are cleared and redrawn, and cells left over from a
+ * longer previous value are cleared to the background color.
+ * 
+ * @param digits Readout registered with st7789_digits_init()
+ * @param text New value (single line)
+ * @return Number of rectangles filled
+ */
+int st7789_digits_update(st7789_digits_t *digits, const char *text);
+
+/**
+ * @brief Width in pixels that text would occupy in this readout
+ */
+uint16_t st7789_digits_measure(const st7789_digits_t *digits, const char *text);
+
+/**
+ * @brief Change the readout colors; the next update redraws every cell
+ */
+void st7789_digits_set_colors(st7789_digits_t *digits, uint16_t color, uint16_t bg_color);
+
+/**
+ * @brief Force the next update to redraw every cell, e.g. after a screen clear
+ */
+void st7789_digits_invalidate(st7789_digits_t *digits);
+
+/**
+ * @brief Draw a straight line between two points
+ * 
+ * Shapes are clipped to the panel and sent as axis-aligned runs: every
+ * horizontal or vertical run of pixels is one st7789_fill_rect() window,
+ * and only isolated diagonal steps cost a window per pixel.
+ * 
+ * @param x0 Start X coordinate
+ * @param y0 Start Y coordinate
+ * @param x1 End X coordinate
+ * @param y1 End Y coordinate
+ * @param color 16-bit RGB565 color value
+ */
+void st7789_draw_line(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color);
+
+/**
+ * @brief Draw a one-pixel rectangle outline (four fills)
+ */
+void st7789_draw_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
+
+/**
+ * @brief Draw a circle outline
+ * 
+ * @param cx Centre X coordinate
+ * @param cy Centre Y coordinate
+ * @param r Radius in pixels
+ * @param color 16-bit RGB565 color value
+ */
+void st7789_draw_circle(uint16_t cx, uint16_t cy, uint16_t r, uint16_t color);
+
+/**
+ * @brief Draw a filled circle, one fill per distinct row width
+ */
+void st7789_fill_circle(uint16_t cx, uint16_t cy, uint16_t r, uint16_t color);
+
+/**
+ * @brief Draw part of a circle outline
+ * 
+ * @param cx Centre X coordinate
+ * @param cy Centre Y coordinate
+ * @param r Radius in pixels
+ * @param start_deg Start angle in degrees, clockwise from 3 o'clock
+ * @param end_deg End angle; the arc runs clockwise from start_deg, and a
+ *                difference of 360 or more draws the whole circle
+ * @param color 16-bit RGB565 color value
+ */
+void st7789_draw_arc(uint16_t cx, uint16_t cy, uint16_t r, int16_t start_deg, int16_t end_deg,
+                     uint16_t color);
+
+/**
+ * @brief Draw a rounded rectangle outline
+ * 
+ * @param x X coordinate of top-left corner
+ * @param y Y coordinate of top-left corner
+ * @param w Width of rectangle
+ * @param h Height of rectangle
+ * @param r Corner radius, reduced to half the shorter side
+ * @param color 16-bit RGB565 color value
+ */
+void st7789_draw_round_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t r,
+                            uint16_t color);
+
+/**
+ * @brief Draw a filled rounded rectangle
+ */
+void st7789_fill_round_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t r,
+                            uint16_t color);
+
+/**
+ * @brief Draw a triangle outline
+ */
+void st7789_draw_triangle(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
+                          uint16_t x2, uint16_t y2, uint16_t color);
+
+/**
+ * @brief Draw a filled triangle
+ * 
+ * Covers exactly the pixels of st7789_draw_triangle() with the same
+ * vertices and everything between them, so flat and degenerate triangles
+ * still draw their outline. Unlike st7789_fill_polygon(), triangles that
+ * share an edge overlap on it.
+ */
+void st7789_fill_triangle(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
+                          uint16_t x2, uint16_t y2, uint16_t color);
+
+/**
+ * @brief Fill a polygon using the even-odd rule
+ * 
+ * Pixels whose centres lie inside the outline are filled, so polygons that
+ * share an edge tile without overlap; pair with an outline for the full
+ * extent. Each row is one fill per span, and identical consecutive rows
+ * merge into one rectangle.
+ * 
+ * @param points Vertices in order; the last joins the first
+ * @param count Number of vertices (3 to ST7789_POLYGON_MAX_VERTICES)
+ * @param color 16-bit RGB565 color value
+ * @return ESP_OK, or ESP_ERR_INVALID_ARG for NULL or a bad vertex count
+ */
+esp_err_t st7789_fill_polygon(const st7789_point_t *points, size_t count, uint16_t color);
+
+/**
+ * @brief Read the glyph cache counters
+ * 
+ * @param stats Receives a copy of the counters
+ */
+void st7789_glyph_cache_get_stats(st7789_glyph_cache_stats_t *stats);
+
+/**
+ * @brief Zero the glyph cache hit, miss and eviction counters
+ */
+void st7789_glyph_cache_reset_stats(void);
+
+/**
+ * @brief Drop every cached glyph
+ */
+void st7789_glyph_cache_clear(void);
+
+/**
+ * @brief Render draw calls into RAM instead of sending them immediately
+ * 
+ * In ST7789_FB_FULL mode nothing reaches the panel until st7789_flush(),
+ * which sends only the merged dirty rectangles. The buffer starts black and
+ * is sent whole on the first flush. ST7789_FB_BAND keeps a
+ * band of full-width rows for builds without PSRAM; overlapping draws
+ * inside it are combined and it is flushed automatically when drawing
+ * moves elsewhere. ST7789_FB_INDEXED8 and ST7789_FB_INDEXED4 work like
+ * ST7789_FB_FULL in a quarter or an eighth of the RAM: each pixel holds the
+ * index of the nearest palette color, expanded to RGB565 at flush time.
+ * 
+ * @param mode Framebuffer mode
+ * @param band_rows Band height for ST7789_FB_BAND, 0 for ST7789_FB_BAND_ROWS
+ * @return ESP_OK, ESP_ERR_INVALID_ARG or ESP_ERR_NO_MEM
+ */
+esp_err_t st7789_fb_enable(st7789_fb_mode_t mode, uint16_t band_rows);
+
+/**
+ * @brief Flush any pending regions, free the buffer and return to immediate mode
+ */
+void st7789_fb_disable(void);
+
+/**
+ * @brief Set palette entries for the indexed framebuffer modes
+ * 
+ * Indexed pixels keep their indices, so changing an entry recolors every
+ * pixel drawn with it at the next st7789_flush(), which resends the whole
+ * screen. The default palette starts with the ST7789_* colors.
+ * 
+ * @param first First entry to set
+ * @param colors RGB565 colors, or NULL to restore the default palette
+ * @param count Number of entries
+ * @return ESP_OK or ESP_ERR_INVALID_ARG
+ */
+esp_err_t st7789_fb_set_palette(uint16_t first, const uint16_t *colors, uint16_t count);
+
+/**
+ * @brief Send the changed regions of the framebuffer to the panel
+ * 
+ * @return ESP_OK, or ESP_ERR_INVALID_STATE if no framebuffer is enabled
+ */
+esp_err_t st7789_flush(void);
+
+/**
+ * @brief Read the framebuffer flush counters
+ * 
+ * @param stats Receives a copy of the counters
+ */
+void st7789_fb_get_stats(st7789_fb_stats_t *stats);
+
+/**
+ * @brief Zero the framebuffer flush counters
+ */
+void st7789_fb_reset_stats(void);
+
+/**
+ * @brief Forget the column and row range assumed to be set on the panel
+ * 
+ * The next draw sends both CASET and RASET. st7789_init() calls this itself;
+ * call it after anything that resets the controller's window behind the
+ * driver's back, such as a hardware reset, SWRESET or sleep.
+ */
+void st7789_window_cache_invalidate(void);
+
+/**
+ * @brief Read the address window counters
+ * 
+ * @param stats Receives a copy of the counters
+ */
+void st7789_window_get_stats(st7789_window_stats_t *stats);
+
+/**
+ * @brief Zero the address window counters
+ */
+void st7789_window_reset_stats(void);
+
+/**
+ * @brief Render full-width rows through two ping-pong band buffers
+ * 
+ * Rows [y, y + h) are cut into ST7789_BAND_ROWS-high bands. Each band is
+ * cleared to bg_color, drawn by the callback and queued for DMA, and the
+ * next band is drawn into the other buffer while it goes out. The whole
+ * region is a single address window.
+ * 
+ * In async mode the render is queued like any other draw and ctx must stay
+ * valid until it has run.
+ * 
+ * @param y First panel row
+ * @param h Number of rows, clipped to the panel
+ * @param bg_color 16-bit RGB565 color each band starts with
+ * @param draw Scene callback
+ * @param ctx Passed to the callback
+ * @return ESP_OK, ESP_ERR_INVALID_ARG, ESP_ERR_INVALID_STATE while a
+ *         framebuffer is enabled, or ESP_ERR_NO_MEM
+ */
+esp_err_t st7789_band_render(uint16_t y, uint16_t h, uint16_t bg_color,
+                             st7789_band_draw_cb_t draw, void *ctx);
+
+/**
+ * @brief Free the band buffers; the next st7789_band_render() allocates them again
+ */
+void st7789_band_release(void);
+
+/**
+ * @brief Read the band renderer timings
+ * 
+ * @param stats Receives a copy of the timings
+ */
+void st7789_band_get_stats(st7789_band_stats_t *stats);
+
+/**
+ * @brief Hand drawing to a render task pinned to another core
+ * 
+ * Draw calls from other tasks are encoded into a lock-free command ring and
+ * return immediately. Strings are copied; blit pixel buffers are not and
+ * must stay valid until st7789_wait_idle() or a fence covering the blit.
+ * Framebuffer enable/disable and cache resets wait for the queue to drain.
+ * 
+ * @param config Settings, or NULL for ST7789_ASYNC_CONFIG_DEFAULT()
+ * @return ESP_OK, ESP_ERR_INVALID_STATE, ESP_ERR_INVALID_ARG or ESP_ERR_NO_MEM
+ */
+esp_err_t st7789_async_start(const st7789_async_config_t *config);
+
+/**
+ * @brief Drain the queue, stop the render task and draw synchronously again
+ */
+void st7789_async_stop(void);
+
+/**
+ * @brief Get a fence covering every command submitted so far
+ */
+uint32_t st7789_async_fence(void);
+
+/**
+ * @brief Wait until the commands covered by a fence have executed
+ * 
+ * @param fence Value from st7789_async_fence()
+ * @param timeout_ms Maximum wait, UINT32_MAX for no limit
+ * @return ESP_OK, or ESP_ERR_TIMEOUT
+ */
+esp_err_t st7789_async_wait_fence(uint32_t fence, uint32_t timeout_ms);
+
+/**
+ * @brief Wait until everything queued so far has been drawn
+ * 
+ * Returns ESP_OK at once when async mode is not running.
+ * 
+ * @param timeout_ms Maximum wait, UINT32_MAX for no limit
+ * @return ESP_OK, or ESP_ERR_TIMEOUT
+ */
+esp_err_t st7789_wait_idle(uint32_t timeout_ms);
+
+/**
+ * @brief Read the async queue counters
+ * 
+ * @param stats Receives a copy of the counters
+ */
+void st7789_async_get_stats(st7789_async_stats_t *stats);
+
+/**
+ * @brief Zero the async queue counters
+ */
+void st7789_async_reset_stats(void);
+
+/**
+ * @brief Read the driver counters
+ * 
+ * All zero when built with ST7789_STATS = 0.
+ * 
+ * @param stats Receives a copy of the counters
+ */
+void st7789_get_stats(st7789_stats_t *stats);
+
+/**
+ * @brief Zero the driver counters
+ */
+void st7789_reset_stats(void);
+
+/**
+ * @brief Short name of an operation, for logs
+ */
+const char *st7789_op_name(st7789_op_t op);
+
+/**
+ * @brief Log the driver counters once
+ */
+void st7789_stats_dump(void);
+
+/**
+ * @brief Start a low-priority task that logs the counters every period_ms
+ * 
+ * @param period_ms Interval between dumps
+ * @return ESP_OK, ESP_ERR_INVALID_STATE if already running, ESP_ERR_NO_MEM,
+ *         or ESP_ERR_NOT_SUPPORTED when built with ST7789_STATS = 0
+ */
+esp_err_t st7789_stats_start_dump_task(uint32_t period_ms);
+
+/**
+ * @brief Stop the periodic dump task
+ */
+void st7789_stats_stop_dump_task(void);
+
+/**
+ * @brief Pause or resume the bus trace (recording starts enabled)
+ */
+void st7789_trace_enable(bool enable);
+
+/**
+ * @brief Discard all recorded trace entries
+ */
+void st7789_trace_clear(void);
+
+/**
+ * @brief Copy the newest trace entries out, oldest first
+ * 
+ * @param out Destination array
+ * @param max Capacity of out in entries
+ * @return Entries copied; 0 when built with ST7789_TRACE = 0
+ */
+size_t st7789_trace_read(st7789_trace_entry_t *out, size_t max);
+
+/**
+ * @brief Log the trace ring as hex lines
+ * 
+ * Feed the captured log to tools/st7789_trace_decode.py for a readable
+ * command transcript.
+ */
+void st7789_trace_dump(void);
+
+/**
+ * @brief Turn the rows between two fixed areas into a scrolling console
+ * 
+ * Uses the panel's hardware vertical scroll (VSCRDEF/VSCSAD): a new line
+ * costs one 240x8 fill and a scroll-offset command instead of a redraw.
+ * The scroll area holds 8x8-font lines of 30 cells.
+ * 
+ * @param config Fixed areas and colors, NULL for ST7789_TERM_CONFIG_DEFAULT()
+ * @return ESP_OK, ESP_ERR_INVALID_ARG if the scroll area is not a positive
+ *         multiple of 8 rows, or ESP_ERR_INVALID_STATE while a framebuffer
+ *         is enabled
+ */
+esp_err_t st7789_term_init(const st7789_term_config_t *config);
+
+/**
+ * @brief Leave terminal mode and reset the scroll registers
+ */
+void st7789_term_deinit(void);
+
+/**
+ * @brief Write one character; handles \n, \r, \t, \b and \f
+ */
+void st7789_term_putc(char c);
+
+/**
+ * @brief Write a string
+ */
+void st7789_term_puts(const char *str);
+
+/**
+ * @brief Formatted output to the terminal
+ */
+int st7789_term_printf(const char *fmt, ...) __attribute__((format(printf, 1, 2)));
+
+/**
+ * @brief Move to the next line, scrolling when on the last one
+ */
+void st7789_term_newline(void);
+
+/**
+ * @brief Blank the scroll area and home the cursor
+ */
+void st7789_term_clear(void);
+
+/**
+ * @brief Colors for text written from now on
+ */
+void st7789_term_set_colors(uint16_t fg_color, uint16_t bg_color);
+
 /**
  * @brief Run display functionality test
  * 
@@ -124,6 +1217,15 @@ void st7789_test(void);
  */
 void st7789_large_font_test(void);
 
+/**
+ * @brief Compare block blits against per-pixel drawing
+ * 
+ * Draws 16x16, 64x64 and full-screen gradient blocks first with
+ * st7789_draw_pixel() and then with st7789_blit(), logging elapsed time and
+ * bytes on the bus for each.
+ */
+void st7789_blit_benchmark(void);
+
 // Common RGB565 color definitions for convenience
 #define ST7789_BLACK   0x0000  // Black
 #define ST7789_WHITE   0xFFFF  // White  
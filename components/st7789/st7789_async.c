@@ -0,0 +1,699 @@
+#include "st7789.h"
+#include "st7789_priv.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/event_groups.h"
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "ST7789_ASYNC";
+
+/**
+ * Commands are variable-length records in a byte ring. Any number of
+ * producers reserve space by advancing ring_head with a compare-and-swap,
+ * fill in the payload and then publish the record by storing its header
+ * word. The render task is the only consumer: it waits for the header at
+ * ring_tail, executes the command, zeroes the record and advances the tail.
+ * A record never wraps; a producer that would cross the end of the ring
+ * first claims the remainder as a padding record.
+ */
+
+// Header word: record size in bytes (bits 0-23) and opcode (bits 24-31)
+#define REC_SIZE(hdr)   ((hdr) & 0x00FFFFFF)
+#define REC_OP(hdr)     ((hdr) >> 24)
+#define REC_HDR(op, sz) (((uint32_t)(op) << 24) | (sz))
+
+// Records start on 8-byte boundaries so pointer and size_t fields stay aligned
+#define REC_ALIGN(sz)   (((sz) + 7) & ~7u)
+
+typedef enum {
+    OP_PAD = 1,
+    OP_FILL,
+    OP_PIXEL,
+    OP_CHAR,
+    OP_TEXT,
+    OP_BLIT,
+    OP_PIXELS,
+    OP_POINTS,
+    OP_IMAGE,
+    OP_COMMAND,
+    OP_FLUSH,
+    OP_BAND,
+} async_op_t;
+
+typedef struct {
+    uint32_t hdr;         // Written last; 0 until the record is published
+    uint32_t enqueue_us;  // Low 32 bits of esp_timer_get_time()
+} rec_head_t;
+
+typedef struct {
+    rec_head_t head;
+    uint16_t x, y, w, h, color;
+} rec_fill_t;
+
+typedef struct {
+    rec_head_t head;
+    uint16_t x, y, color, bg_color;
+    uint8_t font;
+    char c;
+} rec_char_t;
+
+typedef struct {
+    rec_head_t head;
+    uint16_t x, y, color, bg_color;
+    uint8_t font;
+    uint8_t scale;
+    char text[];          // Null-terminated copy of the string
+} rec_text_t;
+
+typedef struct {
+    rec_head_t head;
+    uint16_t x, y, w, h;
+    uint8_t order;
+    size_t stride;
+    const uint16_t *pixels;
+} rec_blit_t;
+
+typedef struct {
+    rec_head_t head;
+    uint16_t count;
+    st7789_pixel_t pixels[];   // Copy of the caller's points
+} rec_pixels_t;
+
+typedef struct {
+    rec_head_t head;
+    uint16_t count, color;
+    st7789_point_t points[];   // Copy of the caller's points
+} rec_points_t;
+
+typedef struct {
+    rec_head_t head;
+    uint16_t x, y;
+    size_t size;
+    const uint8_t *data;   // Referenced, like blit pixels
+} rec_image_t;
+
+typedef struct {
+    rec_head_t head;
+    uint8_t cmd, len;
+    uint8_t params[ST7789_ASYNC_COMMAND_MAX];
+} rec_command_t;
+
+typedef struct {
+    rec_head_t head;
+    uint16_t y, h, bg_color;
+    st7789_band_draw_cb_t draw;
+    void *ctx;
+} rec_band_t;
+
+// Event group bits
+#define EVT_STOPPED   BIT0         // The render task has exited
+#define EVT_WAITERS   0x00FFFFFEu  // One per blocked producer or fence: a command finished
+
+static uint8_t *ring;
+static uint32_t ring_mask;
+static _Atomic uint32_t ring_head;   // Next byte to reserve (producers)
+static _Atomic uint32_t ring_tail;   // Next byte to execute (render task)
+static TaskHandle_t render_task;
+static EventGroupHandle_t async_events;
+static st7789_async_overflow_t overflow_policy;
+static uint32_t block_timeout_ms;
+static atomic_bool stop_requested;
+static _Atomic uint32_t waiter_bits;   // EVT_WAITERS bits claimed by waiting tasks
+
+static _Atomic uint32_t stat_submitted;
+static _Atomic uint32_t stat_dropped;
+static _Atomic uint32_t stat_producer_waits;
+static st7789_async_stats_t consumer_stats;  // Written by the render task only
+static uint64_t latency_total_us;
+
+static inline uint32_t *hdr_ptr(uint32_t pos) {
+    return (uint32_t *)(ring + (pos & ring_mask));
+}
+
+static inline uint32_t now_us(void) {
+    return (uint32_t)esp_timer_get_time();
+}
+
+/**
+ * @brief Claim size contiguous bytes of the ring without blocking
+ *
+ * @return Ring position of the claimed record, or UINT32_MAX if full
+ */
+static uint32_t try_reserve(uint32_t size) {
+    uint32_t ring_size = ring_mask + 1;
+    uint32_t head = atomic_load_explicit(&ring_head, memory_order_relaxed);
+    uint32_t need;
+    do {
+        uint32_t room_to_end = ring_size - (head & ring_mask);
+        need = size <= room_to_end ? size : room_to_end + size;
+        uint32_t tail = atomic_load_explicit(&ring_tail, memory_order_acquire);
+        if (ring_size - (head - tail) < need) {
+            return UINT32_MAX;
+        }
+    } while (!atomic_compare_exchange_weak_explicit(&ring_head, &head, head + need,
+                                                    memory_order_acq_rel,
+                                                    memory_order_relaxed));
+
+    if (need != size) {
+        // Skip the tail end of the ring so the record stays contiguous
+        atomic_store_explicit((_Atomic uint32_t *)hdr_ptr(head),
+                              REC_HDR(OP_PAD, need - size), memory_order_release);
+        head += need - size;
+    }
+    return head;
+}
+
+/**
+ * @brief Claim a progress bit of one's own before waiting on the render task
+ *
+ * Each waiter owns its bit and is the only one clearing it, so it cannot
+ * lose a wakeup to another waiter. The bit starts clear and the render
+ * task sets it after every command, so a command that finishes between
+ * the caller's check and its wait still wakes it.
+ *
+ * @return The bit, or 0 when every bit is taken (the caller then polls)
+ */
+static EventBits_t waiter_claim(void) {
+    uint32_t used = atomic_load(&waiter_bits);
+    for (;;) {
+        uint32_t free_bits = EVT_WAITERS & ~used;
+        if (free_bits == 0) {
+            return 0;
+        }
+        uint32_t bit = free_bits & -free_bits;
+        if (atomic_compare_exchange_weak(&waiter_bits, &used, used | bit)) {
+            xEventGroupClearBits(async_events, bit);
+            return bit;
+        }
+    }
+}
+
+static void waiter_release(EventBits_t bit) {
+    atomic_fetch_and(&waiter_bits, ~bit);
+}
+
+// Sleep until the render task finishes a command, at most ticks
+static void waiter_wait(EventBits_t bit, TickType_t ticks) {
+    if (bit == 0) {
+        vTaskDelay(1);
+        return;
+    }
+    xEventGroupWaitBits(async_events, bit, pdTRUE, pdFALSE, ticks);
+}
+
+/**
+ * @brief Reserve a record, applying the configured back-pressure policy
+ *
+ * @return Pointer to the record payload area, or NULL if the command was dropped
+ */
+static void *reserve(uint32_t size) {
+    size = REC_ALIGN(size);
+    uint32_t pos = UINT32_MAX;
+
+    if (size <= ring_mask + 1) {
+        pos = try_reserve(size);
+    }
+    if (pos == UINT32_MAX && size <= ring_mask + 1 && overflow_policy == ST7789_ASYNC_BLOCK) {
+        atomic_fetch_add(&stat_producer_waits, 1);
+        int64_t deadline = esp_timer_get_time() + (int64_t)block_timeout_ms * 1000;
+        EventBits_t bit = waiter_claim();
+        do {
+            pos = try_reserve(size);
+            if (pos == UINT32_MAX) {
+                int64_t left_ms = (deadline - esp_timer_get_time()) / 1000;
+                if (left_ms > 0) {
+                    waiter_wait(bit, pdMS_TO_TICKS(left_ms) + 1);
+                }
+            }
+        } while (pos == UINT32_MAX && esp_timer_get_time() < deadline);
+        waiter_release(bit);
+    }
+    if (pos == UINT32_MAX) {
+        atomic_fetch_add(&stat_dropped, 1);
+        return NULL;
+    }
+
+    rec_head_t *head = (rec_head_t *)hdr_ptr(pos);
+    head->enqueue_us = now_us();
+    return head;
+}
+
+// Make a filled record of the size passed to reserve() visible to the render task and wake it
+static void publish(void *record, async_op_t op, uint32_t size) {
+    rec_head_t *head = record;
+    atomic_store_explicit((_Atomic uint32_t *)&head->hdr, REC_HDR(op, REC_ALIGN(size)),
+                          memory_order_release);
+    atomic_fetch_add(&stat_submitted, 1);
+    xTaskNotifyGive(render_task);
+}
+
+// True when draws from the calling task must go through the queue
+static inline bool queueing(void) {
+    return render_task != NULL && xTaskGetCurrentTaskHandle() != render_task;
+}
+
+bool st7789_async_queueing(void) {
+    return queueing();
+}
+
+bool st7789_async_fill_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
+    if (!queueing()) return false;
+    rec_fill_t *rec = reserve(sizeof(*rec));
+    if (rec) {
+        rec->x = x;
+        rec->y = y;
+        rec->w = w;
+        rec->h = h;
+        rec->color = color;
+        publish(rec, OP_FILL, sizeof(*rec));
+    }
+    return true;
+}
+
+bool st7789_async_draw_pixel(uint16_t x, uint16_t y, uint16_t color) {
+    if (!queueing()) return false;
+    rec_fill_t *rec = reserve(sizeof(*rec));
+    if (rec) {
+        rec->x = x;
+        rec->y = y;
+        rec->color = color;
+        publish(rec, OP_PIXEL, sizeof(*rec));
+    }
+    return true;
+}
+
+bool st7789_async_draw_char(st7789_font_t font, uint16_t x, uint16_t y, char c,
+                            uint16_t color, uint16_t bg_color) {
+    if (!queueing()) return false;
+    rec_char_t *rec = reserve(sizeof(*rec));
+    if (rec) {
+        rec->x = x;
+        rec->y = y;
+        rec->color = color;
+        rec->bg_color = bg_color;
+        rec->font = font;
+        rec->c = c;
+        publish(rec, OP_CHAR, sizeof(*rec));
+    }
+    return true;
+}
+
+bool st7789_async_draw_text(st7789_font_t font, uint16_t x, uint16_t y, const char *str,
+                            uint16_t color, uint16_t bg_color, uint8_t scale) {
+    if (!queueing()) return false;
+    size_t len = strlen(str);
+    uint32_t size = sizeof(rec_text_t) + len + 1;
+    rec_text_t *rec = reserve(size);
+    if (rec) {
+        rec->x = x;
+        rec->y = y;
+        rec->color = color;
+        rec->bg_color = bg_color;
+        rec->font = font;
+        rec->scale = scale;
+        memcpy(rec->text, str, len + 1);
+        publish(rec, OP_TEXT, size);
+    }
+    return true;
+}
+
+bool st7789_async_blit(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                       const uint16_t *pixels, size_t stride, st7789_pixel_order_t order) {
+    if (!queueing()) return false;
+    rec_blit_t *rec = reserve(sizeof(*rec));
+    if (rec) {
+        rec->x = x;
+        rec->y = y;
+        rec->w = w;
+        rec->h = h;
+        rec->order = order;
+        rec->stride = stride;
+        rec->pixels = pixels;
+        publish(rec, OP_BLIT, sizeof(*rec));
+    }
+    return true;
+}
+
+bool st7789_async_draw_pixels(const st7789_pixel_t *pixels, size_t count) {
+    if (!queueing()) return false;
+    uint32_t size = sizeof(rec_pixels_t) + count * sizeof(st7789_pixel_t);
+    rec_pixels_t *rec = reserve(size);
+    if (rec) {
+        rec->count = count;
+        memcpy(rec->pixels, pixels, count * sizeof(st7789_pixel_t));
+        publish(rec, OP_PIXELS, size);
+    }
+    return true;
+}
+
+bool st7789_async_draw_points(const st7789_point_t *points, size_t count, uint16_t color) {
+    if (!queueing()) return false;
+    uint32_t size = sizeof(rec_points_t) + count * sizeof(st7789_point_t);
+    rec_points_t *rec = reserve(size);
+    if (rec) {
+        rec->count = count;
+        rec->color = color;
+        memcpy(rec->points, points, count * sizeof(st7789_point_t));
+        publish(rec, OP_POINTS, size);
+    }
+    return true;
+}
+
+bool st7789_async_draw_image(uint16_t x, uint16_t y, const uint8_t *data, size_t size) {
+    if (!queueing()) return false;
+    rec_image_t *rec = reserve(sizeof(*rec));
+    if (rec) {
+        rec->x = x;
+        rec->y = y;
+        rec->size = size;
+        rec->data = data;
+        publish(rec, OP_IMAGE, sizeof(*rec));
+    }
+    return true;
+}
+
+bool st7789_async_command(uint8_t cmd, const uint8_t *params, size_t len) {
+    if (!queueing() || len > ST7789_ASYNC_COMMAND_MAX) return false;
+    rec_command_t *rec = reserve(sizeof(*rec));
+    if (rec) {
+        rec->cmd = cmd;
+        rec->len = len;
+        memcpy(rec->params, params, len);
+        publish(rec, OP_COMMAND, sizeof(*rec));
+    }
+    return true;
+}
+
+bool st7789_async_flush(void) {
+    if (!queueing()) return false;
+    rec_head_t *rec = reserve(sizeof(*rec));
+    if (rec) {
+        publish(rec, OP_FLUSH, sizeof(*rec));
+    }
+    return true;
+}
+
+bool st7789_async_band_render(uint16_t y, uint16_t h, uint16_t bg_color,
+                              st7789_band_draw_cb_t draw, void *ctx) {
+    if (!queueing()) return false;
+    rec_band_t *rec = reserve(sizeof(*rec));
+    if (rec) {
+        rec->y = y;
+        rec->h = h;
+        rec->bg_color = bg_color;
+        rec->draw = draw;
+        rec->ctx = ctx;
+        publish(rec, OP_BAND, sizeof(*rec));
+    }
+    return true;
+}
+
+void st7789_async_sync(void) {
+    if (queueing()) {
+        st7789_wait_idle(UINT32_MAX);
+    }
+}
+
+// Run one command on the render task; the draw calls see queueing() == false
+static void execute(uint32_t op, const void *record) {
+    switch (op) {
+    case OP_FILL: {
+        const rec_fill_t *r = record;
+        st7789_fill_rect(r->x, r->y, r->w, r->h, r->color);
+        break;
+    }
+    case OP_PIXEL: {
+        const rec_fill_t *r = record;
+        st7789_draw_pixel(r->x, r->y, r->color);
+        break;
+    }
+    case OP_CHAR: {
+        const rec_char_t *r = record;
+        if (r->font == ST7789_FONT_16X16) {
+            st7789_draw_large_char(r->x, r->y, r->c, r->color, r->bg_color);
+        } else {
+            st7789_draw_char(r->x, r->y, r->c, r->color, r->bg_color);
+        }
+        break;
+    }
+    case OP_TEXT: {
+        const rec_text_t *r = record;
+        if (r->font == ST7789_FONT_16X16) {
+            st7789_draw_large_string(r->x, r->y, r->text, r->color, r->bg_color);
+        } else if (r->scale != 1) {
+            st7789_draw_string_scaled(r->x, r->y, r->text, r->scale, r->color, r->bg_color);
+        } else {
+            st7789_draw_string(r->x, r->y, r->text, r->color, r->bg_color);
+        }
+        break;
+    }
+    case OP_BLIT: {
+        const rec_blit_t *r = record;
+        st7789_blit_stride(r->x, r->y, r->w, r->h, r->pixels, r->stride, r->order);
+        break;
+    }
+    case OP_PIXELS: {
+        const rec_pixels_t *r = record;
+        st7789_draw_pixels(r->pixels, r->count);
+        break;
+    }
+    case OP_POINTS: {
+        const rec_points_t *r = record;
+        st7789_draw_points(r->points, r->count, r->color);
+        break;
+    }
+    case OP_IMAGE: {
+        const rec_image_t *r = record;
+        st7789_draw_image(r->x, r->y, r->data, r->size);
+        break;
+    }
+    case OP_COMMAND: {
+        const rec_command_t *r = record;
+        st7789_bus_command(r->cmd, r->params, r->len);
+        break;
+    }
+    case OP_FLUSH:
+        st7789_flush();
+        break;
+    case OP_BAND: {
+        const rec_band_t *r = record;
+        st7789_band_render(r->y, r->h, r->bg_color, r->draw, r->ctx);
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+/**
+ * @brief Render task: drain the ring in order, sleep when it is empty
+ */
+static void render_task_main(void *arg) {
+    (void)arg;
+    while (!atomic_load(&stop_requested)) {
+        uint32_t tail = atomic_load_explicit(&ring_tail, memory_order_relaxed);
+        uint32_t head = atomic_load_explicit(&ring_head, memory_order_acquire);
+        uint32_t hdr = 0;
+        if (tail != head) {
+            hdr = atomic_load_explicit((_Atomic uint32_t *)hdr_ptr(tail), memory_order_acquire);
+        }
+        if (hdr == 0) {
+            // Empty, or the oldest record is reserved but not yet published.
+            // Every publish notifies, so this cannot sleep past new work.
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            continue;
+        }
+
+        uint32_t depth = head - tail;
+        if (depth > consumer_stats.max_depth_bytes) {
+            consumer_stats.max_depth_bytes = depth;
+        }
+
+        void *record = hdr_ptr(tail);
+        if (REC_OP(hdr) != OP_PAD) {
+            uint32_t latency = now_us() - ((rec_head_t *)record)->enqueue_us;
+            latency_total_us += latency;
+            if (latency > consumer_stats.max_latency_us) {
+                consumer_stats.max_latency_us = latency;
+            }
+            execute(REC_OP(hdr), record);
+            consumer_stats.executed++;
+        }
+
+        // Zero the record so stale bytes never look like a published header
+        memset(record, 0, REC_SIZE(hdr));
+        atomic_store_explicit(&ring_tail, tail + REC_SIZE(hdr), memory_order_release);
+        uint32_t waiters = atomic_load(&waiter_bits);
+        if (waiters != 0) {
+            xEventGroupSetBits(async_events, waiters);
+        }
+    }
+
+    xEventGroupSetBits(async_events, EVT_STOPPED);
+    vTaskDelete(NULL);
+}
+
+/**
+ * @brief Start the render task and route draw calls through its queue
+ *
+ * Call after st7789_init(). From then on every draw call made by another
+ * task is encoded into the command ring and returns immediately; the render
+ * task executes commands in submission order. Strings are copied into the
+ * ring, but blit pixel buffers are referenced, so they must stay valid and
+ * unchanged until a later st7789_wait_idle() or st7789_async_wait_fence()
+ * returns.
+ *
+ * @param config Task and queue settings, NULL for ST7789_ASYNC_CONFIG_DEFAULT()
+ * @return ESP_OK, ESP_ERR_INVALID_STATE if already running,
+ *         ESP_ERR_INVALID_ARG if queue_bytes is not a power of two, or ESP_ERR_NO_MEM
+ */
+esp_err_t st7789_async_start(const st7789_async_config_t *config) {
+    st7789_async_config_t defaults = ST7789_ASYNC_CONFIG_DEFAULT();
+    if (config == NULL) {
+        config = &defaults;
+    }
+    if (render_task != NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    size_t size = config->queue_bytes ? config->queue_bytes : ST7789_ASYNC_QUEUE_BYTES;
+    if (size < 64 || size > (1u << 23) || (size & (size - 1)) != 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    ring = calloc(1, size);
+    async_events = xEventGroupCreate();
+    if (ring == NULL || async_events == NULL) {
+        free(ring);
+        ring = NULL;
+        if (async_events) {
+            vEventGroupDelete(async_events);
+            async_events = NULL;
+        }
+        return ESP_ERR_NO_MEM;
+    }
+
+    ring_mask = size - 1;
+    atomic_store(&ring_head, 0);
+    atomic_store(&ring_tail, 0);
+    overflow_policy = config->overflow;
+    block_timeout_ms = config->block_timeout_ms;
+    atomic_store(&stop_requested, false);
+
+    if (xTaskCreatePinnedToCore(render_task_main, "st7789_render", config->stack_size, NULL,
+                                config->priority, &render_task, config->core) != pdPASS) {
+        render_task = NULL;
+        vEventGroupDelete(async_events);
+        async_events = NULL;
+        free(ring);
+        ring = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+
+    ESP_LOGI(TAG, "Render task started on core %d, %u byte queue",
+             config->core, (unsigned)size);
+    return ESP_OK;
+}
+
+/**
+ * @brief Execute everything queued, stop the render task and return to synchronous drawing
+ */
+void st7789_async_stop(void) {
+    if (render_task == NULL || !queueing()) {
+        return;
+    }
+    st7789_wait_idle(UINT32_MAX);
+
+    atomic_store(&stop_requested, true);
+    xTaskNotifyGive(render_task);
+    xEventGroupWaitBits(async_events, EVT_STOPPED, pdTRUE, pdFALSE, portMAX_DELAY);
+    render_task = NULL;
+
+    vEventGroupDelete(async_events);
+    async_events = NULL;
+    free(ring);
+    ring = NULL;
+    ESP_LOGI(TAG, "Render task stopped");
+}
+
+/**
+ * @brief Mark the current end of the queue
+ *
+ * @return Fence covering every command submitted so far, for st7789_async_wait_fence()
+ */
+uint32_t st7789_async_fence(void) {
+    return render_task ? atomic_load(&ring_head) : 0;
+}
+
+/**
+ * @brief Wait until every command submitted before the fence has executed
+ *
+ * @param fence Value returned by st7789_async_fence()
+ * @param timeout_ms Maximum wait, UINT32_MAX to wait forever
+ * @return ESP_OK, or ESP_ERR_TIMEOUT
+ */
+esp_err_t st7789_async_wait_fence(uint32_t fence, uint32_t timeout_ms) {
+    if (!queueing()) {
+        return ESP_OK;
+    }
+
+    int64_t deadline = esp_timer_get_time() + (int64_t)timeout_ms * 1000;
+    EventBits_t bit = waiter_claim();
+    esp_err_t ret = ESP_OK;
+    while ((int32_t)(atomic_load(&ring_tail) - fence) < 0) {
+        TickType_t ticks = portMAX_DELAY;
+        if (timeout_ms != UINT32_MAX) {
+            int64_t left_ms = (deadline - esp_timer_get_time()) / 1000;
+            if (left_ms <= 0) {
+                ret = ESP_ERR_TIMEOUT;
+                break;
+            }
+            ticks = pdMS_TO_TICKS(left_ms) + 1;
+        }
+        waiter_wait(bit, ticks);
+    }
+    waiter_release(bit);
+    return ret;
+}
+
+/**
+ * @brief Wait until every command submitted so far has reached the panel
+ *
+ * Returns at once when async mode is off.
+ *
+ * @param timeout_ms Maximum wait, UINT32_MAX to wait forever
+ * @return ESP_OK, or ESP_ERR_TIMEOUT
+ */
+esp_err_t st7789_wait_idle(uint32_t timeout_ms) {
+    return st7789_async_wait_fence(st7789_async_fence(), timeout_ms);
+}
+
+/**
+ * @brief Read the queue counters
+ *
+ * @param stats Receives submitted, executed and dropped counts, the deepest
+ *              queue seen and submit-to-execute latency
+ */
+void st7789_async_get_stats(st7789_async_stats_t *stats) {
+    *stats = consumer_stats;
+    stats->submitted = atomic_load(&stat_submitted);
+    stats->dropped = atomic_load(&stat_dropped);
+    stats->producer_waits = atomic_load(&stat_producer_waits);
+    stats->queue_bytes = ring ? ring_mask + 1 : 0;
+    stats->avg_latency_us = stats->executed ? (uint32_t)(latency_total_us / stats->executed) : 0;
+}
+
+/**
+ * @brief Zero the queue counters
+ */
+void st7789_async_reset_stats(void) {
+    atomic_store(&stat_submitted, 0);
+    atomic_store(&stat_dropped, 0);
+    atomic_store(&stat_producer_waits, 0);
+    memset(&consumer_stats, 0, sizeof(consumer_stats));
+    latency_total_us = 0;
+}
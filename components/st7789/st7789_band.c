@@ -0,0 +1,199 @@
+#include "st7789.h"
+#include "st7789_priv.h"
+#include "st7789_transport.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include <string.h>
+
+static const char *TAG = "ST7789_BAND";
+
+#define BAND_PIXELS (ST7789_WIDTH * ST7789_BAND_ROWS)
+
+static uint16_t *band_buf[2];   // Ping-pong buffers, panel byte order, DMA-capable
+static uint16_t *band_pixels;   // Buffer being drawn, NULL outside st7789_band_render()
+static uint16_t band_top;       // First panel row of the band being drawn
+static uint16_t band_height;    // Rows in the band being drawn
+static st7789_band_stats_t band_stats;
+
+bool st7789_band_active(void) {
+    return band_pixels != NULL;
+}
+
+/**
+ * @brief Clip a draw to the band being rendered
+ *
+ * @return false if nothing of it lands in the band
+ */
+static bool clip_to_band(uint16_t *x, uint16_t *y, uint16_t *w, uint16_t *h,
+                         uint16_t *skip_rows) {
+    uint16_t band_end = band_top + band_height;
+    if (*x >= ST7789_WIDTH || *y >= band_end || *w == 0 || *h == 0) return false;
+    if (*y + *h <= band_top) return false;
+
+    *skip_rows = 0;
+    if (*y < band_top) {
+        *skip_rows = band_top - *y;
+        *h -= *skip_rows;
+        *y = band_top;
+    }
+    if (*h > band_end - *y) *h = band_end - *y;
+    if (*w > ST7789_WIDTH - *x) *w = ST7789_WIDTH - *x;
+    return true;
+}
+
+bool st7789_band_fill_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
+    if (band_pixels == NULL) return false;
+
+    uint16_t skip;
+    if (!clip_to_band(&x, &y, &w, &h, &skip)) return true;
+
+    uint16_t be = to_be16(color);
+    uint16_t *row = band_pixels + (size_t)(y - band_top) * ST7789_WIDTH + x;
+    for (uint16_t r = 0; r < h; r++, row += ST7789_WIDTH) {
+        for (uint16_t c = 0; c < w; c++) {
+            row[c] = be;
+        }
+    }
+    return true;
+}
+
+bool st7789_band_blit(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                      const uint16_t *pixels, size_t stride, st7789_pixel_order_t order) {
+    if (band_pixels == NULL) return false;
+
+    uint16_t skip;
+    if (pixels == NULL || !clip_to_band(&x, &y, &w, &h, &skip)) return true;
+
+    pixels += (size_t)skip * stride;
+    uint16_t *row = band_pixels + (size_t)(y - band_top) * ST7789_WIDTH + x;
+    for (uint16_t r = 0; r < h; r++, row += ST7789_WIDTH, pixels += stride) {
+        if (order == ST7789_PIXELS_BE) {
+            memcpy(row, pixels, w * sizeof(uint16_t));
+        } else {
+            st7789_swap_copy(row, pixels, w);
+        }
+    }
+    return true;
+}
+
+// Fill the first rows of a band buffer with one color, two pixels per store
+static void clear_band(uint16_t *pixels, uint16_t rows, uint16_t color) {
+    uint16_t be = to_be16(color);
+    uint32_t pair = ((uint32_t)be << 16) | be;
+    uint32_t *p = (uint32_t *)pixels;
+    for (size_t i = 0; i < (size_t)ST7789_WIDTH * rows / 2; i++) {
+        p[i] = pair;
+    }
+}
+
+static esp_err_t alloc_bands(void) {
+    for (int i = 0; i < 2; i++) {
+        if (band_buf[i] == NULL) {
+            band_buf[i] = heap_caps_malloc(BAND_PIXELS * sizeof(uint16_t), MALLOC_CAP_DMA);
+        }
+        if (band_buf[i] == NULL) {
+            ESP_LOGE(TAG, "Cannot allocate %u byte band buffers",
+                     (unsigned)(2 * BAND_PIXELS * sizeof(uint16_t)));
+            st7789_band_release();
+            return ESP_ERR_NO_MEM;
+        }
+    }
+    return ESP_OK;
+}
+
+/**
+ * @brief Render full-width rows through two ping-pong band buffers
+ *
+ * Band n is drawn while band n - 1 is still being clocked out by DMA. Before
+ * band n is queued the CPU waits for band n - 1 to finish, which frees its
+ * buffer for band n + 1. On the SPI backend the frame therefore takes about
+ * the larger of total draw time and total bus time; the bit-bang and mock
+ * backends send each band synchronously.
+ *
+ * @param y First panel row
+ * @param h Number of rows, clipped to the panel
+ * @param bg_color 16-bit RGB565 color each band starts with
+ * @param draw Scene callback, called once per band
+ * @param ctx Passed to the callback
+ * @return ESP_OK, ESP_ERR_INVALID_ARG, ESP_ERR_INVALID_STATE while a
+ *         framebuffer is enabled or a band render is running, or ESP_ERR_NO_MEM
+ */
+esp_err_t st7789_band_render(uint16_t y, uint16_t h, uint16_t bg_color,
+                             st7789_band_draw_cb_t draw, void *ctx) {
+    if (draw == NULL || y >= ST7789_HEIGHT || h == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (h > ST7789_HEIGHT - y) {
+        h = ST7789_HEIGHT - y;
+    }
+    if (st7789_async_band_render(y, h, bg_color, draw, ctx)) {
+        return ESP_OK;
+    }
+    if (st7789_fb_active() || band_pixels != NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    esp_err_t ret = alloc_bands();
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    // Bands are consecutive rows of one window, so only data follows this
+    st7789_bus_set_window(0, y, ST7789_WIDTH, h);
+
+    int64_t frame_start = esp_timer_get_time();
+    int64_t queued_at = 0;
+    uint32_t bands = 0;
+    for (uint16_t top = y; top < y + h; top += ST7789_BAND_ROWS, bands++) {
+        band_pixels = band_buf[bands & 1];
+        band_top = top;
+        band_height = (y + h - top) < ST7789_BAND_ROWS ? (y + h - top) : ST7789_BAND_ROWS;
+
+        int64_t t0 = esp_timer_get_time();
+        clear_band(band_pixels, band_height, bg_color);
+        draw(band_top, band_height, ctx);
+        int64_t t1 = esp_timer_get_time();
+
+        // The previous band must be on the wire before its buffer is drawn into next
+        st7789_transport_wait();
+        int64_t t2 = esp_timer_get_time();
+        if (bands > 0) {
+            band_stats.send_us[bands - 1] = (uint32_t)(t2 - queued_at);
+        }
+
+        size_t count = (size_t)ST7789_WIDTH * band_height;
+        size_t bytes = count * sizeof(uint16_t);
+        if (st7789_bus_rgb444()) {
+            // Bands are whole rows, so count is even; packing shrinks the buffer in place
+            bytes = st7789_pack_rgb444((uint8_t *)band_pixels, band_pixels, count);
+        }
+        st7789_transport_write_data_async((const uint8_t *)band_pixels, bytes);
+        queued_at = t2;
+        band_stats.render_us[bands] = (uint32_t)(t1 - t0);
+        band_stats.stall_us[bands] = (uint32_t)(t2 - t1);
+    }
+    band_pixels = NULL;
+
+    st7789_transport_wait();
+    int64_t frame_end = esp_timer_get_time();
+    band_stats.send_us[bands - 1] = (uint32_t)(frame_end - queued_at);
+    band_stats.last_bands = bands;
+    band_stats.last_frame_us = (uint32_t)(frame_end - frame_start);
+    band_stats.frames++;
+    return ESP_OK;
+}
+
+/**
+ * @brief Free the band buffers
+ */
+void st7789_band_release(void) {
+    st7789_async_sync();
+    for (int i = 0; i < 2; i++) {
+        heap_caps_free(band_buf[i]);
+        band_buf[i] = NULL;
+    }
+}
+
+void st7789_band_get_stats(st7789_band_stats_t *stats) {
+    *stats = band_stats;
+}
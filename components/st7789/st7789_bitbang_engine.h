@@ -0,0 +1,62 @@
+#ifndef ST7789_BITBANG_ENGINE_H
+#define ST7789_BITBANG_ENGINE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "st7789.h"
+
+/**
+ * @file st7789_bitbang_engine.h
+ * @brief Unrolled register-level software SPI shared by target and host model
+ *
+ * The includer defines two macros before including this header:
+ *
+ * - BB_W1TS(mask): set every GPIO in mask high
+ * - BB_W1TC(mask): set every GPIO in mask low
+ *
+ * On the ESP32 they map to single stores to GPIO_OUT_W1TS_REG and
+ * GPIO_OUT_W1TC_REG; the host model maps them to counters so the exact
+ * number of register writes per byte can be measured on Linux.
+ *
+ * Each bit costs three stores and no branches: clock low together with a
+ * cleared data line, data high if the bit is set (a zero mask is a no-op
+ * store), then clock high so the panel samples on the rising edge.
+ */
+
+#if ST7789_SDA_PIN >= 32 || ST7789_SCK_PIN >= 32 || ST7789_DC_PIN >= 32
+#error "Register bit-bang engine requires SDA, SCK and DC on GPIO 0-31"
+#endif
+
+#define BB_SDA_MASK (1UL << ST7789_SDA_PIN)
+#define BB_SCK_MASK (1UL << ST7789_SCK_PIN)
+#define BB_DC_MASK  (1UL << ST7789_DC_PIN)
+
+// Clock out bit n (7..0) of data; the data-line mask is derived without branching
+#define BB_BIT(data, n) do {                                                   \
+        uint32_t _set = BB_SDA_MASK & (0UL - (((data) >> (n)) & 1UL));          \
+        BB_W1TC(BB_SCK_MASK | (BB_SDA_MASK & ~_set));                           \
+        BB_W1TS(_set);                                                          \
+        BB_W1TS(BB_SCK_MASK);                                                   \
+    } while (0)
+
+static inline __attribute__((always_inline)) void bb_engine_write_byte(uint32_t data) {
+    BB_BIT(data, 7);
+    BB_BIT(data, 6);
+    BB_BIT(data, 5);
+    BB_BIT(data, 4);
+    BB_BIT(data, 3);
+    BB_BIT(data, 2);
+    BB_BIT(data, 1);
+    BB_BIT(data, 0);
+}
+
+// Stream a whole buffer with no per-byte call; forced inline so the IRAM
+// callers never branch into an out-of-line copy placed in flash
+static inline __attribute__((always_inline)) void bb_engine_write_buf(const uint8_t *data, size_t len) {
+    const uint8_t *end = data + len;
+    while (data != end) {
+        bb_engine_write_byte(*data++);
+    }
+}
+
+#endif // ST7789_BITBANG_ENGINE_H
@@ -0,0 +1,82 @@
+#include "st7789.h"
+
+#if ST7789_TRANSPORT == ST7789_TRANSPORT_MOCK
+
+#include "st7789_bitbang_model.h"
+#include <string.h>
+
+// Estimated cost of one GPIO_OUT_W1TS/W1TC store (APB write through the store buffer)
+#ifndef ST7789_BB_CYCLES_REG_WRITE
+#define ST7789_BB_CYCLES_REG_WRITE  4
+#endif
+// Mask computation between stores in the unrolled engine, per bit
+#ifndef ST7789_BB_CYCLES_BIT_ALU
+#define ST7789_BB_CYCLES_BIT_ALU    3
+#endif
+// Buffer load and pointer compare, per byte
+#ifndef ST7789_BB_CYCLES_BYTE_LOOP
+#define ST7789_BB_CYCLES_BYTE_LOOP  3
+#endif
+// digitalWrite() wrapper plus gpio_set_level() argument checks and HAL store
+#ifndef ST7789_BB_CYCLES_GPIO_CALL
+#define ST7789_BB_CYCLES_GPIO_CALL  45
+#endif
+// Per-bit shift/test/loop overhead in the old spi_write_byte_bitbang()
+#ifndef ST7789_BB_CYCLES_LEGACY_BIT
+#define ST7789_BB_CYCLES_LEGACY_BIT 6
+#endif
+
+// Simulated GPIO output register and the panel's shift register
+static uint32_t model_out;
+static uint32_t model_writes;
+static uint8_t model_shift;
+static int model_bits;
+static uint8_t *model_decoded;
+static size_t model_decoded_len;
+
+static void model_store(uint32_t new_out) {
+    model_writes++;
+    bool rising = !(model_out & (1UL << ST7789_SCK_PIN)) && (new_out & (1UL << ST7789_SCK_PIN));
+    model_out = new_out;
+    if (!rising) {
+        return;
+    }
+    model_shift = (model_shift << 1) | ((model_out >> ST7789_SDA_PIN) & 1);
+    if (++model_bits == 8) {
+        if (model_decoded) {
+            model_decoded[model_decoded_len] = model_shift;
+        }
+        model_decoded_len++;
+        model_bits = 0;
+    }
+}
+
+#define BB_W1TS(mask) model_store(model_out | (mask))
+#define BB_W1TC(mask) model_store(model_out & ~(mask))
+
+#include "st7789_bitbang_engine.h"
+
+void st7789_bitbang_model_run(const uint8_t *data, size_t len, uint8_t *decoded,
+                              st7789_bitbang_cost_t *cost) {
+    model_out = 1UL << ST7789_SCK_PIN;  // Clock idles high
+    model_writes = 0;
+    model_shift = 0;
+    model_bits = 0;
+    model_decoded = decoded;
+    model_decoded_len = 0;
+
+    bb_engine_write_buf(data, len);
+
+    memset(cost, 0, sizeof(*cost));
+    cost->bytes = len;
+    cost->reg_writes = model_writes;
+    cost->est_cycles = (uint64_t)model_writes * ST7789_BB_CYCLES_REG_WRITE +
+                       (uint64_t)len * (8 * ST7789_BB_CYCLES_BIT_ALU + ST7789_BB_CYCLES_BYTE_LOOP);
+
+    // The old path made three gpio_set_level() calls per bit: data, clock low, clock high
+    cost->legacy_calls = len * 8 * 3;
+    cost->legacy_est_cycles = (uint64_t)cost->legacy_calls * ST7789_BB_CYCLES_GPIO_CALL +
+                              (uint64_t)len * 8 * ST7789_BB_CYCLES_LEGACY_BIT;
+}
+
+#endif // ST7789_TRANSPORT == ST7789_TRANSPORT_MOCK
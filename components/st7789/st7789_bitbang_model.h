@@ -0,0 +1,43 @@
+#ifndef ST7789_BITBANG_MODEL_H
+#define ST7789_BITBANG_MODEL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @file st7789_bitbang_model.h
+ * @brief Host-side cost model of the register bit-bang engine (Linux target)
+ *
+ * Runs the exact engine from st7789_bitbang_engine.h against a simulated
+ * GPIO output register, decoding the bytes a panel would latch and counting
+ * register stores. The legacy gpio_set_level() path is costed alongside it
+ * so CI can compare per-byte cost without hardware.
+ *
+ * Cycle figures are estimates for a 240 MHz ESP32 and can be tuned with the
+ * ST7789_BB_CYCLES_* definitions in st7789_bitbang_model.c.
+ */
+
+/**
+ * @brief Cost of sending one buffer through both bit-bang paths
+ */
+typedef struct {
+    uint32_t bytes;              // Bytes sent
+    uint32_t reg_writes;         // GPIO register stores by the unrolled engine
+    uint64_t est_cycles;         // Estimated CPU cycles, unrolled engine
+    uint32_t legacy_calls;       // gpio_set_level() calls by the old per-bit loop
+    uint64_t legacy_est_cycles;  // Estimated CPU cycles, old per-bit loop
+} st7789_bitbang_cost_t;
+
+/**
+ * @brief Run data through the modelled engine
+ *
+ * @param data Bytes to send
+ * @param len Number of bytes
+ * @param decoded Optional buffer of len bytes receiving what the panel would
+ *                latch on each rising clock edge; NULL to skip
+ * @param cost Receives register-write and cycle estimates
+ */
+void st7789_bitbang_model_run(const uint8_t *data, size_t len, uint8_t *decoded,
+                              st7789_bitbang_cost_t *cost);
+
+#endif // ST7789_BITBANG_MODEL_H
@@ -0,0 +1,264 @@
+#include "st7789.h"
+#include "st7789_priv.h"
+#include <string.h>
+
+// Cell kinds, each with its own width and segment set
+enum {
+    CELL_SEG7 = 0,   // Digits, letters, '-', ' ': seven segments a-g
+    CELL_DOTS,       // '.' and ':': narrow cell of stroke-sized squares
+    CELL_PERCENT,    // '%': two squares and a stepped diagonal
+};
+
+// Seven-segment bits
+#define SEG_A 0x01   // Top
+#define SEG_B 0x02   // Upper right
+#define SEG_C 0x04   // Lower right
+#define SEG_D 0x08   // Bottom
+#define SEG_E 0x10   // Lower left
+#define SEG_F 0x20   // Upper left
+#define SEG_G 0x40   // Middle
+
+// Dot cell bits
+#define DOT_POINT 0x01
+#define DOT_UPPER 0x02
+#define DOT_LOWER 0x04
+
+// Percent cell bits
+#define PCT_UPPER 0x01
+#define PCT_LOWER 0x02
+#define PCT_SLASH 0x04
+
+#define MAX_RECTS 16   // Most rectangles in one segment (the percent diagonal)
+
+// Segments lit per character; characters left out draw a blank cell
+static const uint8_t seg7_map[128] = {
+    ['0'] = 0x3F, ['1'] = 0x06, ['2'] = 0x5B, ['3'] = 0x4F, ['4'] = 0x66,
+    ['5'] = 0x6D, ['6'] = 0x7D, ['7'] = 0x07, ['8'] = 0x7F, ['9'] = 0x6F,
+    ['-'] = SEG_G, ['_'] = SEG_D, ['='] = SEG_D | SEG_G,
+    ['*'] = SEG_A | SEG_B | SEG_F | SEG_G,   // Degree sign
+    ['A'] = 0x77, ['a'] = 0x77, ['B'] = 0x7C, ['b'] = 0x7C,
+    ['C'] = 0x39, ['c'] = 0x58, ['D'] = 0x5E, ['d'] = 0x5E,
+    ['E'] = 0x79, ['e'] = 0x79, ['F'] = 0x71, ['f'] = 0x71,
+    ['G'] = 0x3D, ['g'] = 0x3D, ['H'] = 0x76, ['h'] = 0x74,
+    ['I'] = 0x30, ['i'] = 0x30, ['J'] = 0x1E, ['j'] = 0x1E,
+    ['L'] = 0x38, ['l'] = 0x38, ['N'] = 0x54, ['n'] = 0x54,
+    ['O'] = 0x3F, ['o'] = 0x5C, ['P'] = 0x73, ['p'] = 0x73,
+    ['Q'] = 0x67, ['q'] = 0x67, ['R'] = 0x50, ['r'] = 0x50,
+    ['S'] = 0x6D, ['s'] = 0x6D, ['T'] = 0x78, ['t'] = 0x78,
+    ['U'] = 0x3E, ['u'] = 0x1C, ['Y'] = 0x6E, ['y'] = 0x6E,
+};
+
+typedef struct {
+    uint16_t x, y, w, h;
+} seg_rect_t;
+
+typedef struct {
+    uint8_t kind;
+    uint8_t segments;
+} cell_t;
+
+static cell_t classify(char c) {
+    switch (c) {
+    case '.': return (cell_t){ CELL_DOTS, DOT_POINT };
+    case ':': return (cell_t){ CELL_DOTS, DOT_UPPER | DOT_LOWER };
+    case '%': return (cell_t){ CELL_PERCENT, PCT_UPPER | PCT_LOWER | PCT_SLASH };
+    default:  return (cell_t){ CELL_SEG7, (unsigned char)c < 128 ? seg7_map[(unsigned char)c] : 0 };
+    }
+}
+
+static uint16_t cell_width(const st7789_digits_t *d, uint8_t kind) {
+    return kind == CELL_DOTS ? d->stroke : d->height / 2 + d->stroke;
+}
+
+/**
+ * @brief Rectangles of one segment, relative to the cell origin
+ *
+ * Horizontal seven-segment bars stop a stroke short of each side, leaving
+ * the notched corners of a classic LED digit.
+ *
+ * @return Number of rectangles written to out
+ */
+static int segment_rects(const st7789_digits_t *d, uint8_t kind, uint8_t bit, seg_rect_t *out) {
+    uint16_t h = d->height, t = d->stroke, w = cell_width(d, kind);
+    uint16_t mid = (h - t) / 2;   // Top of the middle bar
+
+    if (kind == CELL_DOTS) {
+        uint16_t y = bit == DOT_POINT ? h - t : bit == DOT_UPPER ? h / 3 - t / 2 : h * 2 / 3 - t / 2;
+        out[0] = (seg_rect_t){ 0, y, t, t };
+        return 1;
+    }
+
+    if (kind == CELL_PERCENT) {
+        uint16_t s = w / 3 > t ? w / 3 : t;
+        if (bit == PCT_UPPER) {
+            out[0] = (seg_rect_t){ 0, 0, s, s };
+            return 1;
+        }
+        if (bit == PCT_LOWER) {
+            out[0] = (seg_rect_t){ w - s, h - s, s, s };
+            return 1;
+        }
+        // Stepped diagonal from top right to bottom left
+        int steps = h / t;
+        if (steps > MAX_RECTS) steps = MAX_RECTS;
+        if (steps < 2) steps = 2;
+        for (int i = 0; i < steps; i++) {
+            uint16_t y0 = h * i / steps, y1 = h * (i + 1) / steps;
+            out[i] = (seg_rect_t){ (w - t) * (steps - 1 - i) / (steps - 1), y0, t, y1 - y0 };
+        }
+        return steps;
+    }
+
+    switch (bit) {
+    case SEG_A: out[0] = (seg_rect_t){ t, 0, w - 2 * t, t }; break;
+    case SEG_G: out[0] = (seg_rect_t){ t, mid, w - 2 * t, t }; break;
+    case SEG_D: out[0] = (seg_rect_t){ t, h - t, w - 2 * t, t }; break;
+    case SEG_F: out[0] = (seg_rect_t){ 0, t, t, mid - t }; break;
+    case SEG_B: out[0] = (seg_rect_t){ w - t, t, t, mid - t }; break;
+    case SEG_E: out[0] = (seg_rect_t){ 0, mid + t, t, h - t - mid - t }; break;
+    case SEG_C: out[0] = (seg_rect_t){ w - t, mid + t, t, h - t - mid - t }; break;
+    default: return 0;
+    }
+    return 1;
+}
+
+// st7789_fill_rect() clipped to the panel; readouts may run off the right edge
+static bool fill_clipped(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
+    if (x >= ST7789_WIDTH || y >= ST7789_HEIGHT || w == 0 || h == 0) return false;
+    if (w > ST7789_WIDTH - x) w = ST7789_WIDTH - x;
+    if (h > ST7789_HEIGHT - y) h = ST7789_HEIGHT - y;
+    st7789_fill_rect(x, y, w, h, color);
+    return true;
+}
+
+// Paint the segments in mask on or off; returns rectangles filled
+static int paint_segments(const st7789_digits_t *d, uint16_t cell_x, uint8_t kind,
+                          uint8_t mask, bool on) {
+    seg_rect_t rects[MAX_RECTS];
+    int fills = 0;
+    for (uint8_t bit = 1; bit != 0 && bit <= mask; bit <<= 1) {
+        if (!(mask & bit)) continue;
+        int n = segment_rects(d, kind, bit, rects);
+        for (int i = 0; i < n; i++) {
+            if (fill_clipped(cell_x + rects[i].x, d->y + rects[i].y, rects[i].w, rects[i].h,
+                             on ? d->color : d->bg_color)) {
+                fills++;
+            }
+        }
+    }
+    return fills;
+}
+
+/**
+ * @brief Register a big-digit readout at a fixed position
+ *
+ * The stroke is clamped to 1..height/5 so the segments never overlap.
+ * Nothing is drawn until the first st7789_digits_update().
+ *
+ * @param digits Caller-owned readout state
+ * @param x X coordinate of the first cell
+ * @param y Y coordinate of the top of the cells
+ * @param height Cell height in pixels; digit cells are height/2 + stroke wide
+ * @param stroke Segment thickness in pixels
+ * @param color 16-bit RGB565 segment color
+ * @param bg_color 16-bit RGB565 background color
+ */
+void st7789_digits_init(st7789_digits_t *digits, uint16_t x, uint16_t y, uint16_t height,
+                        uint16_t stroke, uint16_t color, uint16_t bg_color) {
+    memset(digits, 0, sizeof(*digits));
+    if (height < 5) height = 5;
+    if (stroke > height / 5) stroke = height / 5;
+    if (stroke == 0) stroke = 1;
+    digits->x = x;
+    digits->y = y;
+    digits->height = height;
+    digits->stroke = stroke;
+    digits->color = color;
+    digits->bg_color = bg_color;
+}
+
+/**
+ * @brief Width in pixels that text would occupy, for aligning a readout
+ */
+uint16_t st7789_digits_measure(const st7789_digits_t *digits, const char *text) {
+    size_t len = strnlen(text, ST7789_DIGITS_MAX_LEN);
+    uint32_t w = 0;
+    for (size_t i = 0; i < len; i++) {
+        w += cell_width(digits, classify(text[i]).kind) + (i > 0 ? digits->stroke : 0);
+    }
+    return w > UINT16_MAX ? UINT16_MAX : w;
+}
+
+/**
+ * @brief Show a new value, repainting only the segments that changed
+ *
+ * Cells are laid out left to right with a one-stroke gap; '.' and ':' take
+ * a narrow cell. While a cell keeps its position and kind, only segments
+ * that switched on or off are filled, so 18.4 -> 18.5 costs three small
+ * rectangles. From the first cell whose position or kind changes, the old
+ * and new extent is cleared in one fill and the rest is drawn afresh.
+ *
+ * @param digits Readout registered with st7789_digits_init()
+ * @param text New value; at most ST7789_DIGITS_MAX_LEN characters are shown
+ * @return Number of rectangles filled
+ */
+int st7789_digits_update(st7789_digits_t *digits, const char *text) {
+    size_t new_len = strnlen(text, ST7789_DIGITS_MAX_LEN);
+    size_t old_len = digits->valid ? digits->len : 0;
+    uint16_t old_end = digits->valid ? digits->x + digits->width : digits->x;
+    int fills = 0;
+
+    uint16_t cell_x = digits->x;
+    size_t i = 0;
+    // Cells that kept their place: diff segment by segment
+    for (; i < new_len && i < old_len; i++) {
+        cell_t cell = classify(text[i]);
+        if (cell.kind != digits->kind[i] || cell_x != digits->cell_x[i]) {
+            break;
+        }
+        uint8_t shown = digits->segments[i];
+        fills += paint_segments(digits, cell_x, cell.kind, shown & ~cell.segments, false);
+        fills += paint_segments(digits, cell_x, cell.kind, cell.segments & ~shown, true);
+        digits->segments[i] = cell.segments;
+        cell_x += cell_width(digits, cell.kind) + digits->stroke;
+    }
+
+    // The rest moved, changed kind, or is new: clear once and redraw
+    uint16_t new_end = digits->x + st7789_digits_measure(digits, text);
+    uint16_t clear_end = new_end > old_end ? new_end : old_end;
+    if (clear_end > cell_x &&
+        fill_clipped(cell_x, digits->y, clear_end - cell_x, digits->height, digits->bg_color)) {
+        fills++;
+    }
+    for (; i < new_len; i++) {
+        cell_t cell = classify(text[i]);
+        fills += paint_segments(digits, cell_x, cell.kind, cell.segments, true);
+        digits->kind[i] = cell.kind;
+        digits->cell_x[i] = cell_x;
+        digits->segments[i] = cell.segments;
+        cell_x += cell_width(digits, cell.kind) + digits->stroke;
+    }
+
+    digits->len = new_len;
+    digits->width = new_end - digits->x;
+    digits->valid = true;
+    return fills;
+}
+
+/**
+ * @brief Change the readout colors; the next update redraws every cell
+ */
+void st7789_digits_set_colors(st7789_digits_t *digits, uint16_t color, uint16_t bg_color) {
+    if (digits->color != color || digits->bg_color != bg_color) {
+        digits->color = color;
+        digits->bg_color = bg_color;
+        digits->valid = false;
+    }
+}
+
+/**
+ * @brief Forget what is on screen so the next update redraws every cell
+ */
+void st7789_digits_invalidate(st7789_digits_t *digits) {
+    digits->valid = false;
+}
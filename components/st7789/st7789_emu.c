@@ -0,0 +1,427 @@
+#include "st7789_transport.h"
+#include "st7789_priv.h"
+
+#if ST7789_TRANSPORT == ST7789_TRANSPORT_MOCK
+
+#include "st7789_emu.h"
+#include "st7789_mock.h"
+#include "esp_timer.h"
+#include <stdio.h>
+#include <string.h>
+
+#define EMU_W ST7789_EMU_GRAM_WIDTH
+#define EMU_H ST7789_EMU_GRAM_HEIGHT
+
+// Parameter counts; PARAMS_STREAM takes pixel data, PARAMS_ANY is unchecked
+#define PARAMS_STREAM  -1
+#define PARAMS_ANY     -2
+#define PARAMS_UNKNOWN -3
+
+// Datasheet waits (microseconds)
+#define WAIT_AFTER_RESET_US   5000     // SWRESET/SLPOUT/SLPIN to the next command
+#define WAIT_SLEEP_CHANGE_US  120000   // SWRESET or SLPIN to SLPOUT, SLPOUT to SLPIN
+
+typedef struct {
+    uint32_t gram[EMU_H][EMU_W];   // 0xRRGGBB as stored by the controller
+
+    // Controller state
+    bool sleeping;
+    bool display_on;
+    bool inverted;
+    uint8_t madctl;
+    uint8_t colmod;
+    uint16_t xs, xe, ys, ye;       // CASET/RASET window in MCU coordinates
+    uint16_t col, row;             // Address counter
+    uint16_t tfa, vsa, bfa, vsp;   // Vertical scroll definition and start
+
+    // Command decoding
+    uint8_t cmd;
+    int expected;                  // Parameter bytes expected, or a PARAMS_* value
+    uint8_t params[16];
+    int nparams;
+    uint8_t pix[3];                // Partial pixel (bytes carried across calls)
+    int npix;
+
+    // Timing checks
+    int64_t quiet_until;
+    int64_t last_reset;            // SWRESET or SLPIN
+    int64_t last_slpout;
+
+    bool last_was_command;
+    st7789_emu_stats_t stats;
+} emu_t;
+
+static emu_t emu;
+
+static int param_count(uint8_t cmd) {
+    switch (cmd) {
+    case 0x00: case 0x01: case 0x10: case 0x11: case 0x12: case 0x13:
+    case 0x20: case 0x21: case 0x28: case 0x29: case 0x34: case 0x38: case 0x39:
+        return 0;
+    case 0x26: case 0x35: case 0x36: case 0x3A:   // GAMSET, TEON, MADCTL, COLMOD
+        return 1;
+    case 0x37:                                    // VSCSAD
+        return 2;
+    case 0x2A: case 0x2B: case 0x30:              // CASET, RASET, PTLAR
+        return 4;
+    case 0x33:                                    // VSCRDEF
+        return 6;
+    case 0x2C: case 0x3C:                         // RAMWR, RAMWRC
+        return PARAMS_STREAM;
+    case 0xB0: case 0xB2: case 0xB7: case 0xBB: case 0xC0: case 0xC2: case 0xC3:
+    case 0xC4: case 0xC6: case 0xD0: case 0xE0: case 0xE1: case 0xE7:
+        return PARAMS_ANY;                        // Panel tuning, not modelled
+    default:
+        return PARAMS_UNKNOWN;
+    }
+}
+
+static void controller_reset(void) {
+    memset(emu.gram, 0, sizeof(emu.gram));
+    emu.sleeping = true;
+    emu.display_on = false;
+    emu.inverted = false;
+    emu.madctl = 0x00;
+    emu.colmod = 0x66;
+    emu.xs = 0;
+    emu.xe = EMU_W - 1;
+    emu.ys = 0;
+    emu.ye = EMU_H - 1;
+    emu.col = 0;
+    emu.row = 0;
+    emu.tfa = 0;
+    emu.vsa = EMU_H;
+    emu.bfa = 0;
+    emu.vsp = 0;
+    emu.expected = 0;
+    emu.nparams = 0;
+    emu.npix = 0;
+}
+
+// Store one pixel at the address counter, then advance it within the window
+static void store_pixel(uint32_t rgb) {
+    bool mv = emu.madctl & 0x20;
+    uint16_t col_max = mv ? EMU_H - 1 : EMU_W - 1;
+    uint16_t row_max = mv ? EMU_W - 1 : EMU_H - 1;
+    int c = (emu.madctl & 0x40) ? col_max - emu.col : emu.col;   // MX
+    int r = (emu.madctl & 0x80) ? row_max - emu.row : emu.row;   // MY
+    int px = mv ? r : c;
+    int py = mv ? c : r;
+
+    if (px >= 0 && px < EMU_W && py >= 0 && py < EMU_H) {
+        emu.gram[py][px] = rgb;
+        emu.stats.pixels_written++;
+    } else {
+        emu.stats.pixels_clipped++;
+    }
+
+    if (++emu.col > emu.xe) {
+        emu.col = emu.xs;
+        if (++emu.row > emu.ye) {
+            emu.row = emu.ys;
+        }
+    }
+}
+
+static uint8_t expand4(uint8_t v) { return (uint8_t)(v << 4 | v); }
+static uint8_t expand5(uint8_t v) { return (uint8_t)(v << 3 | v >> 2); }
+static uint8_t expand6(uint8_t v) { return (uint8_t)(v << 2 | v >> 4); }
+
+static uint32_t rgb(uint8_t r, uint8_t g, uint8_t b) {
+    return (uint32_t)r << 16 | (uint32_t)g << 8 | b;
+}
+
+// Assemble pixels in the current COLMOD format from a RAMWR byte stream
+static void pixel_byte(uint8_t b) {
+    emu.pix[emu.npix++] = b;
+    switch (emu.colmod & 0x07) {
+    case 0x3:   // 12-bit: two pixels in three bytes, each stored once its 12 bits are in
+        if (emu.npix == 2) {
+            store_pixel(rgb(expand4(emu.pix[0] >> 4), expand4(emu.pix[0] & 0xF),
+                            expand4(emu.pix[1] >> 4)));
+        } else if (emu.npix == 3) {
+            store_pixel(rgb(expand4(emu.pix[1] & 0xF), expand4(emu.pix[2] >> 4),
+                            expand4(emu.pix[2] & 0xF)));
+            emu.npix = 0;
+        }
+        break;
+    case 0x5:   // 16-bit RGB565, big-endian
+        if (emu.npix == 2) {
+            uint16_t v = (uint16_t)(emu.pix[0] << 8 | emu.pix[1]);
+            store_pixel(rgb(expand5(v >> 11), expand6((v >> 5) & 0x3F), expand5(v & 0x1F)));
+            emu.npix = 0;
+        }
+        break;
+    default:    // 18-bit: one byte per channel, top six bits used
+        if (emu.npix == 3) {
+            store_pixel(rgb(expand6(emu.pix[0] >> 2), expand6(emu.pix[1] >> 2),
+                            expand6(emu.pix[2] >> 2)));
+            emu.npix = 0;
+        }
+        break;
+    }
+}
+
+static uint16_t be16(const uint8_t *p) {
+    return (uint16_t)(p[0] << 8 | p[1]);
+}
+
+// All parameters of a fixed-length command have arrived
+static void apply_params(void) {
+    const uint8_t *p = emu.params;
+    switch (emu.cmd) {
+    case 0x2A:
+    case 0x2B: {
+        uint16_t start = be16(p), end = be16(p + 2);
+        bool columns = (emu.cmd == 0x2A) != ((emu.madctl & 0x20) != 0);
+        uint16_t limit = columns ? EMU_W : EMU_H;
+        if (start > end || end >= limit) {
+            emu.stats.protocol_errors++;
+            break;
+        }
+        if (emu.cmd == 0x2A) {
+            emu.xs = start;
+            emu.xe = end;
+        } else {
+            emu.ys = start;
+            emu.ye = end;
+        }
+        break;
+    }
+    case 0x33: {
+        uint16_t tfa = be16(p), vsa = be16(p + 2), bfa = be16(p + 4);
+        if (tfa + vsa + bfa != EMU_H) {
+            emu.stats.protocol_errors++;
+            break;
+        }
+        emu.tfa = tfa;
+        emu.vsa = vsa;
+        emu.bfa = bfa;
+        break;
+    }
+    case 0x36:
+        emu.madctl = p[0];
+        break;
+    case 0x37:
+        emu.vsp = be16(p);
+        break;
+    case 0x3A:
+        emu.colmod = p[0];
+        emu.npix = 0;
+        break;
+    default:
+        break;
+    }
+}
+
+static void check_timing(uint8_t cmd, int64_t now) {
+    bool early = now < emu.quiet_until;
+    if (cmd == 0x11 && now < emu.last_reset + WAIT_SLEEP_CHANGE_US) early = true;
+    if (cmd == 0x10 && now < emu.last_slpout + WAIT_SLEEP_CHANGE_US) early = true;
+    if (early) {
+        emu.stats.timing_violations++;
+    }
+}
+
+static void on_command(uint8_t cmd) {
+    int64_t now = esp_timer_get_time();
+    check_timing(cmd, now);
+
+    if (emu.expected > 0 && emu.nparams < emu.expected) {
+        emu.stats.protocol_errors++;   // Previous command was cut short
+    }
+    emu.cmd = cmd;
+    emu.expected = param_count(cmd);
+    emu.nparams = 0;
+    emu.stats.command_counts[cmd]++;
+
+    switch (cmd) {
+    case 0x01:   // SWRESET
+        controller_reset();
+        emu.last_reset = now;
+        emu.quiet_until = now + WAIT_AFTER_RESET_US;
+        break;
+    case 0x10:   // SLPIN
+        emu.sleeping = true;
+        emu.last_reset = now;
+        emu.quiet_until = now + WAIT_AFTER_RESET_US;
+        break;
+    case 0x11:   // SLPOUT
+        emu.sleeping = false;
+        emu.last_slpout = now;
+        emu.quiet_until = now + WAIT_AFTER_RESET_US;
+        break;
+    case 0x20: emu.inverted = false; break;
+    case 0x21: emu.inverted = true; break;
+    case 0x28: emu.display_on = false; break;
+    case 0x29: emu.display_on = true; break;
+    case 0x2C:   // RAMWR restarts at the window origin
+        emu.col = emu.xs;
+        emu.row = emu.ys;
+        emu.npix = 0;
+        break;
+    case 0x3C:   // RAMWRC continues where the last write stopped
+        emu.npix = 0;
+        break;
+    default:
+        if (emu.expected == PARAMS_UNKNOWN) {
+            emu.stats.protocol_errors++;
+        }
+        break;
+    }
+}
+
+static void on_data(const uint8_t *bytes, size_t len) {
+    if (emu.expected == PARAMS_STREAM) {
+        for (size_t i = 0; i < len; i++) {
+            pixel_byte(bytes[i]);
+        }
+        return;
+    }
+    if (emu.expected == PARAMS_ANY) {
+        return;
+    }
+    for (size_t i = 0; i < len; i++) {
+        if (emu.expected <= 0 || emu.nparams >= emu.expected) {
+            emu.stats.protocol_errors++;   // Data nobody asked for
+            return;
+        }
+        emu.params[emu.nparams++] = bytes[i];
+        if (emu.nparams == emu.expected) {
+            apply_params();
+        }
+    }
+}
+
+static void emu_sink(bool is_command, const uint8_t *bytes, size_t len, void *ctx) {
+    (void)ctx;
+    emu.stats.transactions++;
+    if (emu.stats.transactions > 1 && is_command != emu.last_was_command) {
+        emu.stats.dc_transitions++;
+    }
+    emu.last_was_command = is_command;
+
+    if (is_command) {
+        emu.stats.commands++;
+        on_command(bytes[0]);
+    } else {
+        emu.stats.data_bytes += len;
+        on_data(bytes, len);
+    }
+}
+
+void st7789_emu_attach(void) {
+    memset(&emu.stats, 0, sizeof(emu.stats));
+    controller_reset();
+    emu.quiet_until = 0;
+    emu.last_reset = INT64_MIN / 2;
+    emu.last_slpout = INT64_MIN / 2;
+    st7789_mock_set_sink(emu_sink, NULL);
+}
+
+void st7789_emu_detach(void) {
+    st7789_mock_set_sink(NULL, NULL);
+}
+
+void st7789_emu_reset(void) {
+    controller_reset();
+}
+
+void st7789_emu_get_stats(st7789_emu_stats_t *out) {
+    *out = emu.stats;
+}
+
+void st7789_emu_reset_stats(void) {
+    memset(&emu.stats, 0, sizeof(emu.stats));
+}
+
+uint64_t st7789_emu_estimate_us(uint32_t spi_hz, uint32_t transaction_ns) {
+    if (spi_hz == 0) {
+        return 0;
+    }
+    uint64_t bytes = emu.stats.commands + emu.stats.data_bytes;
+    uint64_t wire_us = bytes * 8 * 1000000ULL / spi_hz;
+    return wire_us + (uint64_t)emu.stats.transactions * transaction_ns / 1000;
+}
+
+// Map a visible panel row to its GRAM row through the vertical scroll area
+static uint16_t scrolled_row(uint16_t y) {
+    if (y < emu.tfa || y >= emu.tfa + emu.vsa || emu.vsa == 0) {
+        return y;
+    }
+    uint16_t vsp = emu.vsp;
+    if (vsp < emu.tfa || vsp >= emu.tfa + emu.vsa) {
+        vsp = emu.tfa;   // Out-of-range start lines are ignored by the panel
+    }
+    return emu.tfa + (y - emu.tfa + vsp - emu.tfa) % emu.vsa;
+}
+
+uint32_t st7789_emu_get_pixel(uint16_t x, uint16_t y) {
+    if (x >= ST7789_WIDTH || y >= ST7789_HEIGHT || !emu.display_on || emu.sleeping) {
+        return 0;
+    }
+    uint32_t v = emu.gram[scrolled_row(y)][x];
+    if (emu.madctl & 0x08) {   // BGR panel order
+        v = (v & 0x00FF00) | (v >> 16 & 0xFF) | (v & 0xFF) << 16;
+    }
+    return v;
+}
+
+uint16_t st7789_emu_get_pixel565(uint16_t x, uint16_t y) {
+    uint32_t v = st7789_emu_get_pixel(x, y);
+    return (uint16_t)((v >> 8 & 0xF800) | (v >> 5 & 0x07E0) | (v >> 3 & 0x001F));
+}
+
+esp_err_t st7789_emu_write_ppm(const char *path) {
+    FILE *f = fopen(path, "wb");
+    if (f == NULL) {
+        return ESP_FAIL;
+    }
+    fprintf(f, "P6\n%d %d\n255\n", ST7789_WIDTH, ST7789_HEIGHT);
+    for (uint16_t y = 0; y < ST7789_HEIGHT; y++) {
+        uint8_t line[ST7789_WIDTH * 3];
+        for (uint16_t x = 0; x < ST7789_WIDTH; x++) {
+            uint32_t v = st7789_emu_get_pixel(x, y);
+            line[3 * x] = v >> 16;
+            line[3 * x + 1] = v >> 8;
+            line[3 * x + 2] = v;
+        }
+        fwrite(line, 1, sizeof(line), f);
+    }
+    return fclose(f) == 0 ? ESP_OK : ESP_FAIL;
+}
+
+esp_err_t st7789_emu_compare_ppm(const char *path, uint32_t *mismatches) {
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    int w = 0, h = 0, maxval = 0;
+    if (fscanf(f, "P6 %d %d %d", &w, &h, &maxval) != 3 || fgetc(f) == EOF ||
+        w != ST7789_WIDTH || h != ST7789_HEIGHT || maxval != 255) {
+        fclose(f);
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    uint32_t diff = 0;
+    for (uint16_t y = 0; y < ST7789_HEIGHT; y++) {
+        uint8_t line[ST7789_WIDTH * 3];
+        if (fread(line, 1, sizeof(line), f) != sizeof(line)) {
+            fclose(f);
+            return ESP_ERR_INVALID_SIZE;
+        }
+        for (uint16_t x = 0; x < ST7789_WIDTH; x++) {
+            uint32_t want = rgb(line[3 * x], line[3 * x + 1], line[3 * x + 2]);
+            if (st7789_emu_get_pixel(x, y) != want) {
+                diff++;
+            }
+        }
+    }
+    fclose(f);
+    if (mismatches != NULL) {
+        *mismatches = diff;
+    }
+    return diff == 0 ? ESP_OK : ESP_FAIL;
+}
+
+#endif // ST7789_TRANSPORT == ST7789_TRANSPORT_MOCK
@@ -0,0 +1,116 @@
+#ifndef ST7789_EMU_H
+#define ST7789_EMU_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+/**
+ * @file st7789_emu.h
+ * @brief Host-side ST7789 panel emulator (ST7789_TRANSPORT_MOCK)
+ *
+ * Decodes the command stream the driver sends to the mock transport the way
+ * the controller would: CASET/RASET/RAMWR/RAMWRC into a 240x320 GRAM, with
+ * MADCTL address mapping, COLMOD 12/16/18-bit pixel formats, and vertical
+ * scrolling, sleep and display on/off state. The visible 240x240 area can be
+ * read back or written as a PPM image for golden-image tests, and the bus
+ * counters give exact bytes and an estimated wire time at a chosen SPI clock.
+ *
+ * The emulator installs itself as the mock sink, so it replaces any sink
+ * set with st7789_mock_set_sink().
+ */
+
+#define ST7789_EMU_GRAM_WIDTH   240
+#define ST7789_EMU_GRAM_HEIGHT  320
+
+/**
+ * @brief Bus and protocol counters
+ */
+typedef struct {
+    uint32_t transactions;         // Transport calls (one CS-low period each on SPI)
+    uint32_t commands;             // Command bytes
+    uint64_t data_bytes;           // Parameter and pixel bytes
+    uint32_t dc_transitions;       // Command/data switches
+    uint64_t pixels_written;       // Pixels stored in GRAM
+    uint32_t pixels_clipped;       // Pixels addressed outside GRAM
+    uint32_t protocol_errors;      // Stray data, bad windows, unknown commands
+    uint32_t timing_violations;    // Commands sent inside a datasheet wait period
+    uint32_t command_counts[256];  // Per-opcode command counts
+} st7789_emu_stats_t;
+
+/**
+ * @brief Attach the emulator to the mock transport and power it on
+ *
+ * GRAM starts black and the controller in its reset state (asleep,
+ * display off, 18-bit pixels, MADCTL 0).
+ */
+void st7789_emu_attach(void);
+
+/**
+ * @brief Detach from the mock transport
+ */
+void st7789_emu_detach(void);
+
+/**
+ * @brief Return the controller to its reset state without clearing counters
+ */
+void st7789_emu_reset(void);
+
+/**
+ * @brief Copy the counters into out
+ */
+void st7789_emu_get_stats(st7789_emu_stats_t *out);
+
+/**
+ * @brief Zero the counters
+ */
+void st7789_emu_reset_stats(void);
+
+/**
+ * @brief Estimate the wire time of the traffic counted so far
+ *
+ * Every byte takes 8 clock periods and every transaction adds a fixed
+ * setup cost (CS, DC and driver overhead).
+ *
+ * @param spi_hz SPI clock in Hz
+ * @param transaction_ns Fixed cost per transaction in nanoseconds
+ * @return Estimated time in microseconds
+ */
+uint64_t st7789_emu_estimate_us(uint32_t spi_hz, uint32_t transaction_ns);
+
+/**
+ * @brief Read a visible pixel as the panel would show it
+ *
+ * Applies vertical scrolling, display off and the MADCTL BGR bit.
+ *
+ * @param x Column, 0-239
+ * @param y Row, 0-239
+ * @return 0xRRGGBB, or 0 outside the panel
+ */
+uint32_t st7789_emu_get_pixel(uint16_t x, uint16_t y);
+
+/**
+ * @brief Read a pixel as RGB565, for comparing against drawn colors
+ */
+uint16_t st7789_emu_get_pixel565(uint16_t x, uint16_t y);
+
+/**
+ * @brief Write the visible 240x240 area as a binary PPM (P6)
+ *
+ * @return ESP_OK or ESP_FAIL if the file cannot be written
+ */
+esp_err_t st7789_emu_write_ppm(const char *path);
+
+/**
+ * @brief Compare the visible area against a PPM written earlier
+ *
+ * @param path Golden image
+ * @param mismatches Receives the number of differing pixels (may be NULL)
+ * @return ESP_OK if identical, ESP_FAIL if pixels differ, or
+ *         ESP_ERR_NOT_FOUND / ESP_ERR_INVALID_SIZE if the file is missing or
+ *         not a 240x240 P6 image
+ */
+esp_err_t st7789_emu_compare_ppm(const char *path, uint32_t *mismatches);
+
+#endif // ST7789_EMU_H
@@ -0,0 +1,556 @@
+#include "st7789.h"
+#include "st7789_priv.h"
+#include "esp_attr.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include <string.h>
+
+static const char *TAG = "ST7789_FB";
+
+// Dirty region, half-open: [x0, x1) x [y0, y1)
+typedef struct {
+    uint16_t x0, y0, x1, y1;
+} fb_rect_t;
+
+static st7789_fb_mode_t fb_mode = ST7789_FB_NONE;
+static uint16_t *fb_pixels;    // Panel byte order, ST7789_WIDTH pixels per row
+static uint8_t *fb_indices;    // Indexed modes: palette indices, high nibble first at 4 bits
+static uint16_t fb_index_stride;  // Bytes per row of fb_indices
+static uint16_t fb_rows;       // Rows held: ST7789_HEIGHT in full mode
+static uint16_t fb_top;        // First panel row held (always 0 in full mode)
+static fb_rect_t fb_dirty[ST7789_FB_MAX_DIRTY];
+static int fb_dirty_count;
+static st7789_fb_stats_t fb_stats;
+
+// Indexed modes: the palette as given and as sent (panel byte order)
+static uint16_t palette[ST7789_FB_PALETTE_SIZE];
+static uint16_t palette_be[ST7789_FB_PALETTE_SIZE];
+static bool palette_loaded;
+
+// Color to index lookups, direct-mapped on the color
+#define INDEX_CACHE_SIZE 64
+static struct {
+    uint16_t color;
+    uint8_t index;
+    bool valid;
+} index_cache[INDEX_CACHE_SIZE];
+
+// One expanded panel line; narrow regions stack several rows into it
+static DMA_ATTR uint16_t line_buf[ST7789_WIDTH];
+
+static bool fb_indexed(void) {
+    return fb_mode == ST7789_FB_INDEXED8 || fb_mode == ST7789_FB_INDEXED4;
+}
+
+static uint16_t palette_colors(void) {
+    return fb_mode == ST7789_FB_INDEXED4 ? 16 : ST7789_FB_PALETTE_SIZE;
+}
+
+/**
+ * @brief Load the default palette
+ *
+ * Entries 0-15 are the ST7789_* colors followed by greys and half-intensity
+ * primaries, so a 4-bit buffer draws the named colors exactly. Entries
+ * 16-231 are a 6x6x6 color cube and 232-255 a grey ramp.
+ */
+static void load_default_palette(void) {
+    static const uint16_t base[16] = {
+        ST7789_BLACK, ST7789_WHITE, ST7789_RED, ST7789_GREEN,
+        ST7789_BLUE, ST7789_YELLOW, ST7789_CYAN, ST7789_MAGENTA,
+        0x8410, 0xC618, 0x4208, 0x8000,   // Grey, light grey, dark grey, maroon
+        0x0400, 0x0010, 0xFD20, 0x8010,   // Dark green, navy, orange, purple
+    };
+    memcpy(palette, base, sizeof(base));
+    int i = 16;
+    for (int r = 0; r < 6; r++) {
+        for (int g = 0; g < 6; g++) {
+            for (int b = 0; b < 6; b++) {
+                palette[i++] = ((r * 31 / 5) << 11) | ((g * 63 / 5) << 5) | (b * 31 / 5);
+            }
+        }
+    }
+    for (int k = 0; k < 24; k++) {
+        uint8_t v = 8 + k * 10;   // 8..238, skipping black and white
+        palette[i++] = ((v >> 3) << 11) | ((v >> 2) << 5) | (v >> 3);
+    }
+    for (i = 0; i < ST7789_FB_PALETTE_SIZE; i++) {
+        palette_be[i] = to_be16(palette[i]);
+    }
+    memset(index_cache, 0, sizeof(index_cache));
+    palette_loaded = true;
+}
+
+// Closest palette entry, comparing channels on a common 6-bit scale
+static uint8_t nearest_index(uint16_t color) {
+    int r = (color >> 11) << 1, g = (color >> 5) & 0x3F, b = (color & 0x1F) << 1;
+    uint8_t best = 0;
+    uint32_t best_dist = UINT32_MAX;
+    for (uint16_t i = 0; i < palette_colors(); i++) {
+        uint16_t p = palette[i];
+        int dr = r - ((p >> 11) << 1);
+        int dg = g - ((p >> 5) & 0x3F);
+        int db = b - ((p & 0x1F) << 1);
+        uint32_t dist = dr * dr + dg * dg + db * db;
+        if (dist < best_dist) {
+            best_dist = dist;
+            best = i;
+            if (dist == 0) break;
+        }
+    }
+    return best;
+}
+
+static uint8_t color_index(uint16_t color) {
+    unsigned slot = (color ^ (color >> 6) ^ (color >> 12)) % INDEX_CACHE_SIZE;
+    if (!index_cache[slot].valid || index_cache[slot].color != color) {
+        index_cache[slot].color = color;
+        index_cache[slot].index = nearest_index(color);
+        index_cache[slot].valid = true;
+    }
+    return index_cache[slot].index;
+}
+
+// Write n copies of an index starting at (x, y)
+static void put_index_run(uint16_t x, uint16_t y, uint16_t n, uint8_t index) {
+    uint8_t *row = fb_indices + (size_t)y * fb_index_stride;
+    if (fb_mode == ST7789_FB_INDEXED8) {
+        memset(row + x, index, n);
+        return;
+    }
+    if (x & 1) {
+        row[x >> 1] = (row[x >> 1] & 0xF0) | index;
+        x++;
+        n--;
+    }
+    memset(row + (x >> 1), (index << 4) | index, n >> 1);
+    if (n & 1) {
+        uint8_t *last = row + ((x + n) >> 1);
+        *last = (*last & 0x0F) | (index << 4);
+    }
+}
+
+// Expand one row of a region through the palette into dst
+static void expand_row(uint16_t *dst, uint16_t x, uint16_t y, uint16_t w) {
+    const uint8_t *row = fb_indices + (size_t)y * fb_index_stride;
+    if (fb_mode == ST7789_FB_INDEXED8) {
+        for (uint16_t c = 0; c < w; c++) {
+            dst[c] = palette_be[row[x + c]];
+        }
+        return;
+    }
+    for (uint16_t c = 0; c < w; c++, x++) {
+        uint8_t pair = row[x >> 1];
+        dst[c] = palette_be[(x & 1) ? (pair & 0x0F) : (pair >> 4)];
+    }
+}
+
+// Send an indexed region in one window, expanding a line buffer at a time
+static void flush_indexed_rect(const fb_rect_t *r) {
+    uint16_t w = r->x1 - r->x0;
+    size_t used = 0;
+    st7789_bus_set_window(r->x0, r->y0, w, r->y1 - r->y0);
+    for (uint16_t y = r->y0; y < r->y1; y++) {
+        if (used + w > ST7789_WIDTH) {
+            st7789_bus_write_pixels(line_buf, used);
+            used = 0;
+        }
+        expand_row(line_buf + used, r->x0, y, w);
+        used += w;
+    }
+    st7789_bus_write_pixels(line_buf, used);
+    st7789_bus_end_pixels();
+}
+
+static uint32_t rect_area(const fb_rect_t *r) {
+    return (uint32_t)(r->x1 - r->x0) * (r->y1 - r->y0);
+}
+
+static fb_rect_t rect_union(const fb_rect_t *a, const fb_rect_t *b) {
+    fb_rect_t u = {
+        .x0 = a->x0 < b->x0 ? a->x0 : b->x0,
+        .y0 = a->y0 < b->y0 ? a->y0 : b->y0,
+        .x1 = a->x1 > b->x1 ? a->x1 : b->x1,
+        .y1 = a->y1 > b->y1 ? a->y1 : b->y1,
+    };
+    return u;
+}
+
+// Pixels a merge would send that neither rectangle covers
+static uint32_t merge_waste(const fb_rect_t *a, const fb_rect_t *b) {
+    fb_rect_t u = rect_union(a, b);
+    uint32_t covered = rect_area(a) + rect_area(b);
+    uint16_t ix0 = a->x0 > b->x0 ? a->x0 : b->x0;
+    uint16_t iy0 = a->y0 > b->y0 ? a->y0 : b->y0;
+    uint16_t ix1 = a->x1 < b->x1 ? a->x1 : b->x1;
+    uint16_t iy1 = a->y1 < b->y1 ? a->y1 : b->y1;
+    if (ix0 < ix1 && iy0 < iy1) {
+        covered -= (uint32_t)(ix1 - ix0) * (iy1 - iy0);
+    }
+    return rect_area(&u) - covered;
+}
+
+// Send every dirty region to the panel and empty the set
+static void flush_dirty(void) {
+    uint64_t start_bytes = st7789_bus_bytes;
+    for (int i = 0; i < fb_dirty_count; i++) {
+        const fb_rect_t *r = &fb_dirty[i];
+        uint16_t w = r->x1 - r->x0;
+        uint16_t h = r->y1 - r->y0;
+        if (fb_indexed()) {
+            flush_indexed_rect(r);
+        } else {
+            const uint16_t *src = fb_pixels + (size_t)(r->y0 - fb_top) * ST7789_WIDTH + r->x0;
+            st7789_bus_blit(r->x0, r->y0, w, h, src, ST7789_WIDTH, ST7789_PIXELS_BE);
+        }
+    }
+    // Measured, so it reflects the color depth and the windows the cache skipped
+    uint32_t bytes = (uint32_t)(st7789_bus_bytes - start_bytes);
+
+    fb_stats.flushes++;
+    fb_stats.last_flush_rects = fb_dirty_count;
+    fb_stats.last_flush_bytes = bytes;
+    fb_stats.total_flush_bytes += bytes;
+    fb_dirty_count = 0;
+}
+
+/**
+ * @brief Add a region to the dirty set, merging where it pays off
+ *
+ * A new rectangle is folded into any existing one when the union wastes no
+ * more than the allowed slack, which covers overlaps, containment and
+ * adjacent spans. The merged result is re-checked against the rest so
+ * chains collapse.
+ * 
+ * The full and indexed buffers always mirror the panel, so they may resend up to
+ * ST7789_FB_MERGE_SLACK untouched pixels to save a window, and a full set
+ * is merged with whichever entry wastes the least. A band only holds valid
+ * pixels inside its dirty rectangles, so it merges losslessly and flushes
+ * when the set is full.
+ */
+static void dirty_add(fb_rect_t r) {
+    uint32_t slack = (fb_mode != ST7789_FB_BAND) ? ST7789_FB_MERGE_SLACK : 0;
+    bool merged;
+    do {
+        merged = false;
+        for (int i = 0; i < fb_dirty_count; i++) {
+            if (merge_waste(&fb_dirty[i], &r) <= slack) {
+                r = rect_union(&fb_dirty[i], &r);
+                fb_dirty[i] = fb_dirty[--fb_dirty_count];
+                merged = true;
+                break;
+            }
+        }
+    } while (merged);
+
+    if (fb_dirty_count < ST7789_FB_MAX_DIRTY) {
+        fb_dirty[fb_dirty_count++] = r;
+        return;
+    }
+    
+    if (fb_mode == ST7789_FB_BAND) {
+        flush_dirty();
+        fb_dirty[fb_dirty_count++] = r;
+        return;
+    }
+
+    int best = 0;
+    uint32_t best_waste = UINT32_MAX;
+    for (int i = 0; i < fb_dirty_count; i++) {
+        uint32_t waste = merge_waste(&fb_dirty[i], &r);
+        if (waste < best_waste) {
+            best_waste = waste;
+            best = i;
+        }
+    }
+    r = rect_union(&fb_dirty[best], &r);
+    fb_dirty[best] = fb_dirty[--fb_dirty_count];
+    dirty_add(r);
+}
+
+/**
+ * @brief Clip a draw and make sure the buffer covers its rows
+ *
+ * In band mode a draw outside the held rows flushes the band and moves it
+ * so the draw starts on its first row (or as close as the panel bottom
+ * allows). Draws taller than the band flush it and are handed back to the
+ * caller to send directly, which keeps panel writes in call order.
+ *
+ * @return false if the caller must draw to the panel itself
+ */
+static bool prepare_draw(uint16_t x, uint16_t y, uint16_t *w, uint16_t *h) {
+    if (*w > ST7789_WIDTH - x) *w = ST7789_WIDTH - x;
+    if (*h > ST7789_HEIGHT - y) *h = ST7789_HEIGHT - y;
+
+    if (fb_mode != ST7789_FB_BAND) {
+        return true;
+    }
+
+    if (*h > fb_rows) {
+        if (fb_dirty_count > 0) {
+            flush_dirty();
+        }
+        fb_stats.passthrough_draws++;
+        return false;
+    }
+    if (y < fb_top || y + *h > fb_top + fb_rows) {
+        if (fb_dirty_count > 0) {
+            flush_dirty();
+        }
+        fb_top = (y + fb_rows > ST7789_HEIGHT) ? ST7789_HEIGHT - fb_rows : y;
+        fb_stats.band_moves++;
+    }
+    return true;
+}
+
+bool st7789_fb_active(void) {
+    return fb_mode != ST7789_FB_NONE;
+}
+
+bool st7789_fb_fill_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
+    if (fb_mode == ST7789_FB_NONE) return false;
+    if (x >= ST7789_WIDTH || y >= ST7789_HEIGHT || w == 0 || h == 0) return true;
+    if (!prepare_draw(x, y, &w, &h)) return false;
+
+    if (fb_indexed()) {
+        uint8_t index = color_index(color);
+        for (uint16_t r = 0; r < h; r++) {
+            put_index_run(x, y + r, w, index);
+        }
+        dirty_add((fb_rect_t){ x, y, x + w, y + h });
+        return true;
+    }
+
+    uint16_t be = to_be16(color);
+    uint16_t *row = fb_pixels + (size_t)(y - fb_top) * ST7789_WIDTH + x;
+    for (uint16_t r = 0; r < h; r++, row += ST7789_WIDTH) {
+        for (uint16_t c = 0; c < w; c++) {
+            row[c] = be;
+        }
+    }
+
+    dirty_add((fb_rect_t){ x, y, x + w, y + h });
+    return true;
+}
+
+bool st7789_fb_blit(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                    const uint16_t *pixels, size_t stride, st7789_pixel_order_t order) {
+    if (fb_mode == ST7789_FB_NONE) return false;
+    if (pixels == NULL || x >= ST7789_WIDTH || y >= ST7789_HEIGHT || w == 0 || h == 0) return true;
+    if (!prepare_draw(x, y, &w, &h)) return false;
+
+    if (fb_indexed()) {
+        for (uint16_t r = 0; r < h; r++, pixels += stride) {
+            // Runs of one color are common (text, icons), so map each run once
+            uint16_t c = 0;
+            while (c < w) {
+                uint16_t color = pixels[c];
+                uint16_t run = 1;
+                while (c + run < w && pixels[c + run] == color) run++;
+                if (order == ST7789_PIXELS_BE) {
+                    color = to_be16(color);
+                }
+                put_index_run(x + c, y + r, run, color_index(color));
+                c += run;
+            }
+        }
+        dirty_add((fb_rect_t){ x, y, x + w, y + h });
+        return true;
+    }
+
+    uint16_t *row = fb_pixels + (size_t)(y - fb_top) * ST7789_WIDTH + x;
+    for (uint16_t r = 0; r < h; r++, row += ST7789_WIDTH, pixels += stride) {
+        if (order == ST7789_PIXELS_BE) {
+            memcpy(row, pixels, w * sizeof(uint16_t));
+        } else {
+            st7789_swap_copy(row, pixels, w);
+        }
+    }
+
+    dirty_add((fb_rect_t){ x, y, x + w, y + h });
+    return true;
+}
+
+static bool fb_indexed_mode(st7789_fb_mode_t mode) {
+    return mode == ST7789_FB_INDEXED8 || mode == ST7789_FB_INDEXED4;
+}
+
+static esp_err_t enable_indexed(st7789_fb_mode_t mode) {
+    uint16_t stride = (mode == ST7789_FB_INDEXED8) ? ST7789_WIDTH : ST7789_WIDTH / 2;
+    size_t size = (size_t)stride * ST7789_HEIGHT;
+    // Only the CPU reads it; flushes go out through line_buf
+    uint8_t *indices = heap_caps_malloc(size, MALLOC_CAP_8BIT);
+    if (indices == NULL) {
+        ESP_LOGE(TAG, "Cannot allocate %u byte framebuffer", (unsigned)size);
+        return ESP_ERR_NO_MEM;
+    }
+    memset(indices, 0, size);
+    if (!palette_loaded) {
+        load_default_palette();
+    }
+
+    fb_indices = indices;
+    fb_index_stride = stride;
+    fb_rows = ST7789_HEIGHT;
+    fb_top = 0;
+    fb_dirty_count = 0;
+    fb_mode = mode;
+    // The 16-entry cache of the other depth may point past entry 15
+    memset(index_cache, 0, sizeof(index_cache));
+
+    dirty_add((fb_rect_t){ 0, 0, ST7789_WIDTH, ST7789_HEIGHT });
+    ESP_LOGI(TAG, "%u-bit indexed framebuffer enabled: %u bytes",
+             mode == ST7789_FB_INDEXED8 ? 8 : 4, (unsigned)size);
+    return ESP_OK;
+}
+
+/**
+ * @brief Switch draw calls to render into RAM
+ *
+ * ST7789_FB_FULL holds the whole 240x240 panel (115,200 bytes) and only
+ * touches the bus in st7789_flush(). It starts black and is treated as the
+ * panel image, so the first flush sends every pixel. ST7789_FB_BAND holds band_rows
+ * full-width rows and acts as a write-combining window: overlapping draws
+ * within the band are merged, and it is flushed automatically when a draw
+ * lands elsewhere. Only drawn pixels are ever sent from a band. Enabling again replaces the current buffer after
+ * flushing it.
+ *
+ * ST7789_FB_INDEXED8 and ST7789_FB_INDEXED4 behave like ST7789_FB_FULL but
+ * store a palette index per pixel (57,600 or 28,800 bytes). Draw colors are
+ * mapped to the nearest palette entry, and flushes expand each dirty region
+ * through the palette a line at a time. The buffer starts as index 0.
+ *
+ * @param mode Buffer mode; ST7789_FB_NONE is the same as st7789_fb_disable()
+ * @param band_rows Rows held in band mode, 0 for ST7789_FB_BAND_ROWS
+ * @return ESP_OK, ESP_ERR_INVALID_ARG for a bad row count, or
+ *         ESP_ERR_NO_MEM if the buffer cannot be allocated
+ */
+esp_err_t st7789_fb_enable(st7789_fb_mode_t mode, uint16_t band_rows) {
+    st7789_async_sync();
+    st7789_fb_disable();
+    if (mode == ST7789_FB_NONE) {
+        return ESP_OK;
+    }
+
+    if (fb_indexed_mode(mode)) {
+        return enable_indexed(mode);
+    }
+
+    uint16_t rows = ST7789_HEIGHT;
+    if (mode == ST7789_FB_BAND) {
+        rows = band_rows ? band_rows : ST7789_FB_BAND_ROWS;
+        if (rows > ST7789_HEIGHT) {
+            return ESP_ERR_INVALID_ARG;
+        }
+    }
+
+    size_t size = (size_t)ST7789_WIDTH * rows * sizeof(uint16_t);
+    // DMA-capable memory lets full-width regions go out without a copy
+    uint16_t *pixels = heap_caps_malloc(size, MALLOC_CAP_DMA);
+    if (pixels == NULL) {
+        pixels = heap_caps_malloc(size, MALLOC_CAP_8BIT);
+    }
+    if (pixels == NULL) {
+        ESP_LOGE(TAG, "Cannot allocate %u byte framebuffer", (unsigned)size);
+        return ESP_ERR_NO_MEM;
+    }
+    memset(pixels, 0, size);
+
+    fb_pixels = pixels;
+    fb_rows = rows;
+    fb_top = 0;
+    fb_dirty_count = 0;
+    fb_mode = mode;
+    
+    // The full buffer is authoritative and starts black like the panel after
+    // st7789_init(); the first flush sends it whole so both are in sync
+    if (mode == ST7789_FB_FULL) {
+        dirty_add((fb_rect_t){ 0, 0, ST7789_WIDTH, ST7789_HEIGHT });
+    }
+    ESP_LOGI(TAG, "%s framebuffer enabled: %u rows, %u bytes",
+             mode == ST7789_FB_FULL ? "Full" : "Band", rows, (unsigned)size);
+    return ESP_OK;
+}
+
+/**
+ * @brief Flush pending regions and return to immediate mode
+ */
+void st7789_fb_disable(void) {
+    st7789_async_sync();
+    if (fb_mode == ST7789_FB_NONE) {
+        return;
+    }
+    if (fb_dirty_count > 0) {
+        flush_dirty();
+    }
+    fb_mode = ST7789_FB_NONE;
+    heap_caps_free(fb_pixels);
+    heap_caps_free(fb_indices);
+    fb_pixels = NULL;
+    fb_indices = NULL;
+}
+
+/**
+ * @brief Replace palette entries used by the indexed framebuffer modes
+ *
+ * Pixels keep their indices, so every pixel drawn with a changed entry
+ * takes the new color at the next flush: a theme change costs one full
+ * flush and no redraw. The palette can be set before the buffer is enabled
+ * and survives st7789_fb_disable(). Later draws map their colors against the
+ * new entries, so keep drawing with the current theme's colors.
+ *
+ * @param first First entry to replace
+ * @param colors RGB565 colors, or NULL to restore the default palette (first
+ *               and count are then ignored)
+ * @param count Number of entries
+ * @return ESP_OK, or ESP_ERR_INVALID_ARG if the range runs past entry 255
+ */
+esp_err_t st7789_fb_set_palette(uint16_t first, const uint16_t *colors, uint16_t count) {
+    if (colors != NULL && first + count > ST7789_FB_PALETTE_SIZE) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    st7789_async_sync();
+    if (colors == NULL) {
+        load_default_palette();
+    } else {
+        if (!palette_loaded) {
+            load_default_palette();
+        }
+        for (uint16_t i = 0; i < count; i++) {
+            palette[first + i] = colors[i];
+            palette_be[first + i] = to_be16(colors[i]);
+        }
+        memset(index_cache, 0, sizeof(index_cache));
+    }
+
+    if (fb_indexed()) {
+        fb_dirty_count = 0;
+        dirty_add((fb_rect_t){ 0, 0, ST7789_WIDTH, ST7789_HEIGHT });
+    }
+    return ESP_OK;
+}
+
+/**
+ * @brief Send all changed regions to the panel
+ *
+ * @return ESP_OK, or ESP_ERR_INVALID_STATE if no framebuffer is enabled
+ */
+esp_err_t st7789_flush(void) {
+    if (fb_mode == ST7789_FB_NONE) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (st7789_async_flush()) {
+        return ESP_OK;
+    }
+    int64_t start = ST7789_STATS_OP_BEGIN();
+    flush_dirty();
+    ST7789_STATS_OP_END(ST7789_OP_FLUSH, start);
+    return ESP_OK;
+}
+
+void st7789_fb_get_stats(st7789_fb_stats_t *stats) {
+    *stats = fb_stats;
+}
+
+void st7789_fb_reset_stats(void) {
+    memset(&fb_stats, 0, sizeof(fb_stats));
+}
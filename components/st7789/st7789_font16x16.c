@@ -0,0 +1,532 @@
+// Generated by tools/st7789_font_gen.py from tools/font16x16.txt. Do not edit.
+
+#include "st7789_priv.h"
+
+// Inked rows of each glyph, two bytes per row, most significant bit leftmost
+const uint8_t st7789_font16x16_rows[] = {
+    // '!' (33)
+    0x01, 0x80, 0x07, 0xE0, 0x07, 0xE0, 0x0F, 0xF0,
+    0x0F, 0xF0, 0x07, 0xE0, 0x07, 0xE0, 0x03, 0xC0,
+    0x03, 0xC0, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xC0, 0x03, 0xC0,
+    // '"' (34)
+    0x18, 0x60, 0x3C, 0xF0, 0x3C, 0xF0, 0x18, 0x60,
+    // '#' (35)
+    0x18, 0x60, 0x3C, 0xF0, 0x3C, 0xF0, 0x7C, 0xF8,
+    0xFF, 0xFC, 0xFF, 0xFC, 0x3C, 0xF0, 0x3C, 0xF0,
+    0xFF, 0xFC, 0xFF, 0xFC, 0x7C, 0xF8, 0x3C, 0xF0,
+    0x3C, 0xF0, 0x18, 0x60,
+    // '$' (36)
+    0x06, 0x00, 0x1F, 0x80, 0x1F, 0xF0, 0x7F, 0xF0,
+    0xF0, 0x00, 0xF0, 0x00, 0x7F, 0x80, 0x1F, 0xE0,
+    0x00, 0xF0, 0x00, 0xF0, 0xFF, 0xE0, 0xFF, 0x80,
+    0x1F, 0x80, 0x06, 0x00,
+    // '%' (37)
+    0x70, 0x03, 0xF8, 0x07, 0xDC, 0x0E, 0xDC, 0x1C,
+    0xF8, 0x38, 0x70, 0x70, 0x00, 0xE0, 0x01, 0xC0,
+    0x03, 0x80, 0x07, 0x00, 0x0E, 0x3E, 0x1C, 0x7E,
+    0x38, 0x7B, 0x70, 0x7B, 0xE0, 0x3E,
+    // '&' (38)
+    0x07, 0x80, 0x1F, 0xE0, 0x3C, 0xF0, 0x3C, 0xF0,
+    0x0F, 0xC0, 0x0F, 0x80, 0x1F, 0x1C, 0x7F, 0x3C,
+    0x73, 0xF8, 0xF1, 0xF0, 0xF0, 0xF0, 0x78, 0x78,
+    0x7F, 0x3C, 0x1F, 0x1C,
+    // '\'' (39)
+    0x18, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x78, 0x00,
+    0xF8, 0x00, 0xE0, 0x00,
+    // '(' (40)
+    0x01, 0xC0, 0x07, 0xC0, 0x07, 0x80, 0x1E, 0x00,
+    0x1E, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00,
+    0x3C, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x07, 0x80,
+    0x07, 0xC0, 0x01, 0xC0,
+    // ')' (41)
+    0x38, 0x00, 0x3E, 0x00, 0x1E, 0x00, 0x07, 0x80,
+    0x07, 0x80, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+    0x03, 0xC0, 0x07, 0x80, 0x07, 0x80, 0x1E, 0x00,
+    0x3E, 0x00, 0x38, 0x00,
+    // '*' (42)
+    0x38, 0x1C, 0x3E, 0x7C, 0x0F, 0xF0, 0x0F, 0xF0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0F, 0xF0,
+    0x3E, 0x7C, 0x38, 0x1C,
+    // '+' (43)
+    0x06, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x1F, 0x80,
+    0xFF, 0xF0, 0xFF, 0xF0, 0x1F, 0x80, 0x0F, 0x00,
+    0x0F, 0x00, 0x06, 0x00,
+    // ',' (44)
+    0x07, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x38, 0x00,
+    // '-' (45)
+    0xFF, 0xF0, 0xFF, 0xF0,
+    // '.' (46)
+    0x03, 0xC0, 0x07, 0xE0, 0x07, 0xE0, 0x03, 0xC0,
+    // '/' (47)
+    0x00, 0x1C, 0x00, 0x7C, 0x00, 0x78, 0x01, 0xE0,
+    0x01, 0xE0, 0x07, 0x80, 0x07, 0x80, 0x1E, 0x00,
+    0x1E, 0x00, 0x78, 0x00, 0x78, 0x00, 0xE0, 0x00,
+    0xE0, 0x00, 0xC0, 0x00,
+    // '0' (48)
+    0x07, 0xE0, 0x1F, 0xF8, 0x3C, 0x3C, 0x70, 0x1E,
+    0x60, 0x0F, 0x60, 0x0F, 0x60, 0x0F, 0x60, 0x0F,
+    0x60, 0x0F, 0x60, 0x0F, 0x70, 0x1E, 0x3C, 0x3C,
+    0x1F, 0xF8, 0x07, 0xE0,
+    // '1' (49)
+    0x01, 0xC0, 0x03, 0xC0, 0x07, 0xC0, 0x0D, 0xC0,
+    0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0,
+    0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0,
+    0x7F, 0xF0, 0x7F, 0xF0,
+    // '2' (50)
+    0x07, 0xE0, 0x1F, 0xF8, 0x3C, 0x3C, 0x70, 0x1E,
+    0x60, 0x0F, 0x60, 0x07, 0x00, 0x07, 0x00, 0x0E,
+    0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0,
+    0x7F, 0xFF, 0x7F, 0xFF,
+    // '3' (51)
+    0x07, 0xE0, 0x1F, 0xF8, 0x3C, 0x3C, 0x70, 0x0E,
+    0x00, 0x07, 0x00, 0x07, 0x03, 0xFE, 0x03, 0xFE,
+    0x00, 0x07, 0x00, 0x07, 0x70, 0x0E, 0x3C, 0x3C,
+    0x1F, 0xF8, 0x07, 0xE0,
+    // '4' (52)
+    0x00, 0x0E, 0x00, 0x1E, 0x00, 0x3E, 0x00, 0x6E,
+    0x00, 0xCE, 0x01, 0x8E, 0x03, 0x0E, 0x06, 0x0E,
+    0x7F, 0xFF, 0x7F, 0xFF, 0x00, 0x0E, 0x00, 0x0E,
+    0x00, 0x0E, 0x00, 0x0E,
+    // '5' (53)
+    0x7F, 0xFF, 0x7F, 0xFF, 0x70, 0x00, 0x70, 0x00,
+    0x70, 0x00, 0x7F, 0xE0, 0x7F, 0xF8, 0x00, 0x3C,
+    0x00, 0x0E, 0x00, 0x07, 0x70, 0x0E, 0x3C, 0x3C,
+    0x1F, 0xF8, 0x07, 0xE0,
+    // '6' (54)
+    0x07, 0xE0, 0x1F, 0xF8, 0x3C, 0x3C, 0x70, 0x0E,
+    0x70, 0x07, 0x70, 0x00, 0x7F, 0xE0, 0x7F, 0xF8,
+    0x70, 0x3C, 0x70, 0x0E, 0x70, 0x0E, 0x3C, 0x3C,
+    0x1F, 0xF8, 0x07, 0xE0,
+    // '7' (55)
+    0x7F, 0xFF, 0x7F, 0xFF, 0x00, 0x07, 0x00, 0x0E,
+    0x00, 0x0E, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x38,
+    0x00, 0x38, 0x00, 0x70, 0x00, 0x70, 0x00, 0xE0,
+    0x00, 0xE0, 0x01, 0xC0,
+    // '8' (56)
+    0x07, 0xE0, 0x1F, 0xF8, 0x3C, 0x3C, 0x70, 0x0E,
+    0x70, 0x0E, 0x3C, 0x3C, 0x1F, 0xF8, 0x1F, 0xF8,
+    0x3C, 0x3C, 0x70, 0x0E, 0x70, 0x0E, 0x3C, 0x3C,
+    0x1F, 0xF8, 0x07, 0xE0,
+    // '9' (57)
+    0x07, 0xE0, 0x1F, 0xF8, 0x3C, 0x3C, 0x70, 0x0E,
+    0x70, 0x0E, 0x3C, 0x0E, 0x1F, 0xFE, 0x07, 0xFE,
+    0x00, 0x07, 0x00, 0x07, 0x70, 0x0E, 0x3C, 0x3C,
+    0x1F, 0xF8, 0x07, 0xE0,
+    // ':' (58)
+    0x01, 0xC0, 0x03, 0xE0, 0x03, 0xE0, 0x01, 0xC0,
+    0x00, 0x00, 0x01, 0xC0, 0x03, 0xE0, 0x03, 0xE0,
+    0x01, 0xC0,
+    // ';' (59)
+    0x06, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x06, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x38, 0x00,
+    // '<' (60)
+    0x01, 0xC0, 0x07, 0xC0, 0x07, 0x80, 0x1E, 0x00,
+    0x1E, 0x00, 0x78, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+    0x78, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x07, 0x80,
+    0x07, 0xC0, 0x01, 0xC0,
+    // '=' (61)
+    0xFF, 0xF0, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0xFF, 0xF0,
+    // '>' (62)
+    0x38, 0x00, 0x3E, 0x00, 0x1E, 0x00, 0x07, 0x80,
+    0x07, 0x80, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0xF0,
+    0x01, 0xE0, 0x07, 0x80, 0x07, 0x80, 0x1E, 0x00,
+    0x3E, 0x00, 0x38, 0x00,
+    // '?' (63)
+    0x1F, 0x80, 0x7F, 0xE0, 0xF9, 0xE0, 0xE0, 0xF0,
+    0x00, 0xF0, 0x01, 0xE0, 0x01, 0xE0, 0x07, 0x80,
+    0x0F, 0x80, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0x00, 0x0F, 0x00,
+    // '@' (64)
+    0x1F, 0xE0, 0x7F, 0xF8, 0x78, 0x38, 0xF0, 0x3C,
+    0xF1, 0xFC, 0xF3, 0xFC, 0xF3, 0xFC, 0xF3, 0xFC,
+    0xF3, 0xFC, 0xF1, 0xF8, 0xF0, 0x00, 0x78, 0x00,
+    0x7F, 0xC0, 0x1F, 0xC0,
+    // 'A' (65)
+    0x03, 0x80, 0x07, 0xC0, 0x0E, 0xE0, 0x1C, 0x70,
+    0x1C, 0x70, 0x38, 0x38, 0x38, 0x1C, 0x70, 0x1C,
+    0x7F, 0xFE, 0x7F, 0xFE, 0xE0, 0x07, 0xE0, 0x07,
+    0xE0, 0x07, 0xE0, 0x07,
+    // 'B' (66)
+    0xFF, 0xE0, 0xFF, 0xF8, 0x7E, 0x78, 0x3C, 0x3C,
+    0x3C, 0x3C, 0x3E, 0x78, 0x3F, 0xF0, 0x3F, 0xF0,
+    0x3E, 0x78, 0x3C, 0x3C, 0x3C, 0x3C, 0x7E, 0x78,
+    0xFF, 0xF8, 0xFF, 0xE0,
+    // 'C' (67)
+    0x07, 0xE0, 0x1F, 0xF8, 0x3C, 0x3C, 0x70, 0x1E,
+    0x70, 0x0F, 0x70, 0x07, 0x70, 0x00, 0x70, 0x00,
+    0x70, 0x07, 0x70, 0x0F, 0x70, 0x1E, 0x3C, 0x3C,
+    0x1F, 0xF8, 0x07, 0xE0,
+    // 'D' (68)
+    0x7F, 0xE0, 0x7F, 0xF8, 0x70, 0x3C, 0x70, 0x1E,
+    0x70, 0x0F, 0x70, 0x0F, 0x70, 0x0F, 0x70, 0x0F,
+    0x70, 0x0F, 0x70, 0x0F, 0x70, 0x1E, 0x70, 0x3C,
+    0x7F, 0xF8, 0x7F, 0xE0,
+    // 'E' (69)
+    0x7F, 0xFF, 0x7F, 0xFF, 0x70, 0x00, 0x70, 0x00,
+    0x70, 0x00, 0x7F, 0xE0, 0x7F, 0xE0, 0x7F, 0xE0,
+    0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
+    0x7F, 0xFF, 0x7F, 0xFF,
+    // 'F' (70)
+    0xFF, 0xF8, 0xFF, 0xFC, 0x7E, 0x1C, 0x3C, 0x0C,
+    0x3C, 0xC0, 0x3C, 0xC0, 0x3F, 0xC0, 0x3F, 0xC0,
+    0x3C, 0xC0, 0x3C, 0xC0, 0x3C, 0x00, 0x7E, 0x00,
+    0xFF, 0x00, 0xFF, 0x00,
+    // 'G' (71)
+    0x07, 0xE0, 0x1F, 0xF8, 0x1E, 0x7C, 0x78, 0x1C,
+    0x78, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+    0xF0, 0xF8, 0x78, 0xFC, 0x78, 0x3C, 0x1E, 0x3C,
+    0x1F, 0xFC, 0x07, 0xF8,
+    // 'H' (72)
+    0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07,
+    0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07,
+    0xE0, 0x07, 0xE0, 0x07,
+    // 'I' (73)
+    0x0F, 0xF0, 0x0F, 0xF0, 0x01, 0xC0, 0x01, 0xC0,
+    0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0,
+    0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0,
+    0x0F, 0xF0, 0x0F, 0xF0,
+    // 'J' (74)
+    0x03, 0xFC, 0x03, 0xFC, 0x01, 0xF8, 0x00, 0xF0,
+    0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
+    0x60, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x79, 0xE0,
+    0x7F, 0xE0, 0x1F, 0x80,
+    // 'K' (75)
+    0xF8, 0x18, 0xFC, 0x3C, 0x7C, 0x3C, 0x3C, 0x78,
+    0x3C, 0x78, 0x3C, 0xE0, 0x3F, 0xC0, 0x3F, 0xC0,
+    0x3C, 0xE0, 0x3C, 0x78, 0x3C, 0x78, 0x7C, 0x3C,
+    0xFC, 0x3C, 0xF8, 0x18,
+    // 'L' (76)
+    0xFF, 0x00, 0xFF, 0x00, 0x7E, 0x00, 0x3C, 0x00,
+    0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00,
+    0x3C, 0x0C, 0x3C, 0x1C, 0x3C, 0x1C, 0x7E, 0x7C,
+    0xFF, 0xFC, 0xFF, 0xF8,
+    // 'M' (77)
+    0xE0, 0x07, 0xF0, 0x0F, 0xF8, 0x1F, 0xFC, 0x3F,
+    0xEE, 0x77, 0xE7, 0xE7, 0xE3, 0xC7, 0xE1, 0x87,
+    0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07,
+    0xE0, 0x07, 0xE0, 0x07,
+    // 'N' (78)
+    0xE0, 0x07, 0xF0, 0x07, 0xF8, 0x07, 0xFC, 0x07,
+    0xEE, 0x07, 0xE7, 0x07, 0xE3, 0x87, 0xE1, 0xC7,
+    0xE0, 0xE7, 0xE0, 0x77, 0xE0, 0x3F, 0xE0, 0x1F,
+    0xE0, 0x0F, 0xE0, 0x07,
+    // 'O' (79)
+    0x07, 0x80, 0x1F, 0xE0, 0x1C, 0xE0, 0x78, 0x78,
+    0x78, 0x78, 0xF0, 0x3C, 0xF0, 0x3C, 0xF0, 0x3C,
+    0xF0, 0x3C, 0x78, 0x78, 0x78, 0x78, 0x1C, 0xE0,
+    0x1F, 0xE0, 0x07, 0x80,
+    // 'P' (80)
+    0x7F, 0xE0, 0x7F, 0xF8, 0x70, 0x3C, 0x70, 0x0E,
+    0x70, 0x0E, 0x70, 0x3C, 0x7F, 0xF8, 0x7F, 0xE0,
+    0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
+    0x70, 0x00, 0x70, 0x00,
+    // 'Q' (81)
+    0x1F, 0x80, 0x7F, 0xE0, 0x79, 0xE0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF1, 0xF0,
+    0xF1, 0xF0, 0x73, 0xE0, 0x7F, 0xC0, 0x1F, 0xC0,
+    0x07, 0xF0, 0x01, 0xF0,
+    // 'R' (82)
+    0x7F, 0xE0, 0x7F, 0xF8, 0x70, 0x3C, 0x70, 0x0E,
+    0x70, 0x0E, 0x70, 0x3C, 0x7F, 0xF8, 0x7F, 0xE0,
+    0x73, 0x80, 0x71, 0xC0, 0x70, 0xE0, 0x70, 0x70,
+    0x70, 0x38, 0x70, 0x1C,
+    // 'S' (83)
+    0x07, 0xE0, 0x1F, 0xF8, 0x3C, 0x3C, 0x70, 0x0E,
+    0x70, 0x07, 0x38, 0x00, 0x1F, 0xE0, 0x07, 0xF8,
+    0x00, 0x1C, 0x70, 0x0E, 0x70, 0x0E, 0x3C, 0x3C,
+    0x1F, 0xF8, 0x07, 0xE0,
+    // 'T' (84)
+    0x7F, 0xFF, 0x7F, 0xFF, 0x01, 0xC0, 0x01, 0xC0,
+    0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0,
+    0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0,
+    0x01, 0xC0, 0x01, 0xC0,
+    // 'U' (85)
+    0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07,
+    0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07,
+    0xE0, 0x07, 0xE0, 0x07, 0x70, 0x0E, 0x3C, 0x3C,
+    0x1F, 0xF8, 0x07, 0xE0,
+    // 'V' (86)
+    0x60, 0x60, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0x79, 0xE0, 0x7F, 0xE0, 0x1F, 0x80,
+    0x1F, 0x80, 0x06, 0x00,
+    // 'W' (87)
+    0x60, 0x18, 0xF0, 0x3C, 0xF0, 0x3C, 0xF0, 0x3C,
+    0xF0, 0x3C, 0xF0, 0x3C, 0xF3, 0x3C, 0xF3, 0x3C,
+    0xFF, 0xFC, 0xFF, 0xFC, 0xFC, 0xFC, 0xF8, 0x7C,
+    0xF8, 0x7C, 0x60, 0x18,
+    // 'X' (88)
+    0x60, 0x18, 0xF0, 0x3C, 0xF0, 0x3C, 0x78, 0x78,
+    0x78, 0x78, 0x1C, 0xE0, 0x1F, 0xE0, 0x0F, 0xC0,
+    0x0F, 0xC0, 0x1F, 0xE0, 0x1C, 0xE0, 0x78, 0x78,
+    0xF8, 0x7C, 0xE0, 0x1C,
+    // 'Y' (89)
+    0xE0, 0x07, 0x70, 0x0E, 0x38, 0x1C, 0x1C, 0x38,
+    0x0E, 0x70, 0x07, 0xE0, 0x03, 0xC0, 0x01, 0x80,
+    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80,
+    0x01, 0x80, 0x01, 0x80,
+    // 'Z' (90)
+    0x7F, 0xF8, 0xFF, 0xFC, 0xF8, 0x3C, 0xE0, 0x38,
+    0xE0, 0x78, 0xC1, 0xE0, 0x01, 0xE0, 0x07, 0x80,
+    0x07, 0x8C, 0x1E, 0x1C, 0x1C, 0x1C, 0x7C, 0x7C,
+    0xFF, 0xFC, 0xFF, 0xF8,
+    // '[' (91)
+    0x1F, 0xC0, 0x3F, 0xC0, 0x3E, 0x00, 0x3C, 0x00,
+    0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00,
+    0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3E, 0x00,
+    0x3F, 0xC0, 0x1F, 0xC0,
+    // '\\' (92)
+    0xE0, 0x00, 0xF8, 0x00, 0x78, 0x00, 0x1E, 0x00,
+    0x1E, 0x00, 0x07, 0x80, 0x07, 0x80, 0x01, 0xE0,
+    0x01, 0xE0, 0x00, 0x78, 0x00, 0x78, 0x00, 0x1C,
+    0x00, 0x1C, 0x00, 0x0C,
+    // ']' (93)
+    0x3F, 0x80, 0x3F, 0xC0, 0x07, 0xC0, 0x03, 0xC0,
+    0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+    0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x07, 0xC0,
+    0x3F, 0xC0, 0x3F, 0x80,
+    // '^' (94)
+    0x03, 0x00, 0x07, 0x80, 0x07, 0x80, 0x1F, 0xE0,
+    0x1C, 0xE0, 0x78, 0x78, 0xF8, 0x7C, 0xE0, 0x1C,
+    // '_' (95)
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // '`' (96)
+    0x06, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x07, 0x80,
+    0x07, 0xC0, 0x01, 0xC0,
+    // 'a' (97)
+    0x3F, 0x80, 0x3F, 0xE0, 0x00, 0xE0, 0x00, 0xF0,
+    0x1F, 0xF0, 0x7F, 0xF0, 0xF0, 0xF0, 0xF0, 0x78,
+    0x7F, 0x3C, 0x1F, 0x1C,
+    // 'b' (98)
+    0xF8, 0x00, 0xFC, 0x00, 0x7C, 0x00, 0x3C, 0x00,
+    0x3C, 0x00, 0x3E, 0x00, 0x3F, 0xE0, 0x3F, 0xF8,
+    0x3E, 0x78, 0x3C, 0x3C, 0x3C, 0x3C, 0x7A, 0x78,
+    0xF3, 0xF8, 0xE3, 0xE0,
+    // 'c' (99)
+    0x1F, 0x80, 0x7F, 0xE0, 0x79, 0xF0, 0xF0, 0x70,
+    0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x70, 0x79, 0xF0,
+    0x7F, 0xE0, 0x1F, 0x80,
+    // 'd' (100)
+    0x03, 0xE0, 0x03, 0xF0, 0x01, 0xF0, 0x00, 0xF0,
+    0x00, 0xF0, 0x01, 0xF0, 0x1F, 0xF0, 0x7F, 0xF0,
+    0x79, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x79, 0x78,
+    0x7F, 0x3C, 0x1F, 0x1C,
+    // 'e' (101)
+    0x1F, 0x80, 0x7F, 0xE0, 0x70, 0xE0, 0xF0, 0xF0,
+    0xFF, 0xF0, 0xFF, 0xE0, 0xF0, 0x00, 0x70, 0x00,
+    0x7F, 0xC0, 0x1F, 0xC0,
+    // 'f' (102)
+    0x07, 0x80, 0x1F, 0xE0, 0x1C, 0xF0, 0x3C, 0x70,
+    0x3C, 0x00, 0x7E, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0x7E, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x7E, 0x00,
+    0xFF, 0x00, 0xFF, 0x00,
+    // 'g' (103)
+    0x1F, 0x1C, 0x7F, 0x3C, 0x79, 0x78, 0xF0, 0xF0,
+    0xF0, 0xF0, 0x79, 0xF0, 0x7F, 0xF0, 0x1F, 0xF0,
+    0x00, 0xF0, 0x00, 0xE0, 0xFF, 0xE0, 0xFF, 0x80,
+    // 'h' (104)
+    0xF8, 0x00, 0xFC, 0x00, 0x7C, 0x00, 0x3C, 0x00,
+    0x3C, 0xE0, 0x3C, 0xF8, 0x3F, 0x38, 0x3F, 0x3C,
+    0x3E, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x7C, 0x3C,
+    0xFC, 0x3C, 0xF8, 0x18,
+    // 'i' (105)
+    0x0F, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3E, 0x00, 0x3F, 0x00, 0x1F, 0x00, 0x0F, 0x00,
+    0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x1F, 0x80,
+    0x3F, 0xC0, 0x3F, 0xC0,
+    // 'j' (106)
+    0x00, 0xF0, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x60, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
+    0x00, 0xF0, 0x00, 0xF0, 0x60, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0x79, 0xE0, 0x7F, 0xE0, 0x1F, 0x80,
+    // 'k' (107)
+    0xF8, 0x00, 0xFC, 0x00, 0x7C, 0x00, 0x3C, 0x00,
+    0x3C, 0x1C, 0x3C, 0x7C, 0x3C, 0x78, 0x3C, 0xE0,
+    0x3F, 0xC0, 0x3F, 0xC0, 0x3C, 0xE0, 0x7C, 0x78,
+    0xFC, 0x7C, 0xF8, 0x1C,
+    // 'l' (108)
+    0x3E, 0x00, 0x3F, 0x00, 0x1F, 0x00, 0x0F, 0x00,
+    0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00,
+    0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x1F, 0x80,
+    0x3F, 0xC0, 0x3F, 0xC0,
+    // 'm' (109)
+    0x60, 0x60, 0xF9, 0xF8, 0xFF, 0xF8, 0xFF, 0xFC,
+    0xFF, 0xFC, 0xFF, 0xFC, 0xF3, 0x3C, 0xF3, 0x3C,
+    0xF0, 0x3C, 0x60, 0x18,
+    // 'n' (110)
+    0x7F, 0x80, 0xFF, 0xE0, 0xF9, 0xE0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0x60, 0x60,
+    // 'o' (111)
+    0x1F, 0x80, 0x7F, 0xE0, 0x79, 0xE0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x79, 0xE0,
+    0x7F, 0xE0, 0x1F, 0x80,
+    // 'p' (112)
+    0xE3, 0xE0, 0xF3, 0xF8, 0x7A, 0x78, 0x3C, 0x3C,
+    0x3C, 0x3C, 0x3E, 0x78, 0x3F, 0xF8, 0x3F, 0xE0,
+    0x3C, 0x00, 0x7C, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    // 'q' (113)
+    0x1F, 0x1C, 0x7F, 0x3C, 0x79, 0x78, 0xF0, 0xF0,
+    0xF0, 0xF0, 0x79, 0xF0, 0x7F, 0xF0, 0x1F, 0xF0,
+    0x00, 0xF0, 0x00, 0xF8, 0x03, 0xFC, 0x03, 0xFC,
+    // 'r' (114)
+    0xE1, 0xE0, 0xF3, 0xF8, 0x7F, 0x38, 0x3E, 0x3C,
+    0x3E, 0x3C, 0x3C, 0x18, 0x3C, 0x00, 0x7E, 0x00,
+    0xFF, 0x00, 0xFF, 0x00,
+    // 's' (115)
+    0x1F, 0xF0, 0x7F, 0xF0, 0xF0, 0x00, 0xF0, 0x00,
+    0x7F, 0x80, 0x1F, 0xE0, 0x00, 0xF0, 0x00, 0xF0,
+    0xFF, 0xE0, 0xFF, 0x80,
+    // 't' (116)
+    0x03, 0x00, 0x07, 0x00, 0x07, 0x00, 0x1F, 0x80,
+    0x3F, 0xF0, 0x3F, 0xF0, 0x1F, 0x80, 0x0F, 0x00,
+    0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x30, 0x07, 0x30,
+    0x07, 0xE0, 0x01, 0xC0,
+    // 'u' (117)
+    0x60, 0x60, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x79, 0x78,
+    0x7F, 0x3C, 0x1F, 0x1C,
+    // 'v' (118)
+    0x60, 0x60, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0x79, 0xE0, 0x7F, 0xE0, 0x1F, 0x80,
+    0x1F, 0x80, 0x06, 0x00,
+    // 'w' (119)
+    0x60, 0x18, 0xF0, 0x3C, 0xF3, 0x3C, 0xF3, 0x3C,
+    0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0x7F, 0xF8,
+    0x7C, 0xF8, 0x18, 0x60,
+    // 'x' (120)
+    0xE0, 0x1C, 0xF8, 0x7C, 0x78, 0x78, 0x1C, 0xE0,
+    0x0F, 0xC0, 0x0F, 0xC0, 0x1C, 0xE0, 0x78, 0x78,
+    0xF8, 0x7C, 0xE0, 0x1C,
+    // 'y' (121)
+    0x60, 0x60, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0x79, 0xF0, 0x7F, 0xF0, 0x1F, 0xF0,
+    0x00, 0xF0, 0x00, 0xE0, 0xFF, 0xE0, 0xFF, 0x80,
+    // 'z' (122)
+    0x7F, 0xF0, 0xFF, 0xF0, 0xE3, 0xE0, 0xC3, 0x80,
+    0x07, 0x80, 0x1E, 0x00, 0x1C, 0x30, 0x7C, 0x70,
+    0xFF, 0xF0, 0xFF, 0xE0,
+    // '{' (123)
+    0x01, 0xF0, 0x07, 0xF0, 0x07, 0x80, 0x0F, 0x00,
+    0x0F, 0x00, 0x1E, 0x00, 0xFC, 0x00, 0xFC, 0x00,
+    0x1E, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x07, 0x80,
+    0x07, 0xF0, 0x01, 0xF0,
+    // '|' (124)
+    0x01, 0x80, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+    0x03, 0xC0, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x80, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+    0x03, 0xC0, 0x01, 0x80,
+    // '}' (125)
+    0xF8, 0x00, 0xFE, 0x00, 0x1E, 0x00, 0x0F, 0x00,
+    0x0F, 0x00, 0x07, 0x80, 0x03, 0xF0, 0x03, 0xF0,
+    0x07, 0x80, 0x0F, 0x00, 0x0F, 0x00, 0x1E, 0x00,
+    0xFE, 0x00, 0xF8, 0x00,
+    // '~' (126)
+    0x1E, 0x1C, 0x7F, 0x3C, 0xF3, 0xF8, 0xE1, 0xE0,
+};
+
+const st7789_glyph16_t st7789_font16x16[95] = {
+    {    0,  0,  0 },  // ' '
+    {    0,  0, 14 },  // '!'
+    {   28,  0,  4 },  // '"'
+    {   36,  0, 14 },  // '#'
+    {   64,  0, 14 },  // '$'
+    {   92,  1, 15 },  // '%'
+    {  122,  0, 14 },  // '&'
+    {  150,  0,  6 },  // '\''
+    {  162,  0, 14 },  // '('
+    {  190,  0, 14 },  // ')'
+    {  218,  2, 10 },  // '*'
+    {  238,  2, 10 },  // '+'
+    {  258, 10,  4 },  // ','
+    {  266,  6,  2 },  // '-'
+    {  270, 12,  4 },  // '.'
+    {  278,  0, 14 },  // '/'
+    {  306,  1, 14 },  // '0'
+    {  334,  1, 14 },  // '1'
+    {  362,  1, 14 },  // '2'
+    {  390,  1, 14 },  // '3'
+    {  418,  1, 14 },  // '4'
+    {  446,  1, 14 },  // '5'
+    {  474,  1, 14 },  // '6'
+    {  502,  1, 14 },  // '7'
+    {  530,  1, 14 },  // '8'
+    {  558,  1, 14 },  // '9'
+    {  586,  4,  9 },  // ':'
+    {  604,  2, 12 },  // ';'
+    {  628,  0, 14 },  // '<'
+    {  656,  4,  8 },  // '='
+    {  672,  0, 14 },  // '>'
+    {  700,  0, 14 },  // '?'
+    {  728,  0, 14 },  // '@'
+    {  756,  1, 14 },  // 'A'
+    {  784,  0, 14 },  // 'B'
+    {  812,  1, 14 },  // 'C'
+    {  840,  1, 14 },  // 'D'
+    {  868,  1, 14 },  // 'E'
+    {  896,  0, 14 },  // 'F'
+    {  924,  0, 14 },  // 'G'
+    {  952,  1, 14 },  // 'H'
+    {  980,  1, 14 },  // 'I'
+    { 1008,  0, 14 },  // 'J'
+    { 1036,  0, 14 },  // 'K'
+    { 1064,  0, 14 },  // 'L'
+    { 1092,  1, 14 },  // 'M'
+    { 1120,  1, 14 },  // 'N'
+    { 1148,  0, 14 },  // 'O'
+    { 1176,  1, 14 },  // 'P'
+    { 1204,  0, 14 },  // 'Q'
+    { 1232,  1, 14 },  // 'R'
+    { 1260,  1, 14 },  // 'S'
+    { 1288,  1, 14 },  // 'T'
+    { 1316,  1, 14 },  // 'U'
+    { 1344,  0, 14 },  // 'V'
+    { 1372,  0, 14 },  // 'W'
+    { 1400,  0, 14 },  // 'X'
+    { 1428,  1, 14 },  // 'Y'
+    { 1456,  0, 14 },  // 'Z'
+    { 1484,  0, 14 },  // '['
+    { 1512,  0, 14 },  // '\\'
+    { 1540,  0, 14 },  // ']'
+    { 1568,  0,  8 },  // '^'
+    { 1584, 14,  2 },  // '_'
+    { 1588,  0,  6 },  // '`'
+    { 1600,  4, 10 },  // 'a'
+    { 1620,  0, 14 },  // 'b'
+    { 1648,  4, 10 },  // 'c'
+    { 1668,  0, 14 },  // 'd'
+    { 1696,  4, 10 },  // 'e'
+    { 1716,  0, 14 },  // 'f'
+    { 1744,  4, 12 },  // 'g'
+    { 1768,  0, 14 },  // 'h'
+    { 1796,  0, 14 },  // 'i'
+    { 1824,  0, 16 },  // 'j'
+    { 1856,  0, 14 },  // 'k'
+    { 1884,  0, 14 },  // 'l'
+    { 1912,  4, 10 },  // 'm'
+    { 1932,  4, 10 },  // 'n'
+    { 1952,  4, 10 },  // 'o'
+    { 1972,  4, 12 },  // 'p'
+    { 1996,  4, 12 },  // 'q'
+    { 2020,  4, 10 },  // 'r'
+    { 2040,  4, 10 },  // 's'
+    { 2060,  0, 14 },  // 't'
+    { 2088,  4, 10 },  // 'u'
+    { 2108,  4, 10 },  // 'v'
+    { 2128,  4, 10 },  // 'w'
+    { 2148,  4, 10 },  // 'x'
+    { 2168,  4, 12 },  // 'y'
+    { 2192,  4, 10 },  // 'z'
+    { 2212,  0, 14 },  // '{'
+    { 2240,  0, 14 },  // '|'
+    { 2268,  0, 14 },  // '}'
+    { 2296,  0,  4 },  // '~'
+};
+
+_Static_assert(sizeof(st7789_font16x16_rows) == 2304, "row table out of step with the index");
+_Static_assert(sizeof(st7789_font16x16) / sizeof(st7789_font16x16[0]) == 95,
+               "one entry per printable ASCII character");
@@ -0,0 +1,112 @@
+#include "st7789.h"
+#include "st7789_priv.h"
+#include "esp_attr.h"
+#include <string.h>
+
+#define SMALL_GLYPH_PIXELS (FONT_WIDTH * FONT_HEIGHT)
+#define LARGE_GLYPH_PIXELS (LARGE_FONT_WIDTH * LARGE_FONT_HEIGHT)
+
+// Slot bookkeeping; the pixels live in the per-class pools below
+typedef struct {
+    uint64_t key;       // Packed font/char/colors, 0 = empty slot
+    uint32_t last_use;  // LRU stamp
+} glyph_slot_t;
+
+/**
+ * One fixed-size pool per font so an 8x8 glyph never occupies a 16x16 slot.
+ * The pools are DMA-capable so cached glyphs are sent without a copy.
+ */
+#if ST7789_GLYPH_CACHE_SMALL_SLOTS > 0
+static DMA_ATTR uint16_t small_pool[ST7789_GLYPH_CACHE_SMALL_SLOTS][SMALL_GLYPH_PIXELS];
+static glyph_slot_t small_slots[ST7789_GLYPH_CACHE_SMALL_SLOTS];
+#endif
+#if ST7789_GLYPH_CACHE_LARGE_SLOTS > 0
+static DMA_ATTR uint16_t large_pool[ST7789_GLYPH_CACHE_LARGE_SLOTS][LARGE_GLYPH_PIXELS];
+static glyph_slot_t large_slots[ST7789_GLYPH_CACHE_LARGE_SLOTS];
+#endif
+
+static uint32_t cache_clock;
+static st7789_glyph_cache_stats_t cache_stats;
+
+// Bit 63 marks the key as used so that no valid key is ever 0
+static inline uint64_t make_key(st7789_font_t font, char c, uint16_t color, uint16_t bg_color) {
+    return (1ULL << 63) | ((uint64_t)font << 40) | ((uint64_t)(uint8_t)c << 32) |
+           ((uint64_t)color << 16) | bg_color;
+}
+
+/**
+ * @brief Find a glyph in one pool, or claim the least recently used slot
+ */
+static inline uint16_t *lookup(glyph_slot_t *slots, uint16_t *pool, size_t slot_count,
+                               size_t slot_pixels, uint64_t key, bool *hit) {
+    size_t victim = 0;
+    for (size_t i = 0; i < slot_count; i++) {
+        if (slots[i].key == key) {
+            slots[i].last_use = ++cache_clock;
+            cache_stats.hits++;
+            *hit = true;
+            return pool + i * slot_pixels;
+        }
+        if (slots[i].last_use < slots[victim].last_use) {
+            victim = i;
+        }
+    }
+
+    if (slots[victim].key != 0) {
+        cache_stats.evictions++;
+    }
+    slots[victim].key = key;
+    slots[victim].last_use = ++cache_clock;
+    cache_stats.misses++;
+    *hit = false;
+    return pool + victim * slot_pixels;
+}
+
+uint16_t *st7789_glyph_cache_lookup(st7789_font_t font, char c, uint16_t color,
+                                    uint16_t bg_color, bool *hit) {
+    if (font == ST7789_FONT_16X16) {
+#if ST7789_GLYPH_CACHE_LARGE_SLOTS > 0
+        return lookup(large_slots, &large_pool[0][0], ST7789_GLYPH_CACHE_LARGE_SLOTS,
+                      LARGE_GLYPH_PIXELS, make_key(font, c, color, bg_color), hit);
+#endif
+    } else {
+#if ST7789_GLYPH_CACHE_SMALL_SLOTS > 0
+        return lookup(small_slots, &small_pool[0][0], ST7789_GLYPH_CACHE_SMALL_SLOTS,
+                      SMALL_GLYPH_PIXELS, make_key(font, c, color, bg_color), hit);
+#endif
+    }
+    *hit = false;
+    return NULL;
+}
+
+/**
+ * @brief Read the glyph cache counters
+ *
+ * @param stats Receives hits, misses, evictions and the pool size in bytes
+ */
+void st7789_glyph_cache_get_stats(st7789_glyph_cache_stats_t *stats) {
+    *stats = cache_stats;
+    stats->pool_bytes = (ST7789_GLYPH_CACHE_SMALL_SLOTS * SMALL_GLYPH_PIXELS +
+                         ST7789_GLYPH_CACHE_LARGE_SLOTS * LARGE_GLYPH_PIXELS) * sizeof(uint16_t);
+}
+
+/**
+ * @brief Zero the hit, miss and eviction counters
+ */
+void st7789_glyph_cache_reset_stats(void) {
+    memset(&cache_stats, 0, sizeof(cache_stats));
+}
+
+/**
+ * @brief Drop every cached glyph
+ */
+void st7789_glyph_cache_clear(void) {
+    st7789_async_sync();
+#if ST7789_GLYPH_CACHE_SMALL_SLOTS > 0
+    memset(small_slots, 0, sizeof(small_slots));
+#endif
+#if ST7789_GLYPH_CACHE_LARGE_SLOTS > 0
+    memset(large_slots, 0, sizeof(large_slots));
+#endif
+    cache_clock = 0;
+}
@@ -0,0 +1,269 @@
+#include "st7789.h"
+#include "st7789_priv.h"
+#include "esp_attr.h"
+#include "esp_log.h"
+#include <string.h>
+
+static const char *TAG = "ST7789_IMAGE";
+
+/**
+ * S7Q compressed RGB565 images, a QOI-style byte stream adapted to 16-bit
+ * color. After the 8-byte header ("S7Q1", width and height as little-endian
+ * uint16) comes one op per pixel or run, in raster order:
+ *
+ *   00iiiiii            INDEX  color = index[i]
+ *   01rrggbb            DIFF   r, g, b change by -2..1 (stored +2)
+ *   10gggggg rrrrbbbb   LUMA   g changes by -32..31 (stored +32); r and b by
+ *                              floor(dg / 2) plus -8..7 (stored +8)
+ *   110nnnnn            RUN    previous color, 1-32 more times
+ *   1110nnnn nnnnnnnn   LONG   previous color, 33-4128 more times
+ *   11111110 hi lo      RGB    literal color, big-endian
+ *
+ * Channel arithmetic wraps (5, 6 and 5 bits). Every decoded color except a
+ * run lands in index[(r * 3 + g * 5 + b * 7) % 64]. Decoding starts from
+ * black with a zeroed index. Runs may cross rows. Bytes 0xF0-0xFD and 0xFF
+ * are reserved. tools/st7789_img_encode.py is the reference encoder.
+ */
+
+#define OP_INDEX  0x00
+#define OP_DIFF   0x40
+#define OP_LUMA   0x80
+#define OP_RUN    0xC0
+#define OP_LONG   0xE0
+#define OP_RGB    0xFE
+
+#define LONG_RUN_BIAS 33
+
+// Runs at least this long go out through the fill buffer instead of the line
+#define FILL_RUN_MIN 256
+
+typedef struct {
+    const uint8_t *p, *end;
+    uint16_t prev;
+    bool error;
+    uint16_t index[64];
+} decoder_t;
+
+// Visible part of the image and where decoding has got to
+typedef struct {
+    uint16_t x, y;
+    uint16_t w;            // Image width
+    uint16_t cw, ch;       // Visible width and height
+    uint16_t col, row;     // Next pixel, in image coordinates
+    bool direct;           // Streaming to the bus under one window
+    uint16_t run_color;    // Direct: visible pixels of one color not yet sent
+    uint32_t run_len;
+    uint16_t used;         // Pixels in line
+    bool row_solid;        // Buffered: every pixel in line has line[0]'s color
+} sink_t;
+
+// Direct: panel-order pixels for the bus. Buffered: the current row, host order.
+static DMA_ATTR uint16_t line[ST7789_WIDTH];
+
+static inline unsigned color_hash(uint16_t c) {
+    return ((c >> 11) * 3 + ((c >> 5) & 0x3F) * 5 + (c & 0x1F) * 7) & 0x3F;
+}
+
+static inline uint16_t add_rgb(uint16_t c, int dr, int dg, int db) {
+    unsigned r = ((c >> 11) + dr) & 0x1F;
+    unsigned g = (((c >> 5) & 0x3F) + dg) & 0x3F;
+    unsigned b = ((c & 0x1F) + db) & 0x1F;
+    return (r << 11) | (g << 5) | b;
+}
+
+/**
+ * @brief Decode the next op
+ *
+ * @return Number of pixels of *color it stands for, 0 at the end of the
+ *         data or on a malformed op (then error is set)
+ */
+static uint32_t next_op(decoder_t *d, uint16_t *color) {
+    if (d->p >= d->end) return 0;
+    uint8_t op = *d->p++;
+    uint16_t c;
+
+    if (op == OP_RGB) {
+        if (d->end - d->p < 2) goto bad;
+        c = (d->p[0] << 8) | d->p[1];
+        d->p += 2;
+    } else if ((op & 0xC0) == OP_INDEX) {
+        c = d->index[op & 0x3F];
+    } else if ((op & 0xC0) == OP_DIFF) {
+        c = add_rgb(d->prev, ((op >> 4) & 3) - 2, ((op >> 2) & 3) - 2, (op & 3) - 2);
+    } else if ((op & 0xC0) == OP_LUMA) {
+        if (d->p >= d->end) goto bad;
+        uint8_t rb = *d->p++;
+        int half = ((op & 0x3F) >> 1) - 16;   // floor(dg / 2) without a signed shift
+        c = add_rgb(d->prev, (rb >> 4) - 8 + half, (op & 0x3F) - 32, (rb & 0x0F) - 8 + half);
+    } else if ((op & 0xE0) == OP_RUN) {
+        *color = d->prev;
+        return (op & 0x1F) + 1;
+    } else if ((op & 0xF0) == OP_LONG) {
+        if (d->p >= d->end) goto bad;
+        uint32_t n = ((op & 0x0F) << 8) | *d->p++;
+        *color = d->prev;
+        return n + LONG_RUN_BIAS;
+    } else {
+        goto bad;
+    }
+
+    d->prev = c;
+    d->index[color_hash(c)] = c;
+    *color = c;
+    return 1;
+
+bad:
+    d->error = true;
+    return 0;
+}
+
+static void line_flush(sink_t *s) {
+    st7789_bus_write_pixels(line, s->used);
+    s->used = 0;
+}
+
+// Direct: send the pending run, through the fill buffer if it is long
+static void run_flush(sink_t *s) {
+    if (s->run_len >= FILL_RUN_MIN) {
+        line_flush(s);
+        st7789_bus_write_color(s->run_color, s->run_len);
+    } else {
+        uint16_t be = to_be16(s->run_color);
+        for (uint32_t i = 0; i < s->run_len; i++) {
+            if (s->used == ST7789_WIDTH) line_flush(s);
+            line[s->used++] = be;
+        }
+    }
+    s->run_len = 0;
+}
+
+// Buffered: hand a finished row to the band or framebuffer
+static void row_flush(sink_t *s) {
+    uint16_t y = s->y + s->row;
+    if (s->row_solid) {
+        if (!st7789_band_fill_rect(s->x, y, s->cw, 1, line[0])) {
+            st7789_fb_fill_rect(s->x, y, s->cw, 1, line[0]);
+        }
+    } else if (!st7789_band_blit(s->x, y, s->cw, 1, line, s->cw, ST7789_PIXELS_HOST)) {
+        st7789_fb_blit(s->x, y, s->cw, 1, line, s->cw, ST7789_PIXELS_HOST);
+    }
+    s->used = 0;
+}
+
+// Take n visible pixels of one color
+static void put_visible(sink_t *s, uint16_t color, uint32_t n) {
+    if (s->direct) {
+        if (s->run_len > 0 && color != s->run_color) run_flush(s);
+        s->run_color = color;
+        s->run_len += n;
+        return;
+    }
+    if (s->used == 0) {
+        s->row_solid = true;
+    } else if (color != line[0]) {
+        s->row_solid = false;
+    }
+    for (uint32_t i = 0; i < n; i++) {
+        line[s->used++] = color;
+    }
+}
+
+// Take n decoded pixels of one color, dropping the clipped columns
+static void put_pixels(sink_t *s, uint16_t color, uint32_t n) {
+    while (n > 0 && s->row < s->ch) {
+        uint32_t span = (uint32_t)(s->w - s->col) < n ? (uint32_t)(s->w - s->col) : n;
+        if (s->col < s->cw) {
+            uint32_t vis = (uint32_t)(s->cw - s->col) < span ? (uint32_t)(s->cw - s->col) : span;
+            put_visible(s, color, vis);
+        }
+        s->col += span;
+        n -= span;
+        if (s->col == s->w) {
+            if (!s->direct) row_flush(s);
+            s->col = 0;
+            s->row++;
+        }
+    }
+}
+
+/**
+ * @brief Read the size of an S7Q image
+ *
+ * @param data Image file contents
+ * @param size Length of data in bytes
+ * @param width Receives the width in pixels (may be NULL)
+ * @param height Receives the height in pixels (may be NULL)
+ * @return ESP_OK, or ESP_ERR_INVALID_ARG if data is not an S7Q image
+ */
+esp_err_t st7789_image_get_size(const uint8_t *data, size_t size, uint16_t *width,
+                                uint16_t *height) {
+    if (data == NULL || size < ST7789_IMAGE_HEADER_SIZE || memcmp(data, "S7Q1", 4) != 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (width) *width = data[4] | (data[5] << 8);
+    if (height) *height = data[6] | (data[7] << 8);
+    return ESP_OK;
+}
+
+static esp_err_t draw_image(uint16_t x, uint16_t y, const uint8_t *data, size_t size) {
+    uint16_t w, h;
+    if (st7789_image_get_size(data, size, &w, &h) != ESP_OK) return ESP_ERR_INVALID_ARG;
+    if (w == 0 || h == 0 || x >= ST7789_WIDTH || y >= ST7789_HEIGHT) return ESP_OK;
+
+    sink_t sink = {
+        .x = x, .y = y, .w = w,
+        .cw = w < ST7789_WIDTH - x ? w : ST7789_WIDTH - x,
+        .ch = h < ST7789_HEIGHT - y ? h : ST7789_HEIGHT - y,
+        .direct = !st7789_band_active() && !st7789_fb_active(),
+    };
+    decoder_t dec = { .p = data + ST7789_IMAGE_HEADER_SIZE, .end = data + size };
+
+    if (sink.direct) {
+        st7789_bus_set_window(x, y, sink.cw, sink.ch);
+    }
+    while (sink.row < sink.ch) {
+        uint16_t color;
+        uint32_t n = next_op(&dec, &color);
+        if (n == 0) break;
+        put_pixels(&sink, color, n);
+    }
+    if (sink.direct) {
+        run_flush(&sink);
+        line_flush(&sink);
+        st7789_bus_end_pixels();
+    }
+
+    if (sink.row < sink.ch) {
+        ESP_LOGW(TAG, "Image data %s after %u of %u rows",
+                 dec.error ? "corrupt" : "truncated", sink.row, sink.ch);
+        return ESP_ERR_INVALID_SIZE;
+    }
+    return ESP_OK;
+}
+
+/**
+ * @brief Decode an S7Q image straight to the panel
+ *
+ * Streams through a one-row buffer under a single address window; long
+ * runs go out through the solid-fill buffer. With a framebuffer or band
+ * render active, rows are drawn into it instead. Clipped at the right and
+ * bottom edges; decoding stops after the last visible row.
+ *
+ * @param x X coordinate of top-left corner
+ * @param y Y coordinate of top-left corner
+ * @param data Image file contents, e.g. embedded in flash
+ * @param size Length of data in bytes
+ * @return ESP_OK, ESP_ERR_INVALID_ARG if data is not an S7Q image, or
+ *         ESP_ERR_INVALID_SIZE if it ends early or is corrupt (the rows
+ *         before the fault are drawn)
+ */
+esp_err_t st7789_draw_image(uint16_t x, uint16_t y, const uint8_t *data, size_t size) {
+    esp_err_t ret = st7789_image_get_size(data, size, NULL, NULL);
+    if (ret != ESP_OK) return ret;
+    int64_t start = ST7789_STATS_OP_BEGIN();
+    if (!st7789_async_draw_image(x, y, data, size)) {
+        ret = draw_image(x, y, data, size);
+    }
+    ST7789_STATS_OP_END(ST7789_OP_DRAW_IMAGE, start);
+    return ret;
+}
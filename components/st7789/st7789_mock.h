@@ -0,0 +1,54 @@
+#ifndef ST7789_MOCK_H
+#define ST7789_MOCK_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @file st7789_mock.h
+ * @brief Host-side mock transport for ST7789 driver (ST7789_TRANSPORT_MOCK)
+ *
+ * Replaces the bus with an in-memory recorder so the rendering layer can be
+ * exercised on Linux. Every transport call is counted and, if a sink is
+ * installed, forwarded byte-for-byte for comparison against a reference.
+ */
+
+/**
+ * @brief Transport call counters collected by the mock
+ */
+typedef struct {
+    uint32_t command_calls;   // write_command() calls (one byte each)
+    uint32_t data_calls;      // write_data() calls
+    uint64_t data_bytes;      // Total data bytes across all calls
+    size_t   last_data_len;   // Length of the most recent write_data()
+    size_t   max_data_len;    // Largest single write_data()
+    uint32_t reset_pulses;    // Times RST was asserted
+} st7789_mock_stats_t;
+
+/**
+ * @brief Callback receiving every transport call as it happens
+ *
+ * @param is_command true for a command byte (DC low), false for data
+ * @param bytes Bytes in wire order
+ * @param len Number of bytes (always 1 for commands)
+ * @param ctx User pointer passed to st7789_mock_set_sink()
+ */
+typedef void (*st7789_mock_sink_t)(bool is_command, const uint8_t *bytes, size_t len, void *ctx);
+
+/**
+ * @brief Install or remove (NULL) the byte sink
+ */
+void st7789_mock_set_sink(st7789_mock_sink_t sink, void *ctx);
+
+/**
+ * @brief Copy the current counters into out
+ */
+void st7789_mock_get_stats(st7789_mock_stats_t *out);
+
+/**
+ * @brief Zero all counters
+ */
+void st7789_mock_reset_stats(void);
+
+#endif // ST7789_MOCK_H
@@ -0,0 +1,157 @@
+#include "st7789.h"
+#include "st7789_priv.h"
+#include <string.h>
+
+/**
+ * Scattered pixels are drawn a chunk at a time. Each chunk is bucketed by
+ * row with a stable counting sort, then by column within the row, so
+ * horizontally adjacent points join into one run sent under one address
+ * window. Runs on the same row keep the panel's row range, so the window
+ * cache skips their RASET. Sorting is stable and a repeated point
+ * overwrites the earlier one, so the panel ends up exactly as if every
+ * point had gone through st7789_draw_pixel() in order.
+ */
+
+// Points per queued async record, a fifth of the default ring
+#define ASYNC_CHUNK 64
+
+static st7789_pixel_t batch[ST7789_PIXEL_BATCH];   // Current chunk, by row then column
+static uint16_t row_end[ST7789_HEIGHT + 1];        // Counting sort cursors
+static uint16_t run_colors[ST7789_WIDTH];          // Host-endian colors of one run
+
+_Static_assert(ST7789_PIXEL_BATCH > 0 && ST7789_PIXEL_BATCH <= UINT16_MAX,
+               "row cursors are 16-bit");
+
+// Send one run; solid runs take the fill path when drawing into a buffer
+static void put_run(uint16_t x, uint16_t y, uint16_t w, bool solid) {
+    if (solid) {
+        if (st7789_band_fill_rect(x, y, w, 1, run_colors[0])) return;
+        if (st7789_fb_fill_rect(x, y, w, 1, run_colors[0])) return;
+    } else {
+        if (st7789_band_blit(x, y, w, 1, run_colors, w, ST7789_PIXELS_HOST)) return;
+        if (st7789_fb_blit(x, y, w, 1, run_colors, w, ST7789_PIXELS_HOST)) return;
+    }
+    // On the bus a blit beats a fill: the fill buffer is re-expanded per color
+    st7789_bus_blit(x, y, w, 1, run_colors, w, ST7789_PIXELS_HOST);
+}
+
+// Emit the runs of a sorted row
+static void put_row(const st7789_pixel_t *row, size_t n) {
+    uint16_t x0 = row[0].x, w = 0;
+    bool solid = true;
+    for (size_t i = 0; i < n; i++) {
+        const st7789_pixel_t *p = &row[i];
+        if (w > 0 && p->x == x0 + w - 1) {
+            // Same point again: the later color wins
+            run_colors[w - 1] = p->color;
+            solid = solid && (w == 1 || p->color == run_colors[0]);
+            continue;
+        }
+        if (w > 0 && p->x != x0 + w) {
+            put_run(x0, row[0].y, w, solid);
+            w = 0;
+        }
+        if (w == 0) {
+            x0 = p->x;
+            solid = true;
+        }
+        run_colors[w++] = p->color;
+        solid = solid && p->color == run_colors[0];
+    }
+    put_run(x0, row[0].y, w, solid);
+}
+
+/**
+ * @brief Sort one chunk into batch and send it row by row
+ *
+ * Points come from pixels, or from points with a shared color when pixels
+ * is NULL. Points off the panel are dropped.
+ */
+static void draw_chunk(const st7789_pixel_t *pixels, const st7789_point_t *points,
+                       size_t count, uint16_t color) {
+    memset(row_end, 0, sizeof(row_end));
+    for (size_t i = 0; i < count; i++) {
+        uint16_t x = pixels ? pixels[i].x : points[i].x;
+        uint16_t y = pixels ? pixels[i].y : points[i].y;
+        if (x < ST7789_WIDTH && y < ST7789_HEIGHT) {
+            row_end[y + 1]++;
+        }
+    }
+    for (int y = 1; y <= ST7789_HEIGHT; y++) {
+        row_end[y] += row_end[y - 1];
+    }
+    // row_end[y] is now where row y starts; placing advances it to where row y ends
+    for (size_t i = 0; i < count; i++) {
+        st7789_pixel_t p = pixels ? pixels[i]
+                                  : (st7789_pixel_t){ points[i].x, points[i].y, color };
+        if (p.x < ST7789_WIDTH && p.y < ST7789_HEIGHT) {
+            batch[row_end[p.y]++] = p;
+        }
+    }
+
+    uint16_t start = 0;
+    for (int y = 0; y < ST7789_HEIGHT; y++) {
+        uint16_t end = row_end[y];
+        if (end > start) {
+            // Stable insertion sort by column; rows are short and often already in order
+            for (uint16_t i = start + 1; i < end; i++) {
+                st7789_pixel_t p = batch[i];
+                uint16_t k = i;
+                while (k > start && batch[k - 1].x > p.x) {
+                    batch[k] = batch[k - 1];
+                    k--;
+                }
+                batch[k] = p;
+            }
+            put_row(&batch[start], end - start);
+        }
+        start = end;
+    }
+}
+
+static void draw_batch(const st7789_pixel_t *pixels, const st7789_point_t *points,
+                       size_t count, uint16_t color) {
+    if (st7789_async_queueing()) {
+        // Queue copies; the render task sorts them when it runs the records
+        for (size_t i = 0; i < count; i += ASYNC_CHUNK) {
+            size_t n = count - i < ASYNC_CHUNK ? count - i : ASYNC_CHUNK;
+            if (pixels) {
+                st7789_async_draw_pixels(pixels + i, n);
+            } else {
+                st7789_async_draw_points(points + i, n, color);
+            }
+        }
+        return;
+    }
+    for (size_t i = 0; i < count; i += ST7789_PIXEL_BATCH) {
+        size_t n = count - i < ST7789_PIXEL_BATCH ? count - i : ST7789_PIXEL_BATCH;
+        draw_chunk(pixels ? pixels + i : NULL, points ? points + i : NULL, n, color);
+    }
+}
+
+/**
+ * @brief Draw many pixels, each with its own color
+ *
+ * @param pixels Points and colors, in any order
+ * @param count Number of entries
+ */
+void st7789_draw_pixels(const st7789_pixel_t *pixels, size_t count) {
+    if (pixels == NULL || count == 0) return;
+    int64_t start = ST7789_STATS_OP_BEGIN();
+    draw_batch(pixels, NULL, count, 0);
+    ST7789_STATS_OP_END(ST7789_OP_DRAW_PIXELS, start);
+}
+
+/**
+ * @brief Draw many pixels in one color
+ *
+ * @param points Positions, in any order
+ * @param count Number of points
+ * @param color 16-bit RGB565 color
+ */
+void st7789_draw_points(const st7789_point_t *points, size_t count, uint16_t color) {
+    if (points == NULL || count == 0) return;
+    int64_t start = ST7789_STATS_OP_BEGIN();
+    draw_batch(NULL, points, count, color);
+    ST7789_STATS_OP_END(ST7789_OP_DRAW_PIXELS, start);
+}
@@ -0,0 +1,317 @@
+#ifndef ST7789_PRIV_H
+#define ST7789_PRIV_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "st7789.h"
+
+/**
+ * @file st7789_priv.h
+ * @brief Internal interfaces shared between the ST7789 driver modules
+ *
+ * Not part of the public API. st7789.c owns the panel protocol and exposes
+ * its bus-level primitives here; the optional rendering modules hook into
+ * the draw path through the st7789_fb_* calls.
+ */
+
+// Panel geometry
+#define ST7789_WIDTH   240
+#define ST7789_HEIGHT  240
+
+// Font definitions - 8x8 pixel font
+#define FONT_WIDTH  8
+#define FONT_HEIGHT 8
+#define FONT_CHAR_SPACING 1        // Gap between characters in a string
+#define FONT_LINE_SPACING 2        // Gap between lines in a string
+
+// Large font definitions - 16x16 pixel font
+#define LARGE_FONT_WIDTH  16
+#define LARGE_FONT_HEIGHT 16
+#define LARGE_FONT_CHAR_SPACING 2
+#define LARGE_FONT_LINE_SPACING 4
+
+/**
+ * @brief Where one glyph of the 16x16 font lives in st7789_font16x16_rows
+ *
+ * Only rows top..top+rows-1 are stored; the rest of the cell is blank.
+ */
+typedef struct {
+    uint16_t offset;   // Byte offset of the first stored row
+    uint8_t top;       // First stored row
+    uint8_t rows;      // Stored rows, two bytes each
+} st7789_glyph16_t;
+
+// Generated by tools/st7789_font_gen.py (st7789_font16x16.c), indexed by c - 32
+extern const st7789_glyph16_t st7789_font16x16[95];
+extern const uint8_t st7789_font16x16_rows[];
+
+// One row of a printable ASCII 16x16 glyph, most significant bit leftmost
+static inline uint16_t large_font_row(char c, uint8_t row) {
+    const st7789_glyph16_t *g = &st7789_font16x16[c - 32];
+    uint8_t r = row - g->top;   // Wraps for rows above the glyph
+    if (r >= g->rows) return 0;
+    const uint8_t *p = st7789_font16x16_rows + g->offset + r * 2;
+    return (p[0] << 8) | p[1];
+}
+
+// Store a 16-bit value in panel (big-endian) byte order
+static inline void put_be16(uint8_t *dst, uint16_t value) {
+    dst[0] = value >> 8;
+    dst[1] = value & 0xFF;
+}
+
+// Return color as a uint16_t whose in-memory bytes are in panel order
+static inline uint16_t to_be16(uint16_t color) {
+    uint16_t be;
+    put_be16((uint8_t *)&be, color);
+    return be;
+}
+
+/**
+ * @brief Convert n host-endian RGB565 pixels into panel byte order
+ *
+ * dst and src may be the same buffer.
+ */
+void st7789_swap_copy(uint16_t *dst, const uint16_t *src, size_t n);
+
+/**
+ * @brief Fill a rectangle directly on the panel, bypassing any framebuffer
+ */
+void st7789_bus_fill_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
+
+/**
+ * @brief Stream a block of pixels directly to the panel, bypassing any framebuffer
+ *
+ * Clips at the right and bottom edges. See st7789_blit_stride() for arguments.
+ */
+void st7789_bus_blit(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                     const uint16_t *pixels, size_t stride, st7789_pixel_order_t order);
+
+/**
+ * @brief Open an address window on the panel and issue RAMWR
+ */
+void st7789_bus_set_window(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+
+/**
+ * @brief Stream panel-order pixels into the window opened last
+ *
+ * Sends in the current color depth; consecutive calls continue the same
+ * RAMWR. Call st7789_bus_end_pixels() after the last one.
+ */
+void st7789_bus_write_pixels(const uint16_t *pixels, size_t n);
+
+/**
+ * @brief Stream count pixels of one host-endian color into the window opened last
+ *
+ * Uses the solid-fill run buffer, so long runs cost a few bulk transfers.
+ * Mixes freely with st7789_bus_write_pixels() in the same RAMWR.
+ */
+void st7789_bus_write_color(uint16_t color, uint32_t count);
+
+/**
+ * @brief Finish a pixel stream (sends a 12-bit pixel still waiting for its pair)
+ */
+void st7789_bus_end_pixels(void);
+
+/**
+ * @brief True when pixels go out as 12-bit RGB444
+ */
+bool st7789_bus_rgb444(void);
+
+/**
+ * @brief Pack n (even) panel-order RGB565 pixels to RGB444; dst may equal src
+ *
+ * @return Bytes written, n * 3 / 2
+ */
+size_t st7789_pack_rgb444(uint8_t *dst, const uint16_t *src, size_t n);
+
+/**
+ * @brief Send a command and its parameter bytes directly to the panel
+ */
+void st7789_bus_command(uint8_t cmd, const uint8_t *params, size_t len);
+
+/**
+ * @brief Draw one character cell, painting unsupported characters as background
+ *
+ * Goes through the normal draw path, so it honours an enabled framebuffer.
+ */
+void st7789_draw_glyph(st7789_font_t font, uint16_t x, uint16_t y, char c,
+                       uint16_t color, uint16_t bg_color);
+
+/**
+ * @brief Look up an expanded glyph image in the glyph cache
+ *
+ * On a hit the returned buffer already holds the glyph in panel byte order.
+ * On a miss it is a freshly claimed LRU slot the caller must fill before
+ * use. NULL means the cache is compiled out for this font.
+ */
+uint16_t *st7789_glyph_cache_lookup(st7789_font_t font, char c, uint16_t color,
+                                    uint16_t bg_color, bool *hit);
+
+/**
+ * @brief Whether draws are currently being rendered into a framebuffer
+ */
+bool st7789_fb_active(void);
+
+/**
+ * @brief Render a solid rectangle into the framebuffer if one is active
+ *
+ * @return true if the framebuffer took the draw, false if the caller must
+ *         send it to the panel itself (no framebuffer, or too tall for the band)
+ */
+bool st7789_fb_fill_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
+
+/**
+ * @brief Render a block of pixels into the framebuffer if one is active
+ *
+ * @return true if the framebuffer took the draw, see st7789_fb_fill_rect()
+ */
+bool st7789_fb_blit(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                    const uint16_t *pixels, size_t stride, st7789_pixel_order_t order);
+
+/**
+ * @brief Render a solid rectangle into the current band during st7789_band_render()
+ *
+ * @return true if a band render is in progress (the draw is clipped to the
+ *         band, possibly to nothing), false otherwise
+ */
+bool st7789_band_fill_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
+
+/**
+ * @brief Render a block of pixels into the current band, see st7789_band_fill_rect()
+ */
+bool st7789_band_blit(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                      const uint16_t *pixels, size_t stride, st7789_pixel_order_t order);
+
+/**
+ * @brief Whether a band render is in progress
+ */
+bool st7789_band_active(void);
+
+/**
+ * @brief Queue a draw for the render task when async mode is running
+ *
+ * Called at the top of the matching draw routine. The render task runs the
+ * command through the public draw call, where these return false.
+ *
+ * @return true if the caller is done (command queued, or dropped under
+ *         back-pressure), false if it must draw now
+ */
+bool st7789_async_fill_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
+bool st7789_async_draw_pixel(uint16_t x, uint16_t y, uint16_t color);
+bool st7789_async_draw_char(st7789_font_t font, uint16_t x, uint16_t y, char c,
+                            uint16_t color, uint16_t bg_color);
+bool st7789_async_draw_text(st7789_font_t font, uint16_t x, uint16_t y, const char *str,
+                            uint16_t color, uint16_t bg_color, uint8_t scale);
+bool st7789_async_blit(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                       const uint16_t *pixels, size_t stride, st7789_pixel_order_t order);
+bool st7789_async_draw_pixels(const st7789_pixel_t *pixels, size_t count);
+bool st7789_async_draw_points(const st7789_point_t *points, size_t count, uint16_t color);
+bool st7789_async_draw_image(uint16_t x, uint16_t y, const uint8_t *data, size_t size);
+bool st7789_async_flush(void);
+
+// Longest parameter list st7789_async_command() queues (VSCRDEF)
+#define ST7789_ASYNC_COMMAND_MAX 6
+
+/**
+ * @brief Queue a raw panel command so it stays in order with queued draws
+ *
+ * @return true if queued (or dropped), false if the caller must send it now
+ *         (async mode off, on the render task, or more than
+ *         ST7789_ASYNC_COMMAND_MAX parameter bytes)
+ */
+bool st7789_async_command(uint8_t cmd, const uint8_t *params, size_t len);
+bool st7789_async_band_render(uint16_t y, uint16_t h, uint16_t bg_color,
+                              st7789_band_draw_cb_t draw, void *ctx);
+
+/**
+ * @brief Wait for the render task to go idle before touching shared state
+ *
+ * No-op when async mode is off or when called from the render task.
+ */
+void st7789_async_sync(void);
+
+/**
+ * @brief Whether draws from the calling task are being queued for the render task
+ */
+bool st7789_async_queueing(void);
+
+/*
+ * Bytes handed to the transport since boot, counted in every build. It is
+ * never reset, so the bytes a call sent are the difference across it, even
+ * if st7789_reset_stats() runs in between.
+ */
+extern uint64_t st7789_bus_bytes;
+
+/*
+ * Counter hooks. With ST7789_STATS = 0 they expand to nothing, so the
+ * instrumented paths compile exactly as before, except ST7789_BUS_WRITE(),
+ * which every transport write calls and which still counts st7789_bus_bytes.
+ */
+#if ST7789_STATS
+
+extern st7789_stats_t st7789_live_stats;
+extern bool st7789_live_dc_command;
+
+// Count one transport write; inline so the IRAM bit-bang paths stay in IRAM
+static inline void st7789_stats_bus(bool is_command, size_t len) {
+    if (is_command != st7789_live_dc_command) {
+        st7789_live_stats.dc_transitions++;
+        st7789_live_dc_command = is_command;
+    }
+    st7789_live_stats.bytes_sent += len;
+    st7789_bus_bytes += len;
+    if (is_command) {
+        st7789_live_stats.commands_sent++;
+    } else {
+        st7789_live_stats.data_writes++;
+    }
+}
+
+/**
+ * @brief Start timing a public operation
+ *
+ * @return Start timestamp, or -1 if the call is only being queued for the
+ *         render task (it is timed when the render task runs it)
+ */
+int64_t st7789_stats_op_begin(void);
+void st7789_stats_op_end(st7789_op_t op, int64_t start);
+
+#define ST7789_BUS_WRITE(is_command, len) st7789_stats_bus((is_command), (len))
+#define ST7789_STATS_OP_BEGIN()           st7789_stats_op_begin()
+#define ST7789_STATS_OP_END(op, start)    st7789_stats_op_end((op), (start))
+#define ST7789_STATS_YIELD()              (st7789_live_stats.yields++)
+
+#else
+
+#define ST7789_BUS_WRITE(is_command, len) ((void)(is_command), (void)(st7789_bus_bytes += (len)))
+#define ST7789_STATS_OP_BEGIN()           ((int64_t)0)
+#define ST7789_STATS_OP_END(op, start)    ((void)(start))
+#define ST7789_STATS_YIELD()              ((void)0)
+
+#endif // ST7789_STATS
+
+/*
+ * Bus trace hooks, called by every transport backend. With ST7789_TRACE = 0
+ * they expand to nothing.
+ */
+#if ST7789_TRACE
+
+void st7789_trace_command(uint8_t cmd);
+void st7789_trace_data(const uint8_t *data, size_t len);
+void st7789_trace_reset(int level);
+
+#define ST7789_TRACE_COMMAND(cmd)      st7789_trace_command(cmd)
+#define ST7789_TRACE_DATA(data, len)   st7789_trace_data((data), (len))
+#define ST7789_TRACE_RESET(level)      st7789_trace_reset(level)
+
+#else
+
+#define ST7789_TRACE_COMMAND(cmd)      ((void)0)
+#define ST7789_TRACE_DATA(data, len)   ((void)0)
+#define ST7789_TRACE_RESET(level)      ((void)0)
+
+#endif // ST7789_TRACE
+
+#endif // ST7789_PRIV_H
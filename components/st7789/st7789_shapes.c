@@ -0,0 +1,463 @@
+#include "st7789.h"
+#include "st7789_priv.h"
+#include <math.h>
+#include <stdlib.h>
+
+/**
+ * Every primitive is reduced to axis-aligned runs. A span_t collects
+ * pixels or rows as the primitive produces them and grows while the next
+ * one continues it; when the run breaks it goes out as one st7789_fill_rect()
+ * window, or one st7789_draw_pixel() if it is a single pixel. Only points
+ * with no horizontal or vertical neighbour in the walk (true diagonals)
+ * cost a window each.
+ */
+
+// Pending run; w == 0 means empty. Coordinates may lie off the panel.
+typedef struct {
+    int x, y, w, h;
+    uint16_t color;
+} span_t;
+
+static void span_flush(span_t *s) {
+    if (s->w == 0) return;
+    int x0 = s->x < 0 ? 0 : s->x;
+    int y0 = s->y < 0 ? 0 : s->y;
+    int x1 = s->x + s->w > ST7789_WIDTH ? ST7789_WIDTH : s->x + s->w;
+    int y1 = s->y + s->h > ST7789_HEIGHT ? ST7789_HEIGHT : s->y + s->h;
+    if (x0 < x1 && y0 < y1) {
+        if (x1 - x0 == 1 && y1 - y0 == 1) {
+            st7789_draw_pixel(x0, y0, s->color);
+        } else {
+            st7789_fill_rect(x0, y0, x1 - x0, y1 - y0, s->color);
+        }
+    }
+    s->w = 0;
+}
+
+// Add one pixel of an outline walk, extending the run in either direction
+static void span_plot(span_t *s, int x, int y) {
+    if (s->w != 0) {
+        if (s->h == 1 && y == s->y && (x == s->x + s->w || x == s->x - 1)) {
+            if (x < s->x) s->x = x;
+            s->w++;
+            return;
+        }
+        if (s->w == 1 && x == s->x && (y == s->y + s->h || y == s->y - 1)) {
+            if (y < s->y) s->y = y;
+            s->h++;
+            return;
+        }
+        span_flush(s);
+    }
+    *s = (span_t){ x, y, 1, 1, s->color };
+}
+
+// Add one filled row [x0, x1] of a scanline fill; equal rows stack into one rectangle
+static void span_row(span_t *s, int x0, int x1, int y) {
+    if (x1 < x0) return;
+    if (s->w != 0) {
+        if (s->x == x0 && s->w == x1 - x0 + 1 && (y == s->y + s->h || y == s->y - 1)) {
+            if (y < s->y) s->y = y;
+            s->h++;
+            return;
+        }
+        span_flush(s);
+    }
+    *s = (span_t){ x0, y, x1 - x0 + 1, 1, s->color };
+}
+
+typedef void (*plot_fn_t)(void *ctx, int x, int y);
+
+// Visit every pixel of the Bresenham line from (x0, y0) to (x1, y1), in order
+static void line_walk(int x0, int y0, int x1, int y1, plot_fn_t plot, void *ctx) {
+    int dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+    int dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+    int err = dx + dy;
+    int x = x0, y = y0;
+    for (;;) {
+        plot(ctx, x, y);
+        if (x == x1 && y == y1) break;
+        int e2 = 2 * err;
+        if (e2 >= dy) {
+            err += dy;
+            x += sx;
+        }
+        if (e2 <= dx) {
+            err += dx;
+            y += sy;
+        }
+    }
+}
+
+static void plot_run(void *ctx, int x, int y) {
+    span_plot(ctx, x, y);
+}
+
+/**
+ * @brief Draw a straight line between two points (Bresenham)
+ *
+ * Runs of pixels on the same row or column go out as one window, so
+ * horizontal and vertical lines cost a single fill and a shallow diagonal
+ * one window per step.
+ *
+ * @param x0 Start X
+ * @param y0 Start Y
+ * @param x1 End X
+ * @param y1 End Y
+ * @param color 16-bit RGB565 color
+ */
+void st7789_draw_line(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color) {
+    span_t run = { .color = color };
+    line_walk(x0, y0, x1, y1, plot_run, &run);
+    span_flush(&run);
+}
+
+/**
+ * @brief Draw a rectangle outline, one fill per side
+ */
+void st7789_draw_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
+    if (w == 0 || h == 0) return;
+    span_t run = { .color = color };
+    span_row(&run, x, x + w - 1, y);
+    span_flush(&run);
+    if (h > 1) {
+        span_row(&run, x, x + w - 1, y + h - 1);
+        span_flush(&run);
+    }
+    if (h > 2) {
+        run = (span_t){ x, y + 1, 1, h - 2, color };
+        span_flush(&run);
+        if (w > 1) {
+            run = (span_t){ x + w - 1, y + 1, 1, h - 2, color };
+            span_flush(&run);
+        }
+    }
+}
+
+// Arc filter: directions scaled by ARC_ONE, and the sweep between them
+#define ARC_ONE 4096
+typedef struct {
+    int sx, sy, ex, ey;
+    int sweep;     // Degrees, 1-360
+} arc_t;
+
+static bool arc_contains(const arc_t *arc, int dx, int dy) {
+    if (arc == NULL || arc->sweep >= 360) return true;
+    // Screen y grows downwards, so a positive cross product is clockwise
+    int64_t from_start = (int64_t)arc->sx * dy - (int64_t)arc->sy * dx;
+    int64_t to_end = (int64_t)dx * arc->ey - (int64_t)dy * arc->ex;
+    if (arc->sweep <= 180) {
+        return from_start >= 0 && to_end >= 0;
+    }
+    int64_t from_end = (int64_t)arc->ex * dy - (int64_t)arc->ey * dx;
+    int64_t to_start = (int64_t)dx * arc->sy - (int64_t)dy * arc->sx;
+    return !(from_end > 0 && to_start > 0);
+}
+
+/**
+ * @brief Walk a circle outline, or the four corners of a rounded rectangle
+ *
+ * Corner centres are (xl or xr, yt or yb); a circle has xl == xr and
+ * yt == yb. Each octant is walked in order through its own span, so its
+ * flat part becomes horizontal runs and its steep part vertical ones.
+ * Points shared by two octants are plotted once. For a rounded rectangle
+ * the points on the straight edges are left to the caller.
+ */
+static void outline_corners(int xl, int xr, int yt, int yb, int r, const arc_t *arc,
+                            uint16_t color) {
+    span_t runs[8];
+    for (int i = 0; i < 8; i++) {
+        runs[i] = (span_t){ .color = color };
+    }
+    bool circle = xl == xr && yt == yb;
+
+    int x = 0, y = r, d = 1 - r;
+    while (x <= y) {
+        // Octants clockwise from 12 o'clock: (dx, dy) offsets of the point
+        const int off[8][2] = {
+            {  x, -y }, {  y, -x }, {  y,  x }, {  x,  y },
+            { -x,  y }, { -y,  x }, { -y, -x }, { -x, -y },
+        };
+        for (int o = 0; o < 8; o++) {
+            // x == 0 points sit on an axis (or a straight edge); x == y on a diagonal
+            if (x == 0 && (!circle || o == 2 || o == 4 || o == 6 || o == 7)) continue;
+            if (x == y && (o & 1)) continue;
+            int dx = off[o][0], dy = off[o][1];
+            if (!arc_contains(arc, dx, dy)) {
+                span_flush(&runs[o]);
+                continue;
+            }
+            int cx = dx > 0 ? xr : xl;
+            int cy = dy > 0 ? yb : yt;
+            span_plot(&runs[o], cx + dx, cy + dy);
+        }
+        if (d < 0) {
+            d += 2 * x + 3;
+        } else {
+            d += 2 * (x - y) + 5;
+            y--;
+        }
+        x++;
+    }
+    for (int i = 0; i < 8; i++) {
+        span_flush(&runs[i]);
+    }
+}
+
+/**
+ * @brief Scanline-fill a circle, or a rounded rectangle around its corner centres
+ *
+ * The band between the corner centres is one rectangle. The rows above and
+ * below go through one span each, so rows of equal width stack.
+ */
+static void fill_corners(int xl, int xr, int yt, int yb, int r, uint16_t color) {
+    span_t mid = { xl - r, yt, xr - xl + 2 * r + 1, yb - yt + 1, color };
+    span_t upper = { .color = color };
+    span_t lower = { .color = color };
+    span_flush(&mid);
+
+    int x = 0, y = r, f = 1 - r, ddx = 1, ddy = -2 * r;
+    int px = x, py = y;
+    while (x < y) {
+        if (f >= 0) {
+            y--;
+            ddy += 2;
+            f += ddy;
+        }
+        x++;
+        ddx += 2;
+        f += ddx;
+        if (x < y + 1) {
+            span_row(&upper, xl - y, xr + y, yt - x);
+            span_row(&lower, xl - y, xr + y, yb + x);
+        }
+        if (y != py) {
+            span_row(&upper, xl - px, xr + px, yt - py);
+            span_row(&lower, xl - px, xr + px, yb + py);
+            py = y;
+        }
+        px = x;
+    }
+    span_flush(&upper);
+    span_flush(&lower);
+}
+
+/**
+ * @brief Draw a circle outline (midpoint algorithm)
+ *
+ * @param cx Centre X
+ * @param cy Centre Y
+ * @param r Radius in pixels
+ * @param color 16-bit RGB565 color
+ */
+void st7789_draw_circle(uint16_t cx, uint16_t cy, uint16_t r, uint16_t color) {
+    outline_corners(cx, cx, cy, cy, r, NULL, color);
+}
+
+/**
+ * @brief Draw a filled circle
+ */
+void st7789_fill_circle(uint16_t cx, uint16_t cy, uint16_t r, uint16_t color) {
+    fill_corners(cx, cx, cy, cy, r, color);
+}
+
+/**
+ * @brief Draw part of a circle outline
+ *
+ * Angles are in degrees, clockwise from 3 o'clock, and the arc runs
+ * clockwise from start_deg to end_deg. A difference of 360 or more draws
+ * the whole circle.
+ */
+void st7789_draw_arc(uint16_t cx, uint16_t cy, uint16_t r, int16_t start_deg, int16_t end_deg,
+                     uint16_t color) {
+    int sweep = end_deg - start_deg;
+    if (sweep < 360) {
+        sweep = ((sweep % 360) + 360) % 360;
+        if (sweep == 0) return;
+    }
+    float a = start_deg * (float)M_PI / 180.0f;
+    float b = end_deg * (float)M_PI / 180.0f;
+    arc_t arc = {
+        .sx = lroundf(cosf(a) * ARC_ONE), .sy = lroundf(sinf(a) * ARC_ONE),
+        .ex = lroundf(cosf(b) * ARC_ONE), .ey = lroundf(sinf(b) * ARC_ONE),
+        .sweep = sweep,
+    };
+    outline_corners(cx, cx, cy, cy, r, &arc, color);
+}
+
+/**
+ * @brief Corner radius that fits the rectangle
+ *
+ * A side of exactly 2r puts the corner centres one pixel past each other,
+ * so the straight edge between them is empty. Corners of radius 2 or more
+ * still meet across the gap, but a radius-1 corner is only its axis
+ * points, which that edge would have held. On a 2-pixel side those points
+ * make up the whole side, so the corner is drawn square.
+ */
+static uint16_t clamp_radius(uint16_t w, uint16_t h, uint16_t r) {
+    uint16_t max = (w < h ? w : h) / 2;
+    if (r > max) r = max;
+    if (w == 2 || h == 2) r = 0;
+    return r;
+}
+
+/**
+ * @brief Draw a rounded rectangle outline
+ *
+ * The straight sides are one fill each and the corners are quarter circles
+ * of radius r (reduced to fit).
+ */
+void st7789_draw_round_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t r,
+                            uint16_t color) {
+    if (w == 0 || h == 0) return;
+    r = clamp_radius(w, h, r);
+    if (r == 0) {
+        st7789_draw_rect(x, y, w, h, color);
+        return;
+    }
+    int xl = x + r, xr = x + w - 1 - r, yt = y + r, yb = y + h - 1 - r;
+    span_t run = { .color = color };
+    span_row(&run, xl, xr, y);
+    span_flush(&run);
+    span_row(&run, xl, xr, y + h - 1);
+    span_flush(&run);
+    run = (span_t){ x, yt, 1, yb - yt + 1, color };
+    span_flush(&run);
+    run = (span_t){ x + w - 1, yt, 1, yb - yt + 1, color };
+    span_flush(&run);
+    outline_corners(xl, xr, yt, yb, r, NULL, color);
+}
+
+/**
+ * @brief Draw a filled rounded rectangle
+ */
+void st7789_fill_round_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t r,
+                            uint16_t color) {
+    if (w == 0 || h == 0) return;
+    r = clamp_radius(w, h, r);
+    fill_corners(x + r, x + w - 1 - r, y + r, y + h - 1 - r, r, color);
+}
+
+/**
+ * @brief Draw a triangle outline as three lines
+ */
+void st7789_draw_triangle(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
+                          uint16_t x2, uint16_t y2, uint16_t color) {
+    st7789_draw_line(x0, y0, x1, y1, color);
+    st7789_draw_line(x1, y1, x2, y2, color);
+    st7789_draw_line(x2, y2, x0, y0, color);
+}
+
+/**
+ * @brief Fill a polygon with the even-odd rule, one span per row and crossing pair
+ *
+ * A pixel is filled when its centre lies inside the outline, with vertices
+ * at pixel centres, so polygons sharing an edge never overlap and the
+ * right and bottom edges fall just outside. Rows whose span repeats stack
+ * into a single rectangle.
+ *
+ * @param points Vertices in order; the last connects back to the first
+ * @param count Number of vertices, 3 to ST7789_POLYGON_MAX_VERTICES
+ * @param color 16-bit RGB565 color
+ * @return ESP_OK, or ESP_ERR_INVALID_ARG for NULL or a bad vertex count
+ */
+esp_err_t st7789_fill_polygon(const st7789_point_t *points, size_t count, uint16_t color) {
+    if (points == NULL || count < 3 || count > ST7789_POLYGON_MAX_VERTICES) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    int top = points[0].y, bottom = points[0].y;
+    for (size_t i = 1; i < count; i++) {
+        if (points[i].y < top) top = points[i].y;
+        if (points[i].y > bottom) bottom = points[i].y;
+    }
+    if (bottom >= ST7789_HEIGHT) bottom = ST7789_HEIGHT - 1;
+
+    span_t run = { .color = color };
+    int cross[ST7789_POLYGON_MAX_VERTICES];
+    for (int y = top; y <= bottom; y++) {
+        // Each crossing rounded up: pixel x is inside from one up to the next
+        int n = 0;
+        for (size_t i = 0, j = count - 1; i < count; j = i++) {
+            int ya = points[i].y, yb = points[j].y;
+            if ((ya <= y) == (yb <= y)) continue;
+            int64_t den = yb - ya;
+            int64_t num = (int64_t)points[i].x * den + (int64_t)(y - ya) * (points[j].x - points[i].x);
+            if (den < 0) {
+                den = -den;
+                num = -num;
+            }
+            cross[n++] = (int)((num + den - 1) / den);
+        }
+        // Insertion sort; n is small
+        for (int i = 1; i < n; i++) {
+            int v = cross[i], k = i - 1;
+            while (k >= 0 && cross[k] > v) {
+                cross[k + 1] = cross[k];
+                k--;
+            }
+            cross[k + 1] = v;
+        }
+        for (int i = 0; i + 1 < n; i += 2) {
+            // Only rows with a single span can stack with their neighbours
+            if (n > 2) span_flush(&run);
+            span_row(&run, cross[i], cross[i + 1] - 1, y);
+        }
+    }
+    span_flush(&run);
+    return ESP_OK;
+}
+
+// Rows of triangle extents gathered per pass, on the stack
+#define TRIANGLE_BAND_ROWS 40
+
+// Leftmost and rightmost outline pixel of each row in [top, top + TRIANGLE_BAND_ROWS)
+typedef struct {
+    int top;
+    int16_t left[TRIANGLE_BAND_ROWS];
+    int16_t right[TRIANGLE_BAND_ROWS];
+} extent_band_t;
+
+static void plot_extent(void *ctx, int x, int y) {
+    extent_band_t *band = ctx;
+    int row = y - band->top;
+    if (row < 0 || row >= TRIANGLE_BAND_ROWS) return;
+    // Off-panel columns only need to stay off the panel
+    if (x < -1) x = -1;
+    if (x > ST7789_WIDTH) x = ST7789_WIDTH;
+    if (x < band->left[row]) band->left[row] = x;
+    if (x > band->right[row]) band->right[row] = x;
+}
+
+/**
+ * @brief Draw a filled triangle
+ *
+ * Each row is filled between the outermost pixels st7789_draw_triangle()
+ * puts on it, so the fill covers exactly the outline and everything inside
+ * it, and flat or degenerate triangles draw their outline. The outline is
+ * convex, so that is one span per row. It is walked once per band of
+ * TRIANGLE_BAND_ROWS rows.
+ */
+void st7789_fill_triangle(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
+                          uint16_t x2, uint16_t y2, uint16_t color) {
+    int top = y0 < y1 ? y0 : y1;
+    if (y2 < top) top = y2;
+    int bottom = y0 > y1 ? y0 : y1;
+    if (y2 > bottom) bottom = y2;
+    if (bottom >= ST7789_HEIGHT) bottom = ST7789_HEIGHT - 1;
+
+    span_t run = { .color = color };
+    extent_band_t band;
+    for (band.top = top; band.top <= bottom; band.top += TRIANGLE_BAND_ROWS) {
+        for (int i = 0; i < TRIANGLE_BAND_ROWS; i++) {
+            band.left[i] = INT16_MAX;
+            band.right[i] = INT16_MIN;
+        }
+        line_walk(x0, y0, x1, y1, plot_extent, &band);
+        line_walk(x1, y1, x2, y2, plot_extent, &band);
+        line_walk(x2, y2, x0, y0, plot_extent, &band);
+        for (int i = 0; i < TRIANGLE_BAND_ROWS && band.top + i <= bottom; i++) {
+            span_row(&run, band.left[i], band.right[i], band.top + i);
+        }
+    }
+    span_flush(&run);
+}
@@ -0,0 +1,141 @@
+#include "st7789.h"
+#include "st7789_priv.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <string.h>
+
+static const char *TAG = "ST7789_STATS";
+
+static const char *const op_names[ST7789_OP_COUNT] = {
+    [ST7789_OP_INIT] = "init",
+    [ST7789_OP_FILL_RECT] = "fill_rect",
+    [ST7789_OP_DRAW_PIXEL] = "draw_pixel",
+    [ST7789_OP_DRAW_PIXELS] = "draw_pixels",
+    [ST7789_OP_DRAW_CHAR] = "draw_char",
+    [ST7789_OP_DRAW_LARGE_CHAR] = "draw_large_char",
+    [ST7789_OP_DRAW_STRING] = "draw_string",
+    [ST7789_OP_DRAW_LARGE_STRING] = "draw_large_string",
+    [ST7789_OP_DRAW_STRING_SCALED] = "draw_string_scaled",
+    [ST7789_OP_BLIT] = "blit",
+    [ST7789_OP_DRAW_IMAGE] = "draw_image",
+    [ST7789_OP_FLUSH] = "flush",
+};
+
+const char *st7789_op_name(st7789_op_t op) {
+    return op < ST7789_OP_COUNT ? op_names[op] : "?";
+}
+
+#if ST7789_STATS
+
+st7789_stats_t st7789_live_stats;
+bool st7789_live_dc_command;
+
+static TaskHandle_t dump_task;
+static uint32_t dump_period_ms;
+
+int64_t st7789_stats_op_begin(void) {
+    return st7789_async_queueing() ? -1 : esp_timer_get_time();
+}
+
+void st7789_stats_op_end(st7789_op_t op, int64_t start) {
+    if (start < 0) {
+        return;
+    }
+    uint32_t us = (uint32_t)(esp_timer_get_time() - start);
+    st7789_op_stats_t *s = &st7789_live_stats.ops[op];
+    s->calls++;
+    s->total_us += us;
+    if (us > s->max_us) {
+        s->max_us = us;
+    }
+}
+
+void st7789_get_stats(st7789_stats_t *stats) {
+    *stats = st7789_live_stats;
+}
+
+void st7789_reset_stats(void) {
+    memset(&st7789_live_stats, 0, sizeof(st7789_live_stats));
+}
+
+/**
+ * @brief Log the counters as key=value lines
+ *
+ * One line for the bus totals and one per operation that has been called,
+ * so field logs can be grepped and compared between firmware versions.
+ */
+void st7789_stats_dump(void) {
+    st7789_stats_t s = st7789_live_stats;
+    ESP_LOGI(TAG, "bus bytes=%llu commands=%u data_writes=%u dc_transitions=%u yields=%u",
+             (unsigned long long)s.bytes_sent, (unsigned)s.commands_sent,
+             (unsigned)s.data_writes, (unsigned)s.dc_transitions, (unsigned)s.yields);
+    for (int op = 0; op < ST7789_OP_COUNT; op++) {
+        const st7789_op_stats_t *o = &s.ops[op];
+        if (o->calls == 0) {
+            continue;
+        }
+        ESP_LOGI(TAG, "op=%s calls=%u total_us=%llu avg_us=%u max_us=%u",
+                 op_names[op], (unsigned)o->calls, (unsigned long long)o->total_us,
+                 (unsigned)(o->total_us / o->calls), (unsigned)o->max_us);
+    }
+}
+
+static void dump_task_main(void *arg) {
+    (void)arg;
+    for (;;) {
+        // A notification (from stop) ends the wait early
+        if (ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(dump_period_ms)) > 0) {
+            break;
+        }
+        st7789_stats_dump();
+    }
+    dump_task = NULL;
+    vTaskDelete(NULL);
+}
+
+/**
+ * @brief Log the counters every period_ms from a low-priority task
+ */
+esp_err_t st7789_stats_start_dump_task(uint32_t period_ms) {
+    if (dump_task != NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    dump_period_ms = period_ms;
+    if (xTaskCreatePinnedToCore(dump_task_main, "st7789_stats", 3072, NULL, 1,
+                                &dump_task, tskNO_AFFINITY) != pdPASS) {
+        dump_task = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+void st7789_stats_stop_dump_task(void) {
+    if (dump_task != NULL) {
+        xTaskNotifyGive(dump_task);
+    }
+}
+
+#else // !ST7789_STATS
+
+void st7789_get_stats(st7789_stats_t *stats) {
+    memset(stats, 0, sizeof(*stats));
+}
+
+void st7789_reset_stats(void) {
+}
+
+void st7789_stats_dump(void) {
+    ESP_LOGI(TAG, "Driver counters compiled out (ST7789_STATS = 0)");
+}
+
+esp_err_t st7789_stats_start_dump_task(uint32_t period_ms) {
+    (void)period_ms;
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+void st7789_stats_stop_dump_task(void) {
+}
+
+#endif // ST7789_STATS
@@ -0,0 +1,220 @@
+#include "st7789.h"
+#include "st7789_priv.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define ST7789_VSCRDEF  0x33  // Vertical scrolling definition
+#define ST7789_VSCSAD   0x37  // Vertical scroll start address
+
+#define GRAM_ROWS   320                          // Controller GRAM height
+#define TERM_COLS   (ST7789_WIDTH / FONT_WIDTH)  // 30 cells of 8 pixels
+#define TAB_WIDTH   4
+
+static struct {
+    bool active;
+    uint16_t top;          // First GRAM row of the scroll area
+    uint16_t lines;        // Text lines in the scroll area
+    uint16_t first_line;   // Scroll-area line shown at the top of the area
+    uint16_t row;          // Cursor line, 0 = top of the scroll area on screen
+    uint16_t col;          // Cursor cell; TERM_COLS means wrap before the next char
+    uint16_t fg, bg;
+} term;
+
+// GRAM y of a cursor line, following the hardware scroll offset
+static uint16_t line_y(uint16_t row) {
+    return term.top + ((term.first_line + row) % term.lines) * FONT_HEIGHT;
+}
+
+// In async mode scroll commands join the queue, so they land after the line drawn before them
+static void send_command(uint8_t cmd, const uint8_t *params, size_t len) {
+    if (!st7789_async_command(cmd, params, len)) {
+        st7789_bus_command(cmd, params, len);
+    }
+}
+
+static void send_scroll_start(void) {
+    uint16_t vsp = term.top + term.first_line * FONT_HEIGHT;
+    uint8_t p[2] = { vsp >> 8, vsp & 0xFF };
+    send_command(ST7789_VSCSAD, p, sizeof(p));
+}
+
+static void send_scroll_area(uint16_t tfa, uint16_t vsa, uint16_t bfa) {
+    uint8_t p[6] = { tfa >> 8, tfa & 0xFF, vsa >> 8, vsa & 0xFF, bfa >> 8, bfa & 0xFF };
+    send_command(ST7789_VSCRDEF, p, sizeof(p));
+}
+
+/**
+ * @brief Start terminal mode on the rows between the fixed areas
+ *
+ * Programs VSCRDEF so the top_fixed and bottom_fixed rows stay put while the
+ * rows between them scroll in hardware, then clears the scroll area. The
+ * scroll area must be a whole number of 8-pixel text lines. The fixed areas
+ * keep their screen coordinates, so headers and status bars are drawn there
+ * with the normal API. Anything else drawn into the scroll area lands in
+ * GRAM lines that move with the scroll offset.
+ *
+ * Call again after st7789_init(); a reset clears the scroll registers.
+ *
+ * @param config Areas and colors, NULL for ST7789_TERM_CONFIG_DEFAULT()
+ * @return ESP_OK, ESP_ERR_INVALID_ARG if the scroll area is empty or not a
+ *         multiple of 8 rows, or ESP_ERR_INVALID_STATE while a framebuffer
+ *         is enabled (it would not follow the scroll offset)
+ */
+esp_err_t st7789_term_init(const st7789_term_config_t *config) {
+    st7789_term_config_t defaults = ST7789_TERM_CONFIG_DEFAULT();
+    if (config == NULL) {
+        config = &defaults;
+    }
+    if (config->top_fixed + config->bottom_fixed >= ST7789_HEIGHT) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    uint16_t area = ST7789_HEIGHT - config->top_fixed - config->bottom_fixed;
+    if (area % FONT_HEIGHT != 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (st7789_fb_active()) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    term.top = config->top_fixed;
+    term.lines = area / FONT_HEIGHT;
+    term.fg = config->fg_color;
+    term.bg = config->bg_color;
+    term.active = true;
+
+    // GRAM rows past the 240 visible ones belong to the bottom fixed area
+    send_scroll_area(term.top, area, GRAM_ROWS - term.top - area);
+    st7789_term_clear();
+    return ESP_OK;
+}
+
+/**
+ * @brief Leave terminal mode and restore an unscrolled display
+ *
+ * The scroll area keeps its contents but may show them rotated; redraw it.
+ */
+void st7789_term_deinit(void) {
+    if (!term.active) return;
+    term.first_line = 0;
+    send_scroll_area(0, GRAM_ROWS, 0);
+    send_scroll_start();
+    term.active = false;
+}
+
+void st7789_term_set_colors(uint16_t fg_color, uint16_t bg_color) {
+    term.fg = fg_color;
+    term.bg = bg_color;
+}
+
+/**
+ * @brief Blank the scroll area and home the cursor
+ */
+void st7789_term_clear(void) {
+    if (!term.active) return;
+    st7789_fill_rect(0, term.top, ST7789_WIDTH, term.lines * FONT_HEIGHT, term.bg);
+    term.first_line = 0;
+    term.row = 0;
+    term.col = 0;
+    send_scroll_start();
+}
+
+/**
+ * @brief Move the cursor to the start of the next line
+ *
+ * On the last line the oldest line is blanked and becomes the new bottom
+ * line, and VSCSAD moves it into place: one 240x8 fill plus a two-byte
+ * command, whatever the number of lines.
+ */
+void st7789_term_newline(void) {
+    if (!term.active) return;
+    term.col = 0;
+    if (term.row + 1 < term.lines) {
+        term.row++;
+        return;
+    }
+    st7789_fill_rect(0, line_y(0), ST7789_WIDTH, FONT_HEIGHT, term.bg);
+    term.first_line = (term.first_line + 1) % term.lines;
+    send_scroll_start();
+}
+
+/**
+ * @brief Write one character at the cursor
+ *
+ * Handles '\n' (newline), '\r' (start of line), '\t' (next multiple of four
+ * cells), '\b' (cursor back one cell) and '\f' (clear). Lines wrap after the
+ * 30th cell; the wrap is deferred until the next character, so a full line
+ * followed by '\n' does not leave a blank line.
+ */
+void st7789_term_putc(char c) {
+    if (!term.active) return;
+    switch (c) {
+    case '\n':
+        st7789_term_newline();
+        return;
+    case '\r':
+        term.col = 0;
+        return;
+    case '\f':
+        st7789_term_clear();
+        return;
+    case '\b':
+        if (term.col > 0) term.col--;
+        return;
+    case '\t': {
+        uint16_t next = (term.col / TAB_WIDTH + 1) * TAB_WIDTH;
+        while (term.col < next && term.col < TERM_COLS) {
+            st7789_term_putc(' ');
+        }
+        return;
+    }
+    default:
+        break;
+    }
+
+    if (term.col >= TERM_COLS) {
+        st7789_term_newline();
+    }
+    st7789_draw_glyph(ST7789_FONT_8X8, term.col * FONT_WIDTH, line_y(term.row), c,
+                      term.fg, term.bg);
+    term.col++;
+}
+
+void st7789_term_puts(const char *str) {
+    while (*str) {
+        st7789_term_putc(*str++);
+    }
+}
+
+/**
+ * @brief printf() into the terminal
+ *
+ * @return Number of characters written, or a negative value on a format error
+ */
+int st7789_term_printf(const char *fmt, ...) {
+    char small[96];
+    va_list args;
+
+    va_start(args, fmt);
+    int n = vsnprintf(small, sizeof(small), fmt, args);
+    va_end(args);
+    if (n < 0) {
+        return n;
+    }
+    if ((size_t)n < sizeof(small)) {
+        st7789_term_puts(small);
+        return n;
+    }
+
+    char *big = malloc(n + 1);
+    if (big == NULL) {
+        st7789_term_puts(small);   // Truncated rather than lost
+        return sizeof(small) - 1;
+    }
+    va_start(args, fmt);
+    vsnprintf(big, n + 1, fmt, args);
+    va_end(args);
+    st7789_term_puts(big);
+    free(big);
+    return n;
+}
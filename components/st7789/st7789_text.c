@@ -0,0 +1,112 @@
+#include "st7789.h"
+#include "st7789_priv.h"
+#include <string.h>
+
+// Horizontal distance between cells, matching st7789_draw_string() spacing
+static uint16_t cell_pitch(st7789_font_t font) {
+    return font == ST7789_FONT_16X16 ? LARGE_FONT_WIDTH + LARGE_FONT_CHAR_SPACING
+                                     : FONT_WIDTH + FONT_CHAR_SPACING;
+}
+
+static uint16_t cell_width(st7789_font_t font) {
+    return font == ST7789_FONT_16X16 ? LARGE_FONT_WIDTH : FONT_WIDTH;
+}
+
+static uint16_t cell_height(st7789_font_t font) {
+    return font == ST7789_FONT_16X16 ? LARGE_FONT_HEIGHT : FONT_HEIGHT;
+}
+
+/**
+ * @brief Register a single-line text field at a fixed position
+ *
+ * Nothing is drawn until the first st7789_text_field_update().
+ *
+ * @param field Caller-owned field state
+ * @param x X coordinate of the first character cell
+ * @param y Y coordinate of the first character cell
+ * @param font Font used for every cell
+ * @param color 16-bit RGB565 foreground color
+ * @param bg_color 16-bit RGB565 background color
+ */
+void st7789_text_field_init(st7789_text_field_t *field, uint16_t x, uint16_t y,
+                            st7789_font_t font, uint16_t color, uint16_t bg_color) {
+    memset(field, 0, sizeof(*field));
+    field->x = x;
+    field->y = y;
+    field->font = font;
+    field->color = color;
+    field->bg_color = bg_color;
+}
+
+/**
+ * @brief Show new text, redrawing only the character cells that changed
+ *
+ * Each cell is compared against the text last shown. Cells past the end of
+ * a shorter string are cleared with the background color in one fill.
+ * Characters beyond ST7789_TEXT_FIELD_MAX_LEN or the right edge of the
+ * display are dropped, and newlines are not interpreted.
+ *
+ * @param field Field registered with st7789_text_field_init()
+ * @param text New null-terminated text
+ * @return Number of character cells sent to the panel (cleared cells included)
+ */
+int st7789_text_field_update(st7789_text_field_t *field, const char *text) {
+    uint16_t pitch = cell_pitch(field->font);
+    uint16_t cw = cell_width(field->font);
+    uint16_t ch = cell_height(field->font);
+    if (field->x + cw > ST7789_WIDTH || field->y + ch > ST7789_HEIGHT) {
+        return 0;
+    }
+
+    // Cells that fit between the field origin and the right edge
+    size_t max_cells = (ST7789_WIDTH - field->x - cw) / pitch + 1;
+    if (max_cells > ST7789_TEXT_FIELD_MAX_LEN) {
+        max_cells = ST7789_TEXT_FIELD_MAX_LEN;
+    }
+
+    size_t new_len = strnlen(text, max_cells);
+    size_t old_len = field->len;
+    int cells = 0;
+
+    for (size_t i = 0; i < new_len; i++) {
+        if (field->valid && i < old_len && field->text[i] == text[i]) {
+            continue;
+        }
+        st7789_draw_glyph(field->font, field->x + i * pitch, field->y, text[i],
+                          field->color, field->bg_color);
+        cells++;
+    }
+
+    if (new_len < old_len) {
+        uint16_t clear_x = field->x + new_len * pitch;
+        uint16_t clear_w = (old_len - new_len) * pitch - (pitch - cw);
+        st7789_fill_rect(clear_x, field->y, clear_w, ch, field->bg_color);
+        cells += old_len - new_len;
+    }
+
+    memcpy(field->text, text, new_len);
+    field->text[new_len] = '\0';
+    field->len = new_len;
+    field->valid = true;
+    return cells;
+}
+
+/**
+ * @brief Change the field colors; the next update redraws every cell
+ */
+void st7789_text_field_set_colors(st7789_text_field_t *field, uint16_t color, uint16_t bg_color) {
+    if (field->color != color || field->bg_color != bg_color) {
+        field->color = color;
+        field->bg_color = bg_color;
+        field->valid = false;
+    }
+}
+
+/**
+ * @brief Forget what is on screen so the next update redraws every cell
+ *
+ * Call after anything else has drawn over the field, such as a screen clear.
+ */
+void st7789_text_field_invalidate(st7789_text_field_t *field) {
+    field->valid = false;
+}
@@ -0,0 +1,194 @@
+#include "st7789.h"
+#include "st7789_priv.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include <string.h>
+
+static const char *TAG = "ST7789_TRACE";
+
+#if ST7789_TRACE
+
+static st7789_trace_entry_t trace_ring[ST7789_TRACE_ENTRIES];
+static uint32_t trace_head;        // Entries ever written; next slot is head % size
+static bool trace_enabled = true;
+static bool trace_run_open;        // Last entry is a RUN that the next data may extend
+
+static st7789_trace_entry_t *trace_next(uint8_t type) {
+    st7789_trace_entry_t *e = &trace_ring[trace_head % ST7789_TRACE_ENTRIES];
+    trace_head++;
+    memset(e, 0, sizeof(*e));
+    e->timestamp_us = (uint32_t)esp_timer_get_time();
+    e->type = type;
+    return e;
+}
+
+static st7789_trace_entry_t *trace_last(void) {
+    return &trace_ring[(trace_head - 1) % ST7789_TRACE_ENTRIES];
+}
+
+void st7789_trace_command(uint8_t cmd) {
+    if (!trace_enabled) return;
+    st7789_trace_entry_t *e = trace_next(ST7789_TRACE_CMD);
+    e->length = 1;
+    e->inline_len = 1;
+    e->data[0] = cmd;
+    trace_run_open = false;
+}
+
+void st7789_trace_reset(int level) {
+    if (!trace_enabled) return;
+    st7789_trace_entry_t *e = trace_next(ST7789_TRACE_RESET);
+    e->length = level;
+    trace_run_open = false;
+}
+
+// Literal bytes: total length plus the first few bytes inline
+static void trace_literal(const uint8_t *data, size_t len) {
+    st7789_trace_entry_t *e = trace_next(ST7789_TRACE_DATA);
+    e->length = len;
+    e->inline_len = len < sizeof(e->data) ? len : sizeof(e->data);
+    memcpy(e->data, data, e->inline_len);
+    trace_run_open = false;
+}
+
+// A run of identical 16-bit words, merged into the previous run when it continues it
+static void trace_run(uint8_t hi, uint8_t lo, uint32_t words) {
+    if (trace_run_open) {
+        st7789_trace_entry_t *last = trace_last();
+        if (last->data[0] == hi && last->data[1] == lo) {
+            last->length += words;
+            return;
+        }
+    }
+    st7789_trace_entry_t *e = trace_next(ST7789_TRACE_RUN);
+    e->length = words;
+    e->inline_len = 2;
+    e->data[0] = hi;
+    e->data[1] = lo;
+    trace_run_open = true;
+}
+
+/**
+ * @brief Record a data block, run-length coding pixel streams
+ *
+ * Parameter-sized blocks are stored verbatim. Larger blocks are split into
+ * runs of identical 16-bit words (at least ST7789_TRACE_MIN_RUN long) and
+ * literal stretches between them. A block stops being split after
+ * ST7789_TRACE_MAX_SPLIT entries and its remainder is logged as one literal,
+ * so an image costs a bounded number of entries. Consecutive runs of the
+ * same value merge, which turns a chunked fill into a single entry.
+ */
+void st7789_trace_data(const uint8_t *data, size_t len) {
+    if (!trace_enabled || len == 0) return;
+    if (len <= 4 || (len & 1)) {
+        trace_literal(data, len);
+        return;
+    }
+
+    size_t words = len / 2;
+    size_t i = 0;
+    size_t literal_start = 0;
+    int entries = 0;
+    while (i < words && entries < ST7789_TRACE_MAX_SPLIT - 1) {
+        size_t j = i + 1;
+        while (j < words && data[2 * j] == data[2 * i] && data[2 * j + 1] == data[2 * i + 1]) {
+            j++;
+        }
+        if (j - i >= ST7789_TRACE_MIN_RUN) {
+            if (literal_start < i) {
+                trace_literal(data + 2 * literal_start, 2 * (i - literal_start));
+                entries++;
+            }
+            trace_run(data[2 * i], data[2 * i + 1], j - i);
+            entries++;
+            literal_start = j;
+        }
+        i = j;
+    }
+    if (literal_start < words) {
+        trace_literal(data + 2 * literal_start, 2 * (words - literal_start));
+    }
+}
+
+/**
+ * @brief Pause or resume recording
+ */
+void st7789_trace_enable(bool enable) {
+    trace_enabled = enable;
+    trace_run_open = false;
+}
+
+/**
+ * @brief Discard everything recorded so far
+ */
+void st7789_trace_clear(void) {
+    trace_head = 0;
+    trace_run_open = false;
+}
+
+/**
+ * @brief Copy recorded entries out, oldest first
+ *
+ * Once the ring has wrapped only the newest ST7789_TRACE_ENTRIES are kept.
+ *
+ * @param out Destination array
+ * @param max Capacity of out in entries
+ * @return Number of entries copied
+ */
+size_t st7789_trace_read(st7789_trace_entry_t *out, size_t max) {
+    uint32_t count = trace_head < ST7789_TRACE_ENTRIES ? trace_head : ST7789_TRACE_ENTRIES;
+    uint32_t first = trace_head - count;
+    if (count > max) {
+        first += count - max;
+        count = max;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        out[i] = trace_ring[(first + i) % ST7789_TRACE_ENTRIES];
+    }
+    return count;
+}
+
+/**
+ * @brief Log the ring as hex lines for tools/st7789_trace_decode.py
+ *
+ * Each entry is one line of 32 hex digits (the raw 16-byte entry), framed by
+ * begin/end markers that carry the entry and overwrite counts.
+ */
+void st7789_trace_dump(void) {
+    uint32_t count = trace_head < ST7789_TRACE_ENTRIES ? trace_head : ST7789_TRACE_ENTRIES;
+    uint32_t first = trace_head - count;
+    ESP_LOGI(TAG, "begin entries=%u lost=%u", (unsigned)count, (unsigned)first);
+    for (uint32_t i = 0; i < count; i++) {
+        const uint8_t *b = (const uint8_t *)&trace_ring[(first + i) % ST7789_TRACE_ENTRIES];
+        char hex[2 * sizeof(st7789_trace_entry_t) + 1];
+        for (size_t k = 0; k < sizeof(st7789_trace_entry_t); k++) {
+            static const char digits[] = "0123456789abcdef";
+            hex[2 * k] = digits[b[k] >> 4];
+            hex[2 * k + 1] = digits[b[k] & 0xF];
+        }
+        hex[sizeof(hex) - 1] = '\0';
+        ESP_LOGI(TAG, "%s", hex);
+    }
+    ESP_LOGI(TAG, "end");
+}
+
+#else // !ST7789_TRACE
+
+void st7789_trace_enable(bool enable) {
+    (void)enable;
+}
+
+void st7789_trace_clear(void) {
+}
+
+size_t st7789_trace_read(st7789_trace_entry_t *out, size_t max) {
+    (void)out;
+    (void)max;
+    return 0;
+}
+
+void st7789_trace_dump(void) {
+    ESP_LOGI(TAG, "Bus trace compiled out (ST7789_TRACE = 0)");
+}
+
+#endif // ST7789_TRACE
@@ -0,0 +1,88 @@
+#ifndef ST7789_TRANSPORT_H
+#define ST7789_TRANSPORT_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "st7789.h"
+
+/**
+ * @file st7789_transport.h
+ * @brief Internal bus transport interface for the ST7789 driver
+ *
+ * The drawing code in st7789.c never touches the bus directly. Every byte
+ * goes through the three calls below, which are implemented by exactly one
+ * backend selected at build time with ST7789_TRANSPORT:
+ *
+ * - st7789_transport_spi.c:     ESP-IDF spi_master driver with DMA (default)
+ * - st7789_transport_bitbang.c: software SPI on plain GPIOs (fallback)
+ * - st7789_transport_mock.c:    host-side capture for Linux builds
+ *
+ * All writes are synchronous from the caller's point of view: when a call
+ * returns, the bytes are on the wire and the source buffer may be reused.
+ * The one exception is st7789_transport_write_data_async(), which lets the
+ * band renderer overlap drawing with transmission.
+ */
+
+/**
+ * @brief Configure pins and bring up the bus
+ *
+ * Configures DC and RST as outputs plus whatever the backend needs for
+ * clock and data. Leaves DC in data mode and RST released.
+ *
+ * @return ESP_OK on success, error code from the underlying driver otherwise
+ */
+esp_err_t st7789_transport_init(void);
+
+/**
+ * @brief Human-readable backend name for logging
+ */
+const char *st7789_transport_name(void);
+
+/**
+ * @brief Drive the hardware reset line
+ *
+ * @param level 0 to assert reset, 1 to release it
+ */
+void st7789_transport_set_reset(int level);
+
+/**
+ * @brief Send a single command byte with DC low
+ *
+ * DC is returned to data mode afterwards, matching what the panel expects
+ * for the parameter bytes that usually follow.
+ *
+ * @param cmd ST7789 command byte
+ */
+void st7789_transport_write_command(uint8_t cmd);
+
+/**
+ * @brief Send a block of data bytes with DC high
+ *
+ * Large blocks are split and queued by the backend; the call returns once
+ * all of them have been clocked out.
+ *
+ * @param data Bytes to send, in wire order
+ * @param len Number of bytes
+ */
+void st7789_transport_write_data(const uint8_t *data, size_t len);
+
+/**
+ * @brief Start sending a block of data bytes and return without waiting
+ *
+ * The buffer must be DMA-capable, 32-bit aligned, and left untouched until
+ * st7789_transport_wait() returns. Later transport calls stay in order
+ * and, being synchronous, also wait for it. Backends without a background engine send
+ * the block before returning.
+ *
+ * @param data Bytes to send, in wire order
+ * @param len Number of bytes
+ */
+void st7789_transport_write_data_async(const uint8_t *data, size_t len);
+
+/**
+ * @brief Wait until every st7789_transport_write_data_async() block is sent
+ */
+void st7789_transport_wait(void);
+
+#endif // ST7789_TRANSPORT_H
@@ -0,0 +1,73 @@
+#include "st7789_transport.h"
+#include "st7789_priv.h"
+
+#if ST7789_TRANSPORT == ST7789_TRANSPORT_BITBANG
+
+#include "driver/gpio.h"
+#include "esp_attr.h"
+#include "soc/gpio_reg.h"
+#include "soc/soc.h"
+
+// Single-store pin updates straight to the GPIO set/clear registers,
+// bypassing gpio_set_level() and its argument checks
+#define BB_W1TS(mask) REG_WRITE(GPIO_OUT_W1TS_REG, (mask))
+#define BB_W1TC(mask) REG_WRITE(GPIO_OUT_W1TC_REG, (mask))
+
+#include "st7789_bitbang_engine.h"
+
+esp_err_t st7789_transport_init(void) {
+    gpio_config_t io_conf = {
+        .pin_bit_mask = (1ULL << ST7789_SDA_PIN) | (1ULL << ST7789_SCK_PIN) |
+                        (1ULL << ST7789_DC_PIN) | (1ULL << ST7789_RST_PIN),
+        .mode = GPIO_MODE_OUTPUT,
+        .pull_up_en = GPIO_PULLUP_DISABLE,
+        .pull_down_en = GPIO_PULLDOWN_DISABLE,
+        .intr_type = GPIO_INTR_DISABLE,
+    };
+    esp_err_t ret = gpio_config(&io_conf);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    // Set initial pin states
+    gpio_set_level(ST7789_SCK_PIN, 1);  // Clock idles high
+    gpio_set_level(ST7789_SDA_PIN, 0);  // MOSI idle low
+    gpio_set_level(ST7789_DC_PIN, 1);   // Data mode default
+    gpio_set_level(ST7789_RST_PIN, 1);  // Reset released
+    return ESP_OK;
+}
+
+const char *st7789_transport_name(void) {
+    return "Bit-banging SPI (register, unrolled)";
+}
+
+void st7789_transport_set_reset(int level) {
+    ST7789_TRACE_RESET(level);
+    gpio_set_level(ST7789_RST_PIN, level);
+}
+
+// Hot paths live in IRAM so a flash-cache miss never stalls the clock
+void IRAM_ATTR st7789_transport_write_command(uint8_t cmd) {
+    ST7789_BUS_WRITE(true, 1);
+    ST7789_TRACE_COMMAND(cmd);
+    BB_W1TC(BB_DC_MASK);  // DC low = command mode
+    bb_engine_write_byte(cmd);
+    BB_W1TS(BB_DC_MASK);  // Ready for data mode
+}
+
+void IRAM_ATTR st7789_transport_write_data(const uint8_t *data, size_t len) {
+    ST7789_BUS_WRITE(false, len);
+    ST7789_TRACE_DATA(data, len);
+    BB_W1TS(BB_DC_MASK);  // DC high = data mode
+    bb_engine_write_buf(data, len);
+}
+
+// No background engine: the CPU clocks every bit, so async writes are synchronous
+void st7789_transport_write_data_async(const uint8_t *data, size_t len) {
+    st7789_transport_write_data(data, len);
+}
+
+void st7789_transport_wait(void) {
+}
+
+#endif // ST7789_TRANSPORT == ST7789_TRANSPORT_BITBANG
@@ -0,0 +1,71 @@
+#include "st7789_transport.h"
+#include "st7789_priv.h"
+
+#if ST7789_TRANSPORT == ST7789_TRANSPORT_MOCK
+
+#include "st7789_mock.h"
+#include <string.h>
+
+static st7789_mock_stats_t mock_stats;
+static st7789_mock_sink_t mock_sink;
+static void *mock_sink_ctx;
+
+esp_err_t st7789_transport_init(void) {
+    return ESP_OK;
+}
+
+const char *st7789_transport_name(void) {
+    return "Mock (host)";
+}
+
+void st7789_transport_set_reset(int level) {
+    ST7789_TRACE_RESET(level);
+    if (level == 0) {
+        mock_stats.reset_pulses++;
+    }
+}
+
+void st7789_transport_write_command(uint8_t cmd) {
+    ST7789_BUS_WRITE(true, 1);
+    ST7789_TRACE_COMMAND(cmd);
+    mock_stats.command_calls++;
+    if (mock_sink) {
+        mock_sink(true, &cmd, 1, mock_sink_ctx);
+    }
+}
+
+void st7789_transport_write_data(const uint8_t *data, size_t len) {
+    ST7789_BUS_WRITE(false, len);
+    ST7789_TRACE_DATA(data, len);
+    mock_stats.data_calls++;
+    mock_stats.data_bytes += len;
+    mock_stats.last_data_len = len;
+    if (len > mock_stats.max_data_len) {
+        mock_stats.max_data_len = len;
+    }
+    if (mock_sink) {
+        mock_sink(false, data, len, mock_sink_ctx);
+    }
+}
+
+void st7789_transport_write_data_async(const uint8_t *data, size_t len) {
+    st7789_transport_write_data(data, len);
+}
+
+void st7789_transport_wait(void) {
+}
+
+void st7789_mock_set_sink(st7789_mock_sink_t sink, void *ctx) {
+    mock_sink = sink;
+    mock_sink_ctx = ctx;
+}
+
+void st7789_mock_get_stats(st7789_mock_stats_t *out) {
+    *out = mock_stats;
+}
+
+void st7789_mock_reset_stats(void) {
+    memset(&mock_stats, 0, sizeof(mock_stats));
+}
+
+#endif // ST7789_TRANSPORT == ST7789_TRANSPORT_MOCK
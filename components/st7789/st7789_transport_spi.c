@@ -0,0 +1,241 @@
+#include "st7789_transport.h"
+#include "st7789_priv.h"
+
+#if ST7789_TRANSPORT == ST7789_TRANSPORT_SPI
+
+#include "driver/gpio.h"
+#include "driver/spi_master.h"
+#include "esp_attr.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_memory_utils.h"
+#include <string.h>
+
+static const char *TAG = "ST7789_SPI";
+
+static spi_device_handle_t spi_dev;
+static bool bus_owned;      // We initialized the bus, so we free it on failure
+
+// One transaction descriptor and one DMA bounce buffer per queue slot
+static spi_transaction_t trans_pool[ST7789_SPI_QUEUE_SIZE];
+static uint8_t *bounce_buf[ST7789_SPI_QUEUE_SIZE];
+static int trans_next;      // Next free slot in trans_pool
+static int trans_inflight;  // Transactions queued but not yet collected
+
+/**
+ * @brief Drive DC from the transaction's user field before it is clocked out
+ *
+ * Runs in the SPI ISR for queued transactions, so it must live in IRAM.
+ */
+static void IRAM_ATTR spi_pre_transfer_cb(spi_transaction_t *t) {
+    gpio_set_level(ST7789_DC_PIN, (int)(intptr_t)t->user);
+}
+
+// Block until the oldest queued transaction has finished
+static void spi_collect_one(void) {
+    spi_transaction_t *done;
+    spi_device_get_trans_result(spi_dev, &done, portMAX_DELAY);
+    trans_inflight--;
+}
+
+// Block until every queued transaction has finished
+static void spi_collect_all(void) {
+    while (trans_inflight > 0) {
+        spi_collect_one();
+    }
+}
+
+/**
+ * @brief Queue one DMA transaction, waiting for a free slot if necessary
+ *
+ * Slots are reused in order, so the slot being handed out is always the
+ * oldest one; once the queue is full, collecting a single result frees it.
+ * Sources outside DMA-capable memory (flash constants, PSRAM) are copied
+ * into the slot's bounce buffer first, so len must not exceed
+ * ST7789_SPI_BOUNCE_SIZE in that case.
+ */
+static void spi_queue_chunk(const uint8_t *data, size_t len, int dc, bool copy) {
+    if (trans_inflight == ST7789_SPI_QUEUE_SIZE) {
+        spi_collect_one();
+    }
+
+    int slot = trans_next;
+    trans_next = (trans_next + 1) % ST7789_SPI_QUEUE_SIZE;
+
+    if (copy) {
+        memcpy(bounce_buf[slot], data, len);
+        data = bounce_buf[slot];
+    }
+
+    spi_transaction_t *t = &trans_pool[slot];
+    memset(t, 0, sizeof(*t));
+    t->length = len * 8;
+    t->tx_buffer = data;
+    t->user = (void *)(intptr_t)dc;
+
+    spi_device_queue_trans(spi_dev, t, portMAX_DELAY);
+    trans_inflight++;
+}
+
+esp_err_t st7789_transport_init(void) {
+    gpio_config_t io_conf = {
+        .pin_bit_mask = (1ULL << ST7789_DC_PIN) | (1ULL << ST7789_RST_PIN),
+        .mode = GPIO_MODE_OUTPUT,
+        .pull_up_en = GPIO_PULLUP_DISABLE,
+        .pull_down_en = GPIO_PULLDOWN_DISABLE,
+        .intr_type = GPIO_INTR_DISABLE,
+    };
+    esp_err_t ret = gpio_config(&io_conf);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    gpio_set_level(ST7789_DC_PIN, 1);   // Data mode default
+    gpio_set_level(ST7789_RST_PIN, 1);  // Reset released
+
+    spi_bus_config_t buscfg = {
+        .mosi_io_num = ST7789_SDA_PIN,
+        .miso_io_num = -1,
+        .sclk_io_num = ST7789_SCK_PIN,
+        .quadwp_io_num = -1,
+        .quadhd_io_num = -1,
+        .max_transfer_sz = ST7789_SPI_MAX_TRANSFER,
+    };
+    if (spi_dev != NULL) {
+        // st7789_init() again: bus, device and buffers are still set up
+        spi_collect_all();
+        return ESP_OK;
+    }
+
+    ret = spi_bus_initialize(ST7789_SPI_HOST, &buscfg, SPI_DMA_CH_AUTO);
+    if (ret == ESP_ERR_INVALID_STATE) {
+        ESP_LOGI(TAG, "SPI host %d already initialized, sharing it", ST7789_SPI_HOST);
+    } else if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "SPI bus init failed: %s", esp_err_to_name(ret));
+        return ret;
+    }
+    bus_owned = ret == ESP_OK;
+
+    // Panels without CS latch on the rising edge with the clock idling high,
+    // which is SPI mode 3; mode 0 loses the first bit of every transfer.
+    spi_device_interface_config_t devcfg = {
+        .clock_speed_hz = ST7789_SPI_CLOCK_HZ,
+        .mode = 3,
+        .spics_io_num = -1,
+        .queue_size = ST7789_SPI_QUEUE_SIZE,
+        .pre_cb = spi_pre_transfer_cb,
+        .flags = SPI_DEVICE_NO_DUMMY | SPI_DEVICE_HALFDUPLEX,
+    };
+    ret = spi_bus_add_device(ST7789_SPI_HOST, &devcfg, &spi_dev);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "SPI device add failed: %s", esp_err_to_name(ret));
+        spi_dev = NULL;
+        goto fail;
+    }
+
+    for (int i = 0; i < ST7789_SPI_QUEUE_SIZE; i++) {
+        bounce_buf[i] = heap_caps_malloc(ST7789_SPI_BOUNCE_SIZE, MALLOC_CAP_DMA);
+        if (bounce_buf[i] == NULL) {
+            ESP_LOGE(TAG, "Failed to allocate DMA bounce buffers");
+            ret = ESP_ERR_NO_MEM;
+            goto fail;
+        }
+    }
+
+    ESP_LOGI(TAG, "SPI host %d at %d Hz, queue %d, max transfer %d bytes",
+             ST7789_SPI_HOST, ST7789_SPI_CLOCK_HZ, ST7789_SPI_QUEUE_SIZE,
+             ST7789_SPI_MAX_TRANSFER);
+    return ESP_OK;
+
+fail:
+    // Undo everything so a later st7789_init() starts from scratch
+    for (int i = 0; i < ST7789_SPI_QUEUE_SIZE; i++) {
+        heap_caps_free(bounce_buf[i]);
+        bounce_buf[i] = NULL;
+    }
+    if (spi_dev != NULL) {
+        spi_bus_remove_device(spi_dev);
+        spi_dev = NULL;
+    }
+    if (bus_owned) {
+        spi_bus_free(ST7789_SPI_HOST);
+        bus_owned = false;
+    }
+    return ret;
+}
+
+const char *st7789_transport_name(void) {
+    return "SPI master + DMA";
+}
+
+void st7789_transport_set_reset(int level) {
+    ST7789_TRACE_RESET(level);
+    gpio_set_level(ST7789_RST_PIN, level);
+}
+
+void st7789_transport_write_command(uint8_t cmd) {
+    ST7789_BUS_WRITE(true, 1);
+    ST7789_TRACE_COMMAND(cmd);
+    
+    // Polling transfers cannot start while queued ones are pending
+    spi_collect_all();
+    
+    // Commands are tiny: send from the descriptor itself with no DMA setup
+    spi_transaction_t t = {
+        .flags = SPI_TRANS_USE_TXDATA,
+        .length = 8,
+        .user = (void *)0,
+        .tx_data = { cmd },
+    };
+    spi_device_polling_transmit(spi_dev, &t);
+    gpio_set_level(ST7789_DC_PIN, 1);  // Ready for data mode
+}
+
+void st7789_transport_write_data(const uint8_t *data, size_t len) {
+    if (len == 0) {
+        return;
+    }
+    ST7789_BUS_WRITE(false, len);
+    ST7789_TRACE_DATA(data, len);
+
+    if (len <= 4) {
+        spi_collect_all();
+        spi_transaction_t t = {
+            .flags = SPI_TRANS_USE_TXDATA,
+            .length = len * 8,
+            .user = (void *)1,
+        };
+        memcpy(t.tx_data, data, len);
+        spi_device_polling_transmit(spi_dev, &t);
+        return;
+    }
+
+    // Stream straight from DMA-capable memory, otherwise stage through
+    // the bounce buffers while earlier chunks are still on the wire
+    bool copy = !esp_ptr_dma_capable(data) || ((uintptr_t)data & 3) != 0;
+    size_t chunk_max = copy ? ST7789_SPI_BOUNCE_SIZE : ST7789_SPI_MAX_TRANSFER;
+
+    while (len > 0) {
+        size_t chunk = len < chunk_max ? len : chunk_max;
+        spi_queue_chunk(data, chunk, 1, copy);
+        data += chunk;
+        len -= chunk;
+    }
+    spi_collect_all();
+}
+
+void st7789_transport_write_data_async(const uint8_t *data, size_t len) {
+    ST7789_BUS_WRITE(false, len);
+    ST7789_TRACE_DATA(data, len);
+    while (len > 0) {
+        size_t chunk = len < ST7789_SPI_MAX_TRANSFER ? len : ST7789_SPI_MAX_TRANSFER;
+        spi_queue_chunk(data, chunk, 1, false);
+        data += chunk;
+        len -= chunk;
+    }
+}
+
+void st7789_transport_wait(void) {
+    spi_collect_all();
+}
+
+#endif // ST7789_TRANSPORT == ST7789_TRANSPORT_SPI
@@ -0,0 +1,148 @@
+// Generated by tools/st7789_img_encode.py from icons.png. Do not edit.
+
+#include <stddef.h>
+#include <stdint.h>
+
+const uint8_t st7789_bench_icons[] = {
+    0x53, 0x37, 0x51, 0x31, 0xF0, 0x00, 0x28, 0x00, 0xE2, 0xB6, 0xA6, 0x6B, 0xAF, 0x5D, 0xA8, 0x6C,
+    0xA4, 0x7A, 0xD2, 0x1C, 0x36, 0x0B, 0x00, 0xCC, 0xA3, 0xC8, 0xFE, 0x89, 0x44, 0xA5, 0xC8, 0xA2,
+    0xB8, 0xD2, 0x3A, 0x01, 0x25, 0x00, 0xCC, 0xA8, 0xA4, 0xFE, 0x93, 0x80, 0xAB, 0xB3, 0xA5, 0xA6,
+    0xD2, 0x11, 0x02, 0x3A, 0x00, 0xCC, 0xA7, 0x57, 0xB1, 0x15, 0xAA, 0x45, 0xA5, 0x68, 0xD2, 0x2F,
+    0x2C, 0x31, 0x00, 0xCC, 0xA3, 0xBB, 0xA8, 0xDE, 0xA4, 0xBC, 0xA3, 0xAA, 0xD2, 0x0D, 0x00, 0x37,
+    0x9D, 0x66, 0xCC, 0xA8, 0x48, 0xFE, 0x03, 0x4F, 0xAB, 0x39, 0xA5, 0x68, 0xD2, 0x0C, 0x2B, 0x04,
+    0x00, 0xCA, 0xA2, 0x79, 0xB1, 0x4F, 0x0F, 0xD8, 0x22, 0x18, 0x00, 0xC8, 0xA1, 0xA8, 0xFE, 0x79,
+    0x24, 0x17, 0xD8, 0x36, 0x0B, 0x00, 0xC8, 0xA3, 0x97, 0xFE, 0x8B, 0x20, 0xFE, 0xF5, 0x80, 0xD8,
+    0x30, 0x15, 0x00, 0xC8, 0xA2, 0x78, 0xFE, 0x0A, 0xC6, 0x16, 0xD8, 0x1B, 0x11, 0x00, 0xC8, 0x7F,
+    0xFE, 0x61, 0x4D, 0x3A, 0xD8, 0x31, 0x0F, 0x00, 0xC8, 0xA3, 0x78, 0xFE, 0x03, 0x0D, 0x33, 0xD8,
+    0x13, 0x16, 0x00, 0xC7, 0x18, 0xFE, 0x3B, 0x78, 0xA6, 0x6B, 0xDA, 0x04, 0x18, 0x00, 0xC6, 0x0B,
+    0xFE, 0xB1, 0xC5, 0x17, 0xDA, 0x2B, 0x0B, 0x00, 0xC6, 0x15, 0xFE, 0xC4, 0x80, 0x36, 0xDA, 0x3C,
+    0x15, 0x00, 0xC6, 0x11, 0xFE, 0x0B, 0xE9, 0xA8, 0x56, 0xDA, 0x1D, 0x11, 0x00, 0xC6, 0x7F, 0xFE,
+    0x89, 0xD3, 0x3A, 0xDA, 0x3E, 0x0F, 0x00, 0xC6, 0xA3, 0x78, 0xFE, 0x04, 0x73, 0x33, 0xDA, 0x34,
+    0x16, 0x00, 0xC6, 0x22, 0xAE, 0x5E, 0xDC, 0x22, 0x00, 0xC6, 0xFE, 0x79, 0x24, 0x17, 0xDC, 0x36,
+    0x00, 0xC6, 0x30, 0xFE, 0xF5, 0x80, 0xDC, 0x30, 0x00, 0xC6, 0x1B, 0xB1, 0x15, 0xDC, 0x1B, 0x00,
+    0xC6, 0x31, 0x3A, 0xDC, 0x31, 0x00, 0xC6, 0x13, 0x33, 0xDC, 0x13, 0x00, 0xC5, 0xA6, 0x6B, 0x0F,
+    0xDE, 0x0B, 0x00, 0xC4, 0x25, 0x17, 0xDE, 0x25, 0x00, 0xC4, 0xA8, 0xA4, 0x36, 0xDE, 0x3A, 0x00,
+    0xC4, 0xA7, 0x57, 0x16, 0xDE, 0x31, 0x00, 0xC4, 0x37, 0xFE, 0xAA, 0x57, 0xDE, 0x37, 0x00, 0xC4,
+    0xA8, 0x48, 0x33, 0xDE, 0x04, 0x00, 0xC4, 0xFE, 0x2A, 0xB2, 0x0F, 0xDE, 0x36, 0x00, 0xC4, 0x01,
+    0x17, 0xDE, 0x01, 0x00, 0xC4, 0x02, 0xB0, 0xC0, 0xDE, 0x02, 0x00, 0xC4, 0x2C, 0x16, 0xDE, 0x2C,
+    0x00, 0xC4, 0xFE, 0x69, 0x6E, 0x3A, 0xDE, 0x00, 0x95, 0x10, 0xC4, 0xFE, 0x03, 0x4F, 0x33, 0xDE,
+    0x2B, 0x00, 0xC4, 0x1C, 0x0F, 0xDE, 0x1C, 0x00, 0xC4, 0xFE, 0xB9, 0xE6, 0x17, 0xDE, 0x3A, 0x00,
+    0xC4, 0xFE, 0xD4, 0xE0, 0x36, 0xDE, 0x11, 0x00, 0xC4, 0x2F, 0x16, 0xDE, 0x2F, 0x00, 0xC4, 0x0D,
+    0xA3, 0xAA, 0xDE, 0x0D, 0x00, 0xC4, 0x0C, 0x33, 0xDE, 0x0C, 0x00, 0xC4, 0x0F, 0xE0, 0x00, 0x00,
+    0xC4, 0x17, 0xE0, 0x00, 0x00, 0xC4, 0x36, 0xCB, 0xFE, 0xF6, 0x6C, 0xA6, 0x6E, 0xA4, 0x6C, 0xA2,
+    0x7B, 0xC0, 0x0B, 0x0D, 0x2D, 0x36, 0xCB, 0x00, 0xC4, 0x16, 0xE0, 0x00, 0x00, 0xC4, 0x3A, 0xE0,
+    0x00, 0x00, 0xC4, 0x33, 0xCB, 0xFE, 0x66, 0x5A, 0xA7, 0xE8, 0xA4, 0xC7, 0x31, 0xC0, 0x14, 0x27,
+    0x99, 0x39, 0x33, 0xCB, 0x00, 0xC4, 0x0F, 0xCB, 0xA8, 0xA4, 0xAB, 0xB4, 0xA7, 0xB5, 0x31, 0xC0,
+    0x14, 0x1F, 0x09, 0x0F, 0xCB, 0x00, 0xC4, 0x17, 0xCC, 0xB1, 0x19, 0xFE, 0xFF, 0x9D, 0x31, 0xC0,
+    0x14, 0x2E, 0x17, 0xCC, 0x00, 0xC4, 0x36, 0xC9, 0xA6, 0x5F, 0x0B, 0x31, 0xC6, 0x0B, 0x1A, 0x36,
+    0xC9, 0x00, 0xC4, 0x16, 0xCB, 0xA6, 0xCA, 0xA9, 0xFB, 0xA6, 0xCA, 0x31, 0xC0, 0x01, 0x2B, 0x2C,
+    0x16, 0xCB, 0x00, 0xC4, 0x3A, 0xCC, 0xB1, 0x43, 0xB9, 0x11, 0x31, 0xC0, 0x1F, 0x30, 0x3A, 0xCC,
+    0x00, 0xC4, 0x33, 0xC9, 0xA7, 0xF8, 0xFE, 0xDF, 0xBE, 0x31, 0xC6, 0x14, 0x09, 0x33, 0xC9, 0x00,
+    0xC4, 0x0F, 0xC9, 0xA6, 0x95, 0xB0, 0xD1, 0x31, 0xC6, 0x37, 0x39, 0x0F, 0xC9, 0x00, 0xC4, 0x17,
+    0xCC, 0xFE, 0xFF, 0x9D, 0x31, 0xC2, 0x14, 0x17, 0xCC, 0x00, 0xC4, 0x36, 0xC8, 0xFE, 0xFF, 0x13,
+    0x31, 0xCA, 0x3A, 0x36, 0xC8, 0x00, 0xC4, 0x16, 0xC9, 0xA4, 0xB9, 0xFE, 0xC7, 0x3A, 0x31, 0xC6,
+    0x1B, 0x0E, 0x16, 0xC9, 0x00, 0xC4, 0xFE, 0xAA, 0x57, 0xCC, 0x1F, 0x31, 0xC2, 0x1F, 0x3A, 0xCC,
+    0x00, 0xC4, 0x33, 0xC8, 0xFE, 0x9E, 0xFC, 0x31, 0xCA, 0x10, 0x33, 0xC8, 0x00, 0xC4, 0x0F, 0xC8,
+    0x39, 0xFE, 0xF7, 0xBF, 0x31, 0xC8, 0x24, 0x39, 0x0F, 0xC8, 0x00, 0xC4, 0x17, 0xCC, 0x31, 0xC4,
+    0x17, 0xCC, 0x00, 0xC4, 0x36, 0xC7, 0xFE, 0xFF, 0x13, 0x31, 0xCC, 0x3A, 0x36, 0xC7, 0x00, 0xC4,
+    0x16, 0xC8, 0x0E, 0xFE, 0xEF, 0xDE, 0x31, 0xC8, 0x1F, 0x0E, 0x16, 0xC8, 0x00, 0xC4, 0xFE, 0xAA,
+    0x57, 0xCC, 0x31, 0xC4, 0x3A, 0xCC, 0x00, 0xC4, 0x33, 0xC7, 0x10, 0x31, 0xCC, 0x10, 0x33, 0xC7,
+    0x00, 0xC4, 0x0F, 0xC7, 0x39, 0x24, 0x31, 0xCA, 0x24, 0x39, 0x0F, 0xC7, 0x00, 0xC4, 0x17, 0xCC,
+    0x31, 0xC4, 0x17, 0xCC, 0x00, 0xC4, 0x36, 0xC6, 0x1A, 0x31, 0xC3, 0xFE, 0xF6, 0xF1, 0x99, 0xC1,
+    0x36, 0xC0, 0x34, 0x24, 0x31, 0xC3, 0x1A, 0x36, 0xC6, 0x00, 0xC4, 0x16, 0xC7, 0x0E, 0x1F, 0x31,
+    0xCA, 0x1F, 0x0E, 0x16, 0xC7, 0x00, 0xC4, 0x3A, 0xCC, 0x31, 0xC4, 0x3A, 0xCC, 0x00, 0xC4, 0x33,
+    0xC6, 0x09, 0x31, 0xC3, 0xFE, 0x8E, 0xDC, 0x98, 0x19, 0x33, 0xC0, 0x27, 0x05, 0x31, 0xC3, 0x09,
+    0x33, 0xC6, 0x00, 0xC4, 0x0F, 0xC7, 0x37, 0x31, 0xCC, 0x37, 0x0F, 0xC7, 0x00, 0xC4, 0x17, 0xCC,
+    0x31, 0xC4, 0x17, 0xCC, 0x00, 0xC4, 0x36, 0xC6, 0x0B, 0x31, 0xC1, 0x64, 0x34, 0x36, 0xC4, 0x34,
+    0x1E, 0x31, 0xC1, 0x0B, 0x36, 0xC6, 0x00, 0xC4, 0x16, 0xC7, 0x1B, 0x31, 0xCC, 0x1B, 0x16, 0xC7,
+    0x00, 0xC4, 0x3A, 0xCC, 0x31, 0xC4, 0x3A, 0xCC, 0x00, 0xC4, 0x33, 0xC6, 0xFE, 0xDF, 0xBE, 0x31,
+    0xC1, 0x46, 0x27, 0x33, 0xC4, 0x27, 0x26, 0x31, 0xC1, 0x14, 0x33, 0xC6, 0x00, 0xC4, 0x0F, 0xC6,
+    0xA8, 0xA4, 0x31, 0xCE, 0x09, 0x0F, 0xC6, 0x00, 0xC4, 0x17, 0xCC, 0x31, 0xC4, 0x17, 0xCC, 0x00,
+    0xC4, 0x36, 0xC5, 0x2D, 0x31, 0xC2, 0x34, 0x36, 0xC6, 0x34, 0x31, 0xC2, 0x2D, 0x36, 0xC5, 0x00,
+    0xC4, 0x16, 0xC6, 0x2C, 0x31, 0xCE, 0x2C, 0x16, 0xC6, 0x00, 0xC4, 0x3A, 0xCC, 0x31, 0xC4, 0x3A,
+    0xCC, 0x00, 0xC4, 0x33, 0xC5, 0xFE, 0x66, 0x5A, 0x31, 0xC2, 0x27, 0x33, 0xC6, 0x27, 0x31, 0xC2,
+    0x14, 0x33, 0xC5, 0x00, 0xC4, 0x0F, 0xC6, 0xB3, 0xD0, 0x31, 0xCE, 0x1F, 0x0F, 0xC6, 0x00, 0xC4,
+    0x17, 0xC6, 0x2E, 0xFE, 0xFF, 0x9D, 0x31, 0xCC, 0x14, 0x2E, 0x17, 0xC6, 0x00, 0xC4, 0x36, 0xC5,
+    0x0D, 0x31, 0xC1, 0x24, 0x36, 0xC8, 0x24, 0x31, 0xC1, 0x0D, 0x36, 0xC5, 0x00, 0xC4, 0x16, 0xC6,
+    0x2B, 0x31, 0xCE, 0x2B, 0x16, 0xC6, 0x00, 0xC4, 0x3A, 0xC6, 0x30, 0xB9, 0x11, 0x31, 0xCC, 0x1F,
+    0x30, 0x3A, 0xC6, 0x00, 0xC4, 0x33, 0xC5, 0xFE, 0xAF, 0x3D, 0x31, 0xC1, 0x05, 0x33, 0xC8, 0x05,
+    0x31, 0xC1, 0x27, 0x33, 0xC5, 0x00, 0xC4, 0x0F, 0xC6, 0xFE, 0xE7, 0x7F, 0x31, 0xCE, 0x14, 0x0F,
+    0xC6, 0x00, 0xC4, 0x17, 0xC6, 0xFE, 0xFF, 0x9D, 0x31, 0xCE, 0x14, 0x17, 0xC6, 0x00, 0xC4, 0x36,
+    0xC5, 0x0B, 0x31, 0xC1, 0x34, 0x36, 0xC8, 0x34, 0x31, 0xC1, 0x0B, 0x36, 0xC5, 0x00, 0xC4, 0x16,
+    0xC6, 0x01, 0x31, 0xCE, 0x01, 0x16, 0xC6, 0x00, 0xC4, 0x3A, 0xC6, 0x1F, 0x31, 0xCE, 0x1F, 0x3A,
+    0xC6, 0x00, 0xC4, 0x33, 0xC5, 0xFE, 0xDF, 0xBE, 0x31, 0xC1, 0xFE, 0x35, 0xD9, 0x33, 0xC8, 0x27,
+    0x31, 0xC1, 0x14, 0x33, 0xC5, 0x00, 0xC4, 0x0F, 0xC6, 0x31, 0xD0, 0x0F, 0xC6, 0x00, 0xC4, 0x17,
+    0xC6, 0x31, 0xD0, 0x17, 0xC6, 0x00, 0xC4, 0x36, 0xC5, 0x31, 0xC2, 0x36, 0xCA, 0x31, 0xC2, 0x36,
+    0xC5, 0x00, 0xC4, 0x16, 0xC6, 0x31, 0xD0, 0x16, 0xC6, 0x00, 0xC4, 0x3A, 0xC6, 0x31, 0xD0, 0x3A,
+    0xC6, 0x00, 0xC4, 0x33, 0xC5, 0x31, 0xC2, 0x33, 0xCA, 0x31, 0xC2, 0x33, 0xC5, 0x00, 0xC4, 0x0F,
+    0xC6, 0x31, 0xD0, 0x0F, 0xC6, 0x00, 0xC4, 0x17, 0xC6, 0x31, 0xD0, 0x17, 0xC6, 0x00, 0xC4, 0x36,
+    0xC5, 0x31, 0xC2, 0x36, 0xCA, 0x31, 0xC2, 0x36, 0xC5, 0x00, 0xC4, 0x16, 0xC6, 0x31, 0xD0, 0x16,
+    0xC6, 0x00, 0xC4, 0x3A, 0xC6, 0x31, 0xD0, 0x3A, 0xC6, 0x00, 0xC4, 0x33, 0xC5, 0x31, 0xC2, 0x33,
+    0xCA, 0x31, 0xC2, 0x33, 0xC5, 0x00, 0xC4, 0x0F, 0xC6, 0xFE, 0xE7, 0x7F, 0x31, 0xCE, 0x14, 0x0F,
+    0xC6, 0x00, 0xC4, 0x17, 0xC6, 0xFE, 0xFF, 0x9D, 0x31, 0xCE, 0x14, 0x17, 0xC6, 0x00, 0xC4, 0x36,
+    0xC5, 0x0B, 0x31, 0xC1, 0x34, 0x36, 0xC8, 0x34, 0x31, 0xC1, 0x0B, 0x36, 0xC5, 0x00, 0xC4, 0x16,
+    0xC6, 0x01, 0x31, 0xCE, 0x01, 0x16, 0xC6, 0x00, 0xC4, 0x3A, 0xC6, 0x1F, 0x31, 0xCE, 0x1F, 0x3A,
+    0xC6, 0x00, 0xC4, 0x33, 0xC5, 0xFE, 0xDF, 0xBE, 0x31, 0xC1, 0x27, 0x33, 0xC8, 0x27, 0x31, 0xC1,
+    0x14, 0x33, 0xC5, 0x00, 0xC4, 0x0F, 0xC6, 0xB3, 0xD0, 0x31, 0xCE, 0x1F, 0x0F, 0xC6, 0x00, 0xC4,
+    0x17, 0xC6, 0x2E, 0xFE, 0xFF, 0x9D, 0x31, 0xCC, 0x14, 0x2E, 0x17, 0xC6, 0x00, 0xC4, 0x36, 0xC5,
+    0x0D, 0x31, 0xC1, 0x24, 0x36, 0xC8, 0x24, 0x31, 0xC1, 0x0D, 0x36, 0xC5, 0x00, 0xC4, 0x16, 0xC6,
+    0x2B, 0x31, 0xCE, 0x2B, 0x16, 0xC6, 0x00, 0xC4, 0x3A, 0xC6, 0x30, 0xB9, 0x11, 0x31, 0xCC, 0x1F,
+    0x30, 0x3A, 0xC6, 0x00, 0xC4, 0x33, 0xC5, 0xFE, 0xAF, 0x3D, 0x31, 0xC1, 0x05, 0x33, 0xC8, 0x05,
+    0x31, 0xC1, 0x27, 0x33, 0xC5, 0x00, 0xC4, 0x0F, 0xC6, 0x09, 0x31, 0xCE, 0x09, 0x0F, 0xC6, 0x00,
+    0xC4, 0x17, 0xCC, 0x31, 0xC4, 0x17, 0xCC, 0x00, 0xC4, 0x36, 0xC5, 0x2D, 0x31, 0xC2, 0x34, 0x36,
+    0xC6, 0x34, 0x31, 0xC2, 0x2D, 0x36, 0xC5, 0x00, 0xC4, 0x16, 0xC6, 0x2C, 0x31, 0xCE, 0x2C, 0x16,
+    0xC6, 0x00, 0xC4, 0x3A, 0xCC, 0x31, 0xC4, 0x3A, 0xCC, 0x00, 0xC4, 0x33, 0xC5, 0xFE, 0x66, 0x5A,
+    0x31, 0xC2, 0xFE, 0x35, 0xD9, 0x33, 0xC6, 0x27, 0x31, 0xC2, 0x14, 0x33, 0xC5, 0x00, 0xC4, 0x0F,
+    0xC7, 0x37, 0x31, 0xCC, 0x37, 0x0F, 0xC7, 0x00, 0xC4, 0x17, 0xCC, 0x31, 0xC4, 0x17, 0xCC, 0x00,
+    0xC4, 0x36, 0xC6, 0x0B, 0x31, 0xC1, 0x1E, 0x34, 0x36, 0xC4, 0x34, 0x1E, 0x31, 0xC1, 0x0B, 0x36,
+    0xC6, 0x00, 0xC4, 0x16, 0xC7, 0x1B, 0x31, 0xCC, 0x1B, 0x16, 0xC7, 0x00, 0xC4, 0x3A, 0xCC, 0x31,
+    0xC4, 0x3A, 0xCC, 0x00, 0xC4, 0x33, 0xC6, 0xFE, 0xDF, 0xBE, 0x31, 0xC1, 0x26, 0x27, 0x33, 0xC4,
+    0x27, 0x26, 0x31, 0xC1, 0x14, 0x33, 0xC6, 0x00, 0xC4, 0x0F, 0xC7, 0x39, 0xFE, 0xF7, 0xBF, 0x31,
+    0xCA, 0x24, 0x39, 0x0F, 0xC7, 0x00, 0xC4, 0x17, 0xCC, 0x31, 0xC4, 0x17, 0xCC, 0x00, 0xC4, 0x36,
+    0xC6, 0x1A, 0x31, 0xC3, 0xFE, 0xF6, 0xF1, 0x34, 0x36, 0xC0, 0x34, 0x24, 0x31, 0xC3, 0x1A, 0x36,
+    0xC6, 0x00, 0xC4, 0x16, 0xC7, 0x0E, 0xFE, 0xEF, 0xDE, 0x31, 0xCA, 0x1F, 0x0E, 0x16, 0xC7, 0x00,
+    0xC4, 0x3A, 0xCC, 0x31, 0xC4, 0x3A, 0xCC, 0x00, 0xC4, 0x33, 0xC6, 0xA7, 0xF8, 0x31, 0xC3, 0x05,
+    0x27, 0x33, 0xC0, 0x27, 0x05, 0x31, 0xC3, 0x09, 0x33, 0xC6, 0x00, 0xC4, 0x0F, 0xC8, 0x39, 0xFE,
+    0xF7, 0xBF, 0x31, 0xC8, 0x24, 0x39, 0x0F, 0xC8, 0x00, 0xC4, 0x17, 0xCC, 0x31, 0xC4, 0x17, 0xCC,
+    0x00, 0xC4, 0x36, 0xC7, 0xFE, 0xFF, 0x13, 0x31, 0xCC, 0x3A, 0x36, 0xC7, 0x00, 0xC4, 0x16, 0xC8,
+    0x0E, 0x1F, 0x31, 0xC8, 0x1F, 0x0E, 0x16, 0xC8, 0x00, 0xC4, 0xFE, 0xAA, 0x57, 0xCC, 0x31, 0xC4,
+    0x3A, 0xCC, 0x00, 0xC4, 0x33, 0xC7, 0x10, 0x31, 0xCC, 0x10, 0x33, 0xC7, 0x00, 0xC4, 0x0F, 0xC9,
+    0x39, 0x37, 0x31, 0xC6, 0x37, 0x39, 0x0F, 0xC9, 0x00, 0xC4, 0x17, 0xCC, 0xFE, 0xFF, 0x9D, 0x31,
+    0xC2, 0x14, 0x17, 0xCC, 0x00, 0xC4, 0x36, 0xC8, 0xFE, 0xFF, 0x13, 0x31, 0xCA, 0x3A, 0x36, 0xC8,
+    0x00, 0xC4, 0x16, 0xC9, 0x0E, 0x1B, 0x31, 0xC6, 0x1B, 0x0E, 0x16, 0xC9, 0x00, 0xC4, 0xFE, 0xAA,
+    0x57, 0xCC, 0xFE, 0xF7, 0x9F, 0x31, 0xC2, 0x1F, 0x3A, 0xCC, 0x00, 0xC4, 0x33, 0xC8, 0x10, 0x31,
+    0xCA, 0x10, 0x33, 0xC8, 0x00, 0xC4, 0x0F, 0xCB, 0xA8, 0xA4, 0xAB, 0xB4, 0xA7, 0xB5, 0x31, 0xC0,
+    0x14, 0x1F, 0x09, 0x0F, 0xCB, 0x00, 0xC4, 0x17, 0xCC, 0x2E, 0xFE, 0xFF, 0x9D, 0x31, 0xC0, 0x14,
+    0x2E, 0x17, 0xCC, 0x00, 0xC4, 0x36, 0xC9, 0x1A, 0x0B, 0x31, 0xC6, 0x0B, 0x1A, 0x36, 0xC9, 0x00,
+    0xC4, 0x16, 0xCB, 0x2C, 0x2B, 0x01, 0x31, 0xC0, 0x01, 0x2B, 0x2C, 0x16, 0xCB, 0x00, 0xC4, 0x3A,
+    0xCC, 0x30, 0xB9, 0x11, 0x31, 0xC0, 0x1F, 0x30, 0x3A, 0xCC, 0x00, 0xC4, 0x33, 0xC9, 0xA7, 0xF8,
+    0xFE, 0xDF, 0xBE, 0x31, 0xC6, 0x14, 0x09, 0x33, 0xC9, 0x00, 0xC4, 0x0F, 0xE0, 0x00, 0x00, 0xC4,
+    0x17, 0xE0, 0x00, 0x00, 0xC4, 0x36, 0xCB, 0x2D, 0x0D, 0x0B, 0x31, 0xC0, 0x0B, 0x0D, 0x2D, 0x36,
+    0xCB, 0x00, 0xC4, 0x16, 0xE0, 0x00, 0x00, 0xC4, 0x3A, 0xE0, 0x00, 0x00, 0xC4, 0x33, 0xCB, 0xFE,
+    0x66, 0x5A, 0xA7, 0xE8, 0xA4, 0xC7, 0x31, 0xC0, 0x14, 0x27, 0x99, 0x39, 0x33, 0xCB, 0x00, 0xC4,
+    0x1C, 0x0F, 0xDE, 0x1C, 0x00, 0xC4, 0xFE, 0xB9, 0xE6, 0x17, 0xDE, 0x3A, 0x00, 0xC4, 0x11, 0x36,
+    0xDE, 0x11, 0x00, 0xC4, 0x2F, 0x16, 0xDE, 0x2F, 0x00, 0xC4, 0xFE, 0x91, 0xF4, 0xA3, 0xAA, 0xDE,
+    0x0D, 0x00, 0xC4, 0x0C, 0x33, 0xDE, 0x0C, 0x00, 0xC4, 0xFE, 0x2A, 0xB2, 0x0F, 0xDE, 0x36, 0x00,
+    0xC4, 0xFE, 0x89, 0x44, 0x17, 0xDE, 0x01, 0x00, 0xC4, 0x02, 0xB0, 0xC0, 0xDE, 0x02, 0x00, 0xC4,
+    0xFE, 0x0B, 0x07, 0x16, 0xDE, 0x2C, 0x00, 0xC4, 0xFE, 0x69, 0x6E, 0x3A, 0xDE, 0x00, 0x95, 0x10,
+    0xC4, 0xFE, 0x03, 0x4F, 0x33, 0xDE, 0x2B, 0x00, 0xC4, 0xA6, 0x6B, 0x0F, 0xDE, 0x0B, 0x00, 0xC4,
+    0x25, 0x17, 0xDE, 0x25, 0x00, 0xC4, 0xA8, 0xA4, 0x36, 0xDE, 0x3A, 0x00, 0xC4, 0xA7, 0x57, 0x16,
+    0xDE, 0x31, 0x00, 0xC4, 0xA3, 0xBB, 0xFE, 0xAA, 0x57, 0xDE, 0x37, 0x00, 0xC4, 0x04, 0x33, 0xDE,
+    0x04, 0x00, 0xC5, 0x22, 0x0F, 0xDC, 0x22, 0x00, 0xC6, 0xFE, 0x79, 0x24, 0x17, 0xDC, 0x36, 0x00,
+    0xC6, 0xFE, 0x8B, 0x20, 0xFE, 0xF5, 0x80, 0xDC, 0x30, 0x00, 0xC6, 0xFE, 0x0A, 0xC6, 0x16, 0xDC,
+    0x1B, 0x00, 0xC6, 0xFE, 0x61, 0x4D, 0x3A, 0xDC, 0x31, 0x00, 0xC6, 0x13, 0x33, 0xDC, 0x13, 0x00,
+    0xC6, 0x18, 0xFE, 0x3B, 0x78, 0x0F, 0xDA, 0x04, 0x18, 0x00, 0xC6, 0xA1, 0xA8, 0xFE, 0xB1, 0xC5,
+    0x17, 0xDA, 0x2B, 0x0B, 0x00, 0xC6, 0x15, 0x3C, 0x36, 0xDA, 0x3C, 0x15, 0x00, 0xC6, 0xA2, 0x78,
+    0x1D, 0x16, 0xDA, 0x1D, 0x11, 0x00, 0xC6, 0x7F, 0x3E, 0x3A, 0xDA, 0x3E, 0x0F, 0x00, 0xC6, 0xA3,
+    0x78, 0xFE, 0x04, 0x73, 0x33, 0xDA, 0x34, 0x16, 0x00, 0xC7, 0x18, 0x22, 0xAE, 0x5E, 0xD8, 0x22,
+    0x18, 0x00, 0xC8, 0x0B, 0xFE, 0x79, 0x24, 0x17, 0xD8, 0x36, 0x0B, 0x00, 0xC8, 0x15, 0x30, 0xFE,
+    0xF5, 0x80, 0xD8, 0x30, 0x15, 0x00, 0xC8, 0x11, 0x1B, 0xB1, 0x15, 0xD8, 0x1B, 0x11, 0x00, 0xC8,
+    0x7F, 0x31, 0x3A, 0xD8, 0x31, 0x0F, 0x00, 0xC8, 0xA3, 0x78, 0x13, 0x33, 0xD8, 0x13, 0x16, 0x00,
+    0xCA, 0xA6, 0x6B, 0xAF, 0x5D, 0x1C, 0xA4, 0x7A, 0xD2, 0x1C, 0x36, 0x0B, 0x00, 0xCC, 0x25, 0x01,
+    0xA5, 0xC8, 0x17, 0xD2, 0x3A, 0x01, 0x25, 0x00, 0xCC, 0xA8, 0xA4, 0x02, 0xAB, 0xB3, 0xA5, 0xA6,
+    0xD2, 0x11, 0x02, 0x3A, 0x00, 0xCC, 0xA7, 0x57, 0x2C, 0x2F, 0xA5, 0x68, 0xD2, 0x2F, 0x2C, 0x31,
+    0x00, 0xCC, 0x37, 0xA8, 0xDE, 0x0D, 0xA3, 0xAA, 0xD2, 0x0D, 0x00, 0x37, 0x9D, 0x66, 0xCC, 0xA8,
+    0x48, 0xFE, 0x03, 0x4F, 0x0C, 0x33, 0xD2, 0x0C, 0x2B, 0x04, 0x00, 0xE2, 0xB5,
+};
+
+const size_t st7789_bench_icons_size = sizeof(st7789_bench_icons);
@@ -0,0 +1,1087 @@
+// Generated by tools/st7789_img_encode.py from photo.png. Do not edit.
+
+#include <stddef.h>
+#include <stdint.h>
+
+const uint8_t st7789_bench_photo[] = {
+    0x53, 0x37, 0x51, 0x31, 0x78, 0x00, 0x78, 0x00, 0xFE, 0x55, 0x90, 0x6C, 0xA1, 0xA7, 0x7E, 0x9D,
+    0xA7, 0xA0, 0xA7, 0xA0, 0xA9, 0x9D, 0xB8, 0x76, 0x9E, 0xBA, 0x9B, 0xBA, 0x7B, 0x9C, 0xAA, 0x9D,
+    0xAA, 0x63, 0x9F, 0xAB, 0x57, 0x9D, 0xAA, 0x5B, 0x63, 0xA2, 0x78, 0x56, 0x52, 0xA2, 0x89, 0x51,
+    0x6B, 0x14, 0x6B, 0x59, 0x9D, 0x99, 0x14, 0xC0, 0x65, 0x65, 0x6E, 0x69, 0xA2, 0x97, 0x59, 0x7D,
+    0x6E, 0x6D, 0xA3, 0x87, 0x58, 0xA3, 0x87, 0x12, 0xA3, 0x77, 0xA2, 0x77, 0x59, 0xA2, 0x67, 0xA4,
+    0x67, 0x6E, 0xA2, 0x67, 0x46, 0x6E, 0x4A, 0xA3, 0x88, 0x5F, 0x42, 0xA2, 0x88, 0x41, 0x2D, 0x56,
+    0x6E, 0x6B, 0xC0, 0x56, 0x7F, 0x29, 0xC0, 0x6E, 0x29, 0xC0, 0x69, 0xC0, 0xA2, 0x98, 0x9D, 0x98,
+    0xA3, 0x88, 0x7A, 0x15, 0x69, 0xA1, 0xA9, 0x65, 0x7A, 0xC0, 0x09, 0x7F, 0x61, 0x3B, 0x7F, 0x9D,
+    0xA9, 0x66, 0x7F, 0x71, 0x28, 0xA1, 0xA9, 0x51, 0x21, 0x7F, 0x2B, 0x51, 0x30, 0x51, 0x30, 0xC1,
+    0x6E, 0x26, 0x6E, 0xA2, 0x78, 0x55, 0xA2, 0x88, 0x59, 0x08, 0x6E, 0x07, 0x55, 0x6E, 0x09, 0xA2,
+    0x68, 0x6E, 0xA1, 0x3D, 0x60, 0x12, 0xA2, 0xA8, 0x75, 0x09, 0x0A, 0x72, 0x3C, 0x9C, 0xBA, 0x9D,
+    0xAA, 0x77, 0x9C, 0xAA, 0x16, 0x9D, 0x9A, 0x9D, 0xAB, 0x6F, 0x53, 0x57, 0x7F, 0x42, 0x6F, 0x52,
+    0x6E, 0xA2, 0x89, 0x51, 0x5A, 0x1F, 0x0B, 0x6E, 0xC0, 0x0C, 0x00, 0xC0, 0xA2, 0x87, 0x79, 0x6E,
+    0x02, 0x6D, 0x06, 0x7E, 0x5C, 0xA3, 0x87, 0x6D, 0xA2, 0x66, 0xA3, 0x88, 0x5D, 0x5D, 0x28, 0x5E,
+    0x34, 0x3B, 0x5F, 0xA3, 0x78, 0x55, 0x5A, 0x20, 0x5F, 0x15, 0x6F, 0x5A, 0x56, 0x1D, 0x25, 0x31,
+    0x56, 0x31, 0xC0, 0x29, 0x1D, 0x31, 0xC1, 0x79, 0xC0, 0x32, 0x15, 0x7F, 0x2C, 0x69, 0x7A, 0x17,
+    0x75, 0x66, 0x07, 0xC0, 0x9D, 0xA9, 0x03, 0x7A, 0x9D, 0xA9, 0x52, 0x7A, 0x62, 0xC0, 0x7B, 0x61,
+    0x66, 0x6F, 0x7B, 0x12, 0xC0, 0x66, 0x26, 0x12, 0xA2, 0x87, 0x56, 0x1C, 0xA2, 0x77, 0x51, 0xA2,
+    0x77, 0x6E, 0xA2, 0x88, 0x30, 0x5A, 0x03, 0x34, 0xA2, 0x77, 0x0A, 0x07, 0x09, 0x16, 0xA0, 0xA7,
+    0x20, 0x75, 0x9E, 0xB8, 0x72, 0x9D, 0xB9, 0x23, 0x9D, 0xBA, 0x9D, 0xBB, 0xA0, 0x9A, 0x9C, 0xAA,
+    0x9F, 0x9B, 0x9D, 0x9A, 0x67, 0xA0, 0x8A, 0x01, 0x6F, 0x52, 0x5B, 0x6F, 0xC0, 0x56, 0xA2, 0x89,
+    0x59, 0x51, 0xA3, 0x99, 0x19, 0x66, 0x7E, 0x08, 0xA2, 0x98, 0x04, 0x7E, 0xC0, 0x74, 0x7E, 0x16,
+    0x54, 0xA2, 0x87, 0x7D, 0x18, 0x0F, 0x6D, 0xA4, 0x66, 0x59, 0x26, 0x35, 0xA2, 0x77, 0xA2, 0x67,
+    0x34, 0xA4, 0x67, 0x46, 0xA2, 0x77, 0xA2, 0x78, 0x5F, 0x41, 0x6B, 0xA2, 0x78, 0x5A, 0x1E, 0xA2,
+    0x88, 0x1D, 0xC0, 0xA3, 0x88, 0x52, 0xC1, 0x1D, 0xA2, 0x88, 0xC0, 0x65, 0x6E, 0x32, 0xC0, 0x61,
+    0x79, 0x11, 0xC0, 0x75, 0x0B, 0x0E, 0x04, 0x07, 0x61, 0x03, 0x66, 0x76, 0x9D, 0x99, 0xA0, 0xA9,
+    0xC0, 0x9D, 0xAA, 0x7F, 0x62, 0x9D, 0x99, 0xA2, 0x88, 0x9D, 0x99, 0x7B, 0x7F, 0x5A, 0x21, 0x9D,
+    0x89, 0x7F, 0x05, 0x12, 0xA2, 0x88, 0x59, 0x66, 0x0D, 0xA3, 0x88, 0x2B, 0x59, 0x6E, 0x6E, 0x3A,
+    0x23, 0xA4, 0x77, 0x2F, 0x34, 0x36, 0x15, 0x11, 0x1A, 0x71, 0x9F, 0xB9, 0x01, 0x9B, 0xBA, 0x26,
+    0x9D, 0xBB, 0x12, 0x9E, 0x9B, 0x9D, 0x9A, 0x9D, 0xAB, 0xA1, 0x8A, 0x57, 0x9D, 0x9A, 0x5B, 0x57,
+    0xA3, 0x89, 0x5A, 0x5B, 0x51, 0xA2, 0x78, 0x6F, 0x51, 0x1D, 0x15, 0xC0, 0x65, 0x7E, 0xC0, 0x7A,
+    0x7A, 0x64, 0x1B, 0x69, 0x65, 0x7D, 0x7D, 0x6D, 0x69, 0x6C, 0xA5, 0x77, 0x68, 0xA3, 0x77, 0xA3,
+    0x77, 0xA2, 0x66, 0x6E, 0xA2, 0x66, 0x3E, 0x34, 0xA3, 0x78, 0x4A, 0xA2, 0x78, 0x5E, 0x46, 0xA2,
+    0x88, 0xA2, 0x68, 0x9D, 0x99, 0xA2, 0x79, 0x51, 0x39, 0x5A, 0x9D, 0x99, 0xC1, 0x6F, 0x31, 0xC0,
+    0x1D, 0x31, 0x50, 0x25, 0x2D, 0x69, 0x7A, 0x65, 0x20, 0x28, 0x75, 0x9D, 0x99, 0xA0, 0xA8, 0x3B,
+    0x66, 0x34, 0x76, 0x23, 0x3A, 0x9C, 0x99, 0x7B, 0x62, 0x21, 0x9D, 0x99, 0xA2, 0x89, 0x05, 0x7F,
+    0x66, 0x6B, 0x66, 0xC1, 0x52, 0xA2, 0x88, 0x04, 0x7E, 0x11, 0xC0, 0xA2, 0x87, 0x14, 0x6E, 0x55,
+    0xA3, 0x87, 0x21, 0x59, 0xA2, 0x77, 0x5D, 0xA2, 0x88, 0x49, 0x32, 0x2F, 0xA7, 0x17, 0x9F, 0xB9,
+    0x07, 0x34, 0xA0, 0xA9, 0x9B, 0xBA, 0x73, 0x9C, 0xAA, 0x05, 0x11, 0x9D, 0x9B, 0xA0, 0x9A, 0x9C,
+    0x8A, 0xA2, 0x79, 0x00, 0xA2, 0x79, 0x5B, 0xC0, 0x56, 0x5A, 0x5F, 0xC0, 0x6F, 0x55, 0xA2, 0x88,
+    0x17, 0x26, 0xC0, 0x1A, 0x7F, 0x11, 0x66, 0x1C, 0x10, 0x7A, 0x69, 0x79, 0x09, 0x69, 0xA2, 0x86,
+    0x06, 0x38, 0x1B, 0x68, 0x5D, 0xA4, 0x66, 0xA3, 0x77, 0x5E, 0xA2, 0x76, 0x03, 0x45, 0x07, 0x5E,
+    0xA2, 0x78, 0x5E, 0x56, 0x1D, 0x56, 0x5A, 0xA3, 0x89, 0x25, 0x56, 0xC0, 0x22, 0x6B, 0x55, 0xA3,
+    0x99, 0x1D, 0x29, 0xA2, 0x87, 0x1D, 0x25, 0x7E, 0x65, 0xC0, 0x15, 0x20, 0xC0, 0x1C, 0x72, 0x7A,
+    0x07, 0x61, 0x34, 0x62, 0xA1, 0xB9, 0x35, 0x9C, 0x99, 0x7B, 0x9D, 0xAA, 0x66, 0x62, 0x19, 0x9D,
+    0x99, 0xA1, 0xAA, 0x04, 0x66, 0x7F, 0x06, 0x66, 0xC0, 0x66, 0xA2, 0x78, 0x51, 0x01, 0x06, 0xC1,
+    0xA2, 0x87, 0x04, 0x69, 0x0F, 0xA2, 0x77, 0x0A, 0x08, 0x12, 0xA2, 0x77, 0x17, 0xA2, 0x77, 0x6E,
+    0x0B, 0x9F, 0xB9, 0x9D, 0xB9, 0x9E, 0xBA, 0x35, 0x1C, 0x9D, 0xAA, 0x9E, 0xAB, 0x9D, 0xAB, 0x9F,
+    0x9B, 0x9C, 0x8A, 0x02, 0x9F, 0x8B, 0xA1, 0x8A, 0x9D, 0x89, 0xA2, 0x68, 0x57, 0x5A, 0x5F, 0xA3,
+    0x88, 0x5A, 0xC0, 0x56, 0xA2, 0x87, 0xC0, 0x56, 0x28, 0x51, 0x2B, 0xC0, 0x61, 0xA1, 0xA8, 0x65,
+    0x7A, 0x10, 0x79, 0x08, 0xA2, 0x87, 0x02, 0x7D, 0x06, 0x04, 0xA4, 0x76, 0xA2, 0x76, 0xA2, 0x76,
+    0x59, 0xA4, 0x66, 0xA2, 0x66, 0x5A, 0x34, 0x36, 0xA2, 0x67, 0xA3, 0x79, 0x1F, 0x46, 0x5F, 0x56,
+    0x5A, 0x6B, 0xA2, 0x88, 0x56, 0x6F, 0xC0, 0x52, 0xA2, 0x78, 0x24, 0xA2, 0x88, 0x24, 0x59, 0xA1,
+    0xA9, 0x55, 0x7A, 0x6D, 0x7E, 0x15, 0x7E, 0x66, 0x14, 0x7A, 0x71, 0x66, 0x36, 0x39, 0x72, 0x30,
+    0x9D, 0xAA, 0x62, 0x77, 0x66, 0x9D, 0xAA, 0x7B, 0x0F, 0x67, 0x6B, 0x9D, 0x99, 0x01, 0x6F, 0x7B,
+    0x3B, 0xC0, 0x02, 0x66, 0x02, 0x6E, 0x7B, 0x50, 0xA2, 0x88, 0x3B, 0x03, 0x01, 0xA2, 0x88, 0x3F,
+    0x69, 0x16, 0x6D, 0xA2, 0x87, 0x08, 0xA4, 0x77, 0xA2, 0x77, 0xA2, 0x66, 0xA8, 0x04, 0x39, 0x9F,
+    0xBA, 0x9B, 0xCA, 0x9E, 0xAB, 0x9C, 0xAA, 0x00, 0x9E, 0x9B, 0x15, 0x53, 0x9F, 0x8B, 0x9D, 0x8A,
+    0x57, 0xA3, 0x79, 0x5A, 0x6F, 0x46, 0xA2, 0x78, 0x6F, 0x5E, 0x56, 0x65, 0xA2, 0x78, 0x6E, 0x36,
+    0xC0, 0x39, 0x9D, 0x99, 0xA2, 0x87, 0x2B, 0x7A, 0x66, 0x79, 0x1C, 0x79, 0x61, 0x00, 0x78, 0x7D,
+    0xA2, 0x86, 0x0E, 0x6D, 0x5C, 0x12, 0xA3, 0x76, 0xA3, 0x67, 0x59, 0xA5, 0x67, 0x2A, 0xA5, 0x77,
+    0x4A, 0xA2, 0x78, 0x0B, 0x6F, 0x4A, 0x5A, 0xA2, 0x79, 0x6F, 0x9D, 0x99, 0xA3, 0x79, 0x66, 0x5A,
+    0x52, 0xA2, 0x88, 0x66, 0x51, 0x35, 0xC0, 0x65, 0xC0, 0x36, 0x9D, 0x99, 0x7E, 0x1E, 0xA2, 0x97,
+    0x7A, 0x11, 0x76, 0x1F, 0x18, 0x07, 0x76, 0x71, 0x28, 0x7B, 0x76, 0x9D, 0xAA, 0x7B, 0x08, 0xA0,
+    0x9A, 0x1B, 0x62, 0x9D, 0x9A, 0x67, 0x6F, 0x9D, 0x9A, 0x6F, 0x02, 0x6F, 0x15, 0xC0, 0x51, 0x7F,
+    0xC0, 0x51, 0xC0, 0x10, 0x50, 0xA2, 0x88, 0x02, 0xA2, 0x87, 0x3B, 0xA3, 0x97, 0x06, 0x13, 0x11,
+    0x6D, 0xA3, 0x77, 0x6D, 0x5D, 0xAA, 0x03, 0x9D, 0xC9, 0x9D, 0xBB, 0x73, 0x08, 0x0F, 0x04, 0x63,
+    0x3B, 0x09, 0x43, 0x5B, 0xA1, 0x8A, 0x46, 0xA3, 0x78, 0x5B, 0x5A, 0xA2, 0x67, 0xC0, 0x5A, 0xC0,
+    0xA2, 0x88, 0x41, 0x7E, 0xA2, 0x88, 0x3B, 0x2A, 0xC0, 0x20, 0xA1, 0xA8, 0xC0, 0x22, 0x61, 0x75,
+    0xA2, 0x98, 0x64, 0x79, 0x09, 0x0A, 0x6D, 0x3F, 0xA2, 0x76, 0xA2, 0x76, 0x1C, 0xA3, 0x77, 0x5D,
+    0xA3, 0x66, 0x5E, 0xA4, 0x67, 0x45, 0xA3, 0x78, 0x5E, 0x5F, 0x5A, 0x4A, 0xA1, 0x8A, 0x56, 0x25,
+    0xA2, 0x78, 0x29, 0xC0, 0x56, 0xC0, 0xA2, 0x89, 0x9D, 0x98, 0x3C, 0x51, 0x21, 0x29, 0x21, 0x29,
+    0x25, 0x7E, 0x19, 0x7E, 0x79, 0x7E, 0x14, 0x71, 0x7A, 0x71, 0x62, 0xA1, 0xA9, 0x9D, 0xA9, 0x9F,
+    0xBA, 0x9C, 0x99, 0x73, 0x62, 0x12, 0x67, 0x9D, 0xAB, 0x3F, 0xA1, 0x9A, 0x52, 0xA0, 0x8A, 0x51,
+    0x52, 0xA3, 0x89, 0x6B, 0x56, 0x56, 0xC1, 0x66, 0xA2, 0x88, 0x04, 0x65, 0x14, 0x65, 0x6E, 0x7A,
+    0xA2, 0x87, 0x02, 0xA2, 0x87, 0x01, 0xA2, 0x87, 0x54, 0xA4, 0x77, 0x05, 0xA2, 0x76, 0xAB, 0x22,
+    0x9C, 0xBB, 0x9D, 0xAA, 0x9C, 0xAB, 0x9D, 0xBB, 0x53, 0x9F, 0xAB, 0x9F, 0x8B, 0x15, 0x42, 0xA0,
+    0x7A, 0x6F, 0x11, 0x5F, 0xA2, 0x78, 0x5E, 0x5F, 0xC0, 0x27, 0x5E, 0xA3, 0x88, 0x51, 0xC1, 0x7F,
+    0x00, 0x36, 0xC0, 0x61, 0x7A, 0x75, 0x7F, 0x71, 0x75, 0x64, 0xA1, 0xA8, 0x68, 0x7D, 0x69, 0xA2,
+    0x86, 0xA2, 0x86, 0xA3, 0x76, 0x5C, 0xA3, 0x77, 0xA2, 0x77, 0xA3, 0x66, 0xA2, 0x77, 0xA4, 0x67,
+    0xA2, 0x57, 0x59, 0x4B, 0xA4, 0x77, 0x46, 0x5F, 0x5B, 0xA2, 0x78, 0x56, 0x52, 0x6F, 0x66, 0x5B,
+    0x3C, 0x9D, 0x89, 0x7F, 0x28, 0x6F, 0x28, 0x66, 0xA2, 0x87, 0xC0, 0x29, 0x7E, 0x7E, 0x50, 0x75,
+    0x7E, 0x65, 0xA0, 0xA8, 0x0B, 0xA0, 0xA8, 0x62, 0x71, 0x72, 0x9D, 0xAA, 0x72, 0x62, 0x77, 0x9F,
+    0xAB, 0x72, 0x63, 0x9D, 0x9A, 0x0E, 0x53, 0x9D, 0x9A, 0x5B, 0x6F, 0x0D, 0x67, 0x0C, 0x04, 0xA2,
+    0x89, 0x41, 0xC2, 0xA2, 0x88, 0xC0, 0x04, 0xA2, 0x88, 0xC0, 0x79, 0x7E, 0x0D, 0x3A, 0xA2, 0x97,
+    0xA2, 0x87, 0x50, 0x3F, 0xA4, 0x76, 0x54, 0xAA, 0x21, 0x9E, 0xBA, 0x9B, 0xAB, 0x9F, 0xAB, 0x9E,
+    0x9B, 0x9C, 0x9A, 0x3B, 0xA1, 0x8B, 0x05, 0xA0, 0x8A, 0x5F, 0x4B, 0x2E, 0x5F, 0x41, 0x5E, 0x27,
+    0xA2, 0x77, 0x3D, 0x6E, 0x55, 0x6F, 0x66, 0x33, 0xA1, 0x9A, 0x3D, 0x27, 0x22, 0x2D, 0x62, 0x7A,
+    0x1D, 0x75, 0x1C, 0x04, 0x0F, 0x7C, 0x69, 0xA3, 0x86, 0x68, 0x6D, 0xA4, 0x76, 0xA4, 0x65, 0x24,
+    0x5D, 0x4E, 0xA3, 0x67, 0x39, 0xA2, 0x68, 0xA2, 0x78, 0x5E, 0x4A, 0x5A, 0x5F, 0x5B, 0x7F, 0x29,
+    0xC0, 0x56, 0x6F, 0x52, 0x34, 0x62, 0xA2, 0x78, 0x2A, 0xC0, 0x34, 0x2F, 0x65, 0x69, 0xA3, 0x88,
+    0x61, 0xA2, 0x87, 0x69, 0x61, 0x79, 0xA1, 0xA8, 0x61, 0x0B, 0xA1, 0xA9, 0x9C, 0xA8, 0x39, 0x76,
+    0x9C, 0xBA, 0x62, 0xA0, 0xAA, 0x9C, 0x99, 0x03, 0xA0, 0x9A, 0x9D, 0xAB, 0x0E, 0x3C, 0x57, 0x09,
+    0x5B, 0x6B, 0x9D, 0x89, 0xA3, 0x89, 0x52, 0x6F, 0x45, 0x6F, 0x66, 0xA2, 0x88, 0x11, 0x6F, 0x0C,
+    0xA3, 0x88, 0x05, 0x7A, 0x10, 0x13, 0x1B, 0x64, 0xA2, 0x87, 0x50, 0x3B, 0x3C, 0xA2, 0x77, 0x3D,
+    0xA9, 0x41, 0x9F, 0xAB, 0x9C, 0xAB, 0x9E, 0x9B, 0x06, 0x36, 0xA0, 0x7A, 0xA1, 0x8A, 0x5B, 0x47,
+    0x1D, 0x5A, 0xA2, 0x68, 0x5A, 0x27, 0x5A, 0x6E, 0xA2, 0x78, 0x59, 0x7F, 0x6E, 0x30, 0x04, 0x7B,
+    0x9D, 0x98, 0x7B, 0x2C, 0x7F, 0x25, 0xA1, 0xA8, 0x61, 0x11, 0x05, 0xA2, 0xA8, 0x64, 0x01, 0x02,
+    0xA2, 0x87, 0x06, 0x6D, 0xA3, 0x86, 0xA2, 0x76, 0xA4, 0x66, 0xA2, 0x66, 0x5D, 0xA5, 0x67, 0x39,
+    0x5E, 0xA4, 0x68, 0x5A, 0xA2, 0x68, 0x46, 0x56, 0x6F, 0x46, 0xA1, 0x8A, 0x56, 0xA2, 0x89, 0x9D,
+    0x89, 0x6B, 0xC0, 0x7F, 0x51, 0x7F, 0x56, 0x6E, 0x27, 0xC0, 0x2F, 0x51, 0xA2, 0x87, 0x35, 0x7A,
+    0x6D, 0x1E, 0x7A, 0x75, 0x65, 0xA2, 0xA7, 0x76, 0x61, 0x9F, 0xB9, 0x01, 0x9C, 0x99, 0x9D, 0xBA,
+    0x77, 0x9D, 0xAA, 0x12, 0x9F, 0x9B, 0x9D, 0xAA, 0x9F, 0x9B, 0x52, 0xA0, 0x8A, 0x9D, 0x8A, 0x6B,
+    0x5B, 0x56, 0x10, 0x56, 0x5B, 0xA3, 0x88, 0x5B, 0x55, 0xA2, 0x88, 0xC0, 0x1A, 0x29, 0x51, 0x7E,
+    0x11, 0x7E, 0x14, 0xA1, 0xA8, 0x69, 0x79, 0x60, 0xA3, 0x87, 0x64, 0xA2, 0x87, 0xA3, 0x86, 0x0D,
+    0x63, 0x9D, 0xBC, 0x9D, 0x9A, 0xA0, 0x8B, 0x9C, 0x8A, 0xA1, 0x8B, 0x5B, 0x5F, 0x47, 0x1A, 0xA2,
+    0x68, 0x5A, 0x5E, 0x2C, 0xA3, 0x78, 0x45, 0x6E, 0xC0, 0x6F, 0x7A, 0x6E, 0x04, 0x33, 0x66, 0x66,
+    0x7B, 0x75, 0x7A, 0x76, 0x15, 0xA2, 0x97, 0x71, 0x7D, 0x14, 0x7D, 0x3B, 0xA4, 0x86, 0x58, 0xA2,
+    0x86, 0xA2, 0x76, 0xA4, 0x66, 0xA2, 0x66, 0xA2, 0x66, 0xA3, 0x67, 0xA4, 0x67, 0x49, 0x5F, 0xA2,
+    0x78, 0x4A, 0x5E, 0x5F, 0x1E, 0x57, 0x6F, 0x6B, 0x52, 0x6B, 0x22, 0x6F, 0x66, 0x66, 0x6F, 0xC0,
+    0x24, 0xA2, 0x78, 0x7E, 0x9D, 0x98, 0xA3, 0x88, 0x2F, 0x51, 0x7D, 0xC0, 0xA2, 0x97, 0x69, 0x7D,
+    0x75, 0x61, 0xA0, 0xA8, 0x75, 0x61, 0x72, 0x32, 0x77, 0x72, 0x9C, 0xAA, 0x9D, 0xAA, 0x73, 0x9F,
+    0x9B, 0x9C, 0x9A, 0x06, 0x9F, 0x9B, 0x52, 0xA1, 0x8A, 0x5B, 0x18, 0x9D, 0x89, 0x6F, 0xA3, 0x79,
+    0x5A, 0x6F, 0x2B, 0x56, 0x69, 0x56, 0x23, 0xC0, 0x65, 0x66, 0x7E, 0xC0, 0x71, 0xA2, 0x87, 0x7A,
+    0x18, 0x61, 0x68, 0xA2, 0x97, 0x7D, 0xA2, 0x86, 0xA6, 0x51, 0x9C, 0x9B, 0x9F, 0xAB, 0x9D, 0x9B,
+    0x43, 0xA0, 0x8A, 0x43, 0xA4, 0x68, 0x57, 0x5F, 0x28, 0x5A, 0xA2, 0x77, 0x4A, 0xA3, 0x89, 0x59,
+    0xA2, 0x77, 0xC0, 0x51, 0x09, 0xC0, 0x35, 0x7F, 0x61, 0x7B, 0x7A, 0x27, 0x7A, 0x23, 0x2E, 0x9D,
+    0xA8, 0x7A, 0x70, 0xA2, 0x87, 0x15, 0x79, 0x6C, 0xA2, 0x76, 0xA2, 0x86, 0x5C, 0xA5, 0x76, 0xA3,
+    0x77, 0x5C, 0xA4, 0x57, 0x49, 0xA3, 0x78, 0xA3, 0x67, 0x5A, 0x4B, 0x5A, 0xA2, 0x69, 0x56, 0x6F,
+    0x47, 0x66, 0xA1, 0x8A, 0x36, 0x52, 0xC0, 0x7F, 0x9D, 0x8A, 0xC0, 0x66, 0xC0, 0xA2, 0x87, 0x23,
+    0xA2, 0x87, 0x38, 0x29, 0x65, 0x36, 0x34, 0x65, 0xA2, 0x97, 0x69, 0x19, 0x79, 0x7E, 0x75, 0x71,
+    0xA0, 0xA8, 0x9D, 0xA9, 0x72, 0x9D, 0xBA, 0x9F, 0xBA, 0x62, 0x77, 0x9D, 0xBB, 0x63, 0x53, 0x9C,
+    0x9A, 0x57, 0x3A, 0x39, 0xA1, 0x8A, 0x5B, 0x56, 0x20, 0x22, 0x1A, 0x17, 0xA3, 0x88, 0x5A, 0x6B,
+    0x55, 0x34, 0x6E, 0x25, 0x2D, 0x66, 0x7A, 0x1A, 0x7A, 0x61, 0xA2, 0x97, 0x60, 0x75, 0xA2, 0x87,
+    0xA2, 0x86, 0x64, 0xA7, 0x72, 0x9D, 0x9B, 0x9D, 0xAB, 0x9F, 0x8B, 0x57, 0xA1, 0x8A, 0x43, 0x4A,
+    0x22, 0x30, 0x34, 0x45, 0xA4, 0x77, 0x4A, 0x55, 0xA3, 0x88, 0x09, 0x5A, 0x09, 0x6E, 0x6B, 0x9D,
+    0x99, 0x04, 0x3A, 0x75, 0x7B, 0x25, 0x28, 0x76, 0x79, 0x71, 0x10, 0x79, 0x7D, 0x74, 0x6C, 0xA2,
+    0x86, 0xA4, 0x76, 0xA2, 0x76, 0xA3, 0x76, 0x5D, 0xA4, 0x66, 0xA4, 0x66, 0xA2, 0x57, 0xA2, 0x77,
+    0x4E, 0x4A, 0xA4, 0x68, 0x46, 0x5B, 0x19, 0x5B, 0x5B, 0x6B, 0x6B, 0x57, 0x62, 0xA2, 0x88, 0x52,
+    0x6B, 0xC1, 0x9D, 0x99, 0xC0, 0x32, 0x51, 0xC0, 0xA3, 0x88, 0x2B, 0x38, 0x6E, 0x69, 0x54, 0x79,
+    0xA4, 0x87, 0x64, 0x75, 0x7E, 0xA0, 0xA7, 0x9D, 0xA8, 0x71, 0x72, 0x03, 0x76, 0x9D, 0xBA, 0x9B,
+    0xBA, 0x63, 0x9D, 0xAB, 0x0F, 0x9D, 0x9B, 0xA0, 0x9A, 0x57, 0x9C, 0x8A, 0xA1, 0x8B, 0x6B, 0x1F,
+    0x41, 0x5B, 0x1A, 0xA2, 0x78, 0x6F, 0x25, 0xC0, 0x6E, 0x6F, 0x2A, 0x36, 0x27, 0x2A, 0x2D, 0x66,
+    0x65, 0x26, 0x75, 0x7A, 0x79, 0x60, 0x7E, 0x78, 0x79, 0xA6, 0x61, 0x9D, 0xAC, 0x67, 0x3A, 0x14,
+    0x04, 0x1C, 0x1D, 0x5E, 0x4B, 0x39, 0x00, 0x31, 0x5A, 0xA4, 0x78, 0x55, 0x55, 0x09, 0x56, 0x04,
+    0xC1, 0x76, 0xC0, 0x27, 0x2A, 0x2D, 0x2B, 0x1D, 0x7E, 0x9F, 0xB8, 0x0C, 0x79, 0x7D, 0x03, 0xA3,
+    0x86, 0x58, 0x0F, 0xA3, 0x76, 0xA4, 0x66, 0x48, 0xA4, 0x66, 0xA2, 0x67, 0xA2, 0x57, 0xA3, 0x78,
+    0xA2, 0x68, 0x45, 0xA1, 0x7A, 0xA2, 0x68, 0x57, 0x5B, 0x6F, 0x57, 0x67, 0x52, 0x6F, 0x1E, 0xA2,
+    0x88, 0x19, 0x6B, 0xC1, 0x7F, 0xC0, 0x56, 0x6E, 0x7E, 0x55, 0x1E, 0x6E, 0xA2, 0x87, 0x29, 0x36,
+    0x7D, 0x50, 0x7D, 0x79, 0x79, 0xA2, 0x97, 0x61, 0x9E, 0xB8, 0x61, 0xA0, 0xA9, 0x9D, 0xB9, 0x73,
+    0x9C, 0xB9, 0x63, 0x73, 0x9C, 0xAB, 0x9F, 0x9B, 0x9D, 0x9A, 0x53, 0xA0, 0x8A, 0x5B, 0x57, 0x57,
+    0x5A, 0x4B, 0xA4, 0x78, 0x41, 0xA3, 0x79, 0x55, 0x6F, 0x59, 0xC0, 0xA2, 0x88, 0x27, 0x3B, 0xC0,
+    0x2A, 0xC0, 0x34, 0x61, 0x61, 0x09, 0xA2, 0x98, 0x75, 0x0C, 0x7E, 0x7C, 0x13, 0x9D, 0x9B, 0x9F,
+    0x9B, 0x57, 0x1B, 0x46, 0x4B, 0x5B, 0x5E, 0x5E, 0x5F, 0xA3, 0x78, 0x55, 0xA3, 0x78, 0x55, 0x6E,
+    0xC1, 0xA2, 0x89, 0x30, 0x66, 0x02, 0x66, 0x3B, 0x2A, 0x62, 0xA0, 0xA8, 0x15, 0xA1, 0xA8, 0x79,
+    0x79, 0x0D, 0x0E, 0x7D, 0x6C, 0xA2, 0x86, 0x5C, 0xA4, 0x76, 0xA2, 0x66, 0xA2, 0x66, 0xA4, 0x66,
+    0xA4, 0x67, 0x9F, 0x68, 0xA5, 0x67, 0xA2, 0x68, 0x4A, 0xA1, 0x8A, 0x4A, 0x42, 0xA1, 0x8A, 0x57,
+    0xA1, 0x8A, 0x52, 0x52, 0xA1, 0x9A, 0x66, 0x66, 0x52, 0x67, 0x66, 0xC1, 0xA2, 0x88, 0x9D, 0x99,
+    0x1D, 0x22, 0xA2, 0x88, 0x6D, 0x55, 0x32, 0x1E, 0x24, 0xA3, 0x87, 0x69, 0x7E, 0x29, 0x7E, 0x7D,
+    0x75, 0x70, 0x75, 0x11, 0x9C, 0xA9, 0x72, 0x9F, 0xBA, 0x17, 0x73, 0x9D, 0xAB, 0x62, 0x9F, 0xAC,
+    0x01, 0x53, 0xA1, 0x9A, 0x43, 0x07, 0x5F, 0x5B, 0xA2, 0x78, 0x46, 0x23, 0xA2, 0x78, 0x39, 0x5E,
+    0xC0, 0x38, 0xC0, 0x3D, 0x7A, 0x9D, 0x89, 0x27, 0x7E, 0x39, 0x9D, 0x99, 0xA1, 0xA8, 0x1A, 0x25,
+    0x9D, 0xA8, 0x10, 0xA1, 0xA7, 0x79, 0xA2, 0x82, 0xA0, 0x8B, 0x9D, 0x8A, 0x9F, 0x8B, 0x57, 0x08,
+    0x5B, 0x15, 0x2B, 0x4A, 0x27, 0x5E, 0x02, 0x41, 0x30, 0xC0, 0x35, 0xA2, 0x88, 0x04, 0x7A, 0x29,
+    0x3D, 0x27, 0x39, 0x9D, 0x98, 0x76, 0xA1, 0xA8, 0x7A, 0x70, 0x65, 0x0D, 0x0E, 0x64, 0xA4, 0x86,
+    0x18, 0x6C, 0x5C, 0xA4, 0x66, 0xA3, 0x66, 0xA2, 0x77, 0xA2, 0x57, 0xA2, 0x67, 0xA2, 0x67, 0x1F,
+    0x5F, 0x4B, 0x42, 0xA3, 0x89, 0x47, 0x67, 0x42, 0x2E, 0x9D, 0x9A, 0x6B, 0x62, 0xA2, 0x89, 0x67,
+    0x66, 0x9D, 0x99, 0x6B, 0xC2, 0x66, 0x69, 0x1F, 0x1D, 0xC0, 0x69, 0x34, 0x6E, 0x68, 0xC0, 0xA3,
+    0x87, 0x68, 0x7D, 0x69, 0x79, 0xA1, 0xA7, 0x79, 0x9C, 0xA8, 0xA2, 0xA8, 0x9D, 0xA9, 0x9C, 0xB9,
+    0x9F, 0xB9, 0x73, 0x73, 0x9B, 0xAA, 0x73, 0x9E, 0x9B, 0x67, 0x9B, 0x9B, 0x0E, 0x67, 0x00, 0xA2,
+    0x79, 0x08, 0xA2, 0x79, 0x4A, 0x5A, 0xA2, 0x78, 0x4A, 0xA2, 0x88, 0x59, 0xC0, 0x02, 0xC0, 0x9D,
+    0x99, 0xC0, 0x7B, 0x36, 0x22, 0x7E, 0xA0, 0xA8, 0x76, 0x9D, 0x98, 0xA1, 0xA8, 0x7A, 0x74, 0x7D,
+    0x01, 0xA0, 0x8A, 0x9D, 0x8B, 0x0C, 0x57, 0xA2, 0x79, 0x45, 0xA2, 0x69, 0x4A, 0x6E, 0xA3, 0x78,
+    0x6E, 0x29, 0xA2, 0x78, 0xA2, 0x88, 0x69, 0x56, 0x0E, 0x9D, 0x98, 0x7F, 0x33, 0x65, 0x25, 0x28,
+    0x26, 0x7A, 0x9D, 0xA8, 0xA1, 0xA7, 0x18, 0x9E, 0x96, 0xA2, 0x97, 0x68, 0xA2, 0x86, 0xA2, 0x76,
+    0xA3, 0x86, 0xA3, 0x76, 0xA3, 0x76, 0x4D, 0xA4, 0x66, 0xA4, 0x57, 0x49, 0xA3, 0x78, 0x4A, 0xA3,
+    0x69, 0x5F, 0x32, 0x57, 0x6B, 0x47, 0x67, 0x21, 0x7B, 0x6B, 0x52, 0x77, 0x52, 0x6B, 0x7B, 0x66,
+    0xC0, 0x51, 0x66, 0x7F, 0x6E, 0x29, 0x2E, 0x51, 0xA2, 0x87, 0x1D, 0xC0, 0xA2, 0x76, 0x2D, 0xA2,
+    0x77, 0x7D, 0x54, 0xA2, 0x87, 0x68, 0x7D, 0x79, 0xA2, 0x97, 0x9F, 0xB8, 0x71, 0x9D, 0xA8, 0xA0,
+    0xA9, 0x9C, 0xB9, 0x9D, 0xBA, 0x77, 0x9C, 0xAA, 0x73, 0x0F, 0x04, 0x9D, 0xAB, 0x9F, 0x8B, 0x67,
+    0x47, 0x5B, 0x1C, 0x42, 0x5F, 0xA3, 0x78, 0x45, 0x6F, 0xA2, 0x77, 0x56, 0x5E, 0xA3, 0x88, 0x51,
+    0x02, 0x2E, 0x7B, 0x2C, 0x27, 0x25, 0x7E, 0x9D, 0xA9, 0x7A, 0x11, 0xA0, 0xA7, 0x79, 0x39, 0xA3,
+    0x94, 0x9F, 0x9B, 0xA1, 0x8A, 0x0C, 0xA1, 0x8A, 0x46, 0xA2, 0x68, 0x2B, 0x56, 0xA2, 0x67, 0x56,
+    0x27, 0xA2, 0x77, 0x6F, 0x6E, 0x3A, 0x29, 0x02, 0x2C, 0x33, 0x7A, 0x76, 0x2B, 0x7A, 0x65, 0x14,
+    0x0B, 0x1B, 0x7D, 0x68, 0xA2, 0x86, 0x7D, 0xA2, 0x76, 0xA2, 0x75, 0x5C, 0xA5, 0x77, 0x4C, 0xA4,
+    0x67, 0x4D, 0x0A, 0x4E, 0x5F, 0x5E, 0xA2, 0x69, 0x5F, 0x9D, 0x8A, 0xA1, 0x8A, 0x52, 0xA1, 0x8B,
+    0x52, 0x6B, 0x67, 0x62, 0x9D, 0x9A, 0x67, 0xC0, 0x24, 0x66, 0x51, 0x1F, 0x66, 0xC1, 0x1F, 0x0B,
+    0x24, 0x56, 0xA2, 0x87, 0x50, 0xA3, 0x78, 0xA2, 0x76, 0x65, 0x6D, 0xA3, 0x87, 0xA2, 0x77, 0x68,
+    0x23, 0xA3, 0x97, 0x7D, 0x60, 0xA0, 0xA7, 0x75, 0x9D, 0xA9, 0x0A, 0x03, 0x72, 0x9C, 0xA9, 0x9F,
+    0xBB, 0x9C, 0xAA, 0x9D, 0xAB, 0x9C, 0x9A, 0xA0, 0x9A, 0x9F, 0x8B, 0x9D, 0x9B, 0x0D, 0x0C, 0x10,
+    0xA2, 0x79, 0x46, 0x5A, 0xA3, 0x78, 0x25, 0x2A, 0xA2, 0x78, 0x6E, 0x41, 0x02, 0x66, 0x66, 0x3D,
+    0x9D, 0x99, 0x7A, 0x2A, 0x76, 0x76, 0x60, 0x76, 0x79, 0xA1, 0xA7, 0x79, 0x14, 0x63, 0x57, 0x0C,
+    0xA1, 0x7A, 0x56, 0x0E, 0x5F, 0x6F, 0xA3, 0x78, 0x2A, 0x36, 0x2C, 0x00, 0x38, 0xC0, 0x2C, 0x27,
+    0xC0, 0x39, 0x9D, 0x98, 0x30, 0x2E, 0x75, 0x9D, 0xA8, 0x7E, 0xA1, 0xA7, 0x0D, 0xA2, 0x96, 0x64,
+    0x6D, 0xA3, 0x86, 0xA4, 0x65, 0xA2, 0x76, 0xA4, 0x66, 0x5D, 0xA3, 0x66, 0xA2, 0x57, 0xA4, 0x67,
+    0x5E, 0xA2, 0x58, 0x46, 0xA3, 0x79, 0x47, 0x57, 0xA1, 0x8A, 0x9D, 0x8A, 0x67, 0x37, 0x62, 0x6B,
+    0x9D, 0x9A, 0x67, 0x7B, 0x9D, 0x99, 0x1F, 0x9D, 0x99, 0xA3, 0x99, 0x66, 0xC0, 0x9D, 0x99, 0x6E,
+    0x0B, 0xA2, 0x78, 0x10, 0x6E, 0x6E, 0x1F, 0x6E, 0x6E, 0xA2, 0x76, 0x55, 0x34, 0x59, 0x6C, 0x7E,
+    0xA2, 0x86, 0x64, 0x7D, 0xA2, 0x97, 0x64, 0xA1, 0xB8, 0x9C, 0xA8, 0xA0, 0xA8, 0x71, 0x9E, 0xBA,
+    0x9D, 0xBA, 0x9B, 0xAA, 0xA0, 0xAA, 0x9A, 0xAA, 0x9F, 0x9B, 0x9D, 0xAB, 0xA0, 0x9A, 0x9D, 0x8B,
+    0x57, 0x14, 0x04, 0xA2, 0x79, 0x46, 0x5F, 0x17, 0xA3, 0x89, 0x49, 0xC0, 0x00, 0x51, 0x5A, 0x38,
+    0xA2, 0x87, 0x38, 0x61, 0x36, 0x39, 0x65, 0x7A, 0x9C, 0xA9, 0x25, 0x1C, 0x79, 0x14, 0x03, 0x53,
+    0xA0, 0x7A, 0xA1, 0x8A, 0x42, 0xA2, 0x68, 0x0E, 0xA3, 0x89, 0x4A, 0x6F, 0x55, 0x36, 0x27, 0xC0,
+    0x7E, 0x27, 0x25, 0x2A, 0x28, 0x7A, 0x9D, 0x99, 0xA1, 0xA8, 0x19, 0x61, 0x18, 0x75, 0x01, 0xA2,
+    0x86, 0x78, 0xA3, 0x87, 0xA2, 0x76, 0xA3, 0x76, 0x58, 0xA4, 0x65, 0xA3, 0x67, 0xA3, 0x77, 0xA4,
+    0x57, 0x0A, 0xA2, 0x57, 0xA2, 0x68, 0x47, 0xA2, 0x68, 0x57, 0x5B, 0x57, 0xA0, 0x8A, 0x9D, 0x9A,
+    0x57, 0xA1, 0x9A, 0x9D, 0x9A, 0x7B, 0x62, 0x9C, 0x9A, 0x66, 0x7F, 0x9D, 0x99, 0xA2, 0x99, 0xC0,
+    0x51, 0x7F, 0x9D, 0x99, 0xA2, 0x88, 0xC0, 0x5A, 0x1F, 0x0B, 0x5A, 0x7E, 0xA3, 0x77, 0xC0, 0xA3,
+    0x77, 0x54, 0x22, 0x6D, 0xA3, 0x87, 0x69, 0xA2, 0x76, 0x7D, 0xA2, 0x96, 0x68, 0x26, 0xA0, 0xA8,
+    0x9D, 0xA8, 0x9F, 0xB8, 0x76, 0x71, 0x30, 0x21, 0x73, 0x9B, 0xBB, 0x73, 0x9E, 0x8B, 0x63, 0x67,
+    0x9E, 0x8B, 0x57, 0x5B, 0x57, 0xA2, 0x68, 0x1D, 0x5A, 0xA2, 0x78, 0x2D, 0x6F, 0x45, 0x6E, 0xC0,
+    0x33, 0x00, 0x2C, 0x27, 0x7F, 0x39, 0x9D, 0x98, 0xA2, 0x98, 0x9C, 0xA8, 0xA0, 0xA8, 0x7E, 0x75,
+    0x08, 0xA3, 0x95, 0x57, 0x9D, 0x8A, 0x0C, 0x0B, 0x4A, 0x5B, 0x6E, 0x17, 0xA2, 0x78, 0x2D, 0x6F,
+    0x34, 0x51, 0x39, 0x2D, 0x28, 0x2B, 0x66, 0x79, 0x61, 0x1C, 0x7A, 0x1B, 0x79, 0x6C, 0x0F, 0x3C,
+    0x3F, 0xA2, 0x76, 0xA5, 0x76, 0xA2, 0x76, 0xA3, 0x66, 0x35, 0xA3, 0x67, 0x49, 0xA2, 0x57, 0xA4,
+    0x68, 0x46, 0x4A, 0xA2, 0x79, 0xA2, 0x79, 0x9D, 0x7A, 0xA1, 0x9A, 0x9D, 0x8A, 0xA0, 0x8A, 0x23,
+    0xA1, 0x9A, 0x9C, 0x9A, 0x7B, 0x67, 0x9D, 0x99, 0x63, 0x66, 0x10, 0x9D, 0xAA, 0x6E, 0x62, 0x7F,
+    0x6E, 0xC1, 0x9D, 0x99, 0x10, 0xC0, 0x6E, 0x06, 0x6E, 0xA3, 0x88, 0xA2, 0x67, 0x65, 0xA3, 0x76,
+    0x31, 0x59, 0xA2, 0x86, 0x23, 0x6D, 0xA3, 0x97, 0x68, 0xA2, 0x96, 0x79, 0x79, 0x60, 0xA0, 0xA8,
+    0x9F, 0xB9, 0x9D, 0xB9, 0x72, 0x9C, 0xA9, 0x9D, 0xBA, 0x9F, 0xBB, 0x9D, 0xAA, 0x9C, 0x9B, 0x3F,
+    0xA0, 0x9A, 0x9C, 0x8A, 0xA1, 0x8A, 0x43, 0x57, 0x1C, 0x5B, 0x45, 0x5B, 0xA2, 0x77, 0x5B, 0x6E,
+    0x6F, 0x55, 0x6E, 0x3B, 0x66, 0x27, 0x7A, 0x7B, 0x79, 0x9D, 0x99, 0x71, 0x14, 0xA1, 0xA8, 0x1B,
+    0x7D, 0xA2, 0x84, 0x3D, 0x1C, 0x1B, 0x04, 0x5F, 0xA2, 0x79, 0x1D, 0xA2, 0x78, 0x56, 0x6E, 0x30,
+    0x52, 0x55, 0x30, 0x17, 0x12, 0x0E, 0x76, 0xA2, 0x88, 0x79, 0x79, 0x00, 0x08, 0x7C, 0x03, 0xA3,
+    0x87, 0x6C, 0x5C, 0xA4, 0x76, 0xA3, 0x77, 0x4C, 0xA4, 0x66, 0xA2, 0x67, 0x05, 0xA3, 0x67, 0x5B,
+    0xA2, 0x57, 0x29, 0x42, 0x5B, 0xA2, 0x79, 0x9D, 0x8A, 0x9F, 0x9B, 0x6B, 0x9D, 0x9A, 0xA1, 0x9A,
+    0x63, 0x9D, 0x9A, 0x77, 0x66, 0x7B, 0x66, 0x9D, 0x9A, 0x06, 0x7F, 0x76, 0x56, 0x66, 0x66, 0xC0,
+    0x65, 0xA3, 0x88, 0xC0, 0x13, 0x6E, 0x15, 0x59, 0xA2, 0x78, 0x6E, 0x54, 0xA2, 0x77, 0xA3, 0x87,
+    0x59, 0xA3, 0x87, 0x6D, 0x6D, 0xA2, 0x76, 0x7D, 0xA2, 0x86, 0x74, 0x7E, 0xA1, 0xA7, 0x0F, 0x1A,
+    0x9D, 0xB9, 0x71, 0x9F, 0xBA, 0x9A, 0xBA, 0x77, 0x9D, 0xAA, 0x9D, 0xBB, 0x9E, 0x9B, 0x9D, 0x9A,
+    0xA0, 0x8A, 0x16, 0x57, 0x9D, 0x8A, 0x04, 0x5B, 0xA3, 0x79, 0x5A, 0x56, 0x23, 0xA2, 0x88, 0x5E,
+    0x56, 0x36, 0x7E, 0x2A, 0xC0, 0x7A, 0x51, 0xA1, 0xA9, 0x22, 0x66, 0xA1, 0xA8, 0x60, 0x75, 0x15,
+    0xA2, 0x95, 0x16, 0x9D, 0x8A, 0xA0, 0x7A, 0x6F, 0x9D, 0x8A, 0xA3, 0x88, 0x4A, 0x1D, 0x6F, 0x1A,
+    0xC0, 0x29, 0x6E, 0x9D, 0x98, 0xA2, 0x99, 0x1D, 0x79, 0x1C, 0x04, 0x0C, 0xA2, 0x97, 0x64, 0xA2,
+    0x87, 0x9F, 0x86, 0x3F, 0xA2, 0x87, 0xA4, 0x65, 0xA2, 0x76, 0xA2, 0x66, 0xA3, 0x77, 0xA2, 0x66,
+    0xA3, 0x67, 0x0A, 0xA2, 0x67, 0x4A, 0x4F, 0x5B, 0x5F, 0x57, 0x5B, 0xA1, 0x8B, 0x67, 0x9D, 0x9A,
+    0x53, 0x7B, 0x63, 0x52, 0x73, 0x6B, 0x61, 0x9D, 0xAA, 0xC0, 0x3C, 0x7F, 0x66, 0x61, 0x6F, 0x7E,
+    0x66, 0x7F, 0x9D, 0x88, 0x35, 0x01, 0x09, 0x45, 0x0B, 0x59, 0xA2, 0x88, 0xA2, 0x67, 0x54, 0xA2,
+    0x77, 0x6E, 0xA2, 0x76, 0xA3, 0x87, 0x6D, 0xA2, 0x77, 0xA2, 0x76, 0x64, 0xA2, 0x86, 0xA2, 0x97,
+    0x64, 0x79, 0x70, 0xA1, 0xA8, 0xA0, 0xA8, 0x0A, 0x72, 0x9C, 0xA9, 0x9D, 0xBA, 0x9D, 0xBA, 0x9E,
+    0xAB, 0x9D, 0x9A, 0x9D, 0xAB, 0x9F, 0x9B, 0x9D, 0x9B, 0x57, 0x67, 0x57, 0xA2, 0x79, 0x5A, 0xA2,
+    0x69, 0x56, 0x5E, 0x56, 0xA2, 0x88, 0x2D, 0x66, 0x56, 0xA2, 0x88, 0x50, 0x23, 0x7A, 0x29, 0x60,
+    0x7F, 0x08, 0xA2, 0x97, 0x79, 0x78, 0xA1, 0x95, 0xA0, 0x7A, 0x53, 0x6B, 0x57, 0x18, 0x42, 0xC0,
+    0x5B, 0x11, 0x6B, 0x55, 0x20, 0x0C, 0x69, 0x7F, 0xA2, 0x87, 0x13, 0x1B, 0x69, 0x7D, 0x16, 0x69,
+    0x3C, 0x3F, 0xA2, 0x76, 0xA4, 0x75, 0xA4, 0x66, 0x48, 0xA3, 0x77, 0xA4, 0x67, 0xA3, 0x67, 0x49,
+    0xA3, 0x69, 0xA2, 0x67, 0x5B, 0xA2, 0x69, 0x56, 0x9E, 0x69, 0xA1, 0x8A, 0x53, 0x67, 0x53, 0x67,
+    0x9D, 0xAA, 0xA0, 0x8A, 0x76, 0x63, 0x9D, 0x9A, 0x7A, 0x62, 0x7F, 0x9D, 0x99, 0xA1, 0xA9, 0x9D,
+    0x99, 0x04, 0xC0, 0x61, 0xA2, 0x89, 0x9D, 0x88, 0x33, 0xC0, 0x30, 0x04, 0x5A, 0xA2, 0x87, 0x51,
+    0xA4, 0x77, 0x56, 0x06, 0xA2, 0x77, 0x59, 0xA4, 0x77, 0x58, 0xA3, 0x78, 0x6D, 0xA2, 0x76, 0x6D,
+    0xA2, 0x86, 0x64, 0xA4, 0x86, 0x64, 0x75, 0xA1, 0xA7, 0x75, 0xA0, 0xA8, 0x9C, 0xA8, 0x76, 0xA0,
+    0xB9, 0x9C, 0xAA, 0x9D, 0xBA, 0x9C, 0xAA, 0x77, 0x9C, 0x9B, 0x63, 0x67, 0x63, 0x53, 0x57, 0x57,
+    0x5F, 0xA2, 0x79, 0x56, 0x11, 0xA3, 0x79, 0x51, 0xC0, 0x6F, 0x55, 0x6F, 0x26, 0xC0, 0x61, 0x69,
+    0xA1, 0xA9, 0x60, 0xA2, 0x97, 0x7A, 0x78, 0x68, 0xA3, 0x86, 0x63, 0x53, 0x3C, 0x5F, 0x1B, 0x41,
+    0x6F, 0x6B, 0x14, 0x08, 0xC1, 0x10, 0x66, 0x10, 0x75, 0x00, 0xA3, 0x97, 0x65, 0x68, 0x0D, 0x64,
+    0xA4, 0x76, 0xA3, 0x87, 0x5C, 0xA2, 0x66, 0xA4, 0x66, 0x5D, 0xA3, 0x67, 0x4E, 0xA5, 0x77, 0x4B,
+    0x4E, 0x5B, 0x5F, 0x5B, 0x43, 0xA1, 0x8A, 0x52, 0x9F, 0x9B, 0x6B, 0x9D, 0x9A, 0x63, 0x13, 0x24,
+    0x6B, 0x9C, 0xA9, 0x7F, 0x9C, 0x99, 0x66, 0x7F, 0x9D, 0xA9, 0x30, 0xA2, 0x88, 0x7A, 0x52, 0x7F,
+    0x51, 0x69, 0xC1, 0xA2, 0x88, 0x07, 0x04, 0x6E, 0x6F, 0x54, 0xA2, 0x78, 0x59, 0x6E, 0x5D, 0x6E,
+    0xA4, 0x77, 0x2C, 0x6D, 0x5D, 0xA3, 0x87, 0x54, 0xA3, 0x97, 0xA2, 0x86, 0x64, 0x79, 0x79, 0xA1,
+    0xA7, 0x71, 0x9D, 0xA9, 0x9F, 0xB8, 0x76, 0x9F, 0xBA, 0x9C, 0xBA, 0x9C, 0xA9, 0x9F, 0xAB, 0x9C,
+    0xAA, 0x53, 0x9D, 0xAB, 0xA0, 0x9A, 0x03, 0x43, 0x67, 0xA2, 0x79, 0x56, 0xA1, 0x7A, 0xC0, 0x42,
+    0xA2, 0x78, 0x6E, 0xC1, 0x52, 0xC0, 0x1D, 0x7E, 0x51, 0x7A, 0xA1, 0xA8, 0x1B, 0x64, 0xA2, 0x87,
+    0x7D, 0x9F, 0x96, 0x03, 0x3D, 0x15, 0x56, 0x67, 0x5A, 0x52, 0xA2, 0x88, 0x1F, 0x13, 0x55, 0x3F,
+    0x7E, 0x00, 0xC0, 0xA2, 0x97, 0x3A, 0x7E, 0x68, 0xA3, 0x87, 0x6D, 0xA3, 0x86, 0x59, 0xA2, 0x76,
+    0xA3, 0x76, 0x30, 0xA3, 0x67, 0x49, 0x3B, 0x5E, 0xA3, 0x79, 0xA2, 0x58, 0x5B, 0x5B, 0x5B, 0x42,
+    0xA1, 0x8B, 0x52, 0x9D, 0x9A, 0xA0, 0x8A, 0x9D, 0xAA, 0xA1, 0x9A, 0x9C, 0x9A, 0x62, 0x77, 0x52,
+    0x7B, 0x76, 0x66, 0x66, 0x7B, 0x61, 0x51, 0x7A, 0xC0, 0x7F, 0x51, 0x3D, 0xC0, 0x2E, 0xC1, 0xA2,
+    0x88, 0x5E, 0xC0, 0x09, 0x06, 0x59, 0x6E, 0xA3, 0x88, 0x15, 0xA2, 0x77, 0x24, 0xA2, 0x76, 0x31,
+    0x6D, 0x58, 0xA2, 0x87, 0x68, 0xA4, 0x87, 0x54, 0x7C, 0xA0, 0xA8, 0x64, 0xA0, 0xA7, 0xA1, 0xA8,
+    0x9D, 0xA9, 0x9F, 0xB9, 0x76, 0x9C, 0xB9, 0x9D, 0xBB, 0x62, 0x9B, 0xBB, 0x77, 0x9F, 0x9B, 0x9C,
+    0x9A, 0xA0, 0x9A, 0x03, 0x53, 0xA1, 0x7A, 0x6B, 0x5B, 0x9D, 0x99, 0xA2, 0x78, 0x56, 0xA2, 0x78,
+    0x11, 0x66, 0x11, 0x6E, 0x11, 0x19, 0x7A, 0x9D, 0x98, 0x7E, 0x00, 0x0D, 0x78, 0xA3, 0x97, 0x6C,
+    0x57, 0x9D, 0x9A, 0xA2, 0x89, 0x9C, 0x8A, 0x5A, 0x14, 0xC0, 0x07, 0x14, 0xC0, 0x55, 0x14, 0x69,
+    0x7E, 0x3A, 0xA2, 0x97, 0x3B, 0xA2, 0x86, 0x6D, 0xA3, 0x87, 0x58, 0xA4, 0x76, 0x5D, 0xA2, 0x66,
+    0x26, 0x5E, 0xA4, 0x56, 0xA2, 0x68, 0xA3, 0x78, 0x9F, 0x68, 0x5F, 0x5B, 0x2D, 0x4B, 0x53, 0x53,
+    0x6B, 0x32, 0x66, 0x1B, 0x9F, 0x9B, 0x9D, 0xAA, 0x7B, 0x9D, 0x9A, 0x76, 0xC0, 0x77, 0x61, 0x67,
+    0x65, 0xA1, 0xA9, 0x9D, 0x99, 0xA2, 0x88, 0x66, 0x65, 0x6B, 0x3D, 0x7A, 0x3D, 0x51, 0x3D, 0xC0,
+    0x2E, 0xA2, 0x78, 0x6E, 0x01, 0x06, 0x6E, 0x59, 0x1A, 0x5D, 0x6E, 0x5D, 0x69, 0xA3, 0x77, 0xA2,
+    0x77, 0x6D, 0x6D, 0xA3, 0x87, 0x36, 0x28, 0xA2, 0x87, 0x74, 0x64, 0xA1, 0xA8, 0x71, 0x75, 0x9F,
+    0xB9, 0x76, 0x9D, 0xB9, 0x30, 0x9C, 0xAA, 0x73, 0x9D, 0xAA, 0x73, 0x9D, 0x9B, 0xA1, 0x9A, 0x9B,
+    0xAB, 0x3B, 0xA1, 0x9A, 0x9D, 0x8A, 0xA2, 0x78, 0x57, 0xC0, 0x6F, 0x9D, 0x89, 0xA3, 0x89, 0x66,
+    0xC0, 0x59, 0x1C, 0x7A, 0x50, 0x0C, 0x65, 0xA2, 0x97, 0x11, 0x3B, 0xA3, 0x86, 0x6D, 0xA0, 0x9A,
+    0x52, 0x3B, 0x11, 0x42, 0x10, 0xC0, 0x01, 0x10, 0x51, 0xA3, 0x88, 0xC0, 0x16, 0x0A, 0x03, 0xA3,
+    0x87, 0x6D, 0x6D, 0xA2, 0x77, 0xA2, 0x76, 0x58, 0x21, 0x5D, 0xA2, 0x67, 0xA4, 0x66, 0xA3, 0x78,
+    0x4E, 0xA2, 0x68, 0x0F, 0x1D, 0x5B, 0xA1, 0x7A, 0x42, 0xA0, 0x8A, 0x36, 0x9D, 0x9A, 0xA0, 0x8A,
+    0x67, 0x9C, 0x9A, 0x6B, 0x73, 0xC0, 0x9D, 0xAA, 0x62, 0x7F, 0x9D, 0xAA, 0x66, 0x66, 0x3F, 0xC0,
+    0x7A, 0x3D, 0x38, 0x3D, 0x38, 0x51, 0xA3, 0x98, 0xC0, 0x38, 0xC1, 0x2E, 0xC0, 0x3F, 0xC0, 0xA2,
+    0x78, 0x54, 0x0B, 0xA2, 0x77, 0x59, 0xA2, 0x78, 0x59, 0x6D, 0xA2, 0x77, 0xA2, 0x77, 0xA2, 0x86,
+    0x20, 0xA2, 0x76, 0x7D, 0xA2, 0x77, 0x64, 0x7D, 0x7D, 0x7D, 0xA1, 0xA8, 0x75, 0x0F, 0xA0, 0xA7,
+    0xA0, 0xA8, 0x39, 0x77, 0x72, 0x9C, 0xBA, 0x72, 0x63, 0x63, 0x63, 0x9D, 0xAA, 0x57, 0x08, 0x53,
+    0x56, 0xA1, 0x9A, 0x5B, 0x56, 0xC0, 0x52, 0x18, 0x51, 0x7F, 0x04, 0xC0, 0x0C, 0x79, 0x10, 0x69,
+    0xA2, 0x86, 0x6D, 0xA2, 0x86, 0x54, 0x67, 0x06, 0x67, 0x0A, 0xC0, 0x6F, 0x66, 0xC0, 0x02, 0x16,
+    0x0A, 0xA2, 0x77, 0x50, 0x7E, 0x06, 0xA2, 0x86, 0x6D, 0x5D, 0xA3, 0x76, 0x1F, 0x4D, 0xA2, 0x77,
+    0xA5, 0x67, 0x49, 0xA4, 0x67, 0x4A, 0xA2, 0x68, 0x20, 0x29, 0x42, 0x31, 0x28, 0x2F, 0x53, 0x6B,
+    0x9D, 0x9A, 0x27, 0x62, 0x62, 0xA1, 0x9A, 0x62, 0x63, 0x9D, 0xA9, 0xC0, 0x7B, 0x76, 0x66, 0xC0,
+    0x9C, 0x99, 0xA2, 0x98, 0x66, 0x51, 0x00, 0x9D, 0x89, 0x7E, 0x00, 0xC0, 0x38, 0x24, 0xA2, 0x87,
+    0x38, 0x29, 0x02, 0x2B, 0xA3, 0x88, 0x55, 0x6E, 0x5E, 0x10, 0xA3, 0x77, 0x59, 0x6E, 0x59, 0xA3,
+    0x88, 0x6D, 0x2A, 0x59, 0x32, 0x59, 0x7D, 0x36, 0x64, 0x7D, 0x69, 0xA2, 0x97, 0xA1, 0xA7, 0x61,
+    0x9D, 0xB8, 0x75, 0x76, 0x34, 0x72, 0x77, 0x26, 0x62, 0x73, 0x9D, 0xAA, 0xA0, 0x9A, 0x53, 0x9C,
+    0x99, 0xA1, 0x9A, 0x9D, 0x8A, 0x11, 0x6B, 0x56, 0x56, 0x56, 0xA2, 0x88, 0x00, 0x6F, 0x69, 0x00,
+    0x69, 0x7E, 0x11, 0x3B, 0xA3, 0x87, 0x3A, 0xA3, 0x87, 0x5D, 0x0C, 0x67, 0x56, 0x52, 0x66, 0x03,
+    0xC0, 0x6F, 0x7E, 0x34, 0x0D, 0x3A, 0xA3, 0x88, 0x55, 0x6D, 0xA2, 0x76, 0x6D, 0xA3, 0x77, 0x26,
+    0x59, 0xA3, 0x77, 0x4E, 0xA4, 0x67, 0x5E, 0xA2, 0x67, 0xA2, 0x68, 0x47, 0xA2, 0x68, 0x42, 0x24,
+    0xA1, 0x8A, 0x52, 0xA0, 0x7A, 0x67, 0x62, 0x9D, 0x9B, 0x67, 0x62, 0x77, 0x6B, 0x9D, 0xA9, 0x9D,
+    0xAA, 0xA2, 0x88, 0x9D, 0xA9, 0x66, 0x66, 0x66, 0x7B, 0xC0, 0x65, 0x66, 0x2C, 0x38, 0xC0, 0x66,
+    0x65, 0x33, 0x38, 0xC1, 0x6E, 0x6E, 0x2E, 0x30, 0xA2, 0x88, 0x5A, 0xA2, 0x77, 0x3C, 0xA2, 0x78,
+    0x6D, 0xA2, 0x77, 0xC0, 0xA2, 0x67, 0x1A, 0x24, 0x69, 0xA2, 0x76, 0xA3, 0x87, 0x55, 0xA2, 0x86,
+    0xA3, 0x87, 0x50, 0x7D, 0xA2, 0x97, 0x19, 0x79, 0x18, 0x79, 0xA0, 0xA8, 0x76, 0x9C, 0xA8, 0xA0,
+    0xA9, 0x71, 0x63, 0x9F, 0xB9, 0x9D, 0xAB, 0x9C, 0x99, 0x63, 0x77, 0x0C, 0x52, 0xA1, 0x9A, 0x52,
+    0x67, 0x6F, 0x56, 0x52, 0xC0, 0x7F, 0xC0, 0x01, 0xC0, 0x7E, 0x16, 0x50, 0xA3, 0x97, 0x06, 0xA3,
+    0x86, 0x0F, 0x6E, 0x62, 0x0C, 0x3F, 0x06, 0x7E, 0x66, 0x56, 0xC0, 0xA3, 0x88, 0x3F, 0x13, 0x11,
+    0x55, 0x14, 0x5D, 0xA3, 0x87, 0xA3, 0x77, 0x33, 0x49, 0x5E, 0xA5, 0x67, 0xA2, 0x67, 0x5E, 0x46,
+    0xA2, 0x68, 0x4B, 0x6F, 0x31, 0x42, 0xA1, 0x9A, 0x9D, 0x8A, 0xA1, 0x9A, 0x23, 0x67, 0x63, 0x7B,
+    0x9C, 0x9A, 0x62, 0x7F, 0x62, 0x7B, 0x62, 0x7A, 0x9D, 0x9A, 0x65, 0x66, 0xA2, 0x98, 0x3A, 0x61,
+    0x2E, 0x7A, 0x29, 0xA2, 0x98, 0x56, 0x65, 0x38, 0xC1, 0xA2, 0x77, 0xC1, 0x2E, 0xA2, 0x78, 0x35,
+    0xC0, 0xA2, 0x78, 0x10, 0x6E, 0x1A, 0x6E, 0x59, 0x6E, 0x59, 0xA4, 0x77, 0x6D, 0x6E, 0x5D, 0x25,
+    0xA2, 0x86, 0x6D, 0xA2, 0x87, 0x1B, 0x7D, 0x7E, 0x69, 0xA1, 0xA7, 0x7E, 0x79, 0x9D, 0xA9, 0xA1,
+    0xA8, 0x71, 0x9D, 0xA9, 0x9F, 0xB9, 0x28, 0xA0, 0xA9, 0x9C, 0x99, 0x77, 0x0D, 0xA1, 0xAA, 0x9C,
+    0x9A, 0x52, 0x77, 0x6F, 0x9C, 0x9A, 0x6F, 0x66, 0x6F, 0x16, 0x51, 0x7F, 0x02, 0x0F, 0xC0, 0x7E,
+    0x59, 0x69, 0xA2, 0x86, 0xA3, 0x77, 0xA2, 0x76, 0xC0, 0x9D, 0xAA, 0x51, 0x67, 0xA2, 0x89, 0xC0,
+    0x13, 0x55, 0x65, 0xA3, 0x88, 0x6E, 0x1B, 0x50, 0xA2, 0x77, 0xA4, 0x76, 0x12, 0xA2, 0x66, 0x35,
+    0x59, 0xA2, 0x67, 0xA4, 0x67, 0x4A, 0xA3, 0x78, 0x9F, 0x68, 0xA2, 0x79, 0xA2, 0x68, 0x5B, 0x43,
+    0xA1, 0x8A, 0x2F, 0x53, 0x67, 0x2D, 0x9D, 0x9A, 0x22, 0x63, 0x77, 0x62, 0x6B, 0x62, 0x7A, 0x66,
+    0x62, 0x7A, 0x62, 0xC0, 0x9D, 0x99, 0xA2, 0x98, 0xC0, 0x51, 0x7B, 0x6E, 0xC0, 0x7A, 0x41, 0x38,
+    0xA2, 0x87, 0x2E, 0x29, 0x02, 0x6F, 0x3F, 0xC0, 0x59, 0xA2, 0x88, 0x55, 0xA3, 0x88, 0x15, 0x55,
+    0x17, 0x69, 0x5E, 0x69, 0xA2, 0x77, 0x1F, 0x6D, 0x22, 0x1B, 0xA2, 0x77, 0xA3, 0x87, 0x64, 0x6D,
+    0x6E, 0xA2, 0x97, 0x6D, 0x75, 0x7D, 0x69, 0x71, 0xA2, 0x97, 0x9D, 0xA8, 0x62, 0xA1, 0xA8, 0x76,
+    0x9D, 0xB9, 0x9D, 0xAA, 0xA0, 0xA9, 0x9D, 0xAA, 0x7B, 0x9C, 0x99, 0x62, 0xA0, 0x9A, 0x9D, 0x9A,
+    0x11, 0x67, 0x51, 0x6B, 0x7B, 0x51, 0x6F, 0xC0, 0x7F, 0x3C, 0x10, 0x6D, 0x3F, 0x11, 0x0F, 0xA3,
+    0x87, 0x5D, 0x55, 0x63, 0x19, 0x0F, 0x3B, 0x7F, 0x0F, 0x07, 0x3B, 0x6E, 0xA2, 0x87, 0x5E, 0x6D,
+    0x12, 0xA4, 0x76, 0x49, 0xA3, 0x78, 0x28, 0xA3, 0x67, 0xA2, 0x67, 0x0C, 0x5F, 0xA2, 0x68, 0x4A,
+    0x5B, 0x47, 0x6F, 0x53, 0x22, 0x57, 0x7B, 0xA0, 0x8A, 0x9D, 0x9A, 0x9D, 0xAA, 0xA1, 0x9A, 0x66,
+    0x9D, 0xAA, 0x6B, 0x72, 0x51, 0x62, 0xA1, 0xA9, 0x56, 0x04, 0xC0, 0x61, 0xA2, 0x89, 0x02, 0x56,
+    0x61, 0x38, 0x29, 0x3D, 0x55, 0x3D, 0xC0, 0x02, 0xC0, 0x6E, 0x3A, 0x04, 0x55, 0xC0, 0x6E, 0xA3,
+    0x88, 0x3C, 0xC0, 0x1A, 0x59, 0x66, 0xA2, 0x77, 0x6E, 0x59, 0xA4, 0x77, 0x69, 0x31, 0x1B, 0x6E,
+    0x39, 0x6D, 0x24, 0xA3, 0x88, 0x69, 0x68, 0x7E, 0x1D, 0xA2, 0x88, 0x74, 0x69, 0x75, 0x14, 0x71,
+    0x7E, 0x72, 0x71, 0x62, 0x72, 0x62, 0x1C, 0x26, 0x77, 0x62, 0x63, 0x62, 0x9D, 0x99, 0x6B, 0x7B,
+    0x66, 0x6B, 0x6E, 0x3F, 0x6B, 0x0E, 0x13, 0x6D, 0x02, 0x00, 0x1E, 0x0D, 0xA2, 0x77, 0x12, 0x7B,
+    0xC0, 0x62, 0x52, 0xC0, 0x12, 0xC0, 0x56, 0x6D, 0x21, 0x17, 0x69, 0xA2, 0x67, 0xA4, 0x77, 0xA2,
+    0x77, 0x3E, 0x39, 0x5E, 0xA2, 0x68, 0x4A, 0xA4, 0x68, 0x42, 0x2D, 0x31, 0x30, 0x56, 0x22, 0xA0,
+    0x8A, 0x9D, 0x9A, 0xA1, 0x9A, 0x9C, 0x9A, 0x7F, 0x9C, 0x9A, 0x7B, 0x62, 0x52, 0x7B, 0x7E, 0x62,
+    0x76, 0x52, 0x7E, 0x51, 0x7B, 0x51, 0x3F, 0x66, 0x7A, 0xC2, 0x6E, 0x51, 0x3A, 0x02, 0xC0, 0x45,
+    0xA3, 0x99, 0x5A, 0x35, 0x0E, 0xC0, 0x5A, 0x6E, 0x6E, 0x55, 0xA3, 0x78, 0xC0, 0x6D, 0xC0, 0xA2,
+    0x77, 0x6E, 0x27, 0x18, 0xA2, 0x77, 0x6E, 0xA2, 0x86, 0x6E, 0x54, 0x7E, 0x6E, 0x36, 0x7D, 0x69,
+    0x7E, 0x50, 0x79, 0xA2, 0x98, 0x69, 0x71, 0x7D, 0x76, 0x61, 0x76, 0x76, 0x61, 0x9F, 0xBA, 0x62,
+    0x72, 0x62, 0x62, 0x66, 0x62, 0x0A, 0x14, 0x6B, 0x9D, 0x99, 0xC1, 0x11, 0x51, 0x02, 0x16, 0x1B,
+    0x64, 0xA3, 0x78, 0x6D, 0x17, 0x26, 0x62, 0x12, 0x7F, 0xC1, 0x9D, 0x99, 0x21, 0x66, 0x21, 0x6D,
+    0x55, 0x26, 0xA2, 0x77, 0x49, 0xA4, 0x77, 0x5D, 0x4A, 0xA3, 0x78, 0x5F, 0x5E, 0x25, 0x5F, 0x19,
+    0x31, 0x5B, 0x53, 0x9D, 0x9A, 0xA1, 0x8A, 0x67, 0x53, 0x77, 0x18, 0x63, 0x7B, 0x66, 0x7B, 0x06,
+    0x66, 0x0B, 0x7E, 0x0E, 0x9D, 0x99, 0x04, 0x35, 0x66, 0x3F, 0x51, 0xC0, 0xA3, 0x98, 0x66, 0x33,
+    0x3F, 0x3A, 0x2B, 0x07, 0x30, 0x3F, 0x35, 0xA2, 0x88, 0x55, 0x0B, 0x55, 0xA3, 0x88, 0x06, 0xC0,
+    0x6E, 0x24, 0x55, 0xA2, 0x78, 0x6D, 0x6E, 0x6E, 0x50, 0xA2, 0x77, 0xC0, 0x6D, 0xA2, 0x77, 0x2D,
+    0xA2, 0x77, 0x69, 0x69, 0xA2, 0x87, 0x2F, 0x55, 0xA2, 0x97, 0x69, 0x65, 0x7E, 0x7E, 0x65, 0xA1,
+    0xA8, 0x65, 0x60, 0x76, 0xA1, 0xA8, 0x3B, 0x39, 0x76, 0x62, 0xA1, 0xA9, 0x9D, 0xAA, 0x9D, 0x99,
+    0x7F, 0x62, 0x0D, 0xA2, 0x89, 0x9C, 0x98, 0x7F, 0x52, 0x00, 0xA3, 0x99, 0x51, 0x05, 0xC0, 0x12,
+    0x5A, 0xA3, 0x87, 0xA2, 0x77, 0x26, 0x5D, 0x26, 0x1C, 0x7A, 0x2B, 0xC1, 0x51, 0xA2, 0x77, 0x55,
+    0x6E, 0xA2, 0x77, 0x6E, 0xA2, 0x77, 0x3E, 0xA2, 0x67, 0x55, 0xA5, 0x68, 0x06, 0x5F, 0x5F, 0xA2,
+    0x68, 0x6B, 0x5B, 0x57, 0x2A, 0x5B, 0x9D, 0x9B, 0xA1, 0x9A, 0x52, 0x22, 0x9D, 0xAB, 0x7F, 0x62,
+    0x9D, 0x9A, 0x7A, 0x0B, 0x7B, 0x3C, 0x7A, 0x3A, 0x09, 0xC0, 0x9D, 0x99, 0x35, 0x30, 0x7F, 0x07,
+    0x3F, 0xC0, 0x04, 0x3F, 0xC2, 0x30, 0xA2, 0x78, 0x09, 0x5A, 0xC0, 0x3C, 0xC0, 0x6E, 0xA2, 0x78,
+    0x6E, 0x55, 0xA3, 0x88, 0x54, 0x24, 0xC0, 0x55, 0xA2, 0x77, 0x6E, 0x69, 0x69, 0xA3, 0x88, 0x59,
+    0x6E, 0x32, 0x6D, 0xC0, 0x7D, 0x55, 0xA3, 0x88, 0x50, 0xA2, 0x97, 0x38, 0x50, 0x7E, 0xA2, 0x87,
+    0x61, 0x7E, 0x79, 0x76, 0x9D, 0x98, 0xA1, 0xA8, 0x7B, 0x61, 0xA0, 0xA8, 0x66, 0x9D, 0xA9, 0x7B,
+    0x9C, 0xA9, 0x7F, 0x9D, 0x99, 0x1C, 0x2B, 0x9D, 0x99, 0x7F, 0x62, 0xC0, 0x6E, 0x52, 0x17, 0x1C,
+    0x21, 0x59, 0x6E, 0x59, 0xA5, 0x77, 0x59, 0x30, 0x62, 0x7E, 0x26, 0xC0, 0x66, 0x69, 0x30, 0x55,
+    0x6E, 0x5E, 0x6E, 0x34, 0x5A, 0x0C, 0x0E, 0x5F, 0x5F, 0x5A, 0xA1, 0x7A, 0x6F, 0x9D, 0x8A, 0x57,
+    0xA1, 0x8A, 0x9D, 0x8A, 0x67, 0x67, 0x2F, 0x9D, 0x9A, 0x1F, 0x7B, 0x62, 0x66, 0x77, 0x51, 0x01,
+    0xC0, 0x7B, 0x51, 0x09, 0x51, 0x6F, 0x09, 0x3F, 0x04, 0x3F, 0xA2, 0x78, 0x09, 0x04, 0x09, 0x35,
+    0x04, 0x01, 0x3A, 0x06, 0x69, 0x0B, 0x55, 0xA3, 0x88, 0x51, 0xA3, 0x88, 0x55, 0x6E, 0xA2, 0x78,
+    0x50, 0xA2, 0x77, 0xC0, 0xA2, 0x77, 0x7E, 0x59, 0xA2, 0x88, 0x59, 0x2F, 0x6E, 0x50, 0x23, 0xC0,
+    0xA3, 0x87, 0x51, 0x7A, 0x36, 0x50, 0x6E, 0x7A, 0xA3, 0x88, 0x69, 0x65, 0xA2, 0x87, 0x9D, 0xA8,
+    0xC0, 0x7D, 0x7A, 0x7A, 0x7A, 0x03, 0xA2, 0x98, 0x61, 0x61, 0x76, 0x7A, 0x32, 0x7F, 0x9C, 0x99,
+    0xA1, 0xA9, 0x62, 0x66, 0xC0, 0x76, 0x6B, 0x51, 0x66, 0x66, 0x17, 0x2B, 0x50, 0x6E, 0xA3, 0x78,
+    0x35, 0x59, 0xA4, 0x67, 0x9C, 0xAA, 0x30, 0x66, 0x55, 0x2B, 0x1C, 0xC0, 0xA2, 0x77, 0xA2, 0x78,
+    0x01, 0x59, 0x5A, 0x05, 0x0C, 0x1A, 0x5E, 0x56, 0x4B, 0x19, 0x5B, 0x5B, 0x67, 0x57, 0xA0, 0x8A,
+    0x6B, 0x9C, 0x9A, 0x27, 0x62, 0x67, 0x62, 0x7B, 0x67, 0x66, 0x72, 0x51, 0x7F, 0xC0, 0x66, 0x66,
+    0x3A, 0xA2, 0x88, 0x66, 0x56, 0x09, 0x04, 0xA2, 0x78, 0x9D, 0x98, 0x15, 0x0E, 0x01, 0x0E, 0x6E,
+    0x0B, 0x10, 0xC1, 0x59, 0x6E, 0x6F, 0x6D, 0x66, 0x5A, 0xA2, 0x77, 0x65, 0xA3, 0x88, 0x6D, 0x55,
+    0x2C, 0x6E, 0x6E, 0x27, 0x20, 0xA3, 0x88, 0x50, 0xA2, 0x87, 0xA2, 0x78, 0x50, 0xC0, 0xA2, 0x97,
+    0x55, 0xC0, 0x1B, 0xA3, 0x88, 0x79, 0x55, 0x29, 0xA2, 0x87, 0x9D, 0x99, 0x7E, 0x2D, 0x65, 0x7E,
+    0x60, 0xC0, 0xA1, 0xA9, 0x79, 0x9D, 0x99, 0xA1, 0xA8, 0x38, 0x7A, 0xA1, 0xA9, 0x62, 0x9D, 0xA9,
+    0x7A, 0x32, 0x61, 0x7F, 0x62, 0x2E, 0x52, 0xC0, 0x66, 0x21, 0x2E, 0x41, 0x6E, 0xA3, 0x88, 0xA2,
+    0x67, 0x2D, 0x5E, 0xA0, 0xB9, 0x66, 0x51, 0x35, 0x26, 0x56, 0x28, 0x3C, 0x59, 0x6E, 0xA2, 0x67,
+    0xA2, 0x78, 0x11, 0x06, 0x5A, 0xA2, 0x68, 0x5B, 0x5F, 0x36, 0x52, 0x53, 0x22, 0x6B, 0x53, 0x67,
+    0xA0, 0x9A, 0x9D, 0x9A, 0x7B, 0x9D, 0x99, 0x67, 0x76, 0x62, 0x7F, 0xC0, 0x9D, 0x99, 0x7B, 0x7E,
+    0x51, 0xA2, 0x89, 0x9D, 0x98, 0x6B, 0xC0, 0x3A, 0x6F, 0x55, 0x06, 0x3F, 0x5A, 0x0B, 0x6E, 0xC0,
+    0x6E, 0x10, 0x59, 0xA2, 0x88, 0x41, 0xA4, 0x87, 0x51, 0xA2, 0x78, 0x69, 0x55, 0xA4, 0x77, 0xC0,
+    0x69, 0x55, 0xA2, 0x78, 0x69, 0x6E, 0xA2, 0x87, 0x20, 0x39, 0x50, 0x23, 0x69, 0x6E, 0x7E, 0x69,
+    0x31, 0xA2, 0x77, 0x61, 0x59, 0xA3, 0x98, 0x9D, 0x98, 0xA2, 0x88, 0x6E, 0x65, 0x65, 0x7E, 0xC0,
+    0x7E, 0xC0, 0x79, 0x65, 0xC0, 0x61, 0xA2, 0x97, 0x61, 0x66, 0xA2, 0x98, 0x61, 0x0F, 0x9C, 0x99,
+    0x76, 0xC0, 0xA0, 0xA9, 0xC0, 0x26, 0x7F, 0x26, 0x35, 0x9D, 0x99, 0xA2, 0x88, 0x1C, 0xC0, 0x26,
+    0x5A, 0x28, 0x6E, 0xA3, 0x77, 0x4A, 0x9E, 0xCA, 0x65, 0x23, 0x28, 0xC0, 0x3C, 0x5E, 0x2F, 0x08,
+    0x5E, 0x07, 0xA2, 0x77, 0x06, 0xA2, 0x78, 0x4B, 0x6F, 0x19, 0x25, 0x47, 0x67, 0xA1, 0x8A, 0x9D,
+    0x8A, 0x67, 0x39, 0x9C, 0x99, 0x63, 0x67, 0x66, 0x62, 0x66, 0x77, 0x6F, 0x9D, 0xA9, 0x7F, 0x6E,
+    0x10, 0x62, 0x3F, 0x37, 0x06, 0xA2, 0x87, 0x37, 0x10, 0x66, 0x10, 0x01, 0x10, 0x59, 0xA2, 0x88,
+    0x55, 0x1A, 0x6E, 0x0B, 0x6E, 0x6E, 0xC0, 0x6E, 0xC0, 0x6E, 0x59, 0x6E, 0xA3, 0x88, 0x55, 0xC0,
+    0xA3, 0x87, 0x1B, 0xA3, 0x88, 0x50, 0x1E, 0xA2, 0x88, 0x2B, 0xC0, 0xA2, 0x87, 0x5A, 0x7D, 0x55,
+    0xC0, 0x20, 0xA2, 0x98, 0x51, 0x69, 0xA2, 0x88, 0x7E, 0x9D, 0x88, 0xA3, 0x98, 0x51, 0x25, 0xA2,
+    0x88, 0x65, 0x65, 0x2D, 0x29, 0x66, 0x69, 0x7E, 0x14, 0x7A, 0x7A, 0x9D, 0x99, 0x7E, 0x11, 0x0F,
+    0x05, 0x08, 0x61, 0x3E, 0x3C, 0x65, 0x28, 0xA1, 0xA9, 0xC1, 0x55, 0xC0, 0x3C, 0x28, 0xA2, 0x77,
+    0xA2, 0x78, 0x59, 0x0F, 0x9C, 0xCA, 0xC0, 0x32, 0x66, 0x01, 0x6E, 0x03, 0x08, 0x49, 0x0C, 0xA2,
+    0x78, 0x45, 0x5B, 0xA2, 0x78, 0x29, 0x21, 0x5F, 0xA0, 0x7A, 0x52, 0x36, 0x9D, 0x9A, 0x57, 0x19,
+    0xA2, 0x8A, 0x2C, 0x52, 0x77, 0x51, 0x7B, 0x9D, 0xAA, 0xC0, 0x66, 0x7F, 0x51, 0x66, 0xA2, 0x88,
+    0x66, 0x3C, 0x10, 0xC0, 0x3C, 0x0B, 0x10, 0x06, 0x6B, 0x01, 0xA2, 0x77, 0x06, 0xA3, 0x88, 0x55,
+    0x6E, 0x56, 0x15, 0x1A, 0x24, 0x6E, 0x24, 0x29, 0x55, 0xA2, 0x77, 0x2C, 0x55, 0x6E, 0x6E, 0x69,
+    0xA2, 0x87, 0x6E, 0x23, 0x7E, 0xA2, 0x77, 0x69, 0x36, 0x6E, 0x9D, 0x99, 0xA3, 0x98, 0x59, 0x61,
+    0x1C, 0xA3, 0x88, 0x51, 0x7E, 0xC0, 0x31, 0xC0, 0x51, 0x31, 0x65, 0x7E, 0x25, 0xA2, 0x87, 0x61,
+    0xC0, 0x65, 0xA2, 0x87, 0x62, 0x65, 0xA2, 0x98, 0x0F, 0x65, 0xA2, 0x98, 0x9D, 0xA9, 0xC0, 0xA1,
+    0xA8, 0x0A, 0x39, 0xC0, 0x66, 0x76, 0xC0, 0x7A, 0x52, 0xA2, 0x88, 0xC0, 0x35, 0x56, 0x32, 0x34,
+    0xA2, 0x77, 0x0F, 0x04, 0x9E, 0xC9, 0x7A, 0x37, 0x52, 0x08, 0x03, 0x3E, 0x5A, 0x5A, 0xA3, 0x89,
+    0xA2, 0x67, 0x42, 0xA2, 0x78, 0x5A, 0xA1, 0x7A, 0x5A, 0xA0, 0x8A, 0x42, 0x67, 0x57, 0x2B, 0x6B,
+    0x9D, 0x9A, 0xA0, 0x9A, 0x9D, 0x99, 0xA0, 0x9A, 0x66, 0x62, 0x0D, 0xA1, 0xA9, 0x0B, 0x66, 0x01,
+    0xC0, 0xA2, 0x88, 0x66, 0xC2, 0x5A, 0x15, 0x6E, 0x1F, 0xC0, 0x9D, 0x89, 0x6E, 0xA2, 0x87, 0x6E,
+    0xC1, 0x24, 0x66, 0xC0, 0x24, 0x55, 0x6D, 0xA2, 0x78, 0xC0, 0x6E, 0x65, 0xA2, 0x87, 0xA2, 0x77,
+    0x20, 0x32, 0x55, 0xA2, 0x88, 0x64, 0x6E, 0x2E, 0x65, 0x36, 0x65, 0xA2, 0x77, 0x28, 0xA2, 0x88,
+    0x64, 0x38, 0x29, 0x65, 0xC2, 0xA2, 0x87, 0x51, 0x7A, 0x2A, 0x19, 0xA3, 0x88, 0x51, 0x2D, 0x69,
+    0x61, 0xA2, 0x88, 0x15, 0xA2, 0x98, 0x55, 0x7A, 0x60, 0x17, 0x7E, 0x66, 0x09, 0x11, 0x3B, 0x07,
+    0x61, 0xA2, 0x98, 0x9D, 0x99, 0xC0, 0x7A, 0x66, 0x6F, 0x51, 0x2F, 0xA2, 0x88, 0x34, 0x05, 0x3B,
+    0x5A, 0x09, 0x9D, 0xD9, 0x34, 0xA2, 0x88, 0x34, 0x05, 0xC0, 0x0A, 0x07, 0x11, 0x42, 0xA2, 0x78,
+    0x14, 0x5B, 0x21, 0xA2, 0x79, 0x42, 0x6B, 0x53, 0x57, 0x24, 0x53, 0x67, 0x67, 0x7B, 0x67, 0x9D,
+    0x99, 0x7B, 0x66, 0x66, 0x7B, 0x66, 0x06, 0xC0, 0x1A, 0x06, 0xC0, 0x7F, 0x1A, 0x5A, 0x1A, 0x41,
+    0x1F, 0x55, 0x59, 0xA2, 0x88, 0x55, 0xA2, 0x88, 0x6E, 0x55, 0x66, 0xA2, 0x77, 0xC0, 0x33, 0x55,
+    0x69, 0xC0, 0xA3, 0x88, 0x22, 0xA3, 0x87, 0xC0, 0x69, 0xC0, 0x2B, 0x6F, 0x69, 0x65, 0x6D, 0xC0,
+    0x6D, 0x7F, 0x7E, 0x1C, 0xC0, 0x7E, 0x69, 0xA2, 0x88, 0x69, 0x1D, 0x16, 0xA3, 0x98, 0x66, 0x32,
+    0xC0, 0x19, 0x2D, 0x55, 0x2D, 0x32, 0x2D, 0x7E, 0x21, 0xA2, 0x87, 0x9D, 0x99, 0xA2, 0x88, 0x18,
+    0x69, 0xA2, 0x88, 0x7A, 0x0F, 0x7E, 0x61, 0x7E, 0x01, 0x04, 0xA2, 0x98, 0x3B, 0x66, 0x05, 0x65,
+    0x08, 0x39, 0x08, 0x66, 0x08, 0x39, 0x36, 0xC0, 0xA3, 0x88, 0x04, 0x01, 0x9D, 0xD9, 0x6F, 0x39,
+    0x0D, 0x36, 0x0A, 0xA2, 0x77, 0x09, 0xA2, 0x78, 0x17, 0x28, 0x11, 0x5F, 0x1E, 0x6B, 0xA0, 0x7A,
+    0x52, 0x22, 0xA2, 0x89, 0x53, 0x9D, 0x9A, 0x27, 0x9D, 0xAA, 0x6B, 0x66, 0x10, 0x7F, 0x62, 0x66,
+    0x7F, 0x56, 0x7A, 0x51, 0xC0, 0x6F, 0x06, 0x1F, 0x51, 0x10, 0x15, 0x6E, 0xC0, 0x55, 0xC0, 0xA2,
+    0x77, 0xC0, 0xA2, 0x88, 0x55, 0xA2, 0x87, 0xC0, 0x2C, 0x18, 0xA2, 0x77, 0x6E, 0xC0, 0x65, 0xA3,
+    0x88, 0x6E, 0x65, 0x55, 0x6E, 0xA2, 0x87, 0x65, 0x6E, 0xA2, 0x87, 0xC0, 0x2F, 0xA2, 0x87, 0x1C,
+    0x6E, 0x7A, 0x7E, 0x69, 0xA2, 0x88, 0x32, 0x51, 0x7F, 0x65, 0x55, 0x26, 0x7A, 0x51, 0xC0, 0x21,
+    0x69, 0x15, 0x29, 0x1A, 0x15, 0xC0, 0x1A, 0xC0, 0x7B, 0x69, 0x66, 0x1D, 0x7E, 0x61, 0x66, 0x69,
+    0xA2, 0x99, 0x50, 0xA2, 0x88, 0x01, 0xA2, 0x98, 0x65, 0x07, 0x3B, 0xA2, 0x88, 0x0A, 0x51, 0x0D,
+    0x36, 0x0A, 0x05, 0x0A, 0x38, 0x6E, 0x01, 0xA3, 0x88, 0x05, 0x51, 0xA2, 0x87, 0x0A, 0x0F, 0x3B,
+    0x0C, 0x5F, 0x0B, 0x08, 0x14, 0x29, 0x2D, 0x39, 0x9D, 0x89, 0xA0, 0x7A, 0x20, 0xA1, 0x9A, 0x9D,
+    0x8A, 0x23, 0x63, 0x7F, 0x53, 0x62, 0x62, 0x66, 0x66, 0x66, 0x7B, 0x56, 0x7A, 0x10, 0x0B, 0x17,
+    0x6D, 0x08, 0x15, 0x6E, 0x56, 0x69, 0xA3, 0x88, 0xC0, 0x55, 0xA2, 0x87, 0x1F, 0x6E, 0x69, 0xC0,
+    0x6E, 0x7E, 0x1B, 0x20, 0xC0, 0xA3, 0x88, 0x65, 0x6E, 0x23, 0xC0, 0x69, 0x21, 0xC0, 0xA2, 0x87,
+    0xA2, 0x87, 0xC0, 0x79, 0xC0, 0x54, 0xA2, 0x98, 0x69, 0x51, 0x16, 0xA3, 0x98, 0x19, 0x7A, 0x6E,
+    0x65, 0x7E, 0xC0, 0x6F, 0x1D, 0x55, 0x7B, 0x25, 0x0E, 0xC0, 0xA2, 0x99, 0x29, 0x18, 0x15, 0xC0,
+    0x29, 0x7E, 0xC0, 0x55, 0x2C, 0x9D, 0x98, 0x11, 0x0C, 0xA2, 0x88, 0x14, 0x65, 0x66, 0x7E, 0x7F,
+    0x7A, 0x66, 0x04, 0x07, 0xC0, 0x65, 0x0F, 0xC0, 0x0A, 0xC0, 0x3B, 0x5A, 0x07, 0x09, 0x1A, 0x5A,
+    0x9A, 0xD9, 0x6E, 0x0D, 0x3B, 0xC0, 0xA3, 0x78, 0xC0, 0x1A, 0x08, 0x6B, 0x2C, 0x21, 0x32, 0x9D,
+    0x8A, 0x6B, 0x57, 0x5B, 0xA0, 0x9A, 0x2B, 0x6B, 0x1B, 0x66, 0xA2, 0x89, 0x9D, 0xAA, 0x9D, 0x9A,
+    0x7F, 0xC0, 0x6B, 0x61, 0x56, 0xA2, 0x98, 0x59, 0x6B, 0x0D, 0x12, 0x1F, 0x51, 0xA2, 0x78, 0xA2,
+    0x87, 0x55, 0x13, 0xA3, 0x88, 0xC0, 0x59, 0x2A, 0x1B, 0x34, 0x2F, 0x34, 0x39, 0x32, 0xC0, 0x55,
+    0xC0, 0xA2, 0x88, 0x2B, 0x55, 0x38, 0x2E, 0x7F, 0x6D, 0xC0, 0x69, 0x61, 0xA2, 0x87, 0x69, 0x7E,
+    0x7E, 0x55, 0x1E, 0x35, 0x65, 0xC0, 0x7A, 0x25, 0x0C, 0xC0, 0xA3, 0x98, 0xC1, 0x14, 0x28, 0x14,
+    0xC1, 0x20, 0xC1, 0x55, 0x6F, 0x25, 0xC0, 0x2C, 0x9D, 0x88, 0x1D, 0x25, 0x2C, 0x20, 0x28, 0x66,
+    0xC1, 0x61, 0xC0, 0x79, 0x01, 0x04, 0xA2, 0x87, 0xC0, 0x7A, 0x07, 0x7E, 0x5A, 0x07, 0x14, 0x07,
+    0x59, 0x6F, 0x6F, 0xA2, 0x67, 0x99, 0xEA, 0x36, 0x0A, 0xC0, 0x07, 0x0C, 0x0E, 0x5A, 0x17, 0x4A,
+    0x1D, 0x5F, 0x1E, 0x57, 0x6B, 0xA0, 0x7A, 0x67, 0x5B, 0x9D, 0x9A, 0x67, 0x66, 0x63, 0xC0, 0x1A,
+    0x7F, 0x66, 0x1F, 0xC0, 0x66, 0x6F, 0x51, 0x69, 0x12, 0x24, 0xC0, 0x10, 0xA2, 0x77, 0xC0, 0xA2,
+    0x77, 0x1D, 0x22, 0xC0, 0x6E, 0x20, 0x25, 0x6E, 0x32, 0x2B, 0x5A, 0x2B, 0xC0, 0x6E, 0x38, 0x35,
+    0x65, 0xC0, 0x2E, 0x7E, 0x51, 0x69, 0x7E, 0xC0, 0x6D, 0x7E, 0x7E, 0x39, 0x65, 0x1E, 0xA2, 0x98,
+    0x50, 0x2C, 0x11, 0x7F, 0x7E, 0xC0, 0x17, 0x1C, 0x17, 0x61, 0xA3, 0x88, 0x51, 0x7F, 0x17, 0x03,
+    0x17, 0x1C, 0x56, 0x6E, 0x14, 0xC1, 0x11, 0xA2, 0x88, 0xC2, 0x20, 0xC0, 0x28, 0x66, 0x08, 0x23,
+    0x17, 0xC0, 0x0B, 0x1A, 0x01, 0x3D, 0xA2, 0x88, 0x3D, 0x0C, 0x07, 0x0C, 0x07, 0x18, 0x0C, 0x04,
+    0x1A, 0xC0, 0x23, 0x05, 0x51, 0x3E, 0x07, 0x65, 0x3D, 0x09, 0x06, 0x5F, 0x20, 0x5F, 0x5A, 0x42,
+    0xA1, 0x8A, 0x21, 0xA1, 0x9A, 0x36, 0x57, 0x9D, 0x9A, 0x32, 0x67, 0x9D, 0x9A, 0x1D, 0x33, 0x61,
+    0x10, 0x7F, 0xC1, 0x6E, 0x10, 0xA3, 0x88, 0xC1, 0x59, 0x6E, 0x7E, 0x1D, 0xA3, 0x88, 0x27, 0x6D,
+    0xC0, 0x32, 0xC0, 0x54, 0xA3, 0x99, 0x30, 0x69, 0x66, 0x29, 0x7E, 0x6E, 0x51, 0xC0, 0x6E, 0xA2,
+    0x88, 0x2F, 0x55, 0x37, 0x55, 0x65, 0xA3, 0x88, 0x65, 0x79, 0x39, 0x60, 0xA2, 0x88, 0x9D, 0x98,
+    0x7A, 0x69, 0x19, 0x0F, 0x17, 0x0B, 0x0E, 0xC0, 0x01, 0xA2, 0x98, 0x09, 0xC2, 0x0E, 0x7F, 0x0E,
+    0x0B, 0x06, 0x0B, 0xA2, 0x78, 0x17, 0x1C, 0x14, 0x6F, 0x11, 0xA2, 0x98, 0x14, 0x56, 0x11, 0x14,
+    0x28, 0x1C, 0x17, 0x1C, 0x17, 0x1A, 0x0E, 0x1D, 0x01, 0x09, 0xC0, 0x07, 0xA2, 0x77, 0x66, 0xC0,
+    0x18, 0x04, 0x18, 0x06, 0x0B, 0x17, 0x9D, 0xE9, 0x9D, 0x89, 0x6E, 0x0A, 0x6E, 0x11, 0x09, 0x5F,
+    0xA2, 0x78, 0x46, 0x5E, 0x21, 0x16, 0xA2, 0x79, 0x9D, 0x9A, 0xA2, 0x8A, 0x56, 0x57, 0x2B, 0xA0,
+    0x8A, 0x34, 0x9C, 0x99, 0x6B, 0x66, 0xA1, 0x9A, 0x51, 0x7F, 0xC2, 0x51, 0x2E, 0x1F, 0x6E, 0xA2,
+    0x87, 0xC0, 0x59, 0x6E, 0x69, 0x7E, 0xA2, 0x77, 0x2B, 0xC0, 0x69, 0xA3, 0x88, 0x22, 0x36, 0x3B,
+    0x2F, 0xC0, 0x6E, 0x65, 0x66, 0xC0, 0x28, 0x7F, 0x1C, 0xA2, 0x88, 0x55, 0x7E, 0x65, 0xA2, 0x88,
+    0x7A, 0x1E, 0x7F, 0x65, 0x79, 0x65, 0xA1, 0xA9, 0xC0, 0x0B, 0x7F, 0x76, 0xC0, 0x50, 0x76, 0xC0,
+    0x0F, 0xC0, 0x3B, 0x07, 0x3B, 0x07, 0x55, 0x18, 0xC0, 0x09, 0xC0, 0x06, 0x1A, 0x6E, 0x23, 0x14,
+    0x23, 0x14, 0xA2, 0x88, 0x9D, 0x89, 0x28, 0x20, 0x23, 0x69, 0x14, 0x1C, 0x0B, 0xC1, 0x06, 0x09,
+    0x18, 0x69, 0x18, 0x3D, 0x07, 0x38, 0x18, 0x11, 0x04, 0x06, 0x0B, 0x5B, 0x9B, 0xE9, 0x05, 0x0A,
+    0x6E, 0x3B, 0xA2, 0x78, 0x09, 0x17, 0x08, 0x20, 0x5F, 0x26, 0x5B, 0xA1, 0x8A, 0x9C, 0x89, 0x1B,
+    0x36, 0x53, 0x52, 0x7B, 0x52, 0x27, 0x7B, 0x51, 0x6B, 0x7A, 0xC0, 0x52, 0xC0, 0x27, 0x33, 0x50,
+    0x1D, 0xA3, 0x88, 0x69, 0xC0, 0x39, 0x50, 0x23, 0xA3, 0x97, 0x51, 0x69, 0xA4, 0x77, 0x65, 0x66,
+    0x6D, 0xC0, 0x1C, 0xA3, 0x88, 0x51, 0x35, 0x21, 0x35, 0x21, 0x7E, 0xC1, 0x7E, 0x29, 0x65, 0x31,
+    0x60, 0xA3, 0x88, 0x61, 0x7E, 0x65, 0x7E, 0x14, 0x06, 0xA2, 0x88, 0x09, 0x0C, 0x61, 0x07, 0x05,
+    0x0D, 0xC0, 0x66, 0x00, 0x65, 0x6E, 0x05, 0x55, 0xC0, 0x07, 0x3B, 0x07, 0xA2, 0x78, 0x09, 0x01,
+    0x1A, 0xC0, 0x03, 0x17, 0x6F, 0x51, 0xA3, 0x88, 0x23, 0xC0, 0x0F, 0x28, 0x14, 0x0F, 0x17, 0x1F,
+    0x1A, 0x06, 0xA2, 0x98, 0xC0, 0x9D, 0x98, 0x18, 0xC0, 0x0C, 0x11, 0x3D, 0xC0, 0x09, 0x06, 0x0B,
+    0x03, 0x08, 0x0D, 0x0A, 0xC0, 0x0C, 0x04, 0x0E, 0x0B, 0x23, 0x45, 0x29, 0x5B, 0x56, 0x5B, 0x56,
+    0x57, 0x22, 0xA2, 0x89, 0x9D, 0x89, 0xA1, 0x9A, 0x9D, 0x9A, 0xC0, 0x62, 0xA2, 0x89, 0x66, 0x56,
+    0x31, 0x9D, 0x99, 0x6E, 0xC1, 0xA2, 0x77, 0xA2, 0x87, 0x65, 0x6E, 0x1E, 0x2B, 0x38, 0x55, 0x7E,
+    0x59, 0x20, 0xA2, 0x97, 0xC0, 0x65, 0x6E, 0xC0, 0x65, 0x6E, 0xC0, 0x7F, 0x1D, 0xC0, 0xA3, 0x88,
+    0x22, 0x31, 0x65, 0xA2, 0x88, 0xC0, 0x32, 0x62, 0x19, 0xA3, 0x98, 0x60, 0x11, 0x0F, 0x03, 0x06,
+    0x09, 0x7E, 0x76, 0x0A, 0x61, 0x62, 0xC0, 0xA2, 0x98, 0x9D, 0x99, 0x6E, 0x06, 0x9D, 0x89, 0x32,
+    0x6F, 0x6E, 0x2F, 0x39, 0x6E, 0x0A, 0x07, 0x0C, 0xC0, 0xA2, 0x78, 0x1A, 0x51, 0xC0, 0x0B, 0x5A,
+    0x17, 0xC0, 0x08, 0xC0, 0xA2, 0x88, 0x08, 0x0B, 0x17, 0xC0, 0x1A, 0xC1, 0x76, 0xC0, 0x0C, 0x18,
+    0x50, 0x0C, 0x11, 0x18, 0x3D, 0x0E, 0x06, 0x17, 0x9C, 0xE9, 0xC0, 0x0D, 0x3B, 0x0F, 0x11, 0x0E,
+    0x1A, 0x17, 0x5F, 0x46, 0xC0, 0xA2, 0x69, 0x31, 0x29, 0x53, 0xA2, 0x79, 0x9D, 0x9A, 0x38, 0x9D,
+    0x8A, 0x1E, 0x6F, 0x34, 0xC0, 0x66, 0x52, 0x2F, 0x6B, 0x2F, 0xC0, 0x1B, 0xA2, 0x77, 0x1E, 0x23,
+    0x3F, 0x21, 0x79, 0xA3, 0x87, 0x51, 0xA2, 0x87, 0x69, 0x24, 0xA3, 0x88, 0x31, 0x51, 0xA2, 0x87,
+    0x7A, 0xC0, 0x66, 0x59, 0x19, 0xC0, 0x2D, 0x19, 0x2D, 0x6E, 0x19, 0x32, 0xC0, 0x19, 0x15, 0xC0,
+    0xA3, 0x98, 0x20, 0x61, 0x17, 0x76, 0x09, 0x61, 0x0A, 0x0D, 0x9D, 0xA9, 0x52, 0x7A, 0x66, 0x7F,
+    0xC0, 0x51, 0x37, 0xC1, 0x6E, 0xC0, 0x6E, 0x6E, 0x03, 0x55, 0x0D, 0x41, 0xA3, 0x88, 0x0C, 0x11,
+    0x09, 0x0E, 0xC0, 0x1A, 0x41, 0x17, 0x1F, 0x41, 0x03, 0x08, 0x17, 0x1F, 0x15, 0x55, 0xC0, 0xA2,
+    0x98, 0x18, 0xC0, 0x04, 0x11, 0x07, 0x38, 0x0C, 0x55, 0x0C, 0x0E, 0x09, 0x1A, 0x99, 0xEA, 0x34,
+    0x0D, 0x36, 0xC0, 0x38, 0x09, 0x0B, 0x12, 0x14, 0xA2, 0x79, 0x46, 0x19, 0xA2, 0x78, 0xA0, 0x7A,
+    0x30, 0x57, 0x3B, 0x29, 0x52, 0x6B, 0x66, 0x66, 0x6B, 0xA2, 0x88, 0xC0, 0x6E, 0x34, 0x25, 0x7E,
+    0x6E, 0x2B, 0x6E, 0x6E, 0x7D, 0xC0, 0x64, 0xA3, 0x88, 0x69, 0x7E, 0x69, 0x9D, 0x98, 0x7A, 0xC0,
+    0xA3, 0x98, 0x69, 0x9D, 0x99, 0xA2, 0x88, 0xC0, 0x15, 0x7E, 0x2E, 0x15, 0xC0, 0x29, 0x21, 0x26,
+    0x21, 0x2E, 0x15, 0x6E, 0x2C, 0x50, 0x14, 0x03, 0x0E, 0x09, 0x71, 0x66, 0xA0, 0xA9, 0x51, 0x01,
+    0x66, 0x62, 0x3A, 0x62, 0x6E, 0x30, 0xC0, 0x65, 0x5A, 0x35, 0x55, 0x5A, 0xA2, 0x87, 0x3C, 0x45,
+    0xA2, 0x87, 0x5A, 0x05, 0x5A, 0x07, 0x38, 0xA4, 0x78, 0xC1, 0x06, 0x0B, 0x1F, 0x06, 0x17, 0x06,
+    0xC1, 0x0B, 0x0E, 0x6F, 0x09, 0xC0, 0x65, 0x0C, 0x38, 0x07, 0x3B, 0x6E, 0x0C, 0x38, 0xA3, 0x88,
+    0x18, 0x5A, 0x9A, 0xE9, 0x37, 0x03, 0x0D, 0x0F, 0xC0, 0x3D, 0x1A, 0x0B, 0x14, 0x5B, 0x2E, 0x19,
+    0xA3, 0x89, 0x42, 0x6B, 0x6B, 0x1B, 0x6B, 0xA1, 0x8A, 0x66, 0xC0, 0x6B, 0x1E, 0xA2, 0x88, 0xC0,
+    0x55, 0x37, 0x2B, 0x5A, 0x2B, 0x6D, 0x65, 0x22, 0xA3, 0x97, 0x55, 0xA2, 0x87, 0x65, 0x7E, 0x79,
+    0xC0, 0x7E, 0x65, 0x51, 0xA2, 0x97, 0x9D, 0x99, 0xA2, 0x88, 0x0C, 0xA3, 0x98, 0x55, 0x14, 0x0C,
+    0xC0, 0x25, 0x51, 0xA2, 0x78, 0x15, 0xC0, 0x7E, 0x15, 0x11, 0x20, 0x61, 0xA2, 0x87, 0x72, 0x79,
+    0x07, 0x0A, 0x34, 0xA1, 0xA9, 0x9D, 0xA9, 0x26, 0x62, 0x7A, 0x67, 0xC1, 0x7E, 0xC0, 0x51, 0xA2,
+    0x78, 0x6E, 0x51, 0x2B, 0x5D, 0x6E, 0x5A, 0xC0, 0xA3, 0x77, 0xA2, 0x78, 0x55, 0x36, 0x3B, 0xA3,
+    0x89, 0x09, 0x7F, 0x09, 0xC0, 0x1A, 0x51, 0xC3, 0xA2, 0x98, 0xC0, 0x18, 0x11, 0x04, 0x7E, 0x07,
+    0x3B, 0xC1, 0x07, 0x3B, 0x38, 0x07, 0x04, 0x18, 0x99, 0xEA, 0xA2, 0x78, 0x03, 0x34, 0x5A, 0x36,
+    0x07, 0x49, 0x0B, 0x5A, 0x14, 0x5F, 0x5F, 0x6F, 0x9D, 0x8A, 0x6B, 0x5B, 0xA2, 0x88, 0x57, 0x9D,
+    0x99, 0x6B, 0xC0, 0x56, 0x7F, 0xC0, 0x51, 0x7F, 0xA2, 0x87, 0x51, 0x29, 0xA2, 0x87, 0x65, 0xA2,
+    0x87, 0x50, 0x6E, 0xA2, 0x97, 0x65, 0x69, 0x35, 0x51, 0x79, 0x65, 0x20, 0x14, 0x0F, 0x65, 0xC0,
+    0x06, 0x1A, 0x5A, 0x12, 0x08, 0x0F, 0x08, 0x19, 0x20, 0xC0, 0x11, 0xC0, 0x20, 0xC0, 0x7E, 0x17,
+    0x06, 0x09, 0x61, 0x05, 0x75, 0x2D, 0x66, 0x76, 0x77, 0x9D, 0x99, 0x76, 0x6B, 0x66, 0xC1, 0x7E,
+    0xC0, 0x17, 0x6E, 0x6E, 0x55, 0x6E, 0xA3, 0x88, 0x26, 0xA2, 0x77, 0x01, 0x55, 0xA2, 0x78, 0x6E,
+    0x05, 0x59, 0x38, 0x0C, 0x6E, 0x3A, 0x09, 0x0E, 0x06, 0x7F, 0x09, 0xC0, 0x04, 0xC0, 0x0C, 0x04,
+    0x0C, 0x07, 0x7E, 0xC0, 0x3B, 0x66, 0x0F, 0x0A, 0x0F, 0x07, 0x38, 0x04, 0x2D, 0x01, 0x6E, 0x55,
+    0x34, 0x36, 0x0F, 0x0C, 0x0E, 0x0B, 0x5B, 0x20, 0x46, 0xA2, 0x79, 0xC0, 0x5F, 0x53, 0x51, 0xA2,
+    0x79, 0x66, 0x6B, 0xC0, 0x9D, 0x99, 0xA2, 0x78, 0x7B, 0x29, 0xA2, 0x88, 0x2E, 0x36, 0x2F, 0x65,
+    0xA2, 0x88, 0x68, 0x65, 0x25, 0xA2, 0x87, 0x61, 0x7E, 0x9D, 0x98, 0x14, 0x7F, 0x69, 0x9D, 0xA9,
+    0xA2, 0x88, 0x61, 0x3A, 0x11, 0x0C, 0x18, 0x04, 0x0E, 0x09, 0x56, 0x0B, 0x6F, 0x55, 0x0F, 0x14,
+    0xA2, 0x88, 0x14, 0x20, 0x0F, 0x06, 0x0E, 0x9D, 0xA9, 0x0A, 0x9D, 0xA9, 0x62, 0x9F, 0xB9, 0x77,
+    0x9D, 0xA9, 0x66, 0x6B, 0x62, 0x7B, 0xC0, 0x66, 0x1C, 0x52, 0x1C, 0x55, 0xC0, 0xA2, 0x87, 0x5A,
+    0x6E, 0xA3, 0x87, 0x5A, 0x59, 0x26, 0xA4, 0x67, 0x55, 0x5A, 0x39, 0x5A, 0x02, 0x07, 0x0C, 0x18,
+    0x50, 0x11, 0x09, 0xA2, 0x88, 0x04, 0xC0, 0x3D, 0x04, 0x0C, 0x7E, 0x07, 0x0A, 0xC2, 0x05, 0x0A,
+    0x05, 0x36, 0x3B, 0xC0, 0x0C, 0x99, 0xEB, 0x6E, 0x32, 0x2F, 0x34, 0x05, 0x3B, 0x0C, 0x09, 0xA3,
+    0x78, 0x9D, 0x89, 0xA2, 0x68, 0x6B, 0x5F, 0x56, 0x5B, 0x31, 0x57, 0x6F, 0x51, 0x67, 0x6E, 0x6B,
+    0x27, 0x22, 0xA3, 0x88, 0x27, 0xA2, 0x87, 0x28, 0x65, 0xC0, 0xA2, 0x87, 0x1D, 0x19, 0x21, 0x65,
+    0x18, 0xA2, 0x97, 0x9D, 0x99, 0x0B, 0x0E, 0x04, 0x0C, 0x07, 0xC0, 0x7E, 0x0A, 0xC0, 0x0F, 0x0A,
+    0xC0, 0x38, 0x0C, 0x04, 0x0E, 0x6F, 0x5A, 0x6E, 0x23, 0x28, 0x51, 0x17, 0x76, 0x04, 0x07, 0x9D,
+    0xB9, 0x3E, 0x9D, 0xB9, 0x77, 0x62, 0x9D, 0xAA, 0x7F, 0x0D, 0x7F, 0x9D, 0x9A, 0x7A, 0xC0, 0x6B,
+    0x0D, 0x6F, 0x51, 0xA4, 0x77, 0x1C, 0x51, 0x26, 0x6D, 0x5E, 0x59, 0xA3, 0x88, 0x2B, 0x01, 0x41,
+    0xA3, 0x87, 0x5B, 0x6D, 0x6F, 0x0F, 0xC0, 0x5E, 0x3D, 0x0C, 0x09, 0x7F, 0x04, 0x0C, 0x38, 0x7E,
+    0x07, 0xC0, 0x76, 0x55, 0xA2, 0x98, 0x39, 0xC0, 0x0D, 0xC0, 0x39, 0x3E, 0x0A, 0xC0, 0x9C, 0xDA,
+    0x2B, 0x5A, 0x2D, 0xA3, 0x78, 0x34, 0x39, 0x5E, 0x38, 0x0E, 0x0B, 0x5F, 0xA2, 0x78, 0x56, 0xA1,
+    0x7A, 0x51, 0xA2, 0x78, 0x31, 0x29, 0x57, 0x7E, 0x5B, 0x28, 0xC0, 0x37, 0x6E, 0x28, 0xC0, 0x69,
+    0xA3, 0x98, 0x61, 0xA2, 0x86, 0x19, 0xA2, 0x97, 0xC0, 0x25, 0x9D, 0xA9, 0x7E, 0x0E, 0x04, 0x0C,
+    0x7A, 0x3B, 0x05, 0x7A, 0x51, 0x03, 0x34, 0x08, 0x03, 0x0D, 0x39, 0x3E, 0x0F, 0x07, 0x11, 0x09,
+    0x06, 0x5A, 0xA3, 0x88, 0x17, 0x1A, 0x7A, 0x0C, 0x9C, 0xA9, 0x9F, 0xB9, 0x9D, 0xAA, 0x35, 0x26,
+    0x62, 0x7B, 0x62, 0x9D, 0xAA, 0x52, 0xC0, 0xA2, 0x99, 0x9D, 0x88, 0x6B, 0xC0, 0xA3, 0x88, 0x00,
+    0xC0, 0xA2, 0x77, 0x6E, 0x6D, 0x12, 0xA3, 0x88, 0x2E, 0x45, 0xC0, 0x23, 0x6E, 0x6E, 0x5E, 0x34,
+    0x36, 0xA2, 0x88, 0x07, 0x65, 0x0C, 0x07, 0xC2, 0x7E, 0x07, 0x3B, 0x6B, 0x36, 0xC0, 0x39, 0x34,
+    0xC0, 0x2F, 0xC0, 0xA2, 0x88, 0x2F, 0x08, 0x39, 0x36, 0x9D, 0xEB, 0xC0, 0x55, 0x2D, 0xA2, 0x78,
+    0x69, 0x34, 0x3B, 0x0C, 0x11, 0x1F, 0x9D, 0x89, 0xA4, 0x78, 0x41, 0x29, 0x56, 0x5B, 0xC0, 0x6F,
+    0x41, 0x7B, 0xC0, 0xA2, 0x78, 0x9D, 0x99, 0x35, 0x30, 0x55, 0x79, 0x31, 0x61, 0x6D, 0xA2, 0x98,
+    0x29, 0x65, 0x28, 0x17, 0x1F, 0x09, 0x0C, 0x36, 0x0A, 0x72, 0xC0, 0x32, 0x2D, 0x66, 0xC0, 0xA2,
+    0x88, 0x2D, 0x28, 0x01, 0x37, 0x34, 0xA3, 0x88, 0x55, 0x0A, 0x0C, 0x0E, 0x6F, 0x56, 0x1F, 0x9C,
+    0x99, 0x38, 0x3B, 0x08, 0x28, 0x72, 0x7B, 0x9D, 0xAA, 0x62, 0x7B, 0x67, 0x66, 0x62, 0x67, 0x55,
+    0x66, 0x6B, 0x6E, 0x11, 0x65, 0x5E, 0x00, 0x6E, 0xA2, 0x77, 0x1C, 0x26, 0x59, 0x2E, 0x5E, 0x6E,
+    0x3F, 0x5E, 0x6E, 0x34, 0x39, 0x3E, 0x0A, 0x6E, 0x3B, 0xC0, 0x0F, 0x0C, 0x66, 0x3B, 0xC0, 0x36,
+    0x3E, 0x6B, 0x34, 0xC0, 0x2F, 0x03, 0x32, 0x37, 0x52, 0x32, 0x37, 0x2F, 0x08, 0x30, 0x35, 0x5A,
+    0x69, 0x3C, 0x06, 0x59, 0x05, 0x3B, 0x18, 0x41, 0x6E, 0xA3, 0x78, 0x42, 0xA3, 0x88, 0x57, 0x5A,
+    0x6F, 0x51, 0x6F, 0xA2, 0x78, 0x31, 0xC0, 0x51, 0x6F, 0x69, 0x7E, 0x7F, 0x25, 0xA2, 0x97, 0x65,
+    0x65, 0x7A, 0x17, 0x1F, 0x76, 0x07, 0x0A, 0x9D, 0x99, 0x34, 0xA1, 0xA9, 0x61, 0x28, 0x3A, 0x51,
+    0x66, 0x66, 0x30, 0x21, 0xC0, 0x32, 0x6E, 0x6E, 0x45, 0xA2, 0x87, 0x08, 0x45, 0x0F, 0x5E, 0x1D,
+    0x46, 0x75, 0x0A, 0x34, 0x72, 0x2B, 0x30, 0x10, 0xA1, 0x9A, 0x63, 0x9C, 0x99, 0x62, 0x7B, 0xA2,
+    0x79, 0x62, 0x51, 0x7F, 0x3F, 0x13, 0x3F, 0xA2, 0x87, 0x3D, 0xA3, 0x88, 0x6D, 0x69, 0x5A, 0xA2,
+    0x76, 0x6E, 0xA3, 0x77, 0x2E, 0xA2, 0x67, 0x2B, 0x3C, 0x59, 0xC0, 0x2F, 0x34, 0xA2, 0x78, 0x6E,
+    0x36, 0xC0, 0x6E, 0x0F, 0xC0, 0x05, 0xC0, 0x65, 0x34, 0x08, 0xC0, 0x37, 0x06, 0x37, 0x32, 0x7F,
+    0x2D, 0x01, 0x06, 0x2D, 0x06, 0x1C, 0x30, 0x55, 0xA2, 0x78, 0x2B, 0x01, 0x55, 0x2F, 0x39, 0x07,
+    0x6E, 0xA2, 0x78, 0x41, 0xA3, 0x78, 0x56, 0x5F, 0x56, 0xA3, 0x89, 0x5A, 0x25, 0x7E, 0x25, 0x6F,
+    0x25, 0x55, 0x19, 0x6E, 0x2D, 0x65, 0x15, 0xA2, 0x98, 0x79, 0x9D, 0x99, 0x1A, 0x9D, 0x98, 0x38,
+    0x3B, 0x34, 0x37, 0x62, 0x2B, 0x66, 0x66, 0x30, 0x62, 0xC1, 0x66, 0x55, 0x7E, 0x5A, 0x30, 0x59,
+    0xA2, 0x88, 0x3C, 0xA2, 0x77, 0x03, 0xA2, 0x77, 0x3B, 0xA2, 0x88, 0x6E, 0x36, 0x08, 0x2D, 0x3A,
+    0x9C, 0x99, 0x73, 0x62, 0x77, 0x67, 0x9D, 0xAA, 0x67, 0xC0, 0x3F, 0xC0, 0x6B, 0x7A, 0x6F, 0x06,
+    0x0E, 0x3F, 0x7E, 0x3D, 0x0A, 0xA3, 0x88, 0x44, 0xA3, 0x87, 0x6E, 0x6D, 0xA2, 0x77, 0x45, 0xA4,
+    0x77, 0x5E, 0x69, 0x5E, 0x6E, 0x08, 0x56, 0x0D, 0x5A, 0x36, 0x0A, 0x3E, 0xC0, 0x39, 0x56, 0x34,
+    0xC0, 0x37, 0x2A, 0xA3, 0x98, 0x9C, 0x99, 0x2D, 0xC0, 0x28, 0x3C, 0x28, 0x30, 0x01, 0x28, 0x9D,
+    0xBA, 0x7F, 0x6E, 0x26, 0xC0, 0xA3, 0x88, 0x32, 0x37, 0x39, 0x0A, 0x5E, 0x11, 0x5A, 0x5B, 0x5E,
+    0xA2, 0x78, 0x52, 0xA2, 0x78, 0x56, 0x6E, 0x52, 0xA2, 0x88, 0xC1, 0x19, 0x26, 0xC0, 0x1D, 0x51,
+    0x25, 0x9D, 0xA9, 0x0B, 0x66, 0x7A, 0x76, 0x3E, 0x08, 0x76, 0x28, 0x3A, 0x30, 0x17, 0x7F, 0x76,
+    0xC0, 0x56, 0x62, 0xA2, 0x88, 0x12, 0x1C, 0x10, 0x6E, 0xA2, 0x78, 0x69, 0x30, 0x3A, 0x3C, 0x32,
+    0x2A, 0x34, 0x08, 0x06, 0x3C, 0x3A, 0x17, 0x1C, 0x12, 0xA0, 0x9A, 0x9D, 0xAA, 0x02, 0x7B, 0x13,
+    0xC0, 0x9D, 0x9A, 0x6E, 0x01, 0xC2, 0x7E, 0x6E, 0x55, 0x0C, 0x6E, 0xA2, 0x87, 0x14, 0x58, 0xA4,
+    0x77, 0x12, 0x24, 0x26, 0x30, 0x3A, 0x28, 0x6E, 0x2A, 0xA3, 0x88, 0xC0, 0x0D, 0x31, 0x05, 0x39,
+    0x31, 0xC0, 0x39, 0x08, 0x2F, 0x03, 0x7A, 0x66, 0x2D, 0x3C, 0x65, 0x52, 0xA2, 0x88, 0x61, 0xC1,
+    0x37, 0x30, 0x2E, 0x17, 0x2B, 0x55, 0x35, 0x3A, 0x2D, 0x01, 0x34, 0x39, 0x07, 0x69, 0xA2, 0x78,
+    0x5F, 0x5A, 0x55, 0x5B, 0x2C, 0x40, 0xA3, 0x89, 0x51, 0x2E, 0x9D, 0x99, 0x2E, 0xC0, 0x15, 0x1D,
+    0x18, 0x79, 0x7E, 0x9D, 0xA9, 0x7A, 0x11, 0x3B, 0x39, 0x03, 0x01, 0x3C, 0x9C, 0xA9, 0x7F, 0x62,
+    0x7B, 0x62, 0xC0, 0x9D, 0x99, 0xC0, 0x7B, 0x6E, 0x51, 0x1C, 0x08, 0xA3, 0x88, 0x12, 0x10, 0xA4,
+    0x78, 0x2B, 0x6E, 0x59, 0xC0, 0x6E, 0x6B, 0x61, 0x30, 0x9D, 0xA9, 0x77, 0x12, 0x73, 0x7B, 0x1B,
+    0x04, 0x3F, 0x6B, 0x66, 0x6B, 0xC0, 0x6E, 0x08, 0x66, 0x08, 0x65, 0xA3, 0x88, 0x3F, 0x7E, 0x3D,
+    0x02, 0xA2, 0x76, 0xA3, 0x88, 0x17, 0x59, 0xA4, 0x66, 0xC0, 0x5D, 0x26, 0xA2, 0x77, 0x6E, 0xA2,
+    0x78, 0x5A, 0x69, 0x03, 0x39, 0x6F, 0xC0, 0x39, 0x6B, 0x7E, 0x03, 0x2F, 0x7F, 0x2D, 0xC0, 0x28,
+    0x2B, 0x3A, 0x2B, 0x62, 0x26, 0x21, 0x26, 0x3A, 0x2B, 0x9C, 0xBB, 0xC0, 0xA2, 0x77, 0x6E, 0x2B,
+    0xA2, 0x77, 0x23, 0xA3, 0x87, 0x3E, 0x03, 0x31, 0x36, 0xA4, 0x68, 0x6E, 0x56, 0x5A, 0xA2, 0x77,
+    0x6B, 0x25, 0xC0, 0x56, 0xC0, 0x29, 0x61, 0x69, 0x20, 0x25, 0x23, 0x1C, 0x7A, 0x9C, 0x99, 0xA2,
+    0x97, 0x3B, 0x0A, 0x9D, 0xB9, 0x7B, 0x61, 0x3A, 0x9C, 0xAA, 0xC0, 0x24, 0x67, 0x0D, 0x17, 0x7F,
+    0x9D, 0x89, 0x7F, 0xC0, 0x65, 0x19, 0x0A, 0x6E, 0x69, 0x6E, 0xA3, 0x88, 0x51, 0x24, 0x21, 0xA2,
+    0x87, 0x56, 0xC0, 0x21, 0x66, 0x66, 0x77, 0x9C, 0x99, 0xA0, 0x9A, 0x6B, 0x62, 0x13, 0x52, 0x7B,
+    0x56, 0x51, 0x7F, 0xC1, 0x6F, 0x6D, 0xC0, 0x7E, 0x06, 0x3F, 0x0C, 0xA3, 0x87, 0x55, 0x59, 0xA3,
+    0x87, 0xA3, 0x77, 0x6E, 0x5D, 0x55, 0xA2, 0x77, 0xA2, 0x77, 0x2D, 0x6E, 0xC0, 0xA2, 0x78, 0x3C,
+    0x2F, 0x6E, 0xC1, 0x2F, 0xA3, 0x88, 0x7A, 0x32, 0x2D, 0xC0, 0x28, 0x2B, 0x52, 0x7E, 0x21, 0x66,
+    0xA3, 0x88, 0x66, 0x1C, 0xC0, 0x30, 0x9D, 0xAA, 0x65, 0x2E, 0x17, 0xA2, 0x88, 0x59, 0x1E, 0xA4,
+    0x77, 0x32, 0x03, 0x39, 0x6F, 0x3B, 0x11, 0x6F, 0x1F, 0x51, 0xA2, 0x78, 0x52, 0x14, 0x56, 0xC1,
+    0x6E, 0x0C, 0x69, 0x7A, 0x7B, 0x7E, 0x1D, 0x65, 0x3B, 0x31, 0xA1, 0xA8, 0x2D, 0x62, 0x21, 0x66,
+    0x7B, 0x9D, 0xAA, 0x7B, 0x9D, 0x99, 0x7B, 0x52, 0x7F, 0x66, 0xC0, 0x66, 0xC0, 0x0F, 0x56, 0x14,
+    0x51, 0x19, 0x6E, 0x08, 0x6E, 0xC0, 0x6E, 0xA2, 0x88, 0x12, 0x21, 0xC0, 0x1E, 0x05, 0x0F, 0x67,
+    0x66, 0x13, 0x9D, 0x99, 0xA2, 0x89, 0x52, 0xC0, 0x6F, 0x66, 0x51, 0x7F, 0x0F, 0x50, 0xA3, 0x88,
+    0x10, 0x06, 0x13, 0x0C, 0x16, 0x00, 0x05, 0xA5, 0x77, 0x21, 0x6D, 0x59, 0x2B, 0x59, 0xA3, 0x88,
+    0x59, 0x2D, 0xA3, 0x88, 0x03, 0x2F, 0x03, 0x6E, 0xC1, 0x03, 0x2F, 0x06, 0x32, 0xC0, 0x7B, 0x66,
+    0x61, 0x35, 0x56, 0x7A, 0xC0, 0x62, 0xC0, 0x2B, 0xC0, 0x30, 0x15, 0x6F, 0xC0, 0x69, 0x6E, 0x1C,
+    0x3A, 0xC0, 0x01, 0xC0, 0x2F, 0x08, 0x5E, 0x5A, 0xC0, 0xA2, 0x78, 0x5E, 0xC0, 0x56, 0xA2, 0x78,
+    0x69, 0x56, 0x66, 0x1C, 0x66, 0xC0, 0x0B, 0x66, 0x7E, 0x18, 0x36, 0xC0, 0xA0, 0xA8, 0x7B, 0x9C,
+    0x99, 0x35, 0x2B, 0x21, 0x76, 0x67, 0x62, 0x1E, 0x00, 0xC0, 0x16, 0x7A, 0x3D, 0xC0, 0x0C, 0x5A,
+    0x3D, 0x11, 0x69, 0x6E, 0x1B, 0x7D, 0x55, 0x05, 0x1E, 0x65, 0x1E, 0x0D, 0x05, 0x00, 0x0F, 0x16,
+    0x04, 0x3F, 0x67, 0x10, 0x52, 0xC0, 0xA2, 0x78, 0x52, 0x3B, 0x7F, 0x6E, 0xC0, 0x69, 0x7F, 0x10,
+    0x6E, 0xA2, 0x76, 0x11, 0xA2, 0x87, 0x54, 0x12, 0xA2, 0x77, 0x59, 0xA2, 0x77, 0x2B, 0x30, 0x2D,
+    0x59, 0x28, 0xA3, 0x88, 0x51, 0x06, 0x5A, 0x55, 0x2F, 0x03, 0xC1, 0x06, 0x2D, 0x32, 0x7B, 0x65,
+    0x62, 0xC0, 0x7B, 0x9D, 0x99, 0x2B, 0x66, 0x51, 0xC1, 0x2E, 0x17, 0x1C, 0x6E, 0x26, 0xC0, 0x2B,
+    0x17, 0x35, 0x55, 0x6E, 0x3C, 0x32, 0x34, 0xA3, 0x88, 0x5E, 0x51, 0xA3, 0x78, 0x52, 0xA2, 0x78,
+    0x0B, 0xC1, 0x5A, 0x0B, 0x6F, 0x7E, 0x9D, 0x99, 0x7A, 0xC0, 0x38, 0x3B, 0x36, 0xA1, 0xA9, 0x32,
+    0x01, 0x26, 0x30, 0x62, 0x21, 0x73, 0x62, 0x52, 0x00, 0x7F, 0x67, 0x6F, 0x9D, 0xA9, 0x13, 0x3F,
+    0x13, 0x07, 0x3F, 0x13, 0x0C, 0xC0, 0x11, 0x02, 0x7E, 0x5A, 0x0F, 0x1B, 0x00, 0x0F, 0x0A, 0x0C,
+    0x56, 0x3F, 0x7F, 0x56, 0x6B, 0x62, 0x6F, 0x03, 0x56, 0x7F, 0xC0, 0x6F, 0x0F, 0x03, 0x5A, 0x7E,
+    0x69, 0x06, 0x7D, 0x3D, 0xA2, 0x77, 0xA2, 0x87, 0x17, 0x59, 0xA2, 0x77, 0xA2, 0x77, 0xA2, 0x77,
+    0x30, 0x55, 0xA2, 0x77, 0xA3, 0x78, 0x2D, 0x32, 0x2F, 0xA2, 0x87, 0x2F, 0x34, 0x3C, 0x6B, 0x65,
+    0x6B, 0x7E, 0x62, 0xC0, 0x2B, 0x6B, 0x35, 0x9D, 0x99, 0x7F, 0xC0, 0x26, 0x61, 0x6F, 0x66, 0x26,
+    0x65, 0x1C, 0xC0, 0xA2, 0x87, 0x1C, 0x2E, 0x2B, 0x55, 0xA2, 0x77, 0x56, 0x28, 0x3C, 0x2F, 0x34,
+    0xA2, 0x78, 0x6E, 0x5E, 0x55, 0xA3, 0x89, 0x09, 0xA2, 0x78, 0x51, 0x1A, 0x0B, 0x06, 0xC0, 0x1D,
+    0x65, 0xC0, 0x76, 0x36, 0x39, 0x2F, 0x7A, 0x23, 0x76, 0x77, 0x66, 0x77, 0x9C, 0x99, 0x7F, 0x14,
+    0x66, 0x6B, 0x66, 0x66, 0x3F, 0x66, 0x0E, 0x56, 0x66, 0x06, 0x3A, 0x3F, 0xC0, 0x04, 0x13, 0x18,
+    0x0C, 0xC0, 0x11, 0x0C, 0xC0, 0x18, 0x3F, 0xC0, 0x0E, 0x6B, 0x52, 0x55, 0xA2, 0x89, 0x61, 0x6F,
+    0x3B, 0x7F, 0x5A, 0x0F, 0x3B, 0x69, 0x39, 0x06, 0x0E, 0xC0, 0x11, 0x69, 0x59, 0xA2, 0x87, 0xA3,
+    0x77, 0x59, 0xA2, 0x87, 0x59, 0xA2, 0x78, 0xA2, 0x66, 0xC0, 0xA2, 0x78, 0x2D, 0xC0, 0x2F, 0xC0,
+    0x6E, 0x2F, 0xA2, 0x88, 0x6E, 0xC0, 0x2F, 0x2D, 0xC0, 0x3C, 0x37, 0xC0, 0x9D, 0xA9, 0x30, 0x2B,
+    0x66, 0xC0, 0x66, 0x7F, 0x9D, 0x98, 0x30, 0x10, 0x6F, 0xC0, 0x66, 0x1C, 0x30, 0x40, 0x7E, 0x26,
+    0x5D, 0xA3, 0x88, 0x23, 0xA3, 0x87, 0x6F, 0x59, 0x5E, 0x6E, 0x6F, 0xA2, 0x77, 0x38, 0x6F, 0xA2,
+    0x88, 0x41, 0xA2, 0x87, 0xC0, 0x09, 0x55, 0xA2, 0x98, 0x3D, 0x76, 0x36, 0x39, 0x2F, 0xA2, 0x98,
+    0x9D, 0xA9, 0x7B, 0x9C, 0x99, 0x77, 0x24, 0x9C, 0x9A, 0x7B, 0x7B, 0x9D, 0x9A, 0x02, 0x7F, 0x6B,
+    0x62, 0x3F, 0x0E, 0x52, 0xC1, 0x6E, 0x01, 0xC0, 0xA2, 0x88, 0x0E, 0x06, 0x3F, 0x0E, 0x3F, 0x0E,
+    0x3F, 0x13, 0x0E, 0xC0, 0x01, 0x7F, 0x15, 0x9C, 0x89, 0x7F, 0x6F, 0x51, 0x03, 0x3B, 0xC0, 0x0F,
+    0x6E, 0xC0, 0x10, 0x01, 0x0E, 0xC0, 0x59, 0x02, 0xA3, 0x87, 0x55, 0x17, 0x0D, 0xA3, 0x88, 0x5D,
+    0x59, 0xA2, 0x77, 0xA2, 0x78, 0x23, 0xA4, 0x77, 0x55, 0xA2, 0x78, 0x37, 0x2F, 0x6E, 0x39, 0x34,
+    0x03, 0xC0, 0x32, 0xC1, 0x28, 0x7A, 0x3A, 0x66, 0x61, 0x1C, 0x12, 0x7F, 0xC0, 0x7B, 0x55, 0x66,
+    0xC0, 0x69, 0xC1, 0x21, 0x1C, 0x21, 0xA2, 0x77, 0x51, 0x2B, 0x35, 0x3A, 0x30, 0x2D, 0x32, 0x2F,
+    0x08, 0x5A, 0x0A, 0xA2, 0x77, 0x56, 0x56, 0x3D, 0xA2, 0x88, 0x0C, 0x04, 0xC0, 0x38, 0x7F, 0xC0,
+    0x36, 0x08, 0x03, 0x28, 0x3C, 0x9C, 0xA9, 0x2B, 0x29, 0x9C, 0x99, 0x26, 0x63, 0x76, 0x67, 0x02,
+    0x66, 0x18, 0x06, 0xC0, 0x62, 0x6E, 0x6F, 0x7A, 0x01, 0x6B, 0x3C, 0x10, 0x01, 0x06, 0x15, 0x06,
+    0x01, 0x06, 0xC0, 0x01, 0x69, 0x01, 0x3C, 0x0D, 0x10, 0x08, 0x66, 0xA2, 0x78, 0x3B, 0x0F, 0x03,
+    0x14, 0x3B, 0x6D, 0x15, 0x06, 0x3A, 0x13, 0x55, 0x3D, 0x00, 0x6E, 0xA2, 0x87, 0x5D, 0xA2, 0x77,
+    0xA2, 0x87, 0x5E, 0x35, 0x6E, 0x5A, 0x6E, 0x5D, 0x6F, 0x6E, 0xC1, 0x55, 0xC0, 0x08, 0x34, 0x7E,
+    0x03, 0x32, 0x2D, 0xC0, 0x76, 0x6B, 0x76, 0xC0, 0x1A, 0x26, 0x1C, 0x24, 0x1F, 0x17, 0x1F, 0x52,
+    0x1C, 0x6E, 0x29, 0x26, 0x61, 0x5A, 0x26, 0x69, 0x5A, 0x6E, 0x3A, 0x5A, 0xA2, 0x77, 0x59, 0xA2,
+    0x88, 0x39, 0x6F, 0xC0, 0x59, 0xA2, 0x88, 0x0C, 0xC2, 0x07, 0xC1, 0x0F, 0x36, 0x39, 0x03, 0x61,
+    0x01, 0x62, 0x21, 0x30, 0x9D, 0xAA, 0x17, 0x7B, 0x9D, 0x9A, 0x7B, 0x62, 0x02, 0xA2, 0x89, 0x04,
+    0x13, 0x0E, 0x52, 0xC0, 0xA2, 0x88, 0x52, 0x6E, 0x10, 0x0D, 0x08, 0x10, 0x01, 0x15, 0x9D, 0x99,
+    0x01, 0x0D, 0x3C, 0x01, 0xC0, 0x06, 0x52, 0x08, 0x0D, 0x08, 0x0D, 0x62, 0xA2, 0x88, 0xC0, 0x03,
+    0x08, 0x01, 0x06, 0x65, 0x13, 0x18, 0x69, 0x16, 0x00, 0x19, 0x54, 0xA3, 0x77, 0x6E, 0x6E, 0x26,
+    0x59, 0xA4, 0x77, 0x28, 0x2D, 0xA2, 0x77, 0xC0, 0x34, 0x6E, 0xC1, 0x36, 0x0A, 0x39, 0xA2, 0x88,
+    0x34, 0x37, 0x32, 0x2D, 0x7F, 0x2B, 0x66, 0x1C, 0xC0, 0x62, 0x7F, 0xC0, 0x17, 0xC0, 0xA2, 0x88,
+    0xC0, 0x17, 0x7E, 0x12, 0xC0, 0x21, 0xC0, 0x6E, 0xC0, 0x6E, 0x1C, 0xC0, 0xA2, 0x77, 0x6E, 0x28,
+    0x32, 0xA2, 0x88, 0x2F, 0xA3, 0x88, 0x39, 0x36, 0xA3, 0x88, 0x07, 0xC0, 0x3B, 0x0C, 0x38, 0x0C,
+    0x0F, 0x3B, 0x36, 0x31, 0xA1, 0xA9, 0x76, 0x3C, 0x66, 0x9D, 0xA9, 0x76, 0x62, 0x17, 0x7B, 0x9D,
+    0x9A, 0x66, 0x7B, 0x16, 0x1D, 0x13, 0x3F, 0x66, 0x67, 0x10, 0x55, 0x6F, 0xC1, 0x51, 0x0D, 0x66,
+    0x3C, 0x01, 0xC0, 0x0D, 0x01, 0x6E, 0x01, 0x3C, 0x01, 0x3C, 0x01, 0x08, 0x01, 0x10, 0x08, 0x01,
+    0xC0, 0x10, 0x01, 0x06, 0x13, 0x3F, 0xA2, 0x87, 0xA2, 0x87, 0x59, 0xA2, 0x87, 0x55, 0xA2, 0x67,
+    0x21, 0xA2, 0x77, 0x29, 0x5E, 0x30, 0x1E, 0x28, 0xA3, 0x88, 0x59, 0x03, 0x59, 0x05, 0x6E, 0x36,
+    0xA3, 0x88, 0x0A, 0xC1, 0x3E, 0x34, 0xA2, 0x88, 0x2F, 0x32, 0x01, 0x76, 0x66, 0x30, 0x51, 0x1A,
+    0x6B, 0x66, 0x7F, 0x9D, 0x99, 0xC3, 0xA4, 0x66, 0x51, 0x26, 0xC2, 0x1F, 0x30, 0x55, 0x35, 0x59,
+    0xA2, 0x78, 0x2D, 0xC0, 0x03, 0xC0, 0x05, 0x36, 0x3E, 0x3B, 0x0A, 0x3B, 0xC0, 0x07, 0xC0, 0x66,
+    0x0A, 0x05, 0x08, 0x03, 0x32, 0x2D, 0x3F, 0x21, 0x7B, 0x2E, 0x1C, 0x9D, 0xAA, 0x7B, 0x6B, 0x62,
+    0x1B, 0x9D, 0xA9, 0x3D, 0x04, 0x13, 0x9D, 0x99, 0x06, 0x66, 0x6B, 0x55, 0x08, 0x65, 0x08, 0x39,
+    0x3C, 0x10, 0x01, 0x10, 0x5A, 0x06, 0xC1, 0x01, 0xC1, 0xA2, 0x88, 0xC0, 0x06, 0x01, 0x06, 0x13,
+    0x3A, 0x6E, 0x7E, 0x3D, 0xA2, 0x87, 0x1B, 0x14, 0x1E, 0x50, 0xA3, 0x88, 0xA2, 0x76, 0x5E, 0x2E,
+    0x45, 0x35, 0x28, 0xC0, 0xA4, 0x77, 0x2F, 0xA3, 0x88, 0x36, 0x3B, 0x0F, 0xC0, 0x56, 0x3B, 0x0F,
+    0x66, 0x0F, 0x36, 0x0A, 0x08, 0x37, 0x32, 0x7B, 0x66, 0x61, 0x35, 0x2B, 0xC0, 0x66, 0x9D, 0xA9,
+    0x6B, 0xC1, 0x66, 0xA2, 0x88, 0x12, 0x2B, 0xC0, 0x7E, 0xC0, 0x2B, 0x1A, 0x30, 0x2B, 0x35, 0x55,
+    0x37, 0x28, 0xA3, 0x88, 0x32, 0x6E, 0x6E, 0x6B, 0x59, 0x31, 0x0A, 0x36, 0x3B, 0x0A, 0xC0, 0x36,
+    0x0A, 0xC0, 0x66, 0x08, 0x2F, 0x32, 0x01, 0x9C, 0x99, 0x76, 0x30, 0x9C, 0x99, 0x10, 0xA1, 0x9A,
+    0x9D, 0x99, 0x7B, 0x9D, 0x9A, 0xA2, 0x88, 0x62, 0x11, 0x04, 0x3F, 0xC0, 0x6B, 0x0E, 0x06, 0x7B,
+    0x51, 0x6E, 0xC3, 0x3A, 0x0E, 0x15, 0x3A, 0xC0, 0x3F, 0x13, 0x06, 0x13, 0x3F, 0xC0, 0x13, 0x3F,
+    0x04, 0x0C, 0x11, 0x7E, 0x55, 0x0F, 0x00, 0xA4, 0x87, 0x40, 0xA4, 0x77, 0x55, 0x6E, 0xA2, 0x77,
+    0x59, 0x35, 0x5E, 0x6D, 0x5F, 0x6E, 0x34, 0xA2, 0x78, 0xA2, 0x77, 0x07, 0xC1, 0xA2, 0x78, 0xC0,
+    0x65, 0x56, 0x79, 0x07, 0x3B, 0x7F, 0x05, 0x34, 0x2F, 0xA1, 0xA9, 0x2D, 0x76, 0x62, 0x1C, 0x17,
+    0x1A, 0x6B, 0x7F, 0x9D, 0x99, 0x1F, 0xC0, 0x17, 0x1F, 0xA4, 0x56, 0x1C, 0x30, 0xC4, 0x55, 0x6E,
+    0xC0, 0x23, 0xA2, 0x87, 0x32, 0xA2, 0x88, 0x03, 0x69, 0x34, 0x05, 0x7E, 0x36, 0x07, 0x3B, 0x0A,
+    0xC0, 0x3B, 0x0D, 0x39, 0x08, 0xC0, 0x32, 0xC0, 0x7B, 0x76, 0x1C, 0x7A, 0x67, 0x66, 0x7B, 0x9C,
+    0x99, 0x7F, 0x62, 0x67, 0x16, 0xC0, 0x3D, 0x7B, 0xC0, 0x13, 0x9D, 0x99, 0x13, 0x52, 0xC0, 0xA2,
+    0x88, 0x3F, 0x0E, 0xC2, 0x13, 0x3F, 0x13, 0x6E, 0x3F, 0x6E, 0x18, 0x3D, 0x1D, 0x11, 0xC0, 0x69,
+    0x0F, 0x14, 0x6E, 0x69, 0x5A, 0x08, 0x6E, 0xA2, 0x77, 0xC0, 0xA3, 0x77, 0x59, 0xA2, 0x77, 0xC0,
+    0x3C, 0x32, 0x6E, 0x39, 0x36, 0x3B, 0xC0, 0xA3, 0x78, 0xC0, 0x09, 0x66, 0xA2, 0x77, 0x6B, 0x0E,
+    0x04, 0x0C, 0x11, 0x0C, 0x66, 0x36, 0x31, 0x34, 0x37, 0x28, 0xA2, 0x98, 0x62, 0x66, 0x9D, 0x99,
+    0x7F, 0x21, 0x66, 0x7F, 0x51, 0x7F, 0x2B, 0x65, 0xA4, 0x45, 0x35, 0x51, 0x30, 0x65, 0xC0, 0x56,
+    0x30, 0x35, 0x21, 0xA3, 0x88, 0x23, 0x3C, 0x2D, 0xC0, 0x32, 0x03, 0xA2, 0x77, 0xC1, 0x36, 0xC0,
+    0xA2, 0x88, 0x36, 0x3B, 0xC0, 0x36, 0x31, 0x39, 0x34, 0x2F, 0x32, 0x7A, 0x23, 0x26, 0x1C, 0x7A,
+    0x67, 0x17, 0x66, 0x66, 0xA1, 0x9A, 0x1E, 0x14, 0x51, 0xA2, 0x99, 0x9D, 0x89, 0x3D, 0xC0, 0x7B,
+    0x18, 0x9D, 0x99, 0xA2, 0x87, 0x18, 0x0C, 0x18, 0x9D, 0x98, 0x6F, 0xC0, 0x0C, 0x3D, 0x0C, 0x16,
+    0x65, 0xC0, 0x16, 0x69, 0xC0, 0x59, 0x7A, 0x6E, 0x5A, 0xA2, 0x87, 0xA2, 0x77, 0xC0, 0x6E, 0x59,
+    0x29, 0x5A, 0x30, 0x3A, 0x5A, 0x01, 0x59, 0x34, 0x39, 0x6F, 0x5E, 0x5A, 0x11, 0x42, 0x15, 0x55,
+    0x15, 0x6E, 0x55, 0x1A, 0xC0, 0x06, 0x01, 0xA2, 0x98, 0x07, 0xC0, 0x36, 0x31, 0x34, 0x03, 0x32,
+    0x3C, 0x9D, 0xA9, 0x66, 0x7B, 0x51, 0x7B, 0xC0, 0x7B, 0xC1, 0x51, 0xC0, 0x3C, 0x61, 0x3A, 0x9D,
+    0x99, 0xA2, 0x88, 0x21, 0x66, 0x26, 0x6B, 0x3A, 0x2B, 0x6F, 0x3C, 0x55, 0x32, 0x2F, 0xC1, 0xA3,
+    0x88, 0x31, 0xA2, 0x87, 0x36, 0xA3, 0x88, 0x3B, 0xC0, 0x0F, 0x66, 0x7A, 0xC0, 0x34, 0x2F, 0x2A,
+    0xA2, 0x98, 0x3C, 0x9D, 0x99, 0x26, 0x1C, 0x33, 0x29, 0x52, 0x7B, 0x9D, 0x99, 0x7F, 0x62, 0x6F,
+    0x14, 0x19, 0x62, 0x02, 0xC0, 0x16, 0x66, 0x65, 0x11, 0xC0, 0x69, 0x02, 0x0A, 0x5A, 0x0F, 0x07,
+    0x0F, 0x14, 0x19, 0xC0, 0x12, 0xC0, 0x6E, 0x6F, 0x1C, 0x59, 0xC0, 0xA2, 0x87, 0x55, 0x29, 0x5A,
+    0x21, 0xC0, 0x5E, 0xA2, 0x87, 0x32, 0x08, 0xC0, 0x3E, 0x5F, 0x59, 0xA2, 0x88, 0x0E, 0x06, 0x6F,
+    0x59, 0x6B, 0xC0, 0x08, 0xA2, 0x88, 0x08, 0x7F, 0x08, 0x66, 0x1A, 0x0E, 0x18, 0xC0, 0x07, 0x7A,
+    0x66, 0x7A, 0x76, 0x28, 0x23, 0x3A, 0x9C, 0x99, 0x26, 0x66, 0x26, 0x7B, 0x10, 0x30, 0x51, 0xC0,
+    0x2D, 0x01, 0x61, 0x23, 0x66, 0x7A, 0xC0, 0x35, 0x55, 0x3A, 0x23, 0xC0, 0x3C, 0x2D, 0x01, 0x5A,
+    0x2F, 0x34, 0x39, 0x6E, 0x05, 0x3B, 0x0A, 0x3B, 0x6B, 0x36, 0x0A, 0xC0, 0x36, 0x05, 0x08, 0x61,
+    0x32, 0x01, 0x28, 0x23, 0x21, 0x7B, 0x51, 0x7F, 0x29, 0x9D, 0x9A, 0x7F, 0x66, 0x0D, 0x7F, 0x66,
+    0x62, 0x56, 0x19, 0x14, 0x00, 0x7E, 0x14, 0x19, 0x0D, 0xC0, 0x19, 0x0D, 0xA2, 0x78, 0xC0, 0x17,
+    0x55, 0xC0, 0x21, 0xC0, 0x69, 0x5A, 0xC0, 0x6E, 0x69, 0xA2, 0x78, 0x2B, 0x6E, 0x59, 0xA3, 0x88,
+    0x2D, 0x32, 0x2F, 0x39, 0x6F, 0x3B, 0xA2, 0x78, 0x11, 0x09, 0x0E, 0x5F, 0x0F, 0xA2, 0x88, 0x6E,
+    0x41, 0xC0, 0x20, 0x25, 0x11, 0x25, 0x28, 0x20, 0x60, 0xC0, 0x0B, 0x7F, 0x04, 0x07, 0x3B, 0x0A,
+    0x76, 0x2F, 0x32, 0x76, 0x26, 0x35, 0x66, 0x9D, 0x99, 0x7B, 0x29, 0x6B, 0x10, 0x15, 0x21, 0xA8,
+    0x24, 0x01, 0x3C, 0xC0, 0x61, 0x56, 0x26, 0x2B, 0xC0, 0x3A, 0x2B, 0x5A, 0x7E, 0x01, 0xC0, 0x5A,
+    0x03, 0x08, 0x39, 0x6E, 0x0A, 0xC0, 0x05, 0x0A, 0x07, 0x3B, 0x07, 0x36, 0x0A, 0x7A, 0x39, 0x08,
+    0x65, 0x2A, 0x2D, 0xC0, 0x7F, 0x3A, 0x9D, 0x99, 0x7F, 0x66, 0x61, 0x6B, 0x7F, 0x9D, 0x99, 0x7F,
+    0x66, 0x66, 0x59, 0x66, 0x1C, 0x66, 0xA2, 0x78, 0x9D, 0x98, 0x1C, 0x21, 0x0D, 0xC1, 0x12, 0x26,
+    0x1F, 0x56, 0xA2, 0x77, 0xC0, 0x55, 0xA2, 0x88, 0x59, 0xC0, 0x35, 0x5A, 0x69, 0x01, 0x55, 0xC0,
+    0x34, 0xC0, 0x3B, 0xC0, 0x07, 0x3D, 0x0E, 0x0B, 0x6F, 0xC0, 0x46, 0x20, 0x25, 0x56, 0xA2, 0x88,
+    0x9D, 0x89, 0xC1, 0x7F, 0x59, 0x15, 0x65, 0x25, 0x0C, 0xA2, 0x87, 0x7B, 0x61, 0x7E, 0x75, 0x66,
+    0x36, 0x39, 0x7A, 0x32, 0x2D, 0x62, 0x7A, 0x7B, 0x9D, 0x99, 0xC0, 0x2E, 0x56, 0x51, 0x26, 0x2E,
+    0x05, 0x7A, 0x06, 0x32, 0x7B, 0x51, 0x7E, 0x23, 0xA2, 0x88, 0x30, 0x2B, 0x30, 0xC0, 0x2D, 0xC0,
+    0x2A, 0x03, 0xC0, 0xA2, 0x77, 0xC0, 0x0A, 0xC0, 0x3B, 0x0A, 0x07, 0x3B, 0xA2, 0x88, 0x3B, 0x0A,
+    0xC0, 0x3E, 0x52, 0x05, 0x39, 0x03, 0x2A, 0x2D, 0xC0, 0x2B, 0x3A, 0xC0, 0x35, 0x51, 0x7B, 0x62,
+    0xC0, 0x7F, 0x21, 0xC0, 0x66, 0xC1, 0x7F, 0x69, 0x1C, 0x10, 0x29, 0x26, 0x61, 0x2E, 0x17, 0x6E,
+    0xA2, 0x88, 0x35, 0xC0, 0x3A, 0x23, 0x28, 0x2D, 0xC0, 0xA2, 0x77, 0x08, 0x39, 0x36, 0x02, 0x0F,
+    0x0C, 0x0E, 0x1A, 0x41, 0xA3, 0x88, 0x52, 0x5A, 0x6E, 0x1D, 0x56, 0xC0, 0xA2, 0x78, 0x51, 0x6B,
+    0xA2, 0x88, 0x6E, 0x61, 0x2D, 0x19, 0x21, 0x69, 0x15, 0x2C, 0x0C, 0x20, 0x75, 0x0B, 0x76, 0x04,
+    0xA1, 0xA8, 0x05, 0x39, 0x37, 0x28, 0x3C, 0x62, 0x61, 0xC0, 0x62, 0xA2, 0x88, 0x33, 0x52, 0x65,
+    0x5E, 0x02, 0x31, 0x2F, 0xC0, 0x2A, 0x7E, 0x76, 0x3C, 0x30, 0xC0, 0x28, 0x3C, 0x30, 0x01, 0x32,
+    0x2A, 0x37, 0x08, 0x34, 0x39, 0x0A, 0x36, 0x0A, 0xC1, 0x07, 0x3B, 0x07, 0x3B, 0x07, 0x0A, 0x36,
+    0x05, 0x0D, 0x39, 0x08, 0x66, 0xC0, 0x2A, 0x7A, 0x01, 0x3C, 0x30, 0x3A, 0xC0, 0x21, 0x1C, 0xA2,
+    0x88, 0x2B, 0x30, 0xC0, 0x1C, 0x30, 0x1C, 0x30, 0x21, 0x6E, 0x35, 0x5A, 0x69, 0x23, 0x28, 0x3C,
+    0x01, 0x5A, 0x03, 0x2F, 0x39, 0xC0, 0x0A, 0x3B, 0xA2, 0x78, 0xC0, 0x5F, 0x6E, 0xC0, 0x41, 0xA2,
+    0x78, 0x20, 0xC0, 0x5F, 0xC0, 0x5A, 0x19, 0xA2, 0x88, 0x6E, 0x56, 0x66, 0x6F, 0xC0, 0x51, 0x31,
+    0x22, 0x31, 0x50, 0x19, 0x7E, 0xA2, 0x88, 0x29, 0x50, 0xA2, 0x98, 0x7A, 0x9D, 0x98, 0x76, 0x18,
+    0x3D, 0x0F, 0x39, 0x34, 0xA1, 0xA9, 0x51, 0x62, 0x3A, 0x66, 0xC0, 0x30, 0xC1, 0x65, 0x30, 0x0C,
+    0x3B, 0x0D, 0x66, 0x2F, 0x32, 0xC0, 0x3C, 0x65, 0x5A, 0x28, 0x01, 0x65, 0x2D, 0x3E, 0x06, 0x37,
+    0x34, 0x2F, 0x05, 0x39, 0x0A, 0xC0, 0x36, 0x3B, 0xC0, 0x5A, 0x07, 0x0C, 0xC0, 0x0F, 0x3B, 0x07,
+    0x02, 0x36, 0xC0, 0x05, 0x34, 0x39, 0x7B, 0xC0, 0x9D, 0x99, 0x3E, 0x2D, 0x01, 0x35, 0x3C, 0x01,
+    0x28, 0x30, 0x28, 0xC1, 0x01, 0x2D, 0xC0, 0x2A, 0xC0, 0x32, 0x2F, 0x08, 0x34, 0x0D, 0x05, 0x0A,
+    0x07, 0xA2, 0x88, 0x09, 0x04, 0x5E, 0x0B, 0xA2, 0x88, 0x5B, 0x14, 0x25, 0x11, 0x29, 0xC0, 0x26,
+    0x56, 0xA2, 0x88, 0x52, 0x31, 0xC0, 0x1D, 0x5B, 0xA2, 0x88, 0x61, 0x21, 0xC0, 0x35, 0xC0, 0x9D,
+    0x99, 0xA3, 0x98, 0x1D, 0xC0, 0xA3, 0x98, 0x1E, 0xA2, 0x98, 0x9D, 0x98, 0x7E, 0x76, 0x65, 0x1F,
+    0x09, 0x18, 0x75, 0x05, 0x0D, 0x03, 0x2D, 0x30, 0x52, 0x76, 0x6E, 0xC0, 0x21, 0xC2, 0xAB, 0x05,
+    0x9C, 0x98, 0x3B, 0x0A, 0x61, 0x2F, 0xC0, 0x2D, 0x6E, 0x01, 0x28, 0x32, 0x01, 0x32, 0x2D, 0x2A,
+    0x37, 0x34, 0xC0, 0x39, 0x0A, 0xC0, 0x07, 0x0F, 0x07, 0xA2, 0x87, 0x0C, 0xC0, 0x07, 0xA2, 0x77,
+    0x3D, 0x0C, 0x38, 0x07, 0xC1, 0x69, 0x0F, 0x36, 0x3B, 0x05, 0x69, 0x05, 0x39, 0x34, 0x08, 0xC0,
+    0x03, 0x34, 0x39, 0x08, 0x34, 0xC0, 0x05, 0x51, 0x0A, 0x05, 0x0A, 0x3B, 0x07, 0xC0, 0x0C, 0x04,
+    0x09, 0x6F, 0x1F, 0x6B, 0x5A, 0x51, 0x20, 0x5A, 0x66, 0x5A, 0xA2, 0x78, 0x66, 0x25, 0xC0, 0x6F,
+    0x51, 0x6F, 0x6F, 0xC0, 0x6B, 0x9D, 0x99, 0x6F, 0x6E, 0x51, 0x7B, 0x2F, 0xC0, 0x20, 0x7E, 0xC0,
+    0x7E, 0xC0, 0x24, 0xA3, 0x87, 0x31, 0x79, 0xC0, 0x79, 0x18, 0x65, 0x0F, 0x1A, 0x65, 0x38, 0x07,
+    0x0D, 0x08, 0x9C, 0x99, 0x7A, 0x7F, 0x65, 0x2B, 0x66, 0xC0, 0x3A, 0x9D, 0x89, 0x2B, 0xFE, 0x85,
+    0x8A, 0xA1, 0xA8, 0x04, 0xA1, 0xA8, 0x0D, 0x08, 0xC0, 0x9D, 0x99, 0x2A, 0x01, 0x2D, 0xC0, 0x32,
+    0x2D, 0x32, 0xC0, 0x03, 0xC0, 0x08, 0x05, 0x0A, 0x05, 0x02, 0x07, 0x3B, 0x00, 0x3D, 0x04, 0x7E,
+    0x3D, 0x11, 0x6B, 0x09, 0x1D, 0x09, 0x11, 0x09, 0x11, 0x0C, 0x11, 0x3D, 0x00, 0x0C, 0xC1, 0x07,
+    0xC4, 0x0C, 0x11, 0x0C, 0x3D, 0x09, 0x6F, 0xC0, 0x06, 0x1A, 0x41, 0x6E, 0xC0, 0x6F, 0x5A, 0x2C,
+    0x41, 0xC0, 0x21, 0x6E, 0x6F, 0x25, 0x6E, 0x31, 0x56, 0x6B, 0x1C, 0x5A, 0xA2, 0x99, 0x9D, 0x89,
+    0x6B, 0xA2, 0x88, 0x22, 0xA2, 0x89, 0x9D, 0x98, 0x6F, 0x66, 0xA2, 0x77, 0x3D, 0x29, 0xC0, 0x22,
+    0xC0, 0xA2, 0x87, 0x28, 0x30, 0x69, 0x65, 0xC0, 0x79, 0x15, 0x7E, 0xC0, 0x08, 0x1F, 0x0E, 0x7A,
+    0x0F, 0x3B, 0x39, 0x7A, 0x62, 0x2D, 0x66, 0x7E, 0x52, 0xC0, 0x3F, 0x30, 0x6F, 0x14, 0x1F, 0x76,
+    0x9D, 0x98, 0x0A, 0xC0, 0x76, 0xC0, 0x61, 0x7F, 0x56, 0x2D, 0xC0, 0x32, 0xC0, 0x06, 0x32, 0xA2,
+    0x78, 0x55, 0x08, 0x0D, 0x41, 0x0A, 0x07, 0xC1, 0x0C, 0x09, 0x3D, 0x5A, 0x0E, 0x1D, 0x0E, 0x1D,
+    0x1A, 0xC0, 0x0E, 0x56, 0x0E, 0x06, 0x1A, 0xC0, 0x06, 0x09, 0x06, 0x1A, 0xC0, 0x0E, 0x1A, 0x1F,
+    0x56, 0x1A, 0x12, 0xA2, 0x77, 0x17, 0x56, 0x5A, 0xA2, 0x88, 0x6E, 0x0C, 0xA3, 0x79, 0xC0, 0x6E,
+    0x21, 0x6F, 0x6E, 0x67, 0x55, 0x5B, 0x66, 0x6F, 0x6F, 0x66, 0x2F, 0xC0, 0x6F, 0x22, 0x6F, 0x52,
+    0x7F, 0x6F, 0x51, 0x7A, 0xC0, 0x6F, 0x9D, 0x99, 0x37, 0x51, 0x28, 0x37, 0x6D, 0x7A, 0x51, 0xA3,
+    0x87, 0x3B, 0x2F, 0xA2, 0x87, 0x69, 0x31, 0x2D, 0x55, 0x79, 0x7A, 0x20, 0x1C, 0x06, 0xA2, 0x98,
+    0x07, 0x65, 0x05, 0x39, 0x62, 0x76, 0xC1, 0x7F, 0x51, 0x3C, 0x2D, 0xC0, 0x20, 0x7A, 0x0B, 0x04,
+    0x07, 0x7E, 0x0A, 0x9D, 0xA9, 0x2F, 0x7A, 0xC0, 0xA2, 0x88, 0x3E, 0x32, 0xC0, 0x06, 0x55, 0x34,
+    0x08, 0xC0, 0x0D, 0x0A, 0xC0, 0x07, 0xC0, 0x6E, 0x18, 0x3D, 0x09, 0xC0, 0x5A, 0x0B, 0x1F, 0x0B,
+    0x1F, 0x17, 0x12, 0xC0, 0x55, 0x23, 0x1C, 0x52, 0xC0, 0x69, 0x1C, 0x14, 0x0F, 0x14, 0xC0, 0x56,
+    0xA3, 0x88, 0x56, 0xC0, 0x15, 0xA2, 0x88, 0x15, 0x6F, 0xC0, 0x19, 0xA2, 0x88, 0x2A, 0xC0, 0x56,
+    0x6B, 0x6B, 0xC0, 0x6F, 0x66, 0x1B, 0x27, 0x2E, 0x7A, 0x6F, 0x24, 0x6F, 0x52, 0x7F, 0x66, 0x56,
+    0x66, 0xC1, 0x7F, 0x6E, 0x9D, 0x99, 0x20, 0xC1, 0x69, 0x25, 0x32, 0xC0, 0x59, 0x24, 0x2E, 0x36,
+    0x69, 0x69, 0x29, 0x79, 0x7E, 0x50, 0x15, 0xA2, 0x97, 0x76, 0x0B, 0x0E, 0x76, 0x07, 0x61, 0x66,
+    0xA2, 0x98, 0x61, 0x52, 0x7A, 0xC0, 0x6E, 0x2D, 0x37, 0x56, 0xFE, 0x75, 0xEC, 0x75, 0x60, 0xA1,
+    0xA9, 0x11, 0x3B, 0x0A, 0x05, 0x61, 0x37, 0x2F, 0x32, 0xC0, 0x01, 0x6E, 0x32, 0x37, 0x2F, 0xA2,
+    0x87, 0x39, 0x0D, 0x05, 0x3B, 0xA2, 0x88, 0x07, 0x55, 0x0C, 0x09, 0xC0, 0x5A, 0x1A, 0x17, 0x03,
+    0x1C, 0x17, 0xA2, 0x78, 0xC0, 0x14, 0x20, 0x28, 0x9D, 0x89, 0x6F, 0x69, 0xC0, 0x18, 0xA3, 0x88,
+    0x29, 0xC1, 0x21, 0xC0, 0x6F, 0x51, 0x6F, 0x19, 0xA3, 0x89, 0x56, 0x51, 0x6B, 0x35, 0x56, 0x7F,
+    0x66, 0x56, 0x67, 0x56, 0x3D, 0x29, 0x2B, 0xC0, 0x52, 0xC0, 0x7F, 0x52, 0x1B, 0x6B, 0xC0, 0x7F,
+    0x66, 0x56, 0x65, 0x2C, 0x18, 0x2C, 0x18, 0x2C, 0x31, 0xC0, 0x50, 0xA3, 0x88, 0x20, 0x69, 0xA3,
+    0x88, 0x2B, 0x30, 0x7D, 0xA2, 0x77, 0x64, 0x69, 0x1D, 0x25, 0x7E, 0x64, 0xA0, 0xA8, 0x0C, 0xA0,
+    0xA8, 0x06, 0xA0, 0xA8, 0x00, 0x0F, 0x9D, 0xA9, 0x34, 0x66, 0xC0, 0xA2, 0x88, 0x7A, 0x03, 0xC0,
+    0x34, 0xC0, 0x26, 0x75, 0x14, 0x61, 0x0E, 0x0C, 0x0F, 0x36, 0x05, 0x2F, 0x7E, 0x3E, 0x06, 0x2A,
+    0x7E, 0x06, 0x9D, 0x99, 0x37, 0xA2, 0x88, 0x56, 0x34, 0x39, 0x0D, 0x0A, 0x07, 0xA2, 0x88, 0x04,
+    0x0E, 0xC0, 0x5A, 0xC0, 0x56, 0x6F, 0xC0, 0xA2, 0x77, 0x6F, 0x52, 0x25, 0x11, 0xA2, 0x78, 0x6B,
+    0xC0, 0x15, 0x26, 0x66, 0x56, 0xC1, 0x6F, 0x5A, 0x25, 0x56, 0xC0, 0x57, 0xA2, 0x88, 0x52, 0x5A,
+    0xC0, 0x7F, 0x31, 0x6E, 0x3D, 0x66, 0x42, 0x7F, 0x62, 0x56, 0xA2, 0x88, 0x66, 0x66, 0x52, 0x66,
+    0x2C, 0xC0, 0x66, 0x66, 0x6F, 0x62, 0x51, 0xC0, 0x6F, 0x24, 0x10, 0xA3, 0x88, 0x51, 0xC0, 0x2E,
+    0x51, 0xA2, 0x77, 0x65, 0x16, 0x34, 0x39, 0x69, 0x2B, 0x38, 0x36, 0x7D, 0x30, 0x7D, 0x69, 0x19,
+    0xA2, 0x97, 0x7A, 0x9D, 0x98, 0xA2, 0x97, 0x0B, 0xA0, 0xA8, 0x9D, 0x99, 0x07, 0x0A, 0x0D, 0x51,
+    0x7B, 0x51, 0xC0, 0x7E, 0x6E, 0x6F, 0x59, 0x19, 0xA1, 0xA8, 0x64, 0x17, 0x7A, 0x09, 0x7A, 0x05,
+    0x39, 0xC0, 0x37, 0x66, 0xC0, 0x01, 0x51, 0x32, 0x56, 0x32, 0x06, 0x2F, 0x3C, 0x5B, 0x05, 0x55,
+    0x0A, 0x38, 0x07, 0x59, 0x09, 0x1A, 0x41, 0x6E, 0xC0, 0xA3, 0x89, 0x11, 0x6F, 0x2C, 0x1D, 0x56,
+    0x21, 0x6F, 0x55, 0x2D, 0x56, 0xA2, 0x88, 0x5A, 0x62, 0x5A, 0xC0, 0x52, 0x6F, 0x23, 0xA2, 0x88,
+    0x3B, 0xC0, 0x52, 0x62, 0x6E, 0x6B, 0x6B, 0x66, 0x6B, 0x61, 0x52, 0x16, 0x6F, 0x7F, 0x18, 0x66,
+    0xA2, 0x89, 0x66, 0x62, 0xC1, 0x66, 0x7F, 0x66, 0x56, 0x61, 0x5A, 0x24, 0x1C, 0x08, 0xA2, 0x87,
+    0xC0, 0x5A, 0x1F, 0xA2, 0x77, 0xC0, 0x13, 0xA3, 0x88, 0x22, 0xA2, 0x77, 0x69, 0x6D, 0x30, 0x69,
+    0x68, 0xA3, 0x87, 0x35, 0x60, 0xA3, 0x97, 0x79, 0x65, 0x14, 0x7F, 0x9D, 0xA8, 0x09, 0x0C, 0x38,
+    0x76, 0x7A, 0xC0, 0x7F, 0x51, 0x08, 0xC0, 0x39, 0x56, 0x0A, 0x1D, 0x21, 0x79, 0x14, 0x75, 0x09,
+    0x0C, 0x0A, 0x36, 0x08, 0x34, 0x76, 0x01, 0xC0, 0x51, 0x7E, 0x01, 0xC0, 0x2D, 0x32, 0x34, 0x08,
+    0x05, 0x36, 0x0A, 0x55, 0x0C, 0x04, 0x0E, 0x06, 0x0B, 0x23, 0x14, 0x11, 0x1D, 0xA2, 0x88, 0x41,
+    0x21, 0x26, 0x67, 0x19, 0xA3, 0x89, 0x41, 0x66, 0x6F, 0x6F, 0x52, 0x66, 0x6F, 0x66, 0x6F, 0x52,
+    0xC0, 0x66, 0x57, 0xC0, 0x6B, 0x7F, 0x62, 0x66, 0xC0, 0x67, 0x18, 0x67, 0x66, 0x7F, 0x62, 0x1F,
+    0x6B, 0x61, 0x66, 0x52, 0xA2, 0x98, 0xC0, 0x66, 0x66, 0x55, 0x66, 0x01, 0x3C, 0x01, 0xC0, 0x6E,
+    0x15, 0x5E, 0x69, 0xA2, 0x77, 0x12, 0x6D, 0x6E, 0xA4, 0x77, 0x54, 0x2F, 0x39, 0x69, 0xA2, 0x87,
+    0x9E, 0x86, 0xA4, 0x77, 0x79, 0x35, 0x79, 0x79, 0x60, 0xA2, 0x88, 0x9D, 0xA8, 0x79, 0x76, 0x7F,
+    0x04, 0x7E, 0x9D, 0xA9, 0x0A, 0xC0, 0x61, 0xC1, 0x05, 0xC0, 0xA2, 0x77, 0xC0, 0xFE, 0x5D, 0xCE,
+    0x2D, 0x60, 0x11, 0x76, 0xA1, 0xA8, 0x3D, 0x07, 0x0A, 0x0D, 0x9D, 0xA9, 0x7F, 0x66, 0x51, 0x01,
+    0x9D, 0x99, 0x01, 0x2D, 0x01, 0xC0, 0x5E, 0xC0, 0x6E, 0x39, 0x5E, 0xC0, 0x07, 0xA2, 0x77, 0x42,
+    0x6E, 0xA3, 0x88, 0x9D, 0x89, 0x5F, 0xA2, 0x88, 0x5A, 0xC0, 0x6F, 0x19, 0xA2, 0x88, 0x56, 0x22,
+    0x6B, 0x66, 0x35, 0x9D, 0x9A, 0xA2, 0x78, 0x67, 0xC0, 0x56, 0x62, 0x5A, 0x32, 0x51, 0x7F, 0x52,
+    0x66, 0x67, 0xC0, 0x27, 0x66, 0x67, 0x10, 0x7F, 0x26, 0x61, 0x1C, 0x62, 0x61, 0x3C, 0x7F, 0x51,
+    0xC0, 0xA2, 0x98, 0x52, 0x65, 0xC0, 0xA2, 0x88, 0x9D, 0x99, 0xA4, 0x78, 0x35, 0xC0, 0x01, 0x6D,
+    0xA2, 0x78, 0x3C, 0xA3, 0x88, 0x6E, 0x55, 0x26, 0x1F, 0xA2, 0x77, 0x18, 0x2A, 0xA2, 0x77, 0x59,
+    0x2B, 0x69, 0x6D, 0xA2, 0x86, 0x69, 0xA1, 0xA8, 0x25, 0x74, 0xC0, 0x14, 0x7A, 0x06, 0x7E, 0x66,
+    0x7A, 0x3B, 0x05, 0x3E, 0x0D, 0xC0, 0x41, 0x0A, 0x02, 0xA2, 0x87, 0x0C, 0xA4, 0x0C, 0x9E, 0x86,
+    0xA3, 0xA8, 0x75, 0x74, 0x76, 0x7A, 0x0C, 0x0A, 0x9D, 0xA9, 0x7F, 0x61, 0x7F, 0x9D, 0x99, 0xC0,
+    0x7E, 0xC1, 0x28, 0xA2, 0x88, 0x55, 0x5A, 0x6E, 0x08, 0x0D, 0x05, 0x0F, 0x07, 0x09, 0x56, 0x06,
+    0xA3, 0x79, 0x6E, 0x41, 0x2C, 0x15, 0x6F, 0x5A, 0x25, 0x31, 0x52, 0x6F, 0x5A, 0x6B, 0x6B, 0x9C,
+    0x99, 0x6F, 0x66, 0x2B, 0x6B, 0x66, 0x20, 0x7F, 0x52, 0x18, 0x6B, 0x7F, 0x66, 0x62, 0x62, 0x6F,
+    0x0B, 0x7F, 0x66, 0x10, 0x66, 0x66, 0x7A, 0x52, 0x65, 0xC0, 0xA2, 0x99, 0x51, 0x7E, 0x51, 0x02,
+    0x2E, 0x02, 0x3A, 0x2E, 0x5A, 0xA4, 0x88, 0x55, 0x5A, 0x0B, 0x10, 0x55, 0xA2, 0x77, 0xA2, 0x77,
+    0x1F, 0x55, 0xA2, 0x76, 0xA2, 0x77, 0x1B, 0x32, 0x55, 0xA3, 0x97, 0x6C, 0x7E, 0x6D, 0x7D, 0x79,
+    0x9D, 0xA8, 0x7A, 0x65, 0x7A, 0x75, 0xA2, 0x98, 0x9D, 0x99, 0xA2, 0x97, 0x66, 0x51, 0x05, 0x0A,
+    0x0D, 0x41, 0x3B, 0x07, 0x14, 0x5B, 0xA2, 0x0C, 0x25, 0x7D, 0xA1, 0xA8, 0x9D, 0xA8, 0x61, 0x1D,
+    0x9D, 0xA8, 0x0A, 0x39, 0x76, 0x6B, 0x7A, 0x66, 0x65, 0x7F, 0x9D, 0x89, 0x7E, 0xC0, 0x5A, 0x3C,
+    0xC0, 0x37, 0x56, 0x08, 0x05, 0x0F, 0xC0, 0x5A, 0x5A, 0xA2, 0x78, 0x03, 0xA4, 0x78, 0x5A, 0x2C,
+    0x26, 0x6B, 0xC0, 0x42, 0x5A, 0x7F, 0x5B, 0x7B, 0x52, 0x57, 0x6F, 0x9D, 0x99, 0xA1, 0x9A, 0x66,
+    0x1B, 0x66, 0xA1, 0x8A, 0x13, 0x67, 0x7F, 0x1F, 0x62, 0x66, 0x0B, 0x7F, 0x62, 0xC0, 0x9D, 0xA9,
+    0x7B, 0xC0, 0x66, 0x66, 0x7A, 0x65, 0x6B, 0x7A, 0xC0, 0x55, 0x7B, 0x3B, 0x51, 0x6F, 0x27, 0x33,
+    0x59, 0x3D, 0x3A, 0xA2, 0x87, 0x41, 0xA3, 0x88, 0x5A, 0x10, 0x59, 0x0B, 0xA2, 0x67, 0xA2, 0x76,
+    0x6E, 0xA2, 0x76, 0x1B, 0x2D, 0x6D, 0x6D, 0x68, 0x7D, 0xA2, 0x87, 0x79, 0x1E, 0xA1, 0xA8, 0x7A,
+    0x65, 0x17, 0x7A, 0x7A, 0x9D, 0x99, 0xA2, 0x97, 0x0F, 0x0A, 0xC2, 0x55, 0x6F, 0xC0, 0x0C, 0x5A,
+    0xA2, 0x0D, 0x78, 0x19, 0xA1, 0xA8, 0x20, 0x71, 0x09, 0x0C, 0x0A, 0x9D, 0xA9, 0xA1, 0xA9, 0x51,
+    0x62, 0x7A, 0x66, 0xC0, 0xA2, 0x88, 0x66, 0xC0, 0x51, 0x2B, 0x23, 0x3C, 0x32, 0x6E, 0x39, 0x05,
+    0x0F, 0x41, 0x09, 0x6E, 0xA2, 0x78, 0x46, 0x11, 0x6B, 0x5A, 0xA3, 0x79, 0x9D, 0x89, 0xA2, 0x89,
+    0x42, 0x7F, 0x5B, 0x6B, 0x9D, 0x9A, 0x66, 0x6B, 0x52, 0x66, 0xA0, 0x8A, 0x62, 0x6B, 0x76, 0x52,
+    0x77, 0x66, 0x6B, 0x9C, 0xA9, 0xC0, 0x7B, 0x62, 0x7E, 0x66, 0x02, 0x52, 0x65, 0xA1, 0xA9, 0xC1,
+    0x61, 0x36, 0x61, 0xA2, 0x88, 0x9D, 0x99, 0x25, 0x2A, 0x20, 0x25, 0x2A, 0x56, 0x2A, 0x5A, 0x3D,
+    0x29, 0xA2, 0x77, 0x04, 0xA2, 0x77, 0x0B, 0xA2, 0x77, 0x5D, 0x59, 0xA4, 0x77, 0x5D, 0x1D, 0xA3,
+    0x87, 0xA2, 0x76, 0x2B, 0x6D, 0x1B, 0x21, 0x79, 0xA3, 0x98, 0x79, 0x69, 0x71, 0x14, 0xA1, 0xA8,
+    0x9D, 0x99, 0x76, 0xA2, 0x87, 0x0C, 0x0F, 0x51, 0x0A, 0x3B, 0x0A, 0x07, 0x0F, 0x5F, 0x55, 0x6E,
+    0x34, 0x78, 0xA1, 0xA7, 0x60, 0x75, 0x03, 0x0E, 0x76, 0x0A, 0x9C, 0xA9, 0x7A, 0x7F, 0x61, 0x26,
+    0x66, 0x7F, 0x66, 0x30, 0x21, 0x6F, 0x21, 0x5A, 0xA3, 0x88, 0x28, 0x01, 0x3E, 0x59, 0x5E, 0x3B,
+    0x0C, 0xA2, 0x78, 0x5A, 0x5E, 0x6F, 0x41, 0xA2, 0x79, 0x41, 0x39, 0x9D, 0x89, 0xA2, 0x79, 0x52,
+    0x6B, 0x52, 0x57, 0x7B, 0x56, 0x67, 0x62, 0xA1, 0x9A, 0x13, 0x7B, 0x52, 0x62, 0xA1, 0x9A, 0x76,
+    0x9D, 0x99, 0x66, 0x76, 0x66, 0x66, 0x3D, 0xC0, 0x27, 0x6E, 0x2A, 0xC0, 0x7A, 0x52, 0xA2, 0x98,
+    0x55, 0xC0, 0x7E, 0x51, 0x6B, 0x28, 0x37, 0x28, 0x20, 0x2D, 0x56, 0xA2, 0x78, 0x6E, 0x45, 0x3D,
+    0xA2, 0x67, 0x6E, 0x3C, 0x01, 0xA4, 0x77, 0x49, 0xA4, 0x76, 0xA2, 0x77, 0x58, 0x6D, 0x6D, 0xA4,
+    0x76, 0x7D, 0xA2, 0x86, 0x65, 0x79, 0x7D, 0x65, 0x7E, 0x11, 0xA1, 0xA8, 0x62, 0x0E, 0x62, 0x0C,
+    0x07, 0x0A, 0x51, 0x0A, 0xC0, 0x55, 0x07, 0xC0, 0x04, 0xA2, 0x87, 0x5F, 0xA1, 0x1F, 0x9F, 0x96,
+    0xA1, 0xA7, 0x7D, 0xA0, 0xA7, 0x17, 0x0E, 0x07, 0x05, 0x76, 0x76, 0x66, 0x9D, 0xA9, 0x66, 0x66,
+    0x7B, 0xC0, 0x55, 0xC0, 0x7E, 0x1C, 0xA2, 0x88, 0x21, 0xA3, 0x88, 0x59, 0x01, 0x03, 0xC0, 0x45,
+    0x07, 0x59, 0xA2, 0x79, 0x45, 0xA3, 0x88, 0x5B, 0x46, 0x5A, 0x2D, 0x5B, 0x42, 0x6B, 0xA1, 0x9A,
+    0x42, 0x67, 0x2B, 0x53, 0x66, 0xA0, 0x9A, 0x62, 0x52, 0x77, 0x62, 0x62, 0x7F, 0x9C, 0x99, 0x76,
+    0x6B, 0xA0, 0xA8, 0x62, 0x51, 0x76, 0xA2, 0x88, 0x2A, 0x62, 0xA2, 0x87, 0x7A, 0xC0, 0x9D, 0x99,
+    0xC0, 0xA2, 0x98, 0x55, 0x6B, 0x1F, 0x2E, 0x26, 0xC0, 0x17, 0x30, 0x5B, 0xC0, 0x6E, 0x5A, 0x59,
+    0x02, 0x45, 0x6E, 0xA4, 0x67, 0x1A, 0x5E, 0xA2, 0x76, 0x5D, 0xA3, 0x87, 0x22, 0xA4, 0x76, 0x6C,
+    0x6D, 0x64, 0x28, 0x7D, 0x79, 0x65, 0x79, 0xA2, 0x98, 0x9D, 0xA8, 0x7E, 0x7A, 0x9D, 0xA8, 0x0C,
+    0x66, 0x65, 0xA2, 0x88, 0x0A, 0x05, 0x0F, 0xC0, 0x3B, 0xA3, 0x88, 0x3D, 0x6F, 0x5A, 0xA1, 0x2F,
+    0x68, 0xA3, 0x96, 0xA0, 0xA7, 0x75, 0x61, 0x0E, 0x00, 0x62, 0xA0, 0xA9, 0x9D, 0xA9, 0x7B, 0x9D,
+    0xA9, 0x7F, 0x66, 0x66, 0x7A, 0x6B, 0xC0, 0x26, 0xC0, 0x55, 0x2B, 0xA2, 0x77, 0xC0, 0x37, 0x55,
+    0x5E, 0xA2, 0x77, 0x0D, 0x3B, 0x04, 0x06, 0xA2, 0x78, 0x5A, 0x5F, 0x15, 0x5F, 0x25, 0xA1, 0x8A,
+    0x9D, 0x8A, 0x2F, 0x2E, 0x62, 0xA1, 0x8A, 0x9D, 0x9A, 0x77, 0x9D, 0x9A, 0xA1, 0x9A, 0x9D, 0x99,
+    0x77, 0x62, 0x62, 0x7F, 0x9D, 0xAA, 0x7A, 0x9D, 0xA9, 0x66, 0x62, 0x7E, 0xA0, 0xA9, 0x55, 0x7A,
+    0x62, 0xC0, 0x7E, 0x65, 0x62, 0xC1, 0x69, 0x6F, 0x7E, 0x15, 0x1F, 0x52, 0x2B, 0x51, 0xA3, 0x89,
+    0x5A, 0x5E, 0x27, 0x2C, 0x5A, 0x09, 0x3A, 0xA3, 0x78, 0xA2, 0x67, 0x69, 0xA4, 0x66, 0xA2, 0x76,
+    0x5D, 0x25, 0x6D, 0x7D, 0xA2, 0x76, 0x79, 0xA3, 0x87, 0x64, 0xA1, 0xA8, 0x69, 0x71, 0x20, 0x71,
+    0x7E, 0x65, 0x9D, 0xA9, 0x07, 0x3B, 0x0A, 0x51, 0x05, 0x65, 0x0A, 0xC0, 0x6E, 0x0C, 0x11, 0x6F,
+    0x5E, 0xFE, 0x55, 0xB1, 0x68, 0xA2, 0x96, 0x9E, 0x96, 0xA2, 0xA7, 0x71, 0x1D, 0x0F, 0x9C, 0xA9,
+    0x62, 0x76, 0x76, 0x7B, 0x66, 0x76, 0x9D, 0x9A, 0x65, 0x17, 0x6E, 0x17, 0x0B, 0xA3, 0x78, 0x1C,
+    0x21, 0x2B, 0x59, 0xA2, 0x78, 0x28, 0xA2, 0x77, 0x08, 0x45, 0x07, 0x04, 0xA2, 0x67, 0x14, 0x6B,
+    0x5E, 0x5B, 0x57, 0x5A, 0xA1, 0x8A, 0x53, 0x6F, 0x57, 0x63, 0x67, 0x9C, 0x99, 0xA1, 0x9A, 0x9D,
+    0x9A, 0x62, 0x77, 0x66, 0x77, 0x9D, 0xA9, 0x77, 0x51, 0x72, 0x7F, 0x76, 0x66, 0x61, 0x65, 0x7F,
+    0x65, 0x7F, 0x7A, 0xC0, 0x51, 0xA2, 0x87, 0xC1, 0x7B, 0x55, 0x22, 0x15, 0xA3, 0x88, 0x9D, 0x89,
+    0xA2, 0x77, 0xA2, 0x78, 0x56, 0x5A, 0xA4, 0x77, 0x41, 0x6E, 0x04, 0x06, 0x5D, 0xA2, 0x77, 0xA4,
+    0x66, 0x1A, 0xA2, 0x76, 0x6D, 0xA2, 0x77, 0xA2, 0x86, 0xA2, 0x86, 0x54, 0xA4, 0x86, 0x65, 0x79,
+    0x21, 0x79, 0x7A, 0x60, 0x7B, 0xA1, 0xA8, 0x0C, 0x3B, 0xC0, 0x66, 0x39, 0xC0, 0x0D, 0xC0, 0x0A,
+    0x36, 0x0A, 0xA2, 0x77, 0x5B, 0x1D, 0x45, 0x31, 0xA2, 0x85, 0x64, 0x21, 0x74, 0x08, 0x9E, 0xB9,
+    0x07, 0x9D, 0xB9, 0x76, 0x72, 0x7B, 0x9D, 0xAA, 0x7A, 0x67, 0x9D, 0x99, 0xC0, 0x66, 0xA2, 0x88,
+    0xC0, 0x0D, 0xC0, 0xA3, 0x88, 0x55, 0xA3, 0x77, 0x6E, 0x6E, 0xA2, 0x77, 0x28, 0x6E, 0xA4, 0x67,
+    0x59, 0x5E, 0xA2, 0x78, 0x4B, 0xA2, 0x77, 0x4B, 0x5B, 0xA2, 0x78, 0x25, 0xA1, 0x7A, 0x52, 0xA0,
+    0x8A, 0x57, 0x67, 0x9C, 0x9A, 0xA1, 0x9A, 0x62, 0x63, 0x66, 0x73, 0x62, 0x3C, 0x06, 0x7B, 0x33,
+    0x62, 0x76, 0x7F, 0x65, 0x76, 0x65, 0x7B, 0x7E, 0x65, 0x15, 0xA2, 0x98, 0x69, 0x51, 0x6F, 0x25,
+    0x1D, 0xC0, 0x6F, 0x55, 0x2E, 0x1A, 0x23, 0xA2, 0x88, 0x5E, 0x2A, 0xA3, 0x78, 0x02, 0x5A, 0xA3,
+    0x77, 0x3C, 0xA4, 0x66, 0xA2, 0x77, 0x5D, 0xA3, 0x87, 0x16, 0xA4, 0x77, 0x6C, 0x69, 0x2F, 0x69,
+    0x79, 0x69, 0xA2, 0x96, 0x76, 0x60, 0x79, 0x76, 0x7E, 0x76, 0x07, 0x0A, 0x05, 0x65, 0x7F, 0x39,
+    0xC0, 0x08, 0x39, 0x05, 0x55, 0x0C, 0xC0, 0x46, 0x12, 0xA0, 0x1E, 0x7C, 0xA1, 0xA7, 0xA2, 0x97,
+    0x9D, 0xB8, 0x12, 0x18, 0x05, 0x75, 0x73, 0x3A, 0x9B, 0xAA, 0x76, 0x67, 0x66, 0xC0, 0x62, 0x7F,
+    0x66, 0xC0, 0x08, 0xA2, 0x88, 0xC0, 0x6E, 0x6E, 0x5D, 0x55, 0x30, 0x6E, 0x5E, 0x2D, 0xA2, 0x67,
+    0x0A, 0x45, 0xA4, 0x78, 0x0B, 0xA2, 0x69, 0x5F, 0x5A, 0x42, 0xA2, 0x8A, 0x28, 0x67, 0x57, 0x6B,
+    0x63, 0x53, 0x63, 0x76, 0x53, 0x10, 0x66, 0x77, 0x9D, 0xA9, 0x66, 0x77, 0x71, 0x66, 0x7A, 0x7B,
+    0x65, 0x61, 0x7A, 0x6E, 0x2E, 0x9D, 0x98, 0x7F, 0xC0, 0x7E, 0xC1, 0x52, 0xA2, 0x88, 0x0E, 0x6B,
+    0x2E, 0x17, 0x28, 0x6E, 0x2A, 0x5F, 0x59, 0x3F, 0x5E, 0xA2, 0x76, 0x5E, 0xA3, 0x77, 0x5D, 0x13,
+    0xA2, 0x77, 0xA4, 0x76, 0x58, 0xA3, 0x87, 0x7D, 0x7D, 0x54, 0xA1, 0xA7, 0x26, 0x65, 0x20, 0x60,
+    0x76, 0x7E, 0x62, 0x0F, 0x0A, 0x7A, 0x9D, 0x99, 0x03, 0xC0, 0x34, 0x66, 0x34, 0xA2, 0x88, 0x41,
+    0x3B, 0x0F, 0x04, 0x6E, 0xA2, 0x78, 0x9E, 0x1F, 0xA3, 0x96, 0x7C, 0xA0, 0xA7, 0x20, 0x06, 0x0C,
+    0x31, 0x2F, 0x72, 0xA0, 0xA9, 0x72, 0x52, 0x9D, 0xAA, 0x66, 0x67, 0x62, 0x7E, 0x6B, 0x05, 0xC0,
+    0x0D, 0xC0, 0xA2, 0x77, 0x55, 0x12, 0xA3, 0x88, 0x6D, 0x45, 0xA2, 0x77, 0xA2, 0x77, 0xA3, 0x78,
+    0x34, 0xA2, 0x78, 0x3D, 0x5B, 0xA3, 0x78, 0x20, 0x5A, 0xA1, 0x7A, 0x25, 0x38, 0x9D, 0x8A, 0x22,
+    0x67, 0x57, 0x67, 0x9D, 0xAB, 0xA1, 0x9A, 0x9D, 0xAA, 0x62, 0x9C, 0xAA, 0x66, 0xA1, 0xAA, 0x9B,
+    0xA9, 0x3A, 0x61, 0x27, 0xA1, 0xA9, 0x9D, 0x99, 0x7A, 0x69, 0x62, 0x7E, 0x66, 0xA2, 0x87, 0x51,
+    0x2C, 0x55, 0xC1, 0x0E, 0xA2, 0x89, 0x6E, 0x12, 0xA3, 0x88, 0x1C, 0xA2, 0x78, 0x5F, 0x27, 0xA3,
+    0x78, 0x3F, 0xA2, 0x77, 0x5E, 0x06, 0x5E, 0xA3, 0x87, 0xA4, 0x66, 0x58, 0x6D, 0xA3, 0x87, 0x5C,
+    0xA2, 0x86, 0x69, 0xA1, 0xA7, 0x7D, 0x7E, 0x79, 0x75, 0x60, 0x7A, 0x76, 0x61, 0xA2, 0x98, 0x76,
+    0xC0, 0x66, 0x61, 0x66, 0x6F, 0x37, 0x52, 0x2F, 0x34, 0x0D, 0x41, 0xC0, 0x0C, 0x09, 0xA2, 0x78,
+    0xA1, 0x1F, 0x7C, 0x16, 0xA0, 0xA7, 0x75, 0x9F, 0xB8, 0x07, 0x08, 0x32, 0x9D, 0xBA, 0x9D, 0xAA,
+    0x72, 0xA1, 0x9A, 0x9D, 0xAA, 0x52, 0x7F, 0x14, 0x9D, 0x99, 0x6B, 0xA2, 0x88, 0x02, 0x16, 0x69,
+    0xA2, 0x88, 0x19, 0x17, 0x55, 0x6E, 0x10, 0xA2, 0x77, 0x5E, 0xA4, 0x77, 0x28, 0x2F, 0xA4, 0x67,
+    0x49, 0x06, 0x5F, 0xA3, 0x78, 0x5F, 0x43, 0x6F, 0x57, 0x53, 0x5B, 0x9D, 0x9A, 0xA0, 0x9A, 0x9D,
+    0x9B, 0x62, 0xA0, 0x9A, 0x9D, 0xAA, 0x9D, 0x9A, 0x76, 0x7B, 0x9D, 0xAA, 0x3F, 0x76, 0x62, 0x7A,
+    0x39, 0x61, 0x65, 0x66, 0x2B, 0x61, 0x7F, 0x65, 0x0E, 0x29, 0x51, 0x0E, 0xA2, 0x88, 0x1A, 0x1F,
+    0x2B, 0x5E, 0xC0, 0x5B, 0xA2, 0x77, 0x45, 0xA2, 0x78, 0x5D, 0xA2, 0x77, 0x06, 0xA3, 0x77, 0x59,
+    0xA4, 0x76, 0x5D, 0xA3, 0x77, 0xA3, 0x86, 0x69, 0x68, 0xA2, 0x86, 0x7D, 0x25, 0x65, 0x7D, 0xA1,
+    0xA8, 0x61, 0x71, 0x09, 0x38, 0x0A, 0x76, 0x03, 0x9D, 0x99, 0xC0, 0xA2, 0x98, 0x51, 0xC0, 0x3C,
+    0x32, 0xC0, 0x03, 0x34, 0x6E, 0x07, 0xC0, 0x09, 0xA3, 0x78, 0x9D, 0x2F, 0xA4, 0x86, 0x78, 0xA0,
+    0xA7, 0xA0, 0xA7, 0x9B, 0xB9, 0x9F, 0xB8, 0x34, 0x3C, 0x9C, 0xA9, 0x9D, 0xAA, 0x77, 0x7B, 0x63,
+    0x66, 0x62, 0x67, 0xC0, 0x6B, 0x65, 0xC0, 0x51, 0x11, 0x65, 0x6E, 0x59, 0xA2, 0x88, 0x58, 0xA3,
+    0x88, 0x17, 0x12, 0xA3, 0x87, 0xA2, 0x67, 0x2D, 0x2F, 0xA4, 0x67, 0x45, 0xA4, 0x68, 0x5E, 0x4B,
+    0x5B, 0x5B, 0xA2, 0x79, 0x9C, 0x8A, 0x22, 0x6B, 0x9D, 0x9B, 0x6B, 0x9F, 0xAB, 0x9D, 0x9A, 0x77,
+    0x9C, 0x99, 0xA0, 0xAA, 0x10, 0x62, 0x9D, 0xA9, 0x76, 0x7B, 0x36, 0xC0, 0x9D, 0xA9, 0xA2, 0x87,
+    0x61, 0x66, 0x7E, 0x52, 0xA3, 0x98, 0x9D, 0x99, 0xA2, 0x78, 0x2E, 0x17, 0xC0, 0xA3, 0x88, 0xC0,
+    0x5F, 0x51, 0x5E, 0x38, 0xA2, 0x77, 0x5A, 0x5E, 0x10, 0x59, 0xA2, 0x67, 0x24, 0xA2, 0x77, 0x5C,
+    0x69, 0x1E, 0xA2, 0x76, 0xA3, 0x97, 0xA2, 0x86, 0x35, 0x2A, 0x61, 0xA2, 0x97, 0x75, 0x75, 0x61,
+    0xA1, 0xA9, 0x07, 0x61, 0xA0, 0xA9, 0xC0, 0x9D, 0x99, 0xA1, 0xA9, 0xC0, 0x2B, 0x56, 0xA3, 0x98,
+    0x23, 0x6E, 0xA3, 0x88, 0xC0, 0x03, 0x59, 0x6E, 0x07, 0x59, 0xA2, 0x68, 0xA2, 0x1E, 0x74, 0xA3,
+    0x96, 0x1D, 0xA0, 0xA8, 0x04, 0x0A, 0x9D, 0xBA, 0x2B, 0x9D, 0xAA, 0xA0, 0xA9, 0x9C, 0x9A, 0xA0,
+    0x9A, 0x9C, 0x99, 0x0F, 0x11, 0x52, 0x7B, 0x56, 0x0E, 0xC0, 0x06, 0x69, 0xC0, 0x04, 0x11, 0x69,
+    0x14, 0x6D, 0x59, 0xA4, 0x77, 0x59, 0xA3, 0x77, 0x49, 0xA3, 0x77, 0xA4, 0x67, 0x5E, 0x4A, 0x5E,
+    0x5F, 0x4F, 0xA2, 0x78, 0x43, 0xA2, 0x89, 0x42, 0x9D, 0x9B, 0xA2, 0x79, 0x63, 0x9D, 0x9B, 0x67,
+    0x2E, 0x62, 0x9C, 0xAA, 0x77, 0x66, 0x9D, 0xA9, 0x62, 0x02, 0x62, 0x61, 0x7F, 0x25, 0xC0, 0x65,
+    0xA1, 0xA9, 0xC0, 0x6E, 0x2B, 0xC0, 0x51, 0xA2, 0x78, 0xC0, 0x6F, 0x51, 0x36, 0x59, 0x38, 0x59,
+    0xA2, 0x68, 0xA2, 0x77, 0x59, 0x1A, 0x5D, 0x5D, 0xA4, 0x66, 0x69, 0xA3, 0x76, 0xA2, 0x86, 0xA3,
+    0x87, 0x50, 0xA3, 0x97, 0x64, 0xA2, 0x86, 0xA1, 0xA8, 0x65, 0x70, 0x0B, 0x7A, 0x18, 0x3B, 0x39,
+    0x2F, 0x7A, 0x2D, 0x76, 0x6B, 0x61, 0xA3, 0x88, 0x66, 0xC0, 0x55, 0x32, 0x6D, 0x6F, 0x3E, 0x6D,
+    0x46, 0x6E, 0x07, 0x4E, 0x37, 0x9F, 0x96, 0xA2, 0x96, 0x9D, 0xB8, 0xA1, 0xA8, 0x9F, 0xB8, 0x39,
+    0x2D, 0x3A, 0x9D, 0xAA, 0x9B, 0xBB, 0x77, 0x05, 0x16, 0x66, 0x52, 0x67, 0x7B, 0x5A, 0x61, 0xC1,
+    0x6E, 0xC1, 0xA2, 0x87, 0x6E, 0x54, 0xA3, 0x87, 0xA2, 0x87, 0x49, 0x12, 0xA2, 0x77, 0x5D, 0x3A,
+    0x5E, 0x4D, 0x36, 0xA4, 0x67, 0xA2, 0x68, 0x5B, 0x9F, 0x69, 0x6F, 0x5B, 0x47, 0xA1, 0x8A, 0x9D,
+    0x9B, 0x6B, 0x9F, 0x9B, 0x9D, 0x9A, 0x77, 0x9D, 0x9A, 0x63, 0x9D, 0xAA, 0xA1, 0xA9, 0x76, 0x9D,
+    0xAA, 0x66, 0x02, 0x66, 0x76, 0x51, 0x7A, 0x66, 0xC0, 0x7F, 0x28, 0x6E, 0xC0, 0x20, 0x25, 0xA2,
+    0x78, 0x3B, 0x27, 0x5A, 0xA3, 0x78, 0x04, 0x09, 0xA2, 0x77, 0x5E, 0x59, 0xA2, 0x66, 0xA4, 0x77,
+    0x5D, 0xA3, 0x87, 0x58, 0xA2, 0x86, 0xA3, 0x87, 0x54, 0xA2, 0x96, 0x69, 0xA2, 0x96, 0x75, 0x7A,
+    0x23, 0x75, 0x9D, 0xA9, 0x07, 0x61, 0x7A, 0x76, 0x7B, 0x76, 0x9D, 0x99, 0x66, 0x7B, 0xC0, 0x51,
+    0xC1, 0x2B, 0x26, 0xA2, 0x88, 0x41, 0x3C, 0x2F, 0x39, 0x6F, 0x07, 0x4A, 0x30, 0x68, 0x29, 0x75,
+    0x1A, 0x07, 0x03, 0x9D, 0xA9, 0x9E, 0xBA, 0x9D, 0xAA, 0x73, 0x9D, 0xAA, 0x00, 0x67, 0x63, 0x0E,
+    0x0D, 0x51, 0xA2, 0x89, 0x62, 0xC0, 0x55, 0xC0, 0x7E, 0x5A, 0x10, 0x51, 0xA4, 0x76, 0x69, 0x02,
+    0xA2, 0x87, 0xA3, 0x76, 0x6E, 0x5C, 0xA5, 0x77, 0x4E, 0xA2, 0x66, 0xA3, 0x78, 0x07, 0x5E, 0x5F,
+    0xA3, 0x78, 0x29, 0x46, 0x1D, 0xA1, 0x8A, 0x27, 0x3D, 0x9C, 0x8A, 0xA1, 0x9A, 0x9D, 0xAA, 0x24,
+    0x9D, 0xAA, 0x7B, 0x9D, 0xAA, 0x9D, 0xAA, 0x7B, 0x7A, 0x62, 0x61, 0x67, 0x38, 0x65, 0xC0, 0x7B,
+    0xC0, 0x51, 0x7E, 0xA2, 0x78, 0x36, 0x5A, 0xA2, 0x87, 0x5E, 0x56, 0x6E, 0x59, 0x0B, 0xA2, 0x77,
+    0x5E, 0x6D, 0xA3, 0x77, 0x6E, 0xA3, 0x76, 0x59, 0xA2, 0x86, 0x58, 0xA2, 0x87, 0x6C, 0x30, 0x1D,
+    0x1E, 0x75, 0xA1, 0xA8, 0x60, 0x1A, 0x76, 0x9D, 0xA9, 0x75, 0x2F, 0xA1, 0xA9, 0x9D, 0xA9, 0x62,
+    0x7F, 0x9D, 0x99, 0xA2, 0x88, 0x66, 0x7A, 0x26, 0x7F, 0x51, 0x17, 0x30, 0x51, 0xA4, 0x77, 0x59,
+    0x32, 0xA2, 0x78, 0xA2, 0x77, 0x5E, 0x11, 0xA2, 0x0D, 0xA2, 0x95, 0x15, 0xA0, 0xA7, 0x9F, 0xB8,
+    0x02, 0x2F, 0x3A, 0x17, 0x9D, 0xBB, 0x77, 0x77, 0x9C, 0x8A, 0x67, 0x06, 0x67, 0x6B, 0x52, 0x65,
+    0x02, 0x66, 0x5A, 0xA2, 0x98, 0x5A, 0x02, 0x0A, 0x08, 0x3C, 0x06, 0x69, 0x6D, 0xA2, 0x77, 0xA2,
+    0x86, 0xA2, 0x66, 0xA4, 0x76, 0x5D, 0xA3, 0x78, 0x4D, 0xA3, 0x77, 0x4E, 0x09, 0xA2, 0x68, 0x4A,
+    0xA2, 0x79, 0x5B, 0x57, 0x47, 0x57, 0x62, 0xA0, 0x8A, 0x57, 0x77, 0x63, 0x67, 0x9C, 0x9A, 0x7A,
+    0x73, 0x9D, 0x99, 0x62, 0x76, 0xC0, 0x7F, 0x9D, 0xA9, 0x7F, 0x6E, 0x38, 0x55, 0xC1, 0x3D, 0x02,
+    0x6F, 0x5D, 0x55, 0x0B, 0x01, 0xA3, 0x78, 0x10, 0x5E, 0xA4, 0x76, 0x54, 0xA3, 0x77, 0x6D, 0xA4,
+    0x76, 0x64, 0x6D, 0xA3, 0x87, 0x64, 0xA3, 0xA7, 0x64, 0x75, 0x14, 0x61, 0xA1, 0xA8, 0x72, 0x75,
+    0x3C, 0x77, 0x62, 0x9D, 0xA9, 0x7B, 0xC0, 0x66, 0x66, 0x9D, 0xA9, 0xA2, 0x78, 0x7F, 0x66, 0x55,
+    0x69, 0x1C, 0x69, 0xA4, 0x67, 0x6E, 0x6E, 0x59, 0xA2, 0x68, 0x59, 0xA3, 0x78, 0xA2, 0x67, 0xA1,
+    0x1D, 0x2D, 0x9D, 0xA7, 0xA0, 0xA7, 0x18, 0x9C, 0xA8, 0x01, 0x35, 0x9B, 0xAA, 0x9E, 0xBA, 0x9C,
+    0x9A, 0x9F, 0x9B, 0x63, 0x7B, 0x57, 0x9D, 0x9A, 0x7F, 0x6B, 0x56, 0x6B, 0x55, 0x66, 0xA2, 0x78,
+    0x7E, 0x09, 0x55, 0x7E, 0x0A, 0x54, 0xA2, 0x87, 0x3F, 0x0C, 0xA3, 0x87, 0x44, 0xA4, 0x76, 0xA2,
+    0x76, 0xA2, 0x67, 0xA2, 0x66, 0x5E, 0xA5, 0x67, 0x4E, 0x5A, 0xA3, 0x68, 0xA2, 0x68, 0x57, 0x2D,
+    0x42, 0xA2, 0x79, 0x53, 0x67, 0x53, 0x67, 0x67, 0x9C, 0x9A, 0x6B, 0x63, 0x76, 0x67, 0x76, 0x62,
+    0xC0, 0x9D, 0xA9, 0x6B, 0x7A, 0x51, 0xC1, 0x7F, 0x04, 0x55, 0xA3, 0x88, 0x5A, 0x10, 0x1A, 0xC0,
+    0x5D, 0x6E, 0x5D, 0xA4, 0x77, 0x58, 0x2F, 0xA2, 0x76, 0x6D, 0x69, 0x68, 0x7D, 0x1D, 0xA2, 0x87,
+    0xA0, 0xA7, 0x60, 0xA1, 0xA8, 0x9D, 0xA9, 0x75, 0x36, 0x08, 0x9D, 0xA9, 0x28, 0x26, 0x66, 0xA1,
+    0xA9, 0x63, 0x66, 0x51, 0x7F, 0x66, 0x9D, 0x99, 0xA2, 0x88, 0x59, 0x21, 0xC0, 0x12, 0xA3, 0x77,
+    0xC0, 0xA2, 0x77, 0x59, 0xA2, 0x77, 0x5E, 0xA4, 0x67, 0x6E, 0x45, 0xFE, 0x66, 0x0E, 0xA0, 0xA7,
+    0x70, 0x9F, 0xB8, 0x9F, 0xB8, 0x9B, 0xBA, 0x9F, 0xBA, 0x9C, 0xBA, 0x9D, 0xAA, 0x9D, 0xBB, 0x05,
+    0x9F, 0xAB, 0x9D, 0x9A, 0xA0, 0x8A, 0x0F, 0x6B, 0x66, 0x57, 0x51, 0x6F, 0x6F, 0x66, 0xA2, 0x77,
+    0x9D, 0x99, 0x08, 0x3C, 0x09, 0x55, 0x02, 0x7D, 0x0D, 0x7D, 0xA2, 0x77, 0x54, 0xA3, 0x87, 0x17,
+    0xA2, 0x66, 0xA3, 0x77, 0xA2, 0x66, 0x28, 0xA4, 0x56, 0x07, 0x5E, 0xA2, 0x68, 0x20, 0x29, 0x5B,
+    0x46, 0xA1, 0x8A, 0x9F, 0x8B, 0x52, 0xA0, 0x8A, 0x9C, 0x99, 0x67, 0x67, 0x1F, 0x7B, 0x62, 0x62,
+    0x62, 0xC0, 0x62, 0xC1, 0x7B, 0x55, 0xC0, 0xA2, 0x88, 0x3C, 0xC0, 0xA3, 0x88, 0x59, 0xA2, 0x77,
+    0xC0, 0x59, 0x29, 0x59, 0x6D, 0xA2, 0x77, 0xA2, 0x86, 0x23, 0xA3, 0x87, 0x64, 0x7D, 0xA3, 0x87,
+    0x2A, 0x61, 0xA2, 0x97, 0x75, 0x60, 0xA1, 0xB9, 0x61, 0x72, 0x34, 0x9F, 0xBA, 0x7A, 0x9D, 0xAA,
+    0x9D, 0x99, 0xA1, 0xAA, 0x61, 0x67, 0x51, 0x7B, 0x55, 0x66, 0xA2, 0x89, 0xC0, 0x6E, 0x08, 0xC0,
+    0x21, 0x59, 0x69, 0xA2, 0x78, 0x2B, 0xA3, 0x77, 0x37, 0xA2, 0x67, 0xA2, 0x77, 0x45, 0xFE, 0x6E,
+    0x0E, 0x29, 0x70, 0x9D, 0xB9, 0xA0, 0xB8, 0x9E, 0xB9, 0x9C, 0xA9, 0x9C, 0xBA, 0x73, 0x03, 0x9F,
+    0xAB, 0x18, 0x0E, 0x9D, 0x9A, 0x57, 0xA0, 0x8A, 0x6F, 0x9D, 0x9A, 0x00, 0x6F, 0x7F, 0xC0, 0x5A,
+    0x0C, 0xC0, 0x00, 0xA3, 0x98, 0x9D, 0x98, 0x6E, 0x79, 0x69, 0xA4, 0x87, 0x6D, 0x54, 0x02, 0xA2,
+    0x76, 0xA5, 0x77, 0x58, 0x5D, 0x3A, 0x45, 0x34, 0x07, 0x5E, 0x4A, 0x20, 0x24, 0x19, 0x5F, 0xA0,
+    0x8A, 0x6B, 0x9D, 0x8A, 0xA0, 0x8A, 0x6B, 0x63, 0x9D, 0x99, 0x63, 0x6B, 0x62, 0x66, 0x7F, 0x67,
+    0x65, 0x62, 0xC4, 0x21, 0x55, 0x7E, 0xA2, 0x77, 0x55, 0xA2, 0x77, 0x18, 0xA5, 0x77, 0x54, 0xA2,
+    0x87, 0x69, 0x22, 0xA2, 0x87, 0x69, 0xA2, 0x96, 0x65, 0x29, 0x61, 0xA1, 0xA8, 0x61, 0xA0, 0xA7,
+    0x76, 0x08, 0x9D, 0xA9, 0x62, 0x26, 0x72, 0xA1, 0x9A, 0x9B, 0xA9, 0x0D, 0x7F, 0x66, 0x62, 0x6F,
+    0x9D, 0x99, 0x7F, 0x00, 0xA2, 0x88, 0xC0, 0x19, 0x69, 0xA2, 0x78, 0x6D, 0x55, 0xA3, 0x77, 0x69,
+    0xA2, 0x67, 0xA3, 0x78, 0xA2, 0x77, 0x49, 0xA2, 0x78, 0xFE, 0x65, 0xCC, 0x9F, 0xB7, 0x9F, 0xB8,
+    0x9F, 0xB9, 0x05, 0x32, 0x9E, 0xBA, 0x9A, 0xAA, 0xA0, 0xAA, 0x9C, 0xAA, 0x9D, 0xAB, 0x0E, 0x6B,
+    0x9C, 0x8A, 0x16, 0x57, 0x9D, 0x89, 0xA2, 0x89, 0x56, 0x6B, 0xC0, 0x6E, 0x6B, 0x51, 0x13, 0xC0,
+    0x6D, 0x76, 0x55, 0x7D, 0x7E, 0x3B, 0x7E, 0x6D, 0xA3, 0x87, 0x02, 0xA3, 0x87, 0x5C, 0x12, 0x33,
+    0x26, 0xA2, 0x67, 0x5E, 0xA5, 0x67, 0x4E, 0xA2, 0x68, 0x46, 0xA1, 0x8A, 0x5B, 0xA2, 0x68, 0x52,
+    0xA0, 0x7A, 0x22, 0xA1, 0x9A, 0x2B, 0x6B, 0x52, 0x77, 0x57, 0x76, 0x66, 0x67, 0x55, 0x10, 0x7F,
+    0x10, 0x7B, 0x24, 0x15, 0xA2, 0x88, 0x15, 0x27, 0x2C, 0x6E, 0x1B, 0xA3, 0x88, 0x32, 0x54, 0x2E,
+    0x69, 0x7D, 0x79, 0x7D, 0x7D, 0x61, 0x75, 0xA0, 0xA8, 0x75, 0x7A, 0x9D, 0xA9, 0x2F, 0x2D, 0xA1,
+    0xA9, 0x9D, 0xAA, 0x76, 0x9D, 0x9A, 0x62, 0x66, 0x17, 0x62, 0x67, 0xC1, 0x6B, 0x66, 0x69, 0x16,
+    0x50, 0x6E, 0xC0, 0x6E, 0x23, 0x54, 0xA2, 0x77, 0x69, 0xA2, 0x67, 0x35, 0x49, 0x3E, 0xA2, 0x77,
+    0xFE, 0x75, 0xEC, 0xA0, 0xA7, 0x9C, 0xA8, 0xA1, 0xB8, 0x08, 0x9D, 0xBA, 0x9C, 0xB9, 0x9D, 0xBB,
+    0x9C, 0x9A, 0x19, 0x9B, 0xAB, 0xA1, 0x9B, 0x9C, 0x89, 0xA0, 0x9A, 0x43, 0xA2, 0x88, 0x42, 0x67,
+    0x5A, 0x6F, 0x7F, 0x5A, 0x66, 0x1C, 0x51, 0x0B, 0x04, 0xC0, 0x7E, 0x65, 0x79, 0xA2, 0x87, 0x64,
+    0x6D, 0xA3, 0x87, 0x13, 0x02, 0xA3, 0x86, 0x21, 0x59, 0xA3, 0x77, 0x3A, 0xA2, 0x67, 0xA3, 0x67,
+    0x4A, 0x1D, 0x4A, 0x20, 0x46, 0xA2, 0x79, 0x5A, 0x57, 0x6B, 0x57, 0x53, 0x66, 0x57, 0x32, 0x52,
+    0x67, 0x31, 0xC0, 0x2C, 0x51, 0xC0, 0x7F, 0x2C, 0xC1, 0x18, 0xA2, 0x77, 0xA2, 0x87, 0x25, 0xA2,
+    0x88, 0x6D, 0x38, 0x29, 0xA2, 0x87, 0xA2, 0x86, 0x50, 0x79, 0x2D, 0x65, 0xA1, 0xA7, 0x76, 0x61,
+    0x75, 0x07, 0x9D, 0xB9, 0x3E, 0x76, 0x35, 0x62, 0x62, 0x9D, 0xAA, 0x66, 0x77, 0x52, 0x7F, 0x02,
+    0x11, 0x3D, 0x6B, 0xC0, 0xA2, 0x88, 0x61, 0x55, 0x11, 0x69, 0xC0, 0x0F, 0x12, 0x55, 0x0D, 0xA2,
+    0x77, 0x26, 0x59, 0xA4, 0x67, 0x59, 0xA3, 0x77, 0xFE, 0x75, 0xEC, 0x9F, 0xB7, 0x9F, 0xB9, 0x9B,
+    0xB9, 0x72, 0x9E, 0xBA, 0x26, 0x9C, 0xAA, 0x9D, 0xAB, 0x02, 0x18, 0x9C, 0x9A, 0xA1, 0x8A, 0x63,
+    0x9D, 0x8A, 0xA2, 0x79, 0x6B, 0x56, 0x0B, 0xA2, 0x78, 0xC0, 0x56, 0x55, 0x14, 0x08, 0x7F, 0x08,
+    0x79, 0x6E, 0x76, 0x00, 0xA3, 0x98, 0x79, 0x6D, 0x9E, 0x86, 0xA4, 0x86, 0x55, 0xA3, 0x86, 0x19,
+    0xA3, 0x76, 0x59, 0xA5, 0x66, 0x3A, 0x4D, 0xA3, 0x78, 0x4E, 0x5E, 0xA2, 0x68, 0x20, 0x15, 0x6F,
+    0xA1, 0x8A, 0x5A, 0x5B, 0x57, 0x9D, 0x9A, 0x56, 0xA0, 0x9A, 0x6F, 0xC0, 0x62, 0x52, 0x7F, 0xC0,
+    0x56, 0x2F, 0x6E, 0x2F, 0xC0, 0x59, 0x6E, 0x69, 0xA2, 0x87, 0x7E, 0x22, 0xA2, 0x87, 0x55, 0xA2,
+    0x97, 0x31, 0x79, 0x7E, 0x15, 0x79, 0x17, 0x76, 0x79, 0x72, 0x08, 0x72, 0x9B, 0xAA, 0xA0, 0xA9,
+    0x26, 0x77, 0x9D, 0xAA, 0x03, 0x19, 0x3B, 0xA2, 0x99, 0x3D, 0xA1, 0x9A, 0x65, 0x3F, 0x13, 0x06,
+    0xC1, 0x3F, 0x6E, 0xC0, 0xA2, 0x87, 0x69, 0xA2, 0x77, 0x59, 0x1C, 0x12, 0xA2, 0x77, 0xA3, 0x77,
+    0xA2, 0x77, 0x5E, 0x32, 0xFE, 0x75, 0xAA, 0xA1, 0xB8, 0x71, 0x9C, 0xB9, 0x32, 0x9D, 0xCB, 0x9C,
+    0xA9, 0x9F, 0xAB, 0x9C, 0xAA, 0x9F, 0x9B, 0x3F, 0x9F, 0x9B, 0xA0, 0x8A, 0x56, 0x53, 0x6B, 0x0C,
+    0x10, 0x6B, 0xA2, 0x78, 0xC0, 0x51, 0x6E, 0x6B, 0x6E, 0x14, 0x65, 0x14, 0x08, 0x75, 0x69, 0x00,
+    0x7E, 0x7D, 0x68, 0xA3, 0x87, 0x06, 0xA2, 0x86, 0x5D, 0xA4, 0x76, 0x21, 0xA2, 0x76, 0x2B, 0x5D,
+    0x32, 0x39, 0xA3, 0x78, 0x9F, 0x68, 0xA2, 0x79, 0x5E, 0x4A, 0xA1, 0x8A, 0xA2, 0x79, 0x31, 0x6B,
+    0x42, 0x67, 0x22, 0xA2, 0x89, 0x51, 0x56, 0x66, 0xA2, 0x89, 0x9D, 0x99, 0xA2, 0x88, 0x23, 0x1E,
+    0x23, 0x7E, 0xC0, 0xA2, 0x77, 0x3D, 0x22, 0x2F, 0x7E, 0x6D, 0x60, 0x39, 0x50, 0xA1, 0xA8, 0x7A,
+    0x79, 0x1F, 0x9C, 0xA9, 0x75, 0x76, 0x72, 0x62, 0x72, 0x7B, 0x77, 0x9B, 0xAA, 0x66, 0x0A, 0x62,
+    0x02, 0xA2, 0x89, 0x9C, 0x99, 0xC0, 0x67, 0xC1, 0x7F, 0x51, 0xC0, 0x06, 0x7E, 0x6F, 0x3F, 0xC0,
+    0xA4, 0x76, 0x50, 0xA3, 0x88, 0x6D, 0xA3, 0x77, 0x59, 0xA3, 0x87, 0x45, 0xA2, 0x67, 0x28, 0xFE,
+    0x85, 0xCA, 0x9F, 0xB9, 0x9C, 0xA8, 0x9F, 0xBA, 0x72, 0x9D, 0xBA, 0x9B, 0xBB, 0x73, 0x9D, 0xAB,
+    0x67, 0x06, 0xA0, 0x9A, 0x57, 0x57, 0x9D, 0x8A, 0x6B, 0x5A, 0xA2, 0x79, 0x6E, 0x05, 0x20, 0x5A,
+    0x25, 0x51, 0xC0, 0x25, 0x20, 0x7E, 0x1C, 0x9D, 0x98, 0x04, 0x07, 0x00, 0xA2, 0x97, 0x7D, 0x69,
+    0xA2, 0x86, 0x0E, 0x58, 0xA2, 0x76, 0xA5, 0x77, 0x6D, 0xA2, 0x66, 0x30, 0x4D, 0xA4, 0x77, 0x4D,
+    0xA2, 0x78, 0xA2, 0x68, 0x4A, 0x5E, 0x2C, 0x4A, 0x52, 0x5F, 0x6F, 0x67, 0x56, 0x66, 0x2A, 0xA2,
+    0x78, 0x52, 0x61, 0x6F, 0xC0, 0xA2, 0x88, 0xC0, 0x29, 0xA2, 0x87, 0x66, 0x59, 0xA2, 0x87, 0x23,
+    0x6D, 0xA2, 0x97, 0x65, 0xA2, 0x87, 0x9D, 0xA8, 0x2C, 0x60, 0x17, 0x61, 0xA1, 0xA8, 0x72, 0x03,
+    0x76, 0x9C, 0x99, 0x76, 0x9D, 0xAA, 0x72, 0xA1, 0x9A, 0x9C, 0x9A, 0x7B, 0x62, 0x6B, 0x3F, 0x13,
+    0x62, 0x10, 0x5A, 0x7B, 0x56, 0x55, 0x17, 0x00, 0x0D, 0xC0, 0x10, 0x55, 0x3F, 0x69, 0xA2, 0x87,
+    0xA3, 0x78, 0xA2, 0x86, 0x5E, 0xA2, 0x76, 0x24, 0x2B, 0x59, 0xA3, 0x77, 0x1F, 0x9C, 0xA9, 0xA0,
+    0xA8, 0x9C, 0xB9, 0x9D, 0xBA, 0x9D, 0xBB, 0x7B, 0x9A, 0xAA, 0x9D, 0xAB, 0xA1, 0x9B, 0x9D, 0x9A,
+    0x0F, 0x9D, 0x9A, 0x5B, 0x6B, 0xA1, 0x8A, 0x5A, 0x42, 0xC0, 0x20, 0xC0, 0x6F, 0x40, 0xA2, 0x88,
+    0x2C, 0x55, 0x66, 0x20, 0x65, 0xA2, 0x87, 0x9D, 0xA9, 0x69, 0x07, 0x7D, 0x01, 0x16, 0x64, 0x0D,
+    0x3F, 0xA3, 0x86, 0xA2, 0x77, 0xA3, 0x76, 0xA2, 0x77, 0xA3, 0x76, 0x45, 0xA3, 0x67, 0xA3, 0x77,
+    0x4A, 0xA2, 0x67, 0x5F, 0xA2, 0x77, 0xA3, 0x79, 0x41, 0x15, 0x6F, 0x2D, 0x5B, 0x56, 0x6B, 0x56,
+    0x56, 0x34, 0x20, 0x27, 0x34, 0x27, 0x2F, 0x51, 0x7E, 0x30, 0xC0, 0x7E, 0x54, 0xA2, 0x98, 0x69,
+    0x15, 0xA2, 0x88, 0x11, 0x75, 0x76, 0xA1, 0xA8, 0x62, 0x76, 0x9D, 0xA9, 0xA1, 0xA9, 0x9D, 0xA9,
+    0x9C, 0xAA, 0x77, 0x7A, 0x63, 0x9D, 0xAA, 0x67, 0x6B, 0x9C, 0x99, 0xA1, 0x9A, 0x56, 0x66, 0xA1,
+    0x9A, 0x55, 0x00, 0x7B, 0xC1, 0x51, 0xA3, 0x88, 0x0A, 0x55, 0x08, 0x01, 0x69, 0xA2, 0x87, 0x0C,
+    0x16, 0xA2, 0x86, 0x59, 0xA3, 0x77, 0x59, 0xA3, 0x87, 0x49, 0x2B, 0xA6, 0x06, 0xA1, 0xB8, 0x72,
+    0x9C, 0xA9, 0x9D, 0xBA, 0x77, 0x9C, 0xAA, 0x9C, 0xAB, 0x16, 0x3F, 0x67, 0x00, 0x9F, 0x9B, 0x6F,
+    0x9D, 0x8A, 0x57, 0x04, 0x5B, 0x6F, 0x6F, 0x55, 0xA2, 0x78, 0x1D, 0x55, 0xC0, 0x6B, 0x2C, 0x69,
+    0x20, 0x14, 0xA2, 0x87, 0x61, 0x04, 0x00, 0x79, 0x6D, 0x0A, 0x6D, 0xA2, 0x86, 0x0C, 0xA3, 0x77,
+    0x6C, 0x5D, 0x24, 0x26, 0xA2, 0x66, 0x2D, 0x2F, 0x3E, 0xA3, 0x78, 0x5F, 0x4A, 0x5A, 0x6F, 0x5F,
+    0x51, 0x5F, 0x56, 0x31, 0x56, 0x7F, 0x41, 0x30, 0x66, 0x30, 0xC0, 0x35, 0x38, 0xC0, 0x65, 0x6D,
+    0x66, 0x19, 0xA2, 0x97, 0x65, 0x65, 0x75, 0x17, 0x7A, 0x9D, 0xB9, 0x65, 0x76, 0xA0, 0xA9, 0x9D,
+    0xAA, 0x9D, 0xA9, 0x7B, 0x9D, 0xAA, 0x66, 0x73, 0x05, 0x7B, 0x67, 0x52, 0x67, 0x7F, 0x67, 0x55,
+    0x0A, 0x6F, 0xC0, 0x51, 0x7F, 0x02, 0x16, 0x36, 0x0A, 0x55, 0xC0, 0xA3, 0x87, 0x06, 0x0E, 0x55,
+    0x6D, 0xA2, 0x77, 0xA2, 0x86, 0xA3, 0x77, 0x59, 0xA2, 0x77, 0xA2, 0x77, 0x59, 0xAA, 0x04, 0x3E,
+    0x9D, 0xBA, 0x37, 0x1C, 0x9D, 0xBB, 0x7B, 0x0D, 0x9F, 0xAB, 0x3F, 0xA0, 0x8A, 0x67, 0xA0, 0x8A,
+    0x52, 0x00, 0x6F, 0xA1, 0x8A, 0x56, 0x5A, 0x56, 0xA3, 0x88, 0x56, 0xC0, 0x22, 0x1D, 0xC0, 0x18,
+    0x1D, 0x25, 0x9D, 0xA9, 0xA3, 0x87, 0x9D, 0xA9, 0xA2, 0x87, 0x65, 0x7D, 0x09, 0x6D, 0x3B, 0x06,
+    0x3F, 0x3D, 0xA5, 0x76, 0x6D, 0x12, 0xA3, 0x77, 0xA3, 0x77, 0x37, 0xA2, 0x77, 0x39, 0xA2, 0x78,
+    0x5E, 0x46, 0x6E, 0xA3, 0x79, 0x5E, 0x56, 0x29, 0x5B, 0x51, 0x2D, 0x41, 0x7F, 0x56, 0x6E, 0x2C,
+    0x22, 0x1D, 0xC0, 0xA3, 0x98, 0x1E, 0xA2, 0x98, 0xC0, 0x60, 0xC0, 0x20, 0x75, 0x06, 0x76, 0x65,
+    0x3E, 0x7B, 0x32, 0x9D, 0xAA, 0x76, 0x2B, 0x24, 0x67, 0x9C, 0x9A, 0xA0, 0xA9, 0x67, 0x3D, 0x13,
+    0x52, 0x67, 0x03, 0x3B, 0x36, 0x07, 0x62, 0x09, 0x6F, 0x69, 0xC0, 0x3A, 0xC0, 0x02, 0xC0, 0x3B,
+    0xA3, 0x88, 0x7D, 0xC0, 0x69, 0x54, 0xA2, 0x77, 0xA3, 0x87, 0x0F, 0xA3, 0x87, 0x59, 0xA2, 0x76,
+    0xA2, 0x67, 0xA9, 0x25, 0x9D, 0xAA, 0x9F, 0xB9, 0x9D, 0xAA, 0x2E, 0x17, 0x73, 0x9C, 0x9A, 0x9F,
+    0xAB, 0x13, 0x9C, 0x8A, 0x36, 0x09, 0x3C, 0x5B, 0x18, 0x1F, 0x41, 0x6F, 0x56, 0x5A, 0xA3, 0x88,
+    0x66, 0x56, 0x22, 0xC0, 0x1D, 0x7E, 0x51, 0x14, 0x08, 0x0B, 0x6D, 0x00, 0x0D, 0x7E, 0x3A, 0xA3,
+    0x97, 0x7D, 0x0E, 0xA2, 0x76, 0x59, 0xA4, 0x76, 0x54, 0x24, 0x5E, 0x21, 0xA2, 0x67, 0x2F, 0xA3,
+    0x88, 0xA2, 0x67, 0x04, 0xA2, 0x77, 0x5F, 0x55, 0x5B, 0xA2, 0x78, 0x56, 0x6E, 0x6F, 0x66, 0xC0,
+    0x5B, 0x2D, 0xC0, 0x6E, 0xC0, 0x2D, 0x21, 0x1A, 0x1D, 0x7F, 0x64, 0x62, 0x7A, 0x75, 0x7F, 0x9C,
+    0xA8, 0x3E, 0x62, 0x01, 0x72, 0x30, 0x9D, 0xA9, 0x63, 0x62, 0x63, 0x7F, 0x9D, 0xAA, 0xA1, 0x8A,
+    0x3F, 0x06, 0x67, 0x3B, 0xA2, 0x88, 0x6B, 0x51, 0x6F, 0x6B, 0xC0, 0x51, 0x7F, 0x01, 0x7E, 0x66,
+    0x0E, 0x02, 0x0F, 0xC0, 0x64, 0xA2, 0x78, 0x7D, 0x59, 0x6D, 0x6D, 0xA4, 0x87, 0x5D, 0x6E, 0xA3,
+    0x76, 0x30,
+};
+
+const size_t st7789_bench_photo_size = sizeof(st7789_bench_photo);
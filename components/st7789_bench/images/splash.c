@@ -0,0 +1,129 @@
+// Generated by tools/st7789_img_encode.py from splash.png. Do not edit.
+
+#include <stddef.h>
+#include <stdint.h>
+
+const uint8_t st7789_bench_splash[] = {
+    0x53, 0x37, 0x51, 0x31, 0xF0, 0x00, 0xF0, 0x00, 0xA5, 0x7D, 0xE2, 0xAE, 0x7A, 0xE8, 0x4E, 0x6B,
+    0xEF, 0xFF, 0xE6, 0x3E, 0x7A, 0xED, 0x26, 0xA3, 0x98, 0xB2, 0x76, 0xAE, 0x87, 0xA7, 0x88, 0xAE,
+    0x86, 0xE0, 0x76, 0x1F, 0x1E, 0x19, 0x36, 0x1A, 0xE0, 0x2C, 0xA7, 0x88, 0x1E, 0x1D, 0xE0, 0x7E,
+    0x1E, 0x1B, 0x1A, 0xE0, 0x28, 0x36, 0xBC, 0x76, 0x1D, 0xE0, 0x82, 0x3D, 0x36, 0x1A, 0xE0, 0x25,
+    0xAA, 0x87, 0x83, 0x85, 0x1D, 0xE0, 0x84, 0x3B, 0x37, 0x1A, 0xE0, 0x23, 0x37, 0x8A, 0x74, 0x1D,
+    0xE0, 0x86, 0x3C, 0x37, 0x1A, 0xE0, 0x21, 0x37, 0x3C, 0x1D, 0xE0, 0x88, 0x3C, 0x37, 0x1A, 0xE0,
+    0x1F, 0x36, 0x3B, 0x1D, 0xE0, 0x8A, 0x3B, 0x36, 0x1A, 0xE0, 0x1E, 0x3D, 0x1D, 0xE0, 0x8C, 0x3D,
+    0x1A, 0xE0, 0x1D, 0x1B, 0x1D, 0xE0, 0x8E, 0x1B, 0x1A, 0xE0, 0x1C, 0x1E, 0x1D, 0xE0, 0x8E, 0x1E,
+    0x1A, 0xE0, 0x1B, 0xA3, 0x99, 0x1D, 0xE0, 0x90, 0x3D, 0x1A, 0xE0, 0x1A, 0xB5, 0x87, 0x1D, 0xE0,
+    0x90, 0x20, 0x1A, 0xE0, 0x1A, 0x1E, 0x1D, 0xE0, 0x90, 0x1E, 0x1A, 0xE0, 0x1A, 0x1F, 0x1D, 0xE0,
+    0x90, 0x1F, 0x1A, 0xE0, 0x1A, 0x1D, 0xE0, 0x92, 0x1A, 0xE0, 0x1A, 0x1D, 0xE0, 0x92, 0x1A, 0xE0,
+    0x1A, 0x1D, 0xE0, 0x92, 0x1A, 0xE0, 0x1A, 0x1D, 0xE0, 0x92, 0x1A, 0xDC, 0x7A, 0xDC, 0x98, 0x62,
+    0xE0, 0x92, 0xA8, 0xAE, 0xE0, 0x1A, 0x98, 0x62, 0xE0, 0x92, 0xA8, 0xAE, 0xE0, 0x1A, 0x98, 0x62,
+    0xE0, 0x30, 0x9D, 0xA9, 0x99, 0xB7, 0x97, 0xD7, 0x98, 0xC7, 0x50, 0x99, 0xC7, 0x9D, 0xA9, 0xC2,
+    0x3B, 0x01, 0x1C, 0x27, 0x3E, 0x07, 0x1D, 0xE0, 0x30, 0xA8, 0xAE, 0xE0, 0x1A, 0x98, 0x62, 0xE0,
+    0x2D, 0x9B, 0xB8, 0x94, 0xD6, 0x91, 0xF7, 0x25, 0xCE, 0x2B, 0x38, 0x2F, 0x1D, 0xE0, 0x2D, 0xA8,
+    0xAE, 0xE0, 0x1A, 0x98, 0x62, 0xE0, 0x2B, 0x3E, 0x1C, 0x25, 0xD4, 0x1C, 0x3E, 0x1D, 0xE0, 0x2B,
+    0xA8, 0xAE, 0xE0, 0x1A, 0x98, 0x62, 0xE0, 0x29, 0x3E, 0x01, 0x25, 0xD8, 0x01, 0x3E, 0x1D, 0xE0,
+    0x29, 0xA8, 0xAE, 0xE0, 0x1A, 0x98, 0x62, 0xE0, 0x27, 0x2F, 0x1C, 0x25, 0xDC, 0x1C, 0x2F, 0x1D,
+    0xE0, 0x27, 0xA8, 0xAE, 0xE0, 0x1A, 0x98, 0x62, 0xE0, 0x26, 0x91, 0xF7, 0x3B, 0x25, 0xDE, 0x3B,
+    0x10, 0x1D, 0xE0, 0x26, 0xA8, 0xAE, 0xDC, 0x6B, 0xDC, 0x98, 0x61, 0xE0, 0x25, 0xFE, 0xEC, 0xAE,
+    0x25, 0xE0, 0x02, 0x32, 0x1D, 0xE0, 0x25, 0x24, 0xE0, 0x1A, 0x1D, 0xE0, 0x23, 0x07, 0x2B, 0x25,
+    0xE0, 0x04, 0x2B, 0x07, 0x1D, 0xE0, 0x23, 0x24, 0xE0, 0x1A, 0x1D, 0xE0, 0x22, 0x07, 0x2B, 0x25,
+    0xE0, 0x06, 0x2B, 0x07, 0x1D, 0xE0, 0x22, 0x24, 0xE0, 0x1A, 0x1D, 0xE0, 0x21, 0x07, 0x2B, 0x25,
+    0xE0, 0x08, 0x2B, 0x07, 0x1D, 0xE0, 0x21, 0x24, 0xE0, 0x1A, 0x1D, 0xE0, 0x21, 0x2B, 0x25, 0xE0,
+    0x0A, 0x2B, 0x1D, 0xE0, 0x21, 0x24, 0xE0, 0x1A, 0x1D, 0xE0, 0x20, 0x32, 0x25, 0xE0, 0x0C, 0x32,
+    0x1D, 0xE0, 0x20, 0x24, 0xE0, 0x1A, 0x1D, 0xE0, 0x1F, 0x10, 0x25, 0xE0, 0x0E, 0x10, 0x1D, 0xE0,
+    0x1F, 0x24, 0xE0, 0x1A, 0x1D, 0xE0, 0x1E, 0x2F, 0x3B, 0x25, 0xE0, 0x0E, 0x3B, 0x2F, 0x1D, 0xE0,
+    0x1E, 0x24, 0xE0, 0x1A, 0x1D, 0xE0, 0x1E, 0x1C, 0x25, 0xE0, 0x10, 0x1C, 0x1D, 0xE0, 0x1E, 0x24,
+    0xE0, 0x1A, 0x1D, 0xE0, 0x1D, 0x3E, 0x25, 0xE0, 0x12, 0x3E, 0x1D, 0xE0, 0x1D, 0x24, 0xE0, 0x1A,
+    0x1D, 0xE0, 0x1D, 0x01, 0x25, 0xD3, 0x01, 0x38, 0x3E, 0x07, 0x1D, 0xC0, 0x07, 0x3E, 0x38, 0x01,
+    0x25, 0xD3, 0x01, 0x1D, 0xE0, 0x1D, 0x24, 0xE0, 0x1A, 0x1D, 0xE0, 0x1C, 0x3E, 0x25, 0xD2, 0x32,
+    0x2F, 0x1D, 0xC8, 0x2F, 0x32, 0x25, 0xD2, 0x3E, 0x1D, 0xE0, 0x1C, 0x24, 0xE0, 0x1A, 0x1D, 0xE0,
+    0x1C, 0x1C, 0x25, 0xD0, 0x2B, 0xFE, 0xEE, 0xBA, 0x1D, 0xCC, 0x16, 0x2B, 0x25, 0xD0, 0x1C, 0x1D,
+    0xE0, 0x1C, 0x24, 0xE0, 0x1A, 0x1D, 0xE0, 0x1B, 0x2F, 0x25, 0xD0, 0x1C, 0x07, 0x1D, 0xCE, 0x07,
+    0x1C, 0x25, 0xD0, 0x2F, 0x1D, 0xE0, 0x1B, 0x24, 0xE0, 0x1A, 0x1D, 0xE0, 0x1B, 0x38, 0x25, 0xCF,
+    0x1C, 0x1D, 0xD2, 0x1C, 0x25, 0xCF, 0x38, 0x1D, 0xE0, 0x1B, 0x24, 0xE0, 0x1A, 0x1D, 0xE0, 0x1B,
+    0x2B, 0x25, 0xCE, 0x2B, 0x07, 0x1D, 0xD2, 0x07, 0x2B, 0x25, 0xCE, 0x2B, 0x1D, 0xE0, 0x1B, 0x24,
+    0xE0, 0x1A, 0x1D, 0xE0, 0x1A, 0x07, 0x25, 0xCF, 0x16, 0x1D, 0xD4, 0x16, 0x25, 0xCF, 0x07, 0x1D,
+    0xE0, 0x1A, 0x24, 0xE0, 0x1A, 0x1D, 0xE0, 0x1A, 0x3E, 0x25, 0xCE, 0x32, 0x1D, 0xD6, 0x32, 0x25,
+    0xCE, 0x3E, 0x1D, 0xE0, 0x1A, 0x24, 0xE0, 0x1A, 0x1D, 0xE0, 0x1A, 0x27, 0x25, 0xCE, 0x2F, 0x1D,
+    0xD6, 0x2F, 0x25, 0xCE, 0x27, 0x1D, 0xE0, 0x1A, 0x24, 0xE0, 0x1A, 0x1D, 0xE0, 0x1A, 0x1C, 0x25,
+    0xCD, 0x01, 0x1D, 0xD8, 0x01, 0x25, 0xCD, 0x1C, 0x1D, 0xE0, 0x1A, 0x24, 0xE0, 0x1A, 0x1D, 0xE0,
+    0x1A, 0x01, 0x25, 0xCD, 0x38, 0x1D, 0xD8, 0x38, 0x25, 0xCD, 0x01, 0x1D, 0xE0, 0x1A, 0x24, 0xE0,
+    0x1A, 0x1D, 0xE0, 0x1A, 0x3B, 0x25, 0xCD, 0x3E, 0x1D, 0xD8, 0x3E, 0x25, 0xCD, 0x3B, 0x1D, 0xE0,
+    0x1A, 0x24, 0xE0, 0x1A, 0x1D, 0xE0, 0x1A, 0x25, 0xCE, 0x07, 0x1D, 0xD8, 0x07, 0x25, 0xCE, 0x1D,
+    0xE0, 0x1A, 0x24, 0xE0, 0x1A, 0x1D, 0xE0, 0x1A, 0x25, 0xCE, 0x1D, 0xDA, 0x25, 0xCE, 0x1D, 0xE0,
+    0x1A, 0x24, 0xE0, 0x1A, 0x1D, 0xE0, 0x1A, 0x25, 0xCE, 0x1D, 0xDA, 0x25, 0xCE, 0x1D, 0xE0, 0x1A,
+    0x24, 0xE0, 0x1A, 0x1D, 0xE0, 0x1A, 0x25, 0xCE, 0x07, 0x1D, 0xD8, 0x07, 0x25, 0xCE, 0x1D, 0xE0,
+    0x1A, 0x24, 0xE0, 0x1A, 0x1D, 0xE0, 0x1A, 0x3B, 0x25, 0xCD, 0x3E, 0x1D, 0xD8, 0x3E, 0x25, 0xCD,
+    0x3B, 0x1D, 0xE0, 0x1A, 0x24, 0xE0, 0x1A, 0x1D, 0xE0, 0x1A, 0x01, 0x25, 0xCD, 0x38, 0x1D, 0xD8,
+    0x38, 0x25, 0xCD, 0x01, 0x1D, 0xE0, 0x1A, 0x24, 0xE0, 0x1A, 0x1D, 0xE0, 0x1A, 0x1C, 0x25, 0xCD,
+    0x01, 0x1D, 0xD8, 0x01, 0x25, 0xCD, 0x1C, 0x1D, 0xE0, 0x1A, 0x24, 0xE0, 0x1A, 0x1D, 0xE0, 0x1A,
+    0x27, 0x25, 0xCE, 0x2F, 0x1D, 0xD6, 0x2F, 0x25, 0xCE, 0x27, 0x1D, 0xE0, 0x1A, 0x24, 0xDC, 0x7A,
+    0xDC, 0x1D, 0xE0, 0x1A, 0x3E, 0x25, 0xCE, 0x32, 0x1D, 0xD6, 0x32, 0x25, 0xCE, 0x3E, 0x1D, 0xE0,
+    0x1A, 0x27, 0xE0, 0x1A, 0x1D, 0xE0, 0x1A, 0x07, 0x25, 0xCF, 0x16, 0x1D, 0xD4, 0x16, 0x25, 0xCF,
+    0x07, 0x1D, 0xE0, 0x1A, 0x27, 0xE0, 0x1A, 0x1D, 0xE0, 0x1B, 0x2B, 0x25, 0xCE, 0x2B, 0x07, 0x1D,
+    0xD2, 0x07, 0x2B, 0x25, 0xCE, 0x2B, 0x1D, 0xE0, 0x1B, 0x27, 0xE0, 0x1A, 0x1D, 0xE0, 0x1B, 0x38,
+    0x25, 0xCF, 0x1C, 0x1D, 0xD2, 0x1C, 0x25, 0xCF, 0x38, 0x1D, 0xE0, 0x1B, 0x27, 0xE0, 0x1A, 0x1D,
+    0xE0, 0x1B, 0x2F, 0x25, 0xD0, 0x1C, 0x07, 0x1D, 0xCE, 0x07, 0x1C, 0x25, 0xD0, 0x2F, 0x1D, 0xE0,
+    0x1B, 0x27, 0xE0, 0x1A, 0x1D, 0xE0, 0x1C, 0x1C, 0x25, 0xD0, 0x2B, 0x16, 0x1D, 0xCC, 0x16, 0x2B,
+    0x25, 0xD0, 0x1C, 0x1D, 0xE0, 0x1C, 0x27, 0xE0, 0x1A, 0x1D, 0xE0, 0x1C, 0x3E, 0x25, 0xD2, 0x32,
+    0x2F, 0x1D, 0xC8, 0x2F, 0x32, 0x25, 0xD2, 0x3E, 0x1D, 0xE0, 0x1C, 0x27, 0xE0, 0x1A, 0x1D, 0xE0,
+    0x1D, 0x01, 0x25, 0xD3, 0x01, 0x38, 0x3E, 0x07, 0x1D, 0xC0, 0x07, 0x3E, 0x38, 0x01, 0x25, 0xD3,
+    0x01, 0x1D, 0xE0, 0x1D, 0x27, 0xE0, 0x1A, 0x1D, 0xE0, 0x1D, 0x3E, 0x25, 0xE0, 0x12, 0x3E, 0x1D,
+    0xE0, 0x1D, 0x27, 0xE0, 0x1A, 0x1D, 0xE0, 0x1E, 0x1C, 0x25, 0xE0, 0x10, 0x1C, 0x1D, 0xE0, 0x1E,
+    0x27, 0xE0, 0x1A, 0x1D, 0xE0, 0x1E, 0x2F, 0x3B, 0x25, 0xE0, 0x0E, 0x3B, 0x2F, 0x1D, 0xE0, 0x1E,
+    0x27, 0xE0, 0x1A, 0x1D, 0xE0, 0x1F, 0x10, 0x25, 0xE0, 0x0E, 0x10, 0x1D, 0xE0, 0x1F, 0x27, 0xE0,
+    0x1A, 0x1D, 0xE0, 0x20, 0x32, 0x25, 0xE0, 0x0C, 0x32, 0x1D, 0xE0, 0x20, 0x27, 0xE0, 0x1A, 0x1D,
+    0xE0, 0x21, 0x2B, 0x25, 0xE0, 0x0A, 0x2B, 0x1D, 0xE0, 0x21, 0x27, 0xE0, 0x1A, 0x1D, 0xE0, 0x21,
+    0x07, 0x2B, 0x25, 0xE0, 0x08, 0x2B, 0x07, 0x1D, 0xE0, 0x21, 0x27, 0xE0, 0x1A, 0x1D, 0xE0, 0x22,
+    0x07, 0x2B, 0x25, 0xE0, 0x06, 0x2B, 0x07, 0x1D, 0xE0, 0x22, 0x27, 0xE0, 0x1A, 0x1D, 0xE0, 0x23,
+    0x07, 0x2B, 0x25, 0xE0, 0x04, 0x2B, 0x07, 0x1D, 0xE0, 0x23, 0x27, 0xE0, 0x1A, 0x1D, 0xE0, 0x25,
+    0x32, 0x25, 0xE0, 0x02, 0x32, 0x1D, 0xE0, 0x25, 0x27, 0xE0, 0x1A, 0x1D, 0xE0, 0x26, 0x10, 0x3B,
+    0x25, 0xDE, 0x3B, 0x10, 0x1D, 0xE0, 0x26, 0x27, 0xE0, 0x1A, 0x1D, 0xE0, 0x27, 0x2F, 0x1C, 0x25,
+    0xDC, 0x1C, 0x2F, 0x1D, 0xE0, 0x27, 0x27, 0xE0, 0x1A, 0x1D, 0xE0, 0x29, 0x3E, 0x01, 0x25, 0xD8,
+    0x01, 0x3E, 0x1D, 0xE0, 0x29, 0x27, 0xE0, 0x1A, 0x1D, 0xE0, 0x2B, 0x3E, 0x1C, 0x25, 0xD4, 0x1C,
+    0x3E, 0x1D, 0xE0, 0x2B, 0x27, 0xE0, 0x1A, 0x1D, 0xE0, 0x2D, 0x2F, 0x38, 0x2B, 0x25, 0xCE, 0x2B,
+    0x38, 0x2F, 0x1D, 0xE0, 0x2D, 0x27, 0xE0, 0x1A, 0x1D, 0xE0, 0x30, 0x07, 0x3E, 0x97, 0xD7, 0x1C,
+    0x01, 0x3B, 0x25, 0xC2, 0x3B, 0x01, 0x1C, 0x27, 0x3E, 0x07, 0x1D, 0xE0, 0x30, 0xA8, 0xBF, 0xE0,
+    0x1A, 0x1D, 0xE0, 0x92, 0x27, 0xE0, 0x1A, 0x1D, 0xE0, 0x92, 0x27, 0xE0, 0x1A, 0x1D, 0xE0, 0x92,
+    0x27, 0xE0, 0x1A, 0x1D, 0xE0, 0x92, 0x27, 0xE0, 0x1A, 0x1D, 0xE0, 0x92, 0x27, 0xE0, 0x1A, 0x1D,
+    0xE0, 0x92, 0x27, 0xE0, 0x1A, 0x1D, 0xE0, 0x92, 0x27, 0xE0, 0x1A, 0x1D, 0xE0, 0x92, 0x27, 0xE0,
+    0x1A, 0x1D, 0xE0, 0x92, 0x27, 0xDC, 0x7A, 0xDC, 0x1D, 0xE0, 0x92, 0x2A, 0xE0, 0x1A, 0x1D, 0xE0,
+    0x92, 0x2A, 0xE0, 0x1A, 0x1D, 0xE0, 0x92, 0x2A, 0xE0, 0x1A, 0x1D, 0xE0, 0x92, 0x2A, 0xE0, 0x1A,
+    0x1D, 0xE0, 0x92, 0x2A, 0xE0, 0x1A, 0x1D, 0xE0, 0x92, 0x2A, 0xE0, 0x1A, 0x1D, 0xDC, 0xB2, 0x8A,
+    0xE0, 0x56, 0x1D, 0xDC, 0x2A, 0xE0, 0x1A, 0x1D, 0xDC, 0x1F, 0xE0, 0x56, 0x1D, 0xDC, 0x2A, 0xE0,
+    0x1A, 0x1D, 0xDC, 0x1F, 0xE0, 0x56, 0x1D, 0xDC, 0x2A, 0xDC, 0x6B, 0xDC, 0x1D, 0xDC, 0x1F, 0xE0,
+    0x56, 0x1D, 0xDC, 0x31, 0xE0, 0x1A, 0x1D, 0xDC, 0x1F, 0xE0, 0x56, 0x1D, 0xDC, 0x31, 0xE0, 0x1A,
+    0x1D, 0xDC, 0x1F, 0xE0, 0x56, 0x1D, 0xDC, 0x31, 0xE0, 0x1A, 0x1D, 0xE0, 0x92, 0x31, 0xE0, 0x1A,
+    0x1D, 0xE0, 0x92, 0x31, 0xE0, 0x1A, 0x1D, 0xE0, 0x92, 0x31, 0xE0, 0x1A, 0x1D, 0xE0, 0x92, 0x31,
+    0xE0, 0x1A, 0x1D, 0xE0, 0x92, 0x31, 0xE0, 0x1A, 0x1D, 0xE0, 0x92, 0x31, 0xE0, 0x1A, 0x1D, 0xE0,
+    0x92, 0x31, 0xE0, 0x1A, 0x1D, 0xE0, 0x92, 0x31, 0xE0, 0x1A, 0x1D, 0xE0, 0x10, 0x86, 0x89, 0xE0,
+    0x2E, 0x1D, 0xE0, 0x10, 0x31, 0xE0, 0x1A, 0x1D, 0xE0, 0x10, 0x20, 0xE0, 0x2E, 0x1D, 0xE0, 0x10,
+    0x31, 0xE0, 0x1A, 0x1D, 0xE0, 0x10, 0x20, 0xE0, 0x2E, 0x1D, 0xE0, 0x10, 0x31, 0xE0, 0x1A, 0x1D,
+    0xE0, 0x10, 0x20, 0xE0, 0x2E, 0x1D, 0xE0, 0x10, 0x31, 0xE0, 0x1A, 0x1D, 0xE0, 0x10, 0x20, 0xE0,
+    0x2E, 0x1D, 0xE0, 0x10, 0x31, 0xE0, 0x1A, 0x1D, 0xE0, 0x10, 0x20, 0xE0, 0x2E, 0x1D, 0xE0, 0x10,
+    0x31, 0xE0, 0x1A, 0x1D, 0xE0, 0x92, 0x31, 0xE0, 0x1A, 0x1D, 0xE0, 0x92, 0x31, 0xE0, 0x1A, 0x1D,
+    0xE0, 0x92, 0x31, 0xE0, 0x1A, 0x1D, 0xE0, 0x92, 0x31, 0xE0, 0x1A, 0x1D, 0xE0, 0x92, 0x31, 0xE0,
+    0x1A, 0x1D, 0xE0, 0x92, 0x31, 0xE0, 0x1A, 0x1D, 0xE0, 0x92, 0x31, 0xDC, 0x7A, 0xDC, 0x1D, 0xE0,
+    0x92, 0x34, 0xE0, 0x1A, 0x1D, 0xE0, 0x92, 0x34, 0xE0, 0x1A, 0x1D, 0xE0, 0x92, 0x34, 0xE0, 0x1A,
+    0x1D, 0xE0, 0x92, 0x34, 0xE0, 0x1A, 0x8A, 0x42, 0x1D, 0xE0, 0x90, 0x22, 0x34, 0xE0, 0x1A, 0x83,
+    0x54, 0x1D, 0xE0, 0x90, 0x28, 0x34, 0xE0, 0x1A, 0xB5, 0x66, 0x1D, 0xE0, 0x90, 0x2D, 0x34, 0xE0,
+    0x1A, 0xA3, 0x88, 0x1D, 0xE0, 0x90, 0x0D, 0x34, 0xE0, 0x1B, 0x28, 0x1D, 0xE0, 0x8E, 0x28, 0x34,
+    0xE0, 0x1C, 0xA7, 0x88, 0x1D, 0xE0, 0x8E, 0x35, 0x34, 0xE0, 0x1D, 0xBF, 0x65, 0x1D, 0xE0, 0x8C,
+    0x0A, 0x34, 0xE0, 0x1E, 0x0D, 0x8A, 0x53, 0x1D, 0xE0, 0x8A, 0x05, 0x0D, 0x34, 0xE0, 0x1F, 0xAA,
+    0x77, 0x3C, 0x1D, 0xE0, 0x88, 0x3C, 0x0E, 0x34, 0xE0, 0x21, 0x0E, 0x3C, 0x1D, 0xE0, 0x86, 0x3C,
+    0x0E, 0x34, 0xE0, 0x23, 0x0E, 0x05, 0x1D, 0xE0, 0x84, 0x05, 0x0E, 0x34, 0xE0, 0x25, 0x0D, 0x0A,
+    0x1D, 0xE0, 0x82, 0x0A, 0x0D, 0x34, 0xE0, 0x28, 0x35, 0x28, 0x1D, 0xE0, 0x7E, 0x28, 0x35, 0x34,
+    0xE0, 0x2C, 0xA3, 0x98, 0xB2, 0x66, 0x28, 0x22, 0x1D, 0xE0, 0x76, 0x22, 0x28, 0x30, 0x10, 0x34,
+    0xED, 0x26, 0x7A, 0xE5, 0xB2, 0xAF, 0x13, 0xB3, 0x00, 0xAA, 0x45, 0xE0, 0x30, 0x97, 0xCB, 0x8E,
+    0xEF, 0x94, 0xDD, 0xE0, 0x0E, 0x76, 0x9D, 0xBA, 0x37, 0xE0, 0x45, 0xFE, 0x44, 0x4D, 0x3C, 0xE0,
+    0x34, 0x92, 0xDD, 0x07, 0xE0, 0x0F, 0x72, 0x37, 0xE0, 0x11, 0x6B, 0xE0, 0x10, 0x10, 0x3C, 0xE0,
+    0x36, 0x0D, 0x07, 0xE0, 0x0F, 0x39, 0x3E, 0xE0, 0x42, 0xFE, 0x4C, 0xED, 0x3C, 0xE0, 0x36, 0x97,
+    0xCB, 0x07, 0xE0, 0x0F, 0x05, 0x9C, 0xCB, 0xE0, 0x42, 0x3C, 0xE0, 0x38, 0x07, 0xE0, 0x10, 0x3E,
+    0xE0, 0x42, 0x3C, 0xE0, 0x38, 0x07, 0xE0, 0x10, 0x3E, 0xE0, 0x42, 0x39, 0x3C, 0xE0, 0x36, 0x97,
+    0xCB, 0x07, 0xE0, 0x0F, 0x05, 0x9C, 0xCB, 0xE0, 0x42, 0x10, 0x3C, 0xE0, 0x36, 0x0D, 0x07, 0xE0,
+    0x0F, 0x9C, 0xCA, 0x3E, 0xE0, 0x43, 0x1D, 0x3C, 0xE0, 0x34, 0x22, 0x07, 0xE0, 0x0F, 0x00, 0x3E,
+    0xE0, 0x45, 0x10, 0xB3, 0x00, 0x3C, 0xE0, 0x30, 0x97, 0xCB, 0x0D, 0x07, 0xE0, 0x0E, 0x05, 0x9D,
+    0xBA, 0x77, 0xEF, 0xFF, 0xC2, 0x7A, 0xE2, 0xAE,
+};
+
+const size_t st7789_bench_splash_size = sizeof(st7789_bench_splash);
@@ -0,0 +1,536 @@
+#include "st7789_bench.h"
+#include "st7789.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "ST7789_BENCH";
+
+// Panel geometry (the driver targets 240x240 panels only)
+#define PANEL_WIDTH   240
+#define PANEL_HEIGHT  240
+#define SCREEN_PIXELS ((uint64_t)PANEL_WIDTH * PANEL_HEIGHT)
+#define BLIT_SMALL 64
+
+/**
+ * @brief One benchmark case
+ *
+ * run() performs reps repetitions of the workload, adds the pixels it drew
+ * to *pixels and returns the number of driver calls made. It returns 0 if
+ * the case could not run (for example, out of memory).
+ */
+typedef struct {
+    const char *name;
+    uint32_t reps;
+    uint32_t (*run)(uint32_t reps, uint64_t *pixels);
+} bench_case_t;
+
+// Deterministic color sequence so every run sends the same bytes
+static uint16_t bench_color(uint32_t i) {
+    return (uint16_t)(i * 0x9E37u + 0x1234u);
+}
+
+static uint32_t run_fill_full(uint32_t reps, uint64_t *pixels) {
+    for (uint32_t i = 0; i < reps; i++) {
+        st7789_fill_rect(0, 0, PANEL_WIDTH, PANEL_HEIGHT, bench_color(i));
+    }
+    *pixels += reps * SCREEN_PIXELS;
+    return reps;
+}
+
+static uint32_t run_fill_large(uint32_t reps, uint64_t *pixels) {
+    for (uint32_t i = 0; i < reps; i++) {
+        st7789_fill_rect((i & 1) * 120, ((i >> 1) & 1) * 120, 120, 120, bench_color(i));
+    }
+    *pixels += (uint64_t)reps * 120 * 120;
+    return reps;
+}
+
+static uint32_t run_fill_small(uint32_t reps, uint64_t *pixels) {
+    uint32_t calls = 0;
+    for (uint32_t i = 0; i < reps; i++) {
+        for (uint16_t y = 0; y < PANEL_HEIGHT; y += 8) {
+            st7789_fill_rect((calls * 8) % PANEL_WIDTH, y, 8, 8, bench_color(calls));
+            calls++;
+        }
+    }
+    *pixels += (uint64_t)calls * 8 * 8;
+    return calls;
+}
+
+static uint32_t run_pixel(uint32_t reps, uint64_t *pixels) {
+    uint32_t calls = 0;
+    for (uint32_t i = 0; i < reps; i++) {
+        for (uint16_t x = 0; x < PANEL_WIDTH; x++) {
+            // A diagonal and its mirror, so consecutive pixels never share a row
+            st7789_draw_pixel(x, (x + i) % PANEL_HEIGHT, bench_color(calls));
+            st7789_draw_pixel(x, (PANEL_HEIGHT - 1 - x + i) % PANEL_HEIGHT, bench_color(calls + 1));
+            calls += 2;
+        }
+    }
+    *pixels += calls;
+    return calls;
+}
+
+static uint32_t run_char8(uint32_t reps, uint64_t *pixels) {
+    uint32_t calls = 0;
+    for (uint32_t i = 0; i < reps; i++) {
+        for (uint16_t x = 0; x + 8 <= PANEL_WIDTH; x += 8) {
+            st7789_draw_char(x, (i * 8) % PANEL_HEIGHT, 'A' + calls % 26,
+                             ST7789_WHITE, ST7789_BLACK);
+            calls++;
+        }
+    }
+    *pixels += (uint64_t)calls * 8 * 8;
+    return calls;
+}
+
+static uint32_t run_char16(uint32_t reps, uint64_t *pixels) {
+    static const char chars[] = "0123456789.C%";
+    uint32_t calls = 0;
+    for (uint32_t i = 0; i < reps; i++) {
+        for (uint16_t x = 0; x + 16 <= PANEL_WIDTH; x += 16) {
+            st7789_draw_large_char(x, (i * 16) % PANEL_HEIGHT, chars[calls % (sizeof(chars) - 1)],
+                                   ST7789_WHITE, ST7789_BLACK);
+            calls++;
+        }
+    }
+    *pixels += (uint64_t)calls * 16 * 16;
+    return calls;
+}
+
+static uint32_t run_string8(uint32_t reps, uint64_t *pixels) {
+    static const char line[] = "THE QUICK BROWN FOX JUMPS OVER";   // 30 cells, one panel row
+    for (uint32_t i = 0; i < reps; i++) {
+        st7789_draw_string(0, (i * 8) % PANEL_HEIGHT, line, ST7789_GREEN, ST7789_BLACK);
+    }
+    *pixels += (uint64_t)reps * (sizeof(line) - 1) * 8 * 8;
+    return reps;
+}
+
+static uint32_t run_string16(uint32_t reps, uint64_t *pixels) {
+    static const char line[] = "22.1C 45.0% 1013";   // 16 cells, with spacing
+    for (uint32_t i = 0; i < reps; i++) {
+        st7789_draw_large_string(0, (i * 16) % PANEL_HEIGHT, line, ST7789_YELLOW, ST7789_BLACK);
+    }
+    *pixels += (uint64_t)reps * (sizeof(line) - 1) * 16 * 16;
+    return reps;
+}
+
+// The char16 workload through the scaled 8x8 font, one character per call
+static uint32_t run_char8x2(uint32_t reps, uint64_t *pixels) {
+    static const char chars[] = "0123456789.C%";
+    uint32_t calls = 0;
+    for (uint32_t i = 0; i < reps; i++) {
+        for (uint16_t x = 0; x + 16 <= PANEL_WIDTH; x += 16) {
+            char str[2] = { chars[calls % (sizeof(chars) - 1)], '\0' };
+            st7789_draw_string_scaled(x, (i * 16) % PANEL_HEIGHT, str, 2, ST7789_WHITE, ST7789_BLACK);
+            calls++;
+        }
+    }
+    *pixels += (uint64_t)calls * 16 * 16;
+    return calls;
+}
+
+// The string16 workload through the scaled 8x8 font: same cells, same pitch
+static uint32_t run_string8x2(uint32_t reps, uint64_t *pixels) {
+    static const char line[] = "22.1C 45.0% 1013";
+    for (uint32_t i = 0; i < reps; i++) {
+        st7789_draw_string_scaled(0, (i * 16) % PANEL_HEIGHT, line, 2, ST7789_YELLOW, ST7789_BLACK);
+    }
+    *pixels += (uint64_t)reps * (sizeof(line) - 1) * 16 * 16;
+    return reps;
+}
+
+static uint32_t run_string8x4(uint32_t reps, uint64_t *pixels) {
+    static const char line[] = "22.1C";   // 5 cells of 32x32
+    for (uint32_t i = 0; i < reps; i++) {
+        st7789_draw_string_scaled(0, (i * 32) % (PANEL_HEIGHT - 32), line, 4, ST7789_CYAN, ST7789_BLACK);
+    }
+    *pixels += (uint64_t)reps * (sizeof(line) - 1) * 32 * 32;
+    return reps;
+}
+
+/**
+ * Shape cases draw the same figures twice: through the span-coalescing
+ * primitives and, in the *_px cases, pixel by pixel the way a naive
+ * plotter would. Pixels and bus bytes then compare directly.
+ */
+#define SHAPE_LINES 16
+
+static void line_end(uint32_t i, uint16_t *x1, uint16_t *y1) {
+    // A fan from the top-left corner sweeping from the top edge to the left
+    uint16_t k = i % SHAPE_LINES;
+    *x1 = k < SHAPE_LINES / 2 ? PANEL_WIDTH - 1 : (SHAPE_LINES - 1 - k) * 30;
+    *y1 = k < SHAPE_LINES / 2 ? k * 30 : PANEL_HEIGHT - 1;
+}
+
+static uint32_t run_line(uint32_t reps, uint64_t *pixels) {
+    for (uint32_t i = 0; i < reps; i++) {
+        uint16_t x1, y1;
+        line_end(i, &x1, &y1);
+        st7789_draw_line(0, 0, x1, y1, bench_color(i));
+        *pixels += (x1 > y1 ? x1 : y1) + 1;
+    }
+    return reps;
+}
+
+static uint32_t run_line_px(uint32_t reps, uint64_t *pixels) {
+    uint32_t calls = 0;
+    for (uint32_t i = 0; i < reps; i++) {
+        uint16_t x1, y1;
+        line_end(i, &x1, &y1);
+        int dx = x1, dy = -(int)y1, err = dx + dy, x = 0, y = 0;
+        for (;;) {
+            st7789_draw_pixel(x, y, bench_color(i));
+            calls++;
+            if (x == x1 && y == y1) break;
+            int e2 = 2 * err;
+            if (e2 >= dy) { err += dy; x++; }
+            if (e2 <= dx) { err += dx; y++; }
+        }
+    }
+    *pixels += calls;
+    return calls;
+}
+
+// Points a naive midpoint plotter draws: eight per step of the walk
+static uint32_t circle_points(int r) {
+    int x = 0, y = r, d = 1 - r;
+    uint32_t steps = 0;
+    while (x <= y) {
+        if (d < 0) {
+            d += 2 * x + 3;
+        } else {
+            d += 2 * (x - y) + 5;
+            y--;
+        }
+        x++;
+        steps++;
+    }
+    return steps * 8;
+}
+
+static uint32_t run_circle(uint32_t reps, uint64_t *pixels) {
+    for (uint32_t i = 0; i < reps; i++) {
+        uint16_t r = 20 + (i * 13) % 100;
+        st7789_draw_circle(PANEL_WIDTH / 2, PANEL_HEIGHT / 2, r, bench_color(i));
+        *pixels += circle_points(r);
+    }
+    return reps;
+}
+
+static uint32_t run_circle_px(uint32_t reps, uint64_t *pixels) {
+    uint32_t calls = 0;
+    for (uint32_t i = 0; i < reps; i++) {
+        int cx = PANEL_WIDTH / 2, cy = PANEL_HEIGHT / 2;
+        int x = 0, y = 20 + (i * 13) % 100, d = 1 - y;
+        while (x <= y) {
+            // All eight octants, repeating the points they share as naive code does
+            const int off[8][2] = {
+                {  x, -y }, {  y, -x }, {  y,  x }, {  x,  y },
+                { -x,  y }, { -y,  x }, { -y, -x }, { -x, -y },
+            };
+            for (int o = 0; o < 8; o++) {
+                st7789_draw_pixel(cx + off[o][0], cy + off[o][1], bench_color(i));
+                calls++;
+            }
+            if (d < 0) {
+                d += 2 * x + 3;
+            } else {
+                d += 2 * (x - y) + 5;
+                y--;
+            }
+            x++;
+        }
+    }
+    *pixels += calls;
+    return calls;
+}
+
+static uint32_t run_disc(uint32_t reps, uint64_t *pixels) {
+    for (uint32_t i = 0; i < reps; i++) {
+        uint16_t r = 10 + (i * 7) % 50;
+        st7789_fill_circle(60 + (i % 3) * 60, 60 + (i / 3 % 3) * 60, r, bench_color(i));
+        *pixels += (uint64_t)r * r * 355 / 113;
+    }
+    return reps;
+}
+
+static uint32_t run_round_rect(uint32_t reps, uint64_t *pixels) {
+    for (uint32_t i = 0; i < reps; i++) {
+        uint16_t inset = (i * 10) % 100;
+        st7789_fill_round_rect(inset, inset, PANEL_WIDTH - 2 * inset, 60, 12, bench_color(i));
+        st7789_draw_round_rect(inset, inset, PANEL_WIDTH - 2 * inset, 60, 12, ST7789_WHITE);
+        *pixels += (uint64_t)(PANEL_WIDTH - 2 * inset) * 60;
+    }
+    return reps * 2;
+}
+
+static uint32_t run_triangle(uint32_t reps, uint64_t *pixels) {
+    for (uint32_t i = 0; i < reps; i++) {
+        int t = (i * 17) % 120;
+        int x1 = PANEL_WIDTH - 1, y1 = t + 60, y2 = PANEL_HEIGHT - 1 - t / 2;
+        st7789_fill_triangle(t, 0, x1, y1, 0, y2, bench_color(i));
+        // Area by the shoelace formula, close to the pixel count
+        int64_t area2 = (int64_t)(x1 - t) * y2 - (int64_t)(0 - t) * y1;
+        *pixels += (uint64_t)(area2 < 0 ? -area2 : area2) / 2;
+    }
+    return reps;
+}
+
+// A point cloud: 1024 points per rep scattered over a 64x64 patch
+#define CLOUD_POINTS 1024
+
+static void cloud_point(uint32_t rep, uint32_t i, st7789_pixel_t *p) {
+    uint32_t h = (rep * CLOUD_POINTS + i) * 2654435761u;
+    p->x = 88 + (h >> 8) % 64;
+    p->y = 88 + (h >> 20) % 64;
+    p->color = bench_color(i & 7);
+}
+
+static uint32_t run_cloud(uint32_t reps, uint64_t *pixels) {
+    static st7789_pixel_t cloud[CLOUD_POINTS];
+    for (uint32_t i = 0; i < reps; i++) {
+        for (uint32_t k = 0; k < CLOUD_POINTS; k++) {
+            cloud_point(i, k, &cloud[k]);
+        }
+        st7789_draw_pixels(cloud, CLOUD_POINTS);
+    }
+    *pixels += (uint64_t)reps * CLOUD_POINTS;
+    return reps;
+}
+
+static uint32_t run_cloud_px(uint32_t reps, uint64_t *pixels) {
+    for (uint32_t i = 0; i < reps; i++) {
+        for (uint32_t k = 0; k < CLOUD_POINTS; k++) {
+            st7789_pixel_t p;
+            cloud_point(i, k, &p);
+            st7789_draw_pixel(p.x, p.y, p.color);
+        }
+    }
+    *pixels += (uint64_t)reps * CLOUD_POINTS;
+    return reps * CLOUD_POINTS;
+}
+
+static void fill_gradient(uint16_t *pixels, uint16_t w, uint16_t h) {
+    for (uint16_t row = 0; row < h; row++) {
+        for (uint16_t col = 0; col < w; col++) {
+            pixels[row * w + col] = ((col * 31 / w) << 11) | ((row * 63 / h) << 5) | 0x0F;
+        }
+    }
+}
+
+static uint32_t run_blit_small(uint32_t reps, uint64_t *pixels) {
+    static uint16_t image[BLIT_SMALL * BLIT_SMALL];
+    fill_gradient(image, BLIT_SMALL, BLIT_SMALL);
+    for (uint32_t i = 0; i < reps; i++) {
+        uint16_t x = (i * BLIT_SMALL) % (PANEL_WIDTH - BLIT_SMALL);
+        uint16_t y = (i * 2 * BLIT_SMALL) % (PANEL_HEIGHT - BLIT_SMALL);
+        st7789_blit(x, y, BLIT_SMALL, BLIT_SMALL, image);
+    }
+    // Async mode references the image, so it must be drawn before returning
+    st7789_wait_idle(UINT32_MAX);
+    *pixels += (uint64_t)reps * BLIT_SMALL * BLIT_SMALL;
+    return reps;
+}
+
+static uint32_t run_blit_full(uint32_t reps, uint64_t *pixels) {
+    uint16_t *image = malloc(SCREEN_PIXELS * sizeof(uint16_t));
+    if (image == NULL) {
+        ESP_LOGW(TAG, "blit_full skipped: out of memory");
+        return 0;
+    }
+    fill_gradient(image, PANEL_WIDTH, PANEL_HEIGHT);
+    for (uint32_t i = 0; i < reps; i++) {
+        st7789_blit(0, 0, PANEL_WIDTH, PANEL_HEIGHT, image);
+    }
+    st7789_wait_idle(UINT32_MAX);
+    free(image);
+    *pixels += reps * SCREEN_PIXELS;
+    return reps;
+}
+
+// Compressed images in images/, generated by tools/st7789_img_encode.py
+extern const uint8_t st7789_bench_splash[], st7789_bench_icons[], st7789_bench_photo[];
+extern const size_t st7789_bench_splash_size, st7789_bench_icons_size, st7789_bench_photo_size;
+
+typedef struct {
+    const char *name;      // Case name
+    const uint8_t *data;
+    const size_t *size;
+} bench_image_t;
+
+static const bench_image_t images[] = {
+    { "image_splash", st7789_bench_splash, &st7789_bench_splash_size },   // UI splash screen
+    { "image_icons",  st7789_bench_icons,  &st7789_bench_icons_size },    // Six flat icons
+    { "image_photo",  st7789_bench_photo,  &st7789_bench_photo_size },    // Noisy photo, worst case
+};
+
+// Tile the image over the screen, one placement per rep
+static uint32_t run_image(const bench_image_t *image, uint32_t reps, uint64_t *pixels) {
+    uint16_t w, h;
+    if (st7789_image_get_size(image->data, *image->size, &w, &h) != ESP_OK || w == 0 || h == 0) {
+        return 0;
+    }
+    // An image larger than the panel is drawn clipped at the origin
+    uint16_t cols = w < PANEL_WIDTH ? PANEL_WIDTH / w : 1;
+    uint16_t rows = h < PANEL_HEIGHT ? PANEL_HEIGHT / h : 1;
+    for (uint32_t i = 0; i < reps; i++) {
+        st7789_draw_image((i % cols) * w, (i / cols % rows) * h, image->data, *image->size);
+    }
+    *pixels += (uint64_t)reps * w * h;
+    return reps;
+}
+
+static uint32_t run_image_splash(uint32_t reps, uint64_t *pixels) {
+    return run_image(&images[0], reps, pixels);
+}
+
+static uint32_t run_image_icons(uint32_t reps, uint64_t *pixels) {
+    return run_image(&images[1], reps, pixels);
+}
+
+static uint32_t run_image_photo(uint32_t reps, uint64_t *pixels) {
+    return run_image(&images[2], reps, pixels);
+}
+
+static const bench_case_t cases[] = {
+    { "fill_full",  8,  run_fill_full },
+    { "fill_large", 32, run_fill_large },
+    { "fill_small", 16, run_fill_small },
+    { "pixel",      16, run_pixel },
+    { "char8",      30, run_char8 },
+    { "char16",     15, run_char16 },
+    { "string8",    60, run_string8 },
+    { "string16",   30, run_string16 },
+    { "char8x2",    15, run_char8x2 },
+    { "string8x2",  30, run_string8x2 },
+    { "string8x4",  30, run_string8x4 },
+    { "line",       64, run_line },
+    { "line_px",    64, run_line_px },
+    { "circle",     32, run_circle },
+    { "circle_px",  32, run_circle_px },
+    { "disc",       32, run_disc },
+    { "round_rect", 16, run_round_rect },
+    { "triangle",   16, run_triangle },
+    { "cloud",      16, run_cloud },
+    { "cloud_px",   16, run_cloud_px },
+    { "blit_64",    32, run_blit_small },
+    { "blit_full",  4,  run_blit_full },
+    { "image_splash", 8,  run_image_splash },
+    { "image_icons",  24, run_image_icons },
+    { "image_photo",  16, run_image_photo },
+};
+
+_Static_assert(sizeof(cases) / sizeof(cases[0]) <= ST7789_BENCH_MAX_CASES,
+               "ST7789_BENCH_MAX_CASES too small");
+
+static bool run_case(const bench_case_t *c, uint32_t scale, st7789_bench_result_t *out) {
+    st7789_stats_t before, after;
+
+    // Start every case from a drained queue and a known screen
+    st7789_fill_rect(0, 0, PANEL_WIDTH, PANEL_HEIGHT, ST7789_BLACK);
+    st7789_wait_idle(UINT32_MAX);
+
+    memset(out, 0, sizeof(*out));
+    out->name = c->name;
+    out->bits_per_pixel = st7789_get_color_depth() == ST7789_COLOR_12BIT ? 12 : 16;
+    st7789_get_stats(&before);
+    int64_t start = esp_timer_get_time();
+    out->calls = c->run(c->reps * scale, &out->pixels);
+    st7789_wait_idle(UINT32_MAX);
+    out->elapsed_us = (uint64_t)(esp_timer_get_time() - start);
+    st7789_get_stats(&after);
+
+    out->bus_bytes = after.bytes_sent - before.bytes_sent;
+    out->bus_commands = after.commands_sent - before.commands_sent;
+    return out->calls > 0;
+}
+
+// Log the compression ratio of each image the run will draw, outside the timing
+static void report_images(const char *only) {
+    for (size_t i = 0; i < sizeof(images) / sizeof(images[0]); i++) {
+        const bench_image_t *image = &images[i];
+        if (only != NULL && strstr(image->name, only) == NULL) {
+            continue;
+        }
+        uint16_t w, h;
+        if (st7789_image_get_size(image->data, *image->size, &w, &h) != ESP_OK) {
+            ESP_LOGW(TAG, "image=%s is not an S7Q image", image->name);
+            continue;
+        }
+        uint32_t raw = (uint32_t)w * h * 2;
+        uint32_t ratio_x100 = (uint32_t)((uint64_t)raw * 100 / *image->size);
+        ESP_LOGI(TAG, "image=%s width=%u height=%u raw_bytes=%u bytes=%u ratio=%u.%02u",
+                 image->name, w, h, (unsigned)raw, (unsigned)*image->size,
+                 (unsigned)(ratio_x100 / 100), (unsigned)(ratio_x100 % 100));
+    }
+}
+
+/**
+ * @brief Run every case (or those matching the filter) in table order
+ *
+ * Each case starts from a cleared, idle display. Async mode may be running;
+ * its queue is drained inside the timed region so the numbers include the
+ * drawing, not just the submission.
+ */
+esp_err_t st7789_bench_run(const st7789_bench_config_t *config,
+                           st7789_bench_result_t *results, size_t max_results, size_t *count) {
+    uint32_t scale = (config && config->scale) ? config->scale : 1;
+    const char *only = config ? config->only : NULL;
+    st7789_color_depth_t depth = config ? config->color_depth : ST7789_COLOR_16BIT;
+    st7789_color_depth_t previous = st7789_get_color_depth();
+    size_t done = 0;
+    bool matched = false;
+
+    esp_err_t ret = st7789_set_color_depth(depth);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    ESP_LOGI(TAG, "suite=st7789 version=1 width=%u height=%u scale=%u stats=%d bpp=%u",
+             PANEL_WIDTH, PANEL_HEIGHT, (unsigned)scale, ST7789_STATS,
+             depth == ST7789_COLOR_12BIT ? 12u : 16u);
+    report_images(only);
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        if (only != NULL && strstr(cases[i].name, only) == NULL) {
+            continue;
+        }
+        matched = true;
+
+        st7789_bench_result_t result;
+        if (!run_case(&cases[i], scale, &result)) {
+            continue;
+        }
+        st7789_bench_report(&result);
+        if (results != NULL && done < max_results) {
+            results[done] = result;
+        }
+        done++;
+    }
+
+    st7789_set_color_depth(previous);
+    if (count != NULL) {
+        *count = (results == NULL || done < max_results) ? done : max_results;
+    }
+    return matched ? ESP_OK : ESP_ERR_NOT_FOUND;
+}
+
+void st7789_bench_report(const st7789_bench_result_t *r) {
+    uint64_t us = r->elapsed_us ? r->elapsed_us : 1;
+    uint64_t pixels_per_s = r->pixels * 1000000ULL / us;
+    uint64_t bytes_per_s = r->bus_bytes * 1000000ULL / us;
+    // Full-screen equivalents per second, in hundredths
+    uint64_t fps_x100 = pixels_per_s * 100 / SCREEN_PIXELS;
+
+    ESP_LOGI(TAG, "name=%s bpp=%u calls=%u pixels=%llu bus_bytes=%llu commands=%u us=%llu "
+             "pixels_per_s=%llu bytes_per_s=%llu fps=%llu.%02u",
+             r->name, (unsigned)r->bits_per_pixel, (unsigned)r->calls, (unsigned long long)r->pixels,
+             (unsigned long long)r->bus_bytes, (unsigned)r->bus_commands,
+             (unsigned long long)r->elapsed_us, (unsigned long long)pixels_per_s,
+             (unsigned long long)bytes_per_s, (unsigned long long)(fps_x100 / 100),
+             (unsigned)(fps_x100 % 100));
+}
@@ -0,0 +1,70 @@
+#ifndef ST7789_BENCH_H
+#define ST7789_BENCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "st7789.h"
+
+/**
+ * @file st7789_bench.h
+ * @brief Throughput benchmark suite for the ST7789 driver
+ *
+ * Every case draws a fixed, deterministic workload through the public API,
+ * so two runs of the same build do the same work and the same bus traffic.
+ * Results are logged as one key=value line per case. The suite runs on the
+ * panel and on the Linux target against the mock transport, where the bus
+ * byte and command counts are exact and the timings measure the rendering
+ * layer alone.
+ */
+
+/**
+ * @brief Result of one benchmark case
+ */
+typedef struct {
+    const char *name;          // Case name, stable across versions
+    uint8_t bits_per_pixel;    // Bus color depth the case ran at (16 or 12)
+    uint32_t calls;            // Driver calls made
+    uint64_t pixels;           // Pixels drawn
+    uint64_t bus_bytes;        // Bytes sent to the panel (0 with ST7789_STATS = 0)
+    uint32_t bus_commands;     // Command bytes sent (0 with ST7789_STATS = 0)
+    uint64_t elapsed_us;       // Wall time, including draining async mode
+} st7789_bench_result_t;
+
+/**
+ * @brief Suite settings
+ */
+typedef struct {
+    uint32_t scale;            // Multiplies every case's repetitions, 0 = 1
+    const char *only;          // Run only cases whose name contains this, NULL for all
+    st7789_color_depth_t color_depth;   // Bus color depth to measure at
+} st7789_bench_config_t;
+
+#define ST7789_BENCH_MAX_CASES 32
+
+/**
+ * @brief Run the suite on an initialized display
+ *
+ * Sets the requested color depth for the run and restores the previous one
+ * afterwards.
+ *
+ * @param config Settings, NULL for scale 1, every case, 16-bit
+ * @param results Receives one entry per case run (may be NULL)
+ * @param max_results Capacity of results
+ * @param count Receives the number of cases run, capped at max_results when
+ *              results is given (may be NULL)
+ * @return ESP_OK, or ESP_ERR_NOT_FOUND if the filter matched no case
+ */
+esp_err_t st7789_bench_run(const st7789_bench_config_t *config,
+                           st7789_bench_result_t *results, size_t max_results, size_t *count);
+
+/**
+ * @brief Log one result as a key=value line
+ *
+ * Fields: name, bpp, calls, pixels, bus_bytes, commands, us, pixels_per_s,
+ * bytes_per_s and fps, where fps counts full-screen equivalents
+ * (240x240 pixels) per second.
+ */
+void st7789_bench_report(const st7789_bench_result_t *result);
+
+#endif // ST7789_BENCH_H
@@ -0,0 +1,41 @@
+#include "st7789_bitbang_model.h"
+#include "unity.h"
+#include <stdio.h>
+#include <string.h>
+
+/*
+ * Bit-bang engine on the cost model: the panel must latch exactly the bytes
+ * sent, and the engine must stay well ahead of the old gpio_set_level() loop.
+ */
+
+#define MODEL_LEN 1024
+
+void test_bitbang_model_round_trip(void) {
+    static uint8_t data[MODEL_LEN];
+    static uint8_t decoded[MODEL_LEN + 1];
+
+    // Edge patterns first, then pseudo-random bytes
+    static const uint8_t edges[] = { 0x00, 0xFF, 0xAA, 0x55, 0x01, 0x80, 0x7F, 0xFE };
+    memcpy(data, edges, sizeof(edges));
+    uint32_t seed = 0x2545F491;
+    for (size_t i = sizeof(edges); i < MODEL_LEN; i++) {
+        seed = seed * 1664525 + 1013904223;
+        data[i] = seed >> 24;
+    }
+
+    st7789_bitbang_cost_t cost;
+    for (size_t len = 1; len <= MODEL_LEN; len = len < 16 ? len + 1 : len * 2) {
+        memset(decoded, 0xA5, sizeof(decoded));
+        st7789_bitbang_model_run(data, len, decoded, &cost);
+        TEST_ASSERT_EQUAL_MEMORY_MESSAGE(data, decoded, len, "decoded bytes");
+        TEST_ASSERT_EQUAL_HEX8_MESSAGE(0xA5, decoded[len], "latched past the end");
+        TEST_ASSERT_EQUAL_UINT32(len, cost.bytes);
+        // Data, clock low and clock high for each bit
+        TEST_ASSERT_EQUAL_UINT32(len * 8 * 3, cost.reg_writes);
+    }
+
+    printf("bitbang: %.1f reg writes/byte, %.1f cycles/byte (legacy %.1f calls, %.1f cycles/byte)\n",
+           (double)cost.reg_writes / cost.bytes, (double)cost.est_cycles / cost.bytes,
+           (double)cost.legacy_calls / cost.bytes, (double)cost.legacy_est_cycles / cost.bytes);
+    TEST_ASSERT_LESS_THAN(cost.legacy_est_cycles / 4, cost.est_cycles);
+}
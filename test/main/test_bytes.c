@@ -0,0 +1,96 @@
+#include "test_common.h"
+#include "unity.h"
+#include <stdio.h>
+
+/*
+ * Bus cost of single operations. Each runs against a forgotten address
+ * window, so it pays for CASET/RASET. A change here is a change in how
+ * many bytes the driver sends, so update the table only on purpose.
+ */
+
+static uint16_t sprite[16 * 16];
+
+static void op_pixel(void)        { st7789_draw_pixel(10, 10, ST7789_RED); }
+static void op_fill_rect(void)    { st7789_fill_rect(10, 10, 20, 10, ST7789_RED); }
+static void op_clear(void)        { st7789_clear_screen(ST7789_BLUE); }
+static void op_line_h(void)       { st7789_draw_line(0, 50, 99, 50, ST7789_GREEN); }
+static void op_line_diag(void)    { st7789_draw_line(0, 0, 49, 49, ST7789_GREEN); }
+static void op_rect(void)         { st7789_draw_rect(10, 10, 40, 30, ST7789_WHITE); }
+static void op_char(void)         { st7789_draw_char(0, 0, 'A', ST7789_WHITE, ST7789_BLACK); }
+static void op_string(void)       { st7789_draw_string(0, 0, "Hello", ST7789_WHITE, ST7789_BLACK); }
+static void op_large_char(void)   { st7789_draw_large_char(0, 0, 'A', ST7789_WHITE, ST7789_BLACK); }
+static void op_blit(void)         { st7789_blit(0, 0, 16, 16, sprite); }
+static void op_fill_circle(void)  { st7789_fill_circle(120, 120, 20, ST7789_RED); }
+
+static void op_points(void) {
+    static st7789_point_t points[100];
+    for (uint16_t i = 0; i < 100; i++) {
+        points[i] = (st7789_point_t){ (i * 37) % 200, (i * 53) % 200 };
+    }
+    st7789_draw_points(points, 100, ST7789_WHITE);
+}
+
+static void op_fb_flush(void) {
+    st7789_fill_rect(10, 10, 20, 10, ST7789_RED);
+    st7789_draw_pixel(40, 12, ST7789_RED);   // Cheaper as its own region than merged
+    st7789_flush();
+}
+
+typedef struct {
+    const char *name;
+    void (*op)(void);
+    bool depth12;           // Run at ST7789_COLOR_12BIT
+    st7789_fb_mode_t fb;
+    uint32_t commands;
+    uint64_t bytes;
+} byte_case_t;
+
+static const byte_case_t cases[] = {
+    { "pixel",       op_pixel,        false, ST7789_FB_NONE,         3,     13 },
+    { "fill_rect",   op_fill_rect,    false, ST7789_FB_NONE,         3,    411 },
+    { "fill_rect12", op_fill_rect,    true,  ST7789_FB_NONE,         3,    311 },
+    { "clear",       op_clear,        false, ST7789_FB_NONE,         3, 115211 },
+    { "clear12",     op_clear,        true,  ST7789_FB_NONE,         3,  86411 },
+    { "line_h",      op_line_h,       false, ST7789_FB_NONE,         3,    211 },
+    { "line_diag",   op_line_diag,    false, ST7789_FB_NONE,       150,    650 },
+    { "rect",        op_rect,         false, ST7789_FB_NONE,        10,    306 },
+    { "char",        op_char,         false, ST7789_FB_NONE,         3,    139 },
+    { "string",      op_string,       false, ST7789_FB_NONE,         3,    715 },
+    { "large_char",  op_large_char,   false, ST7789_FB_NONE,         3,    523 },
+    { "blit",        op_blit,         false, ST7789_FB_NONE,         3,    523 },
+    { "blit12",      op_blit,         true,  ST7789_FB_NONE,         3,    395 },
+    { "fill_circle", op_fill_circle,  false, ST7789_FB_NONE,        82,   2904 },
+    { "points",      op_points,       false, ST7789_FB_NONE,       300,   1300 },
+    { "fb_flush",    op_fb_flush,     false, ST7789_FB_FULL,         6,    424 },
+    { "fb_flush4",   op_fb_flush,     false, ST7789_FB_INDEXED4,     6,    424 },
+};
+
+void test_bus_bytes_per_op(void) {
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        const byte_case_t *c = &cases[i];
+        test_panel_reset();
+        if (c->depth12) {
+            TEST_ASSERT_EQUAL(ESP_OK, st7789_set_color_depth(ST7789_COLOR_12BIT));
+        }
+        if (c->fb != ST7789_FB_NONE) {
+            TEST_ASSERT_EQUAL(ESP_OK, st7789_fb_enable(c->fb, 0));
+            st7789_flush();   // The first flush sends the whole buffer
+        }
+        test_bus_reset();
+        c->op();
+        uint32_t commands = test_bus_commands();
+        uint64_t bytes = test_bus_bytes();
+        if (c->fb != ST7789_FB_NONE) {
+            st7789_fb_stats_t fb_stats;
+            st7789_fb_get_stats(&fb_stats);
+            TEST_ASSERT_EQUAL_UINT64_MESSAGE(bytes, fb_stats.last_flush_bytes, "reported flush bytes");
+        }
+        st7789_fb_disable();
+        test_assert_protocol_clean();
+
+        printf("%-12s %5lu commands %7llu bytes\n", c->name, (unsigned long)commands,
+               (unsigned long long)bytes);
+        TEST_ASSERT_EQUAL_UINT32_MESSAGE(c->commands, commands, c->name);
+        TEST_ASSERT_EQUAL_UINT64_MESSAGE(c->bytes, bytes, c->name);
+    }
+}
@@ -0,0 +1,108 @@
+#include "test_common.h"
+#include "st7789_mock.h"
+#include "unity.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+static test_bus_byte_t *capture_buf;
+static size_t capture_cap;
+static size_t capture_len;
+
+void test_panel_reset(void) {
+    st7789_async_stop();
+    st7789_fb_disable();
+    st7789_term_deinit();
+
+    st7789_emu_attach();
+    TEST_ASSERT_EQUAL(ESP_OK, st7789_init());
+    st7789_reset_stats();
+    test_bus_reset();
+}
+
+uint64_t test_bus_bytes(void) {
+    st7789_emu_stats_t s;
+    st7789_emu_get_stats(&s);
+    return s.commands + s.data_bytes;
+}
+
+uint32_t test_bus_commands(void) {
+    st7789_emu_stats_t s;
+    st7789_emu_get_stats(&s);
+    return s.commands;
+}
+
+void test_bus_reset(void) {
+    st7789_wait_idle(UINT32_MAX);
+    st7789_window_cache_invalidate();
+    st7789_emu_reset_stats();
+}
+
+void test_assert_protocol_clean(void) {
+    st7789_emu_stats_t s;
+    st7789_emu_get_stats(&s);
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, s.protocol_errors, "protocol errors");
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, s.timing_violations, "timing violations");
+}
+
+void test_snapshot(uint16_t *pixels) {
+    for (uint16_t y = 0; y < TEST_HEIGHT; y++) {
+        for (uint16_t x = 0; x < TEST_WIDTH; x++) {
+            pixels[y * TEST_WIDTH + x] = st7789_emu_get_pixel565(x, y);
+        }
+    }
+}
+
+uint32_t test_snapshot_diff(const uint16_t *pixels) {
+    uint32_t diff = 0;
+    for (uint16_t y = 0; y < TEST_HEIGHT; y++) {
+        for (uint16_t x = 0; x < TEST_WIDTH; x++) {
+            diff += pixels[y * TEST_WIDTH + x] != st7789_emu_get_pixel565(x, y);
+        }
+    }
+    return diff;
+}
+
+void test_assert_golden(const char *name) {
+    char path[512];
+    snprintf(path, sizeof(path), "%s/%s.ppm", ST7789_TEST_GOLDEN_DIR, name);
+
+    const char *update = getenv("ST7789_UPDATE_GOLDEN");
+    if (update != NULL && update[0] == '1') {
+        TEST_ASSERT_EQUAL_MESSAGE(ESP_OK, st7789_emu_write_ppm(path), path);
+        printf("Updated %s\n", path);
+        return;
+    }
+
+    uint32_t mismatches = 0;
+    esp_err_t ret = st7789_emu_compare_ppm(path, &mismatches);
+    if (ret != ESP_OK) {
+        char actual[128];
+        snprintf(actual, sizeof(actual), "%s.actual.ppm", name);
+        st7789_emu_write_ppm(actual);
+        printf("%s: %s, %u pixels differ; actual image saved as %s\n",
+               name, esp_err_to_name(ret), (unsigned)mismatches, actual);
+    }
+    TEST_ASSERT_EQUAL_MESSAGE(ESP_OK, ret, name);
+}
+
+static void capture_sink(bool is_command, const uint8_t *bytes, size_t len, void *ctx) {
+    for (size_t i = 0; i < len; i++, capture_len++) {
+        if (capture_len < capture_cap) {
+            capture_buf[capture_len] = (test_bus_byte_t){ bytes[i], is_command };
+        }
+    }
+}
+
+void test_capture_start(test_bus_byte_t *buf, size_t cap) {
+    st7789_wait_idle(UINT32_MAX);
+    capture_buf = buf;
+    capture_cap = cap;
+    capture_len = 0;
+    st7789_mock_set_sink(capture_sink, NULL);
+}
+
+size_t test_capture_stop(void) {
+    st7789_wait_idle(UINT32_MAX);
+    st7789_mock_set_sink(NULL, NULL);
+    return capture_len;
+}
@@ -0,0 +1,95 @@
+#ifndef TEST_COMMON_H
+#define TEST_COMMON_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "st7789.h"
+#include "st7789_emu.h"
+
+/**
+ * @file test_common.h
+ * @brief Shared helpers for the host tests
+ *
+ * Every test starts from test_panel_reset(): a fresh emulated panel behind
+ * the mock transport, a freshly initialized driver and zeroed counters.
+ */
+
+#define TEST_WIDTH   240
+#define TEST_HEIGHT  240
+#define TEST_PIXELS  (TEST_WIDTH * TEST_HEIGHT)
+
+/**
+ * @brief Start from a freshly initialized driver on a blank emulated panel
+ *
+ * Stops async mode, the framebuffer and the terminal if a previous test
+ * left them on, so a failing test cannot leak state into the next one.
+ */
+void test_panel_reset(void);
+
+/**
+ * @brief Bus bytes (command plus data) the panel has received since the
+ *        last test_bus_reset()
+ */
+uint64_t test_bus_bytes(void);
+
+/**
+ * @brief Command bytes the panel has received since the last test_bus_reset()
+ */
+uint32_t test_bus_commands(void);
+
+/**
+ * @brief Zero the emulator counters and forget the panel's address window,
+ *        so the next draw pays for a full CASET/RASET
+ */
+void test_bus_reset(void);
+
+/**
+ * @brief Fail the current test if the panel saw a protocol error or timing violation
+ */
+void test_assert_protocol_clean(void);
+
+/**
+ * @brief Copy the visible panel into pixels (TEST_PIXELS RGB565 values, row major)
+ */
+void test_snapshot(uint16_t *pixels);
+
+/**
+ * @brief Number of visible pixels that differ from a snapshot
+ */
+uint32_t test_snapshot_diff(const uint16_t *pixels);
+
+/**
+ * @brief Compare the visible panel against golden/<name>.ppm
+ *
+ * With ST7789_UPDATE_GOLDEN=1 in the environment the image is written
+ * instead. On a mismatch the actual image is saved as <name>.actual.ppm in
+ * the working directory for inspection.
+ */
+void test_assert_golden(const char *name);
+
+/**
+ * @brief One byte as the panel received it
+ */
+typedef struct {
+    uint8_t byte;
+    bool is_command;
+} test_bus_byte_t;
+
+/**
+ * @brief Record the raw bus stream into buf instead of the emulator
+ *
+ * Bytes past cap are counted but not stored.
+ */
+void test_capture_start(test_bus_byte_t *buf, size_t cap);
+
+/**
+ * @brief Stop recording
+ *
+ * The emulator stays detached; call test_panel_reset() before drawing to it again.
+ *
+ * @return Bytes seen since test_capture_start()
+ */
+size_t test_capture_stop(void);
+
+#endif // TEST_COMMON_H
@@ -0,0 +1,85 @@
+#include "test_common.h"
+#include "unity.h"
+#include <stdio.h>
+
+/*
+ * Solid fills must put exactly the byte stream of the original per-pixel
+ * loop on the bus: CASET, RASET and RAMWR with big-endian start/end words,
+ * then one big-endian word per pixel. The window cache is reset first, since
+ * skipping an unchanged CASET/RASET is a later saving of its own.
+ */
+
+#define FILL_STREAM_MAX  (11 + TEST_PIXELS * 2)
+
+static test_bus_byte_t expected[FILL_STREAM_MAX];
+static test_bus_byte_t actual[FILL_STREAM_MAX];
+
+static size_t put(size_t n, uint8_t byte, bool is_command) {
+    expected[n] = (test_bus_byte_t){ byte, is_command };
+    return n + 1;
+}
+
+static size_t put_word(size_t n, uint16_t word) {
+    n = put(n, word >> 8, false);
+    return put(n, word & 0xFF, false);
+}
+
+// The stream the original fill_rect() sent
+static size_t reference_fill(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
+    size_t n = 0;
+    n = put(n, 0x2A, true);   // CASET
+    n = put_word(n, x);
+    n = put_word(n, x + w - 1);
+    n = put(n, 0x2B, true);   // RASET
+    n = put_word(n, y);
+    n = put_word(n, y + h - 1);
+    n = put(n, 0x2C, true);   // RAMWR
+    for (uint32_t i = 0; i < (uint32_t)w * h; i++) {
+        n = put_word(n, color);
+    }
+    return n;
+}
+
+static void check_stream(size_t expected_len, const char *what) {
+    size_t len = test_capture_stop();
+    TEST_ASSERT_EQUAL_size_t(expected_len, len);
+    for (size_t i = 0; i < len; i++) {
+        if (actual[i].byte != expected[i].byte || actual[i].is_command != expected[i].is_command) {
+            printf("%s: byte %u is 0x%02X (%s), expected 0x%02X (%s)\n", what, (unsigned)i,
+                   actual[i].byte, actual[i].is_command ? "command" : "data",
+                   expected[i].byte, expected[i].is_command ? "command" : "data");
+            TEST_FAIL_MESSAGE(what);
+        }
+    }
+}
+
+void test_fill_rect_stream(void) {
+    static const struct { uint16_t x, y, w, h, color; } rects[] = {
+        { 0, 0, 1, 1, ST7789_WHITE },
+        { 239, 239, 1, 1, 0x1234 },
+        { 10, 20, 30, 40, ST7789_RED },
+        { 3, 7, 1, 200, 0xA55A },
+        { 0, 100, 240, 1, 0x00FF },
+        { 5, 5, 100, 50, 0xFF00 },      // More pixels than one run buffer
+        { 17, 3, 223, 237, 0x8001 },    // Odd sizes, many chunks
+        { 0, 0, 240, 240, ST7789_BLACK },
+    };
+    for (size_t i = 0; i < sizeof(rects) / sizeof(rects[0]); i++) {
+        test_panel_reset();
+        size_t len = reference_fill(rects[i].x, rects[i].y, rects[i].w, rects[i].h, rects[i].color);
+        test_capture_start(actual, FILL_STREAM_MAX);
+        st7789_fill_rect(rects[i].x, rects[i].y, rects[i].w, rects[i].h, rects[i].color);
+        check_stream(len, "fill_rect");
+    }
+}
+
+void test_clear_screen_stream(void) {
+    static const uint16_t colors[] = { ST7789_BLACK, ST7789_WHITE, 0x1F80 };
+    for (size_t i = 0; i < sizeof(colors) / sizeof(colors[0]); i++) {
+        test_panel_reset();
+        size_t len = reference_fill(0, 0, TEST_WIDTH, TEST_HEIGHT, colors[i]);
+        test_capture_start(actual, FILL_STREAM_MAX);
+        st7789_clear_screen(colors[i]);
+        check_stream(len, "clear_screen");
+    }
+}
@@ -0,0 +1,88 @@
+#include "test_common.h"
+#include "unity.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Every printable character of the 16x16 font must render exactly as drawn
+ * in its source, tools/font16x16.txt, and every character but the space
+ * must put ink on the panel.
+ */
+
+#define FONT_FIRST  32
+#define FONT_LAST   126
+#define FONT_COUNT  (FONT_LAST - FONT_FIRST + 1)
+#define GLYPH_SIZE  16
+#define PITCH       18
+#define PER_ROW     (TEST_WIDTH / PITCH)
+
+static uint16_t source[FONT_COUNT][GLYPH_SIZE];
+
+// Parse the font source: a "char <code>" header, then 16 rows of '#' and '.'
+static void load_source(void) {
+    const char *path = ST7789_TEST_TOOLS_DIR "/font16x16.txt";
+    FILE *f = fopen(path, "r");
+    TEST_ASSERT_NOT_NULL(f);
+
+    bool seen[FONT_COUNT] = { false };
+    char line[64];
+    int code = -1, row = GLYPH_SIZE;
+    while (fgets(line, sizeof(line), f) != NULL) {
+        line[strcspn(line, "\r\n")] = '\0';
+        if (strncmp(line, "char ", 5) == 0) {
+            code = atoi(line + 5);
+            TEST_ASSERT_TRUE(code >= FONT_FIRST && code <= FONT_LAST && !seen[code - FONT_FIRST]);
+            seen[code - FONT_FIRST] = true;
+            row = 0;
+        } else if (row < GLYPH_SIZE && line[0] != '\0') {
+            TEST_ASSERT_EQUAL_size_t(GLYPH_SIZE, strlen(line));
+            uint16_t bits = 0;
+            for (int col = 0; col < GLYPH_SIZE; col++) {
+                bits = (bits << 1) | (line[col] == '#');
+            }
+            source[code - FONT_FIRST][row++] = bits;
+        }
+    }
+    fclose(f);
+    for (int i = 0; i < FONT_COUNT; i++) {
+        TEST_ASSERT_TRUE_MESSAGE(seen[i], "character missing from the font source");
+    }
+}
+
+// Draw every glyph in a grid and compare each cell with the source
+static void check_all_glyphs(uint16_t fg, uint16_t bg) {
+    for (int i = 0; i < FONT_COUNT; i++) {
+        st7789_draw_large_char((i % PER_ROW) * PITCH, (i / PER_ROW) * PITCH, FONT_FIRST + i, fg, bg);
+    }
+    st7789_wait_idle(UINT32_MAX);
+
+    for (int i = 0; i < FONT_COUNT; i++) {
+        uint16_t x0 = (i % PER_ROW) * PITCH, y0 = (i / PER_ROW) * PITCH;
+        uint32_t ink = 0;
+        for (int row = 0; row < GLYPH_SIZE; row++) {
+            for (int col = 0; col < GLYPH_SIZE; col++) {
+                bool set = source[i][row] & (0x8000 >> col);
+                uint16_t got = st7789_emu_get_pixel565(x0 + col, y0 + row);
+                if (got != (set ? fg : bg)) {
+                    printf("'%c': pixel (%d, %d) is 0x%04X, expected 0x%04X\n", FONT_FIRST + i,
+                           col, row, got, set ? fg : bg);
+                    TEST_FAIL_MESSAGE("glyph differs from tools/font16x16.txt");
+                }
+                ink += got == fg;
+            }
+        }
+        if (FONT_FIRST + i != ' ') {
+            TEST_ASSERT_GREATER_THAN_MESSAGE(0, ink, "glyph draws nothing");
+        }
+    }
+}
+
+void test_font16_every_glyph(void) {
+    load_source();
+    test_panel_reset();
+    check_all_glyphs(ST7789_WHITE, ST7789_BLACK);
+    // Again in other colors, now from the glyph cache
+    check_all_glyphs(ST7789_RED, 0x0010);
+    test_assert_protocol_clean();
+}
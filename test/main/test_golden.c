@@ -0,0 +1,295 @@
+#include "test_common.h"
+#include "unity.h"
+
+/*
+ * Golden-image tests: each scene exercises a group of drawing calls and must
+ * match its committed golden/<scene>.ppm pixel for pixel. The scene is then
+ * drawn again through every other path that supports it (full and band
+ * framebuffer, async queue, band render), which must reach the same image.
+ */
+
+// Paths a scene is redrawn through after the direct draw
+#define VIA_FB_FULL  (1 << 0)
+#define VIA_FB_BAND  (1 << 1)
+#define VIA_ASYNC    (1 << 2)
+#define VIA_BAND     (1 << 3)   // Only for stateless scenes: the callback runs once per band
+#define VIA_ALL      (VIA_FB_FULL | VIA_FB_BAND | VIA_ASYNC | VIA_BAND)
+
+// 40x30 S7Q test pattern (runs, gradient, index hits, literals), made with
+// tools/st7789_img_encode.py
+static const uint8_t pattern_s7q[] = {
+    0x53, 0x37, 0x51, 0x31, 0x28, 0x00, 0x1E, 0x00, 0xFE, 0x00, 0x13, 0xE0,
+    0xCE, 0xAC, 0x2E, 0x79, 0xC0, 0x79, 0x79, 0x79, 0xC0, 0x79, 0x79, 0x79,
+    0xC0, 0x79, 0x79, 0xC0, 0x79, 0x79, 0x79, 0xC0, 0x79, 0x79, 0x79, 0xC0,
+    0x79, 0x79, 0x79, 0xC0, 0x79, 0x79, 0xC0, 0x79, 0x79, 0x79, 0xC0, 0x79,
+    0x79, 0x79, 0xC0, 0x79, 0x79, 0xC0, 0xA2, 0xB3, 0x79, 0xC0, 0x79, 0x79,
+    0x79, 0xC0, 0x79, 0x79, 0x79, 0xC0, 0x79, 0x79, 0xC0, 0x79, 0x79, 0x79,
+    0xC0, 0x79, 0x79, 0x79, 0xC0, 0x79, 0x79, 0x79, 0xC0, 0x79, 0x79, 0xC0,
+    0x79, 0x79, 0x79, 0xC0, 0x79, 0x79, 0x79, 0xC0, 0x79, 0x79, 0xC0, 0xA2,
+    0xB3, 0x79, 0xC0, 0x79, 0x79, 0x79, 0xC0, 0x79, 0x79, 0x79, 0xC0, 0x79,
+    0x79, 0xC0, 0x79, 0x79, 0x79, 0xC0, 0x79, 0x79, 0x79, 0xC0, 0x79, 0x79,
+    0x79, 0xC0, 0x79, 0x79, 0xC0, 0x79, 0x79, 0x79, 0xC0, 0x79, 0x79, 0x79,
+    0xC0, 0x79, 0x79, 0xC0, 0xA2, 0xB3, 0x79, 0xC0, 0x79, 0x79, 0x79, 0xC0,
+    0x79, 0x79, 0x79, 0xC0, 0x79, 0x79, 0xC0, 0x79, 0x79, 0x79, 0xC0, 0x79,
+    0x79, 0x79, 0xC0, 0x79, 0x79, 0x79, 0xC0, 0x79, 0x79, 0xC0, 0x79, 0x79,
+    0x79, 0xC0, 0x79, 0x79, 0x79, 0xC0, 0x79, 0x79, 0xC0, 0xA2, 0xB3, 0x79,
+    0xC0, 0x79, 0x79, 0x79, 0xC0, 0x79, 0x79, 0x79, 0xC0, 0x79, 0x79, 0xC0,
+    0x79, 0x79, 0x79, 0xC0, 0x79, 0x79, 0x79, 0xC0, 0x79, 0x79, 0x79, 0xC0,
+    0x79, 0x79, 0xC0, 0x79, 0x79, 0x79, 0xC0, 0x79, 0x79, 0x79, 0xC0, 0x79,
+    0x79, 0xC0, 0xA2, 0xB3, 0x79, 0xC0, 0x79, 0x79, 0x79, 0xC0, 0x79, 0x79,
+    0x79, 0xC0, 0x79, 0x79, 0xC0, 0x79, 0x79, 0x79, 0xC0, 0x79, 0x79, 0x79,
+    0xC0, 0x79, 0x79, 0x79, 0xC0, 0x79, 0x79, 0xC0, 0x79, 0x79, 0x79, 0xC0,
+    0x79, 0x79, 0x79, 0xC0, 0x79, 0x79, 0xC0, 0xA2, 0xB3, 0x79, 0xC0, 0x79,
+    0x79, 0x79, 0xC0, 0x79, 0x79, 0x79, 0xC0, 0x79, 0x79, 0xC0, 0x79, 0x79,
+    0x79, 0xC0, 0x79, 0x79, 0x79, 0xC0, 0x79, 0x79, 0x79, 0xC0, 0x79, 0x79,
+    0xC0, 0x79, 0x79, 0x79, 0xC0, 0x79, 0x79, 0x79, 0xC0, 0x79, 0x79, 0xC0,
+    0xA2, 0xB3, 0x79, 0xC0, 0x79, 0x79, 0x79, 0xC0, 0x79, 0x79, 0x79, 0xC0,
+    0x79, 0x79, 0xC0, 0x79, 0x79, 0x79, 0xC0, 0x79, 0x79, 0x79, 0xC0, 0x79,
+    0x79, 0x79, 0xC0, 0x79, 0x79, 0xC0, 0x79, 0x79, 0x79, 0xC0, 0x79, 0x79,
+    0x79, 0xC0, 0x79, 0x79, 0xC0, 0xFE, 0xF8, 0x00, 0xC3, 0x76, 0xC3, 0x6D,
+    0xC3, 0x56, 0xC3, 0x1D, 0xC3, 0x3B, 0xC3, 0x19, 0xC3, 0x31, 0xC3, 0x1D,
+    0xC3, 0x3B, 0xC3, 0x19, 0xC3, 0x31, 0xC3, 0x1D, 0xC3, 0x3B, 0xC3, 0x19,
+    0xC3, 0x31, 0xC3, 0x1D, 0xC3, 0x3B, 0xC3, 0x19, 0xC3, 0x31, 0xC3, 0x1D,
+    0xC3, 0x3B, 0xC3, 0x19, 0xC3, 0x31, 0xC3, 0x1D, 0xC3, 0x3B, 0xC3, 0x19,
+    0xC3, 0x31, 0xC3, 0x1D, 0xC3, 0x3B, 0xC3, 0x19, 0xC3, 0x31, 0xC3, 0x1D,
+    0xC3, 0x3B, 0xC3, 0x19, 0xC3, 0x31, 0xC3, 0x1D, 0xC3, 0x3B, 0xC3, 0x19,
+    0xC3, 0x31, 0xC3, 0x1D, 0xC3, 0x3B, 0xC3, 0x19, 0xC3, 0x31, 0xC3, 0x1D,
+    0xC3, 0x3B, 0xC3, 0x19, 0xC3, 0x31, 0xC3, 0x1D, 0xC3, 0x3B, 0xC3, 0x19,
+    0xC3, 0x31, 0xC3, 0x1D, 0xC3, 0x3B, 0xC3, 0x19, 0xC3, 0x31, 0xC3, 0x1D,
+    0xC3, 0x3B, 0xC3, 0x19, 0xC3, 0x31, 0xC3, 0x1D, 0xC3, 0x3B, 0xC3, 0x19,
+    0xC3, 0x31, 0xC3, 0xFE, 0xC3, 0xC5, 0xE0, 0xA6, 0xFE, 0x82, 0xC9, 0xFE,
+    0xB7, 0x91, 0xFE, 0x0E, 0xD9, 0xFE, 0xEE, 0x66, 0xFE, 0x7F, 0x83, 0xFE,
+    0x1A, 0x8C, 0xFE, 0x50, 0x4E, 0xFE, 0x39, 0xF6, 0xFE, 0xBE, 0x5B, 0xAF,
+    0x8F, 0x90, 0x15, 0xFE, 0xC2, 0xF2, 0xFE, 0x34, 0x35, 0xBC, 0x3D, 0xFE,
+    0x06, 0xB6, 0xFE, 0x6E, 0xF7, 0xB0, 0xD2, 0x91, 0x7F, 0xFE, 0x5D, 0x39,
+    0xB2, 0xCA, 0xFE, 0x51, 0xB7, 0xFE, 0x24, 0xD4, 0xFE, 0x47, 0x0C, 0x86,
+    0x9A, 0xFE, 0x40, 0xDE, 0xFE, 0x43, 0xB5, 0x8A, 0xB6, 0xFE, 0x02, 0xB8,
+    0xFE, 0x6B, 0x3D, 0xFE, 0x6E, 0x53, 0x95, 0xB6, 0xFE, 0x55, 0x3D, 0xFE,
+    0x94, 0x1F, 0xFE, 0xA0, 0x96, 0xFE, 0x65, 0xD4, 0xFE, 0x68, 0xD8, 0xFE,
+    0x5D, 0x03, 0xFE, 0x64, 0xCD, 0xFE, 0xC4, 0x35, 0xFE, 0x98, 0xFA, 0xFE,
+    0x0B, 0x0B, 0xFE, 0xB8, 0xED, 0xFE, 0xD4, 0x6E, 0xFE, 0x54, 0xF8, 0xFE,
+    0x4A, 0x99, 0xFE, 0x87, 0x12, 0xFE, 0x21, 0x59, 0xFE, 0xA9, 0xE8, 0xA3,
+    0x5A, 0xFE, 0x01, 0xBB, 0xFE, 0xAD, 0x00, 0x86, 0x42, 0xFE, 0x9E, 0xB2,
+    0x9A, 0xE9, 0xFE, 0x9C, 0xB4, 0xFE, 0xF6, 0x24, 0xFE, 0xA1, 0xAF, 0x87,
+    0xC0, 0xFE, 0xF6, 0x62, 0xFE, 0xF1, 0xF0, 0xFE, 0x5A, 0x2C, 0xFE, 0x1D,
+    0x2F, 0xFE, 0x83, 0x2A, 0xFE, 0x0B, 0xB5, 0xFE, 0xB7, 0x1D, 0x9F, 0xCB,
+    0xB3, 0x70, 0x89, 0xD4, 0xFE, 0xBB, 0x7C, 0xFE, 0xC0, 0xB2, 0x80, 0x0B,
+    0xFE, 0xE7, 0xD8, 0xFE, 0x17, 0xEC, 0xFE, 0x5C, 0xA1, 0x9F, 0xA6, 0xFE,
+    0x3C, 0xF0, 0xFE, 0x7D, 0xFF, 0xFE, 0xEC, 0xA6, 0xFE, 0xB0, 0x52, 0xFE,
+    0xB5, 0xA7, 0xFE, 0x80, 0x75, 0xFE, 0xEC, 0xFA, 0xFE, 0x37, 0x52, 0xFE,
+    0xBC, 0x0E, 0xFE, 0x97, 0x7B, 0xBB, 0xB1, 0xFE, 0xDD, 0xAF, 0xA8, 0xE4,
+    0x80, 0x07, 0xFE, 0xAE, 0x75, 0xFE, 0xB9, 0xAA, 0xFE, 0x4B, 0xE0, 0xB1,
+    0xCF, 0x99, 0x82, 0xFE, 0x2F, 0x24, 0xFE, 0x9F, 0xF9, 0xFE, 0xA2, 0x33,
+    0xFE, 0x9C, 0xC2, 0x90, 0x8C, 0xFE, 0x28, 0x09, 0xFE, 0x4C, 0x38, 0xB1,
+    0xA5, 0xFE, 0xF7, 0xB3, 0xFE, 0x52, 0xB3, 0xFE, 0x18, 0xDB, 0xFE, 0x29,
+    0x73, 0x93, 0x3C, 0xA4, 0xF1, 0xFE, 0x79, 0x84, 0xFE, 0xB0, 0x0A, 0xFE,
+    0x80, 0x1B, 0xFE, 0xE9, 0x4C, 0xFE, 0xD7, 0xF0, 0xFE, 0x4A, 0x8F, 0xFE,
+    0x1C, 0x85, 0xFE, 0x10, 0xC0, 0xFE, 0xFC, 0xB4, 0xFE, 0xAB, 0x1A, 0xFE,
+    0x6A, 0x03, 0xFE, 0x42, 0xDA,
+};
+
+static void scene_graphics(void) {
+    st7789_clear_screen(0x0841);
+    st7789_fill_rect(4, 4, 60, 30, ST7789_RED);
+    st7789_fill_rect(70, 4, 1, 30, ST7789_GREEN);
+    st7789_fill_rect(76, 4, 30, 1, ST7789_BLUE);
+    st7789_fill_rect(200, 200, 40, 40, ST7789_YELLOW);   // Touches the right and bottom edges
+    for (uint16_t i = 0; i < 20; i++) {
+        st7789_draw_pixel(110 + i * 2, 4 + i, ST7789_WHITE);
+    }
+
+    // Lines in every octant from a common centre
+    for (int a = 0; a < 16; a++) {
+        static const int8_t dx[16] = { 30, 28, 21, 11, 0, -11, -21, -28, -30, -28, -21, -11, 0, 11, 21, 28 };
+        static const int8_t dy[16] = { 0, 11, 21, 28, 30, 28, 21, 11, 0, -11, -21, -28, -30, -28, -21, -11 };
+        st7789_draw_line(190, 40, 190 + dx[a], 40 + dy[a], 0xFFE0 - a * 0x0841);
+    }
+    st7789_draw_rect(4, 40, 50, 30, ST7789_CYAN);
+    st7789_draw_circle(90, 60, 20, ST7789_MAGENTA);
+    st7789_fill_circle(140, 60, 15, ST7789_GREEN);
+    st7789_draw_arc(140, 60, 19, -45, 200, ST7789_WHITE);
+    st7789_draw_round_rect(4, 80, 70, 40, 10, ST7789_WHITE);
+    st7789_fill_round_rect(80, 80, 70, 40, 14, ST7789_BLUE);
+    st7789_fill_triangle(160, 80, 230, 100, 170, 130, ST7789_RED);
+    st7789_draw_triangle(160, 80, 230, 100, 170, 130, ST7789_WHITE);
+
+    static const st7789_point_t star[] = {
+        { 40, 130 }, { 50, 160 }, { 80, 160 }, { 55, 178 }, { 65, 208 },
+        { 40, 190 }, { 15, 208 }, { 25, 178 }, { 0, 160 }, { 30, 160 },
+    };
+    TEST_ASSERT_EQUAL(ESP_OK, st7789_fill_polygon(star, sizeof(star) / sizeof(star[0]), ST7789_YELLOW));
+
+    // A scatter cloud, with repeats, and a same-color point batch
+    static st7789_pixel_t cloud[600];
+    static st7789_point_t points[300];
+    for (uint32_t i = 0; i < 600; i++) {
+        uint32_t h = i * 2654435761u;
+        cloud[i] = (st7789_pixel_t){ 100 + (h >> 8) % 48, 140 + (h >> 16) % 48, (uint16_t)(h >> 3) };
+    }
+    for (uint32_t i = 0; i < 300; i++) {
+        points[i] = (st7789_point_t){ 150 + i % 40, 140 + (i * 7) % 50 };
+    }
+    st7789_draw_pixels(cloud, 600);
+    st7789_draw_points(points, 300, ST7789_WHITE);
+}
+
+static void scene_text(void) {
+    st7789_clear_screen(ST7789_BLACK);
+    st7789_draw_char(0, 0, 'A', ST7789_RED, ST7789_BLUE);
+    st7789_draw_string(10, 0, "Hello, World! 0123456789 wraps at the edge\nNext line", ST7789_WHITE, 0x2104);
+    st7789_draw_large_char(0, 40, 'Q', ST7789_GREEN, ST7789_BLACK);
+    st7789_draw_large_string(20, 40, "Temp: 22.5C\nabc xyz ~{}", ST7789_YELLOW, 0x0010);
+    st7789_draw_string_scaled(0, 80, "x2 Scale", 2, ST7789_CYAN, ST7789_BLACK);
+    st7789_draw_string_scaled(0, 100, "x3!", 3, ST7789_MAGENTA, 0x2000);
+
+    static st7789_text_field_t field;
+    st7789_text_field_init(&field, 120, 100, ST7789_FONT_16X16, ST7789_WHITE, ST7789_RED);
+    st7789_text_field_update(&field, "22.5C");
+    st7789_text_field_update(&field, "22.1C");
+    st7789_text_field_update(&field, "9.8");
+
+    static st7789_digits_t digits;
+    st7789_digits_init(&digits, 4, 140, 60, 6, ST7789_GREEN, 0x0200);
+    st7789_digits_update(&digits, "-12.8*");
+    st7789_digits_update(&digits, "18:45");
+}
+
+static void scene_images(void) {
+    static uint16_t gradient[64 * 48];
+    for (uint16_t y = 0; y < 48; y++) {
+        for (uint16_t x = 0; x < 64; x++) {
+            gradient[y * 64 + x] = ((x / 2) << 11) | (y << 5) | (31 - x / 2);
+        }
+    }
+    static uint16_t swapped[64 * 48];
+    for (size_t i = 0; i < 64 * 48; i++) {
+        swapped[i] = gradient[i];
+    }
+    st7789_swap_pixels(swapped, 64 * 48);
+
+    st7789_clear_screen(0x1082);
+    st7789_blit(0, 0, 64, 48, gradient);
+    st7789_blit_be(70, 0, 64, 48, swapped);
+    st7789_blit_stride(140, 0, 20, 48, gradient + 10, 64, ST7789_PIXELS_HOST);
+    st7789_blit_sub(0, 60, gradient, 64, 16, 8, 32, 32, ST7789_PIXELS_HOST);
+    st7789_blit(200, 220, 64, 48, gradient);   // Clipped at the right and bottom edges
+
+    TEST_ASSERT_EQUAL(ESP_OK, st7789_draw_image(60, 60, pattern_s7q, sizeof(pattern_s7q)));
+    TEST_ASSERT_EQUAL(ESP_OK, st7789_draw_image(220, 100, pattern_s7q, sizeof(pattern_s7q)));
+}
+
+static void scene_terminal(void) {
+    st7789_clear_screen(ST7789_BLACK);
+    st7789_draw_string(0, 4, "HEADER", ST7789_YELLOW, ST7789_BLACK);
+    st7789_term_config_t config = ST7789_TERM_CONFIG_DEFAULT();
+    config.top_fixed = 16;
+    config.bottom_fixed = 16;
+    TEST_ASSERT_EQUAL(ESP_OK, st7789_term_init(&config));
+    st7789_fill_rect(0, 224, 240, 16, ST7789_BLUE);
+    for (int i = 0; i < 40; i++) {
+        st7789_term_printf("line %02d%s\n", i, i == 30 ? " long enough to wrap onto the next line" : "");
+    }
+    st7789_term_set_colors(ST7789_GREEN, ST7789_BLACK);
+    st7789_term_puts("tail\tx");
+}
+
+typedef struct {
+    const char *name;
+    void (*draw)(void);
+    uint32_t via;
+} scene_t;
+
+static uint16_t golden[TEST_PIXELS];
+
+static void run_band(uint16_t y, uint16_t h, void *ctx) {
+    ((const scene_t *)ctx)->draw();
+}
+
+// Draw the scene directly against its golden image, then through each other path
+static void check_scene(const scene_t *scene) {
+    test_panel_reset();
+    scene->draw();
+    test_assert_protocol_clean();
+    test_assert_golden(scene->name);
+    test_snapshot(golden);
+
+    if (scene->via & VIA_FB_FULL) {
+        test_panel_reset();
+        TEST_ASSERT_EQUAL(ESP_OK, st7789_fb_enable(ST7789_FB_FULL, 0));
+        scene->draw();
+        st7789_flush();
+        st7789_fb_disable();
+        TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, test_snapshot_diff(golden), "full framebuffer");
+    }
+    if (scene->via & VIA_FB_BAND) {
+        test_panel_reset();
+        TEST_ASSERT_EQUAL(ESP_OK, st7789_fb_enable(ST7789_FB_BAND, 40));
+        scene->draw();
+        st7789_flush();
+        st7789_fb_disable();
+        TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, test_snapshot_diff(golden), "band framebuffer");
+    }
+    if (scene->via & VIA_ASYNC) {
+        test_panel_reset();
+        st7789_async_config_t config = ST7789_ASYNC_CONFIG_DEFAULT();
+        config.block_timeout_ms = 5000;   // A dropped command would show up as a diff
+        TEST_ASSERT_EQUAL(ESP_OK, st7789_async_start(&config));
+        scene->draw();
+        TEST_ASSERT_EQUAL(ESP_OK, st7789_wait_idle(UINT32_MAX));
+        st7789_async_stop();
+        TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, test_snapshot_diff(golden), "async");
+    }
+    if (scene->via & VIA_BAND) {
+        test_panel_reset();
+        TEST_ASSERT_EQUAL(ESP_OK, st7789_band_render(0, TEST_HEIGHT, ST7789_BLACK, run_band,
+                                                     (void *)scene));
+        TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, test_snapshot_diff(golden), "band render");
+    }
+    test_assert_protocol_clean();
+}
+
+void test_golden_graphics(void) {
+    static const scene_t scene = { "graphics", scene_graphics, VIA_ALL };
+    check_scene(&scene);
+}
+
+void test_golden_text(void) {
+    // Text fields and readouts keep state between calls, so no band render
+    static const scene_t scene = { "text", scene_text, VIA_FB_FULL | VIA_FB_BAND | VIA_ASYNC };
+    check_scene(&scene);
+}
+
+void test_golden_images(void) {
+    static const scene_t scene = { "images", scene_images, VIA_ALL };
+    check_scene(&scene);
+}
+
+void test_golden_images_12bit(void) {
+    test_panel_reset();
+    TEST_ASSERT_EQUAL(ESP_OK, st7789_set_color_depth(ST7789_COLOR_12BIT));
+    scene_images();
+    test_assert_protocol_clean();
+    test_assert_golden("images_12bit");
+}
+
+void test_golden_terminal(void) {
+    // Hardware scrolling cannot go through a framebuffer
+    static const scene_t scene = { "terminal", scene_terminal, VIA_ASYNC };
+    check_scene(&scene);
+}
+
+void test_golden_indexed(void) {
+    test_panel_reset();
+    TEST_ASSERT_EQUAL(ESP_OK, st7789_fb_enable(ST7789_FB_INDEXED4, 0));
+    scene_graphics();
+    st7789_flush();
+    test_assert_golden("indexed4");
+
+    // Recoloring through the palette alone must change the image on the next flush
+    static const uint16_t night[] = { 0x0000, 0x8410, 0x4000, 0x0200 };
+    TEST_ASSERT_EQUAL(ESP_OK, st7789_fb_set_palette(0, night, 4));
+    st7789_flush();
+    st7789_fb_disable();
+    test_assert_protocol_clean();
+    test_assert_golden("indexed4_night");
+}
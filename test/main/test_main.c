@@ -0,0 +1,50 @@
+#include <stdlib.h>
+#include "unity.h"
+
+/*
+ * Host tests for the st7789 driver. Built for the Linux target with the mock
+ * transport, whose bytes feed the panel emulator (st7789_emu.h).
+ */
+
+void test_golden_graphics(void);
+void test_golden_text(void);
+void test_golden_images(void);
+void test_golden_images_12bit(void);
+void test_golden_terminal(void);
+void test_golden_indexed(void);
+void test_bus_bytes_per_op(void);
+void test_bitbang_model_round_trip(void);
+void test_fill_rect_stream(void);
+void test_clear_screen_stream(void);
+void test_string_commands(void);
+void test_font16_every_glyph(void);
+void test_round_rect_reference(void);
+void test_round_rect_two_pixel_sides(void);
+void test_fill_triangle_covers_outline(void);
+void test_pixels_scatter(void);
+void test_pixels_cluster(void);
+void test_points_plot(void);
+
+void app_main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_golden_graphics);
+    RUN_TEST(test_golden_text);
+    RUN_TEST(test_golden_images);
+    RUN_TEST(test_golden_images_12bit);
+    RUN_TEST(test_golden_terminal);
+    RUN_TEST(test_golden_indexed);
+    RUN_TEST(test_bus_bytes_per_op);
+    RUN_TEST(test_bitbang_model_round_trip);
+    RUN_TEST(test_fill_rect_stream);
+    RUN_TEST(test_clear_screen_stream);
+    RUN_TEST(test_string_commands);
+    RUN_TEST(test_font16_every_glyph);
+    RUN_TEST(test_round_rect_reference);
+    RUN_TEST(test_round_rect_two_pixel_sides);
+    RUN_TEST(test_fill_triangle_covers_outline);
+    RUN_TEST(test_pixels_scatter);
+    RUN_TEST(test_pixels_cluster);
+    RUN_TEST(test_points_plot);
+    exit(UNITY_END() == 0 ? EXIT_SUCCESS : EXIT_FAILURE);
+}
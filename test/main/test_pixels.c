@@ -0,0 +1,139 @@
+#include "test_common.h"
+#include "unity.h"
+#include <stdio.h>
+
+/*
+ * st7789_draw_pixels()/st7789_draw_points() must leave the panel exactly as
+ * one st7789_draw_pixel() per point in order would, in immediate mode, in
+ * both framebuffer modes and through the async queue, and must send fewer
+ * bus bytes doing it.
+ */
+
+#define CLOUD_POINTS  1500   // More than one ST7789_PIXEL_BATCH chunk
+
+typedef enum {
+    MODE_DIRECT,
+    MODE_FB_FULL,
+    MODE_FB_BAND,
+    MODE_ASYNC,
+    MODE_COUNT,
+} draw_mode_t;
+
+static const char *const mode_names[MODE_COUNT] = { "direct", "fb full", "fb band", "async" };
+
+static st7789_pixel_t cloud[CLOUD_POINTS];
+static st7789_point_t points[CLOUD_POINTS];
+static uint16_t sequential[TEST_PIXELS];
+
+static void begin(draw_mode_t mode) {
+    test_panel_reset();
+    st7789_clear_screen(0x0841);
+    if (mode == MODE_FB_FULL) {
+        TEST_ASSERT_EQUAL(ESP_OK, st7789_fb_enable(ST7789_FB_FULL, 0));
+        st7789_clear_screen(0x0841);   // The buffer starts black
+    } else if (mode == MODE_FB_BAND) {
+        TEST_ASSERT_EQUAL(ESP_OK, st7789_fb_enable(ST7789_FB_BAND, 40));
+    } else if (mode == MODE_ASYNC) {
+        st7789_async_config_t config = ST7789_ASYNC_CONFIG_DEFAULT();
+        config.block_timeout_ms = 5000;
+        TEST_ASSERT_EQUAL(ESP_OK, st7789_async_start(&config));
+    }
+    test_bus_reset();
+}
+
+// Finish the mode and return the bus bytes sent since begin()
+static uint64_t end(draw_mode_t mode) {
+    if (mode == MODE_FB_FULL || mode == MODE_FB_BAND) {
+        st7789_flush();
+        st7789_fb_disable();
+    } else if (mode == MODE_ASYNC) {
+        TEST_ASSERT_EQUAL(ESP_OK, st7789_wait_idle(UINT32_MAX));
+        st7789_async_stop();
+    }
+    test_assert_protocol_clean();
+    return test_bus_bytes();
+}
+
+// Points drawn one by one, then as a batch, which must save more than
+// min_saving percent of the bus bytes in immediate mode
+static void check_batch(const char *name, bool same_color, uint16_t color, uint32_t min_saving) {
+    uint64_t bytes_each = 0, bytes_batch = 0;
+    for (draw_mode_t mode = 0; mode < MODE_COUNT; mode++) {
+        begin(mode);
+        for (size_t i = 0; i < CLOUD_POINTS; i++) {
+            if (same_color) {
+                st7789_draw_pixel(points[i].x, points[i].y, color);
+            } else {
+                st7789_draw_pixel(cloud[i].x, cloud[i].y, cloud[i].color);
+            }
+        }
+        uint64_t each = end(mode);
+        test_snapshot(sequential);
+
+        begin(mode);
+        if (same_color) {
+            st7789_draw_points(points, CLOUD_POINTS, color);
+        } else {
+            st7789_draw_pixels(cloud, CLOUD_POINTS);
+        }
+        uint64_t batch = end(mode);
+        uint32_t diff = test_snapshot_diff(sequential);
+        if (diff != 0) {
+            printf("%s, %s: %lu pixels differ\n", name, mode_names[mode], (unsigned long)diff);
+        }
+        TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, diff, mode_names[mode]);
+        if (mode == MODE_DIRECT) {
+            bytes_each = each;
+            bytes_batch = batch;
+        }
+    }
+
+    uint32_t saving = (uint32_t)(100 - bytes_batch * 100 / bytes_each);
+    printf("%s: %llu bus bytes one by one, %llu batched (%lu%% less)\n", name,
+           (unsigned long long)bytes_each, (unsigned long long)bytes_batch, (unsigned long)saving);
+    TEST_ASSERT_GREATER_THAN_MESSAGE(min_saving, saving, name);
+}
+
+static uint32_t next_random(uint32_t *seed) {
+    *seed = *seed * 1664525 + 1013904223;
+    return *seed >> 8;
+}
+
+void test_pixels_scatter(void) {
+    // Uniform over the panel plus a margin past it, with repeats in other colors
+    uint32_t seed = 12345;
+    for (size_t i = 0; i < CLOUD_POINTS; i++) {
+        if (i % 10 == 9) {
+            cloud[i] = cloud[next_random(&seed) % i];
+            cloud[i].color ^= 0xFFFF;
+        } else {
+            cloud[i].x = next_random(&seed) % (TEST_WIDTH + 20);
+            cloud[i].y = next_random(&seed) % (TEST_HEIGHT + 20);
+            cloud[i].color = next_random(&seed);
+        }
+    }
+    check_batch("scatter", false, 0, 25);
+}
+
+void test_pixels_cluster(void) {
+    // A dense blob: most points have a horizontal neighbour
+    uint32_t seed = 777;
+    for (size_t i = 0; i < CLOUD_POINTS; i++) {
+        cloud[i].x = 100 + next_random(&seed) % 48;
+        cloud[i].y = 100 + next_random(&seed) % 40;
+        cloud[i].color = (i & 1) ? ST7789_GREEN : ST7789_YELLOW;
+    }
+    check_batch("cluster", false, 0, 55);
+}
+
+void test_points_plot(void) {
+    // Triangle-wave traces: short runs along each step, one band per 240 points
+    for (size_t i = 0; i < CLOUD_POINTS; i++) {
+        uint16_t x = i % TEST_WIDTH;
+        uint16_t band = i / TEST_WIDTH;
+        int32_t t = (int32_t)x * 4 - 480;
+        int32_t y = 20 + band * 30 + (t < 0 ? -t : t) / 40;
+        points[i] = (st7789_point_t){ x, (uint16_t)y };
+    }
+    check_batch("plot", true, ST7789_CYAN, 60);
+}
@@ -0,0 +1,190 @@
+#include "test_common.h"
+#include "unity.h"
+#include <stdio.h>
+#include <string.h>
+
+/*
+ * Rounded rectangles against a reference built pixel by pixel: the straight
+ * edges between the corner centres (both centres' axis points when they
+ * cross), plus the midpoint-circle quadrant of each corner. Filled, each
+ * row runs between the outline's outermost pixels. Triangle fills must
+ * cover their outline exactly, flat and degenerate triangles included.
+ */
+
+#define BOX      24   // Test area, and the largest rectangle side swept
+#define ORIGIN   8
+
+static bool ref[BOX + 2][BOX + 2];
+
+static void ref_set(int x, int y) {
+    if (x >= 0 && y >= 0 && x < BOX + 2 && y < BOX + 2) {
+        ref[y][x] = true;
+    }
+}
+
+// Reference outline of a w x h rounded rectangle at (1, 1) in ref[]
+static void ref_round_rect(int w, int h, int r) {
+    memset(ref, 0, sizeof(ref));
+    int max = (w < h ? w : h) / 2;
+    if (r > max) r = max;
+    int x = 1, y = 1;
+    int xl = x + r, xr = x + w - 1 - r, yt = y + r, yb = y + h - 1 - r;
+    int ex0 = xl < xr ? xl : xr, ex1 = xl < xr ? xr : xl;
+    int ey0 = yt < yb ? yt : yb, ey1 = yt < yb ? yb : yt;
+    for (int i = ex0; i <= ex1; i++) {
+        ref_set(i, y);
+        ref_set(i, y + h - 1);
+    }
+    for (int i = ey0; i <= ey1; i++) {
+        ref_set(x, i);
+        ref_set(x + w - 1, i);
+    }
+    if (r == 0) {
+        return;
+    }
+    // Midpoint circle, each point in the quadrant of its corner
+    int px = 0, py = r, d = 1 - r;
+    while (px <= py) {
+        const int pts[8][2] = {
+            { px, py }, { py, px }, { -px, py }, { -py, px },
+            { px, -py }, { py, -px }, { -px, -py }, { -py, -px },
+        };
+        for (int i = 0; i < 8; i++) {
+            int dx = pts[i][0], dy = pts[i][1];
+            if (dx >= 0 && dy >= 0) ref_set(xr + dx, yb + dy);
+            if (dx >= 0 && dy <= 0) ref_set(xr + dx, yt + dy);
+            if (dx <= 0 && dy >= 0) ref_set(xl + dx, yb + dy);
+            if (dx <= 0 && dy <= 0) ref_set(xl + dx, yt + dy);
+        }
+        if (d < 0) {
+            d += 2 * px + 3;
+        } else {
+            d += 2 * (px - py) + 5;
+            py--;
+        }
+        px++;
+    }
+}
+
+// Turn the reference outline into its fill
+static void ref_fill_rows(void) {
+    for (int y = 0; y < BOX + 2; y++) {
+        int left = -1, right = -1;
+        for (int x = 0; x < BOX + 2; x++) {
+            if (ref[y][x]) {
+                if (left < 0) left = x;
+                right = x;
+            }
+        }
+        for (int x = left; left >= 0 && x <= right; x++) {
+            ref[y][x] = true;
+        }
+    }
+}
+
+// Compare the panel area against ref[]; returns the number of differing pixels
+static int compare_ref(uint16_t color, bool report, const char *what, int w, int h, int r) {
+    int diff = 0;
+    for (int y = 0; y < BOX + 2; y++) {
+        for (int x = 0; x < BOX + 2; x++) {
+            bool set = st7789_emu_get_pixel565(ORIGIN - 1 + x, ORIGIN - 1 + y) == color;
+            if (set != ref[y][x]) {
+                if (report && diff == 0) {
+                    printf("%s %dx%d r=%d: pixel (%d, %d) %s\n", what, w, h, r, x - 1, y - 1,
+                           set ? "drawn, expected blank" : "missing");
+                }
+                diff++;
+            }
+        }
+    }
+    return diff;
+}
+
+static void clear_box(void) {
+    st7789_fill_rect(ORIGIN - 1, ORIGIN - 1, BOX + 2, BOX + 2, ST7789_BLACK);
+}
+
+void test_round_rect_reference(void) {
+    test_panel_reset();
+    int failures = 0;
+    for (int w = 1; w <= BOX; w++) {
+        for (int h = 1; h <= BOX; h++) {
+            for (int r = 0; r <= 13; r++) {
+                ref_round_rect(w, h, r);
+                clear_box();
+                st7789_draw_round_rect(ORIGIN, ORIGIN, w, h, r, ST7789_WHITE);
+                failures += compare_ref(ST7789_WHITE, failures < 5, "draw_round_rect", w, h, r) != 0;
+
+                ref_fill_rows();
+                clear_box();
+                st7789_fill_round_rect(ORIGIN, ORIGIN, w, h, r, ST7789_WHITE);
+                failures += compare_ref(ST7789_WHITE, failures < 5, "fill_round_rect", w, h, r) != 0;
+            }
+        }
+    }
+    test_assert_protocol_clean();
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, failures, "rounded rectangles differing from the reference");
+}
+
+// The cases where the corner centres cross with radius-1 corners
+void test_round_rect_two_pixel_sides(void) {
+    static const struct { uint16_t w, h; } sizes[] = { { 2, 2 }, { 2, 9 }, { 9, 2 } };
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        uint16_t w = sizes[i].w, h = sizes[i].h;
+        test_panel_reset();
+        st7789_draw_round_rect(10, 10, w, h, 5, ST7789_WHITE);
+        st7789_fill_round_rect(50, 10, w, h, 5, ST7789_WHITE);
+        // Every pixel of a 2-pixel side lies on the outline
+        for (uint16_t y = 0; y < h; y++) {
+            for (uint16_t x = 0; x < w; x++) {
+                TEST_ASSERT_EQUAL_HEX16(ST7789_WHITE, st7789_emu_get_pixel565(10 + x, 10 + y));
+                TEST_ASSERT_EQUAL_HEX16(ST7789_WHITE, st7789_emu_get_pixel565(50 + x, 10 + y));
+            }
+        }
+    }
+}
+
+static uint16_t outline[TEST_PIXELS];
+
+void test_fill_triangle_covers_outline(void) {
+    static const uint16_t tris[][6] = {
+        { 10, 10, 200, 40, 60, 180 },
+        { 200, 40, 10, 10, 60, 180 },      // Same triangle, other winding
+        { 5, 100, 235, 100, 120, 100 },    // Flat: all on one row
+        { 50, 5, 50, 230, 50, 120 },       // Flat: all in one column
+        { 10, 20, 110, 70, 210, 120 },     // Collinear on a diagonal
+        { 30, 30, 30, 30, 30, 30 },        // A single point
+        { 40, 50, 41, 90, 39, 130 },       // Sliver
+        { 100, 200, 300, 260, 20, 400 },   // Off the bottom and right
+        { 0, 0, 239, 0, 0, 239 },
+    };
+    for (size_t i = 0; i < sizeof(tris) / sizeof(tris[0]); i++) {
+        const uint16_t *t = tris[i];
+        test_panel_reset();
+        st7789_draw_triangle(t[0], t[1], t[2], t[3], t[4], t[5], ST7789_WHITE);
+        test_snapshot(outline);
+
+        test_panel_reset();
+        st7789_fill_triangle(t[0], t[1], t[2], t[3], t[4], t[5], ST7789_RED);
+        test_assert_protocol_clean();
+
+        for (uint16_t y = 0; y < TEST_HEIGHT; y++) {
+            int left = -1, right = -1;
+            for (uint16_t x = 0; x < TEST_WIDTH; x++) {
+                if (outline[y * TEST_WIDTH + x] == ST7789_WHITE) {
+                    if (left < 0) left = x;
+                    right = x;
+                }
+            }
+            // Filled from the leftmost to the rightmost outline pixel, nothing else
+            for (uint16_t x = 0; x < TEST_WIDTH; x++) {
+                bool inside = left >= 0 && x >= left && x <= right;
+                uint16_t got = st7789_emu_get_pixel565(x, y);
+                if (got != (inside ? ST7789_RED : ST7789_BLACK)) {
+                    printf("triangle %u: pixel (%u, %u) is 0x%04X\n", (unsigned)i, x, y, got);
+                    TEST_FAIL_MESSAGE("fill does not match the outline");
+                }
+            }
+        }
+    }
+}
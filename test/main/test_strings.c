@@ -0,0 +1,105 @@
+#include "test_common.h"
+#include "unity.h"
+#include <stdio.h>
+
+/*
+ * String drawing against the original per-glyph loop, reproduced here with
+ * st7789_draw_char()/st7789_draw_large_char() and a fresh window for every
+ * glyph. The string calls must draw the same glyph pixels, may only add
+ * background in the gaps between them, and must send far fewer commands.
+ */
+
+#define SENTINEL  0x0841   // Screen color that neither a glyph nor its background uses
+#define FG        ST7789_YELLOW
+#define BG        ST7789_BLUE
+
+typedef struct {
+    void (*draw_char)(uint16_t x, uint16_t y, char c, uint16_t color, uint16_t bg_color);
+    void (*draw_string)(uint16_t x, uint16_t y, const char *str, uint16_t color, uint16_t bg_color);
+    uint16_t width, height;   // Glyph cell
+    uint16_t advance;         // Glyph width plus spacing
+    uint16_t line_pitch;      // Glyph height plus spacing
+} font_t;
+
+static const font_t font8 = { st7789_draw_char, st7789_draw_string, 8, 8, 9, 10 };
+static const font_t font16 = { st7789_draw_large_char, st7789_draw_large_string, 16, 16, 18, 20 };
+
+// The original draw_string()/draw_large_string() loop
+static void draw_per_glyph(const font_t *font, uint16_t x, uint16_t y, const char *str) {
+    uint16_t cur_x = x, cur_y = y;
+    for (; *str; str++) {
+        if (*str == '\n') {
+            cur_x = x;
+            cur_y += font->line_pitch;
+        } else if (*str == '\r') {
+            cur_x = x;
+        } else {
+            if (cur_x + font->width <= TEST_WIDTH && cur_y + font->height <= TEST_HEIGHT) {
+                st7789_window_cache_invalidate();   // The original set a full window per glyph
+                font->draw_char(cur_x, cur_y, *str, FG, BG);
+            }
+            cur_x += font->advance;
+            if (cur_x + font->width > TEST_WIDTH) {
+                cur_x = x;
+                cur_y += font->line_pitch;
+            }
+        }
+        if (cur_y + font->height > TEST_HEIGHT) {
+            break;
+        }
+    }
+}
+
+static uint16_t per_glyph[TEST_PIXELS];
+static uint16_t whole[TEST_PIXELS];
+
+static void check_string(const font_t *font, uint16_t x, uint16_t y, const char *str,
+                         uint32_t expected_commands) {
+    test_panel_reset();
+    st7789_clear_screen(SENTINEL);
+    test_bus_reset();
+    draw_per_glyph(font, x, y, str);
+    uint32_t before = test_bus_commands();
+    test_snapshot(per_glyph);
+
+    test_panel_reset();
+    st7789_clear_screen(SENTINEL);
+    test_bus_reset();
+    font->draw_string(x, y, str, FG, BG);
+    uint32_t after = test_bus_commands();
+    test_snapshot(whole);
+    test_assert_protocol_clean();
+
+    uint32_t gaps = 0;
+    for (uint32_t i = 0; i < TEST_PIXELS; i++) {
+        if (whole[i] != per_glyph[i]) {
+            if (per_glyph[i] != SENTINEL || whole[i] != BG) {
+                printf("\"%s\": pixel (%u, %u) is 0x%04X, per-glyph drawing gave 0x%04X\n", str,
+                       (unsigned)(i % TEST_WIDTH), (unsigned)(i / TEST_WIDTH), whole[i], per_glyph[i]);
+                TEST_FAIL_MESSAGE("string differs from per-glyph drawing");
+            }
+            gaps++;
+        }
+    }
+
+    printf("%2ux%-2u \"", font->width, font->height);
+    for (const char *p = str; *p; p++) {
+        printf(*p == '\n' ? "\\n" : *p == '\r' ? "\\r" : "%c", *p);
+    }
+    printf("\": %lu commands per glyph, %lu as a string, %lu gap pixels filled\n",
+           (unsigned long)before, (unsigned long)after, (unsigned long)gaps);
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(expected_commands, after, str);
+    TEST_ASSERT_LESS_THAN_MESSAGE(before, after, str);
+}
+
+void test_string_commands(void) {
+    check_string(&font8, 10, 10, "Hello", 3);
+    check_string(&font8, 0, 0, "Hello, World!", 3);
+    check_string(&font8, 4, 100, "two\nlines", 6);
+    check_string(&font8, 4, 100, "over\rwrite", 5);
+    check_string(&font8, 200, 50, "wraps at the right edge", 14);
+    check_string(&font8, 0, 230, "clipped\nat the bottom", 3);
+    check_string(&font16, 10, 10, "Temp", 3);
+    check_string(&font16, 0, 40, "22.5C\nabc", 6);
+    check_string(&font16, 150, 200, "wrap ~{}", 6);
+}
@@ -0,0 +1,131 @@
+#!/usr/bin/env python3
+"""Generate the ST7789 16x16 font table from its text source.
+
+Reads tools/font16x16.txt (one 16x16 block of '#' and '.' per printable
+ASCII character) and writes components/st7789/st7789_font16x16.c. Blank
+rows above and below each glyph are trimmed, so the table stores only the
+rows that carry ink, two bytes per row.
+
+    python tools/st7789_font_gen.py            # regenerate the table
+    python tools/st7789_font_gen.py --check    # fail if it is out of date
+"""
+
+import argparse
+import os
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+SOURCE = os.path.join(ROOT, "tools", "font16x16.txt")
+OUTPUT = os.path.join(ROOT, "components", "st7789", "st7789_font16x16.c")
+
+FIRST, LAST = 32, 126
+SIZE = 16
+
+
+def parse(path):
+    """Return {code: [16 row bitmasks, MSB = leftmost pixel]}."""
+    glyphs, code, rows = {}, None, []
+    with open(path) as f:
+        for lineno, line in enumerate(f, 1):
+            line = line.rstrip("\n")
+            if not line or line.startswith("#") and code is None:
+                continue
+            if line.startswith("char "):
+                code, rows = int(line.split()[1]), []
+                if not FIRST <= code <= LAST or code in glyphs:
+                    sys.exit("%s:%d: bad or repeated character %d" % (path, lineno, code))
+                continue
+            if code is None or len(line) != SIZE or set(line) - set("#."):
+                sys.exit("%s:%d: expected %d cells of '#' or '.'" % (path, lineno, SIZE))
+            rows.append(int(line.replace("#", "1").replace(".", "0"), 2))
+            if len(rows) == SIZE:
+                glyphs[code], code = rows, None
+    missing = [c for c in range(FIRST, LAST + 1) if c not in glyphs]
+    if missing or code is not None:
+        sys.exit("%s: incomplete font, missing %s" % (path, missing or [code]))
+    return glyphs
+
+
+def check_ink(glyphs):
+    """Every printable character other than space must draw something."""
+    blank = [chr(c) for c, rows in glyphs.items() if c != 32 and not any(rows)]
+    if blank:
+        sys.exit("glyphs without ink: %s" % " ".join(blank))
+
+
+def describe(code):
+    ch = chr(code)
+    return "'\\%s'" % ch if ch in "'\\" else "'%s'" % ch
+
+
+def render(glyphs):
+    """Return the C source for the packed table."""
+    data, index = [], []
+    for code in range(FIRST, LAST + 1):
+        rows = glyphs[code]
+        ink = [i for i, r in enumerate(rows) if r]
+        top = ink[0] if ink else 0
+        used = rows[top:ink[-1] + 1] if ink else []
+        index.append((len(data) * 2, top, len(used), code))
+        data.append((code, used))
+
+    total = sum(len(used) for _, used in data) * 2
+    out = [
+        "// Generated by tools/st7789_font_gen.py from tools/font16x16.txt. Do not edit.",
+        "",
+        '#include "st7789_priv.h"',
+        "",
+        "// Inked rows of each glyph, two bytes per row, most significant bit leftmost",
+        "const uint8_t st7789_font16x16_rows[] = {",
+    ]
+    for code, used in data:
+        if not used:
+            continue
+        out.append("    // %s (%d)" % (describe(code), code))
+        row_bytes = ["0x%02X, 0x%02X," % (r >> 8, r & 0xFF) for r in used]
+        for i in range(0, len(row_bytes), 4):
+            out.append("    " + " ".join(row_bytes[i:i + 4]))
+    out += [
+        "};",
+        "",
+        "const st7789_glyph16_t st7789_font16x16[%d] = {" % (LAST - FIRST + 1),
+    ]
+    offset = 0
+    for _, top, count, code in index:
+        out.append("    { %4d, %2d, %2d },  // %s" % (offset, top, count, describe(code)))
+        offset += count * 2
+    out += [
+        "};",
+        "",
+        "_Static_assert(sizeof(st7789_font16x16_rows) == %d, \"row table out of step with the index\");" % total,
+        "_Static_assert(sizeof(st7789_font16x16) / sizeof(st7789_font16x16[0]) == 95,",
+        "               \"one entry per printable ASCII character\");",
+        "",
+    ]
+    return "\n".join(out), total
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--check", action="store_true",
+                        help="verify the generated file is up to date instead of writing it")
+    args = parser.parse_args()
+
+    glyphs = parse(SOURCE)
+    check_ink(glyphs)
+    text, total = render(glyphs)
+
+    if args.check:
+        with open(OUTPUT) as f:
+            if f.read() != text:
+                sys.exit("%s is out of date; run %s" % (OUTPUT, sys.argv[0]))
+        print("%d glyphs OK, %d bytes of rows" % (len(glyphs), total))
+        return
+
+    with open(OUTPUT, "w") as f:
+        f.write(text)
+    print("wrote %s: %d glyphs, %d bytes of rows" % (OUTPUT, len(glyphs), total))
+
+
+if __name__ == "__main__":
+    main()
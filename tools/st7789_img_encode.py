@@ -0,0 +1,286 @@
+#!/usr/bin/env python3
+"""Encode images as S7Q, the compressed RGB565 format of st7789_draw_image().
+
+Reads 8-bit PNG (greyscale, RGB, palette, with or without alpha; not
+interlaced) or binary PPM, converts to RGB565 and writes either the raw
+.s7q file or a C source file with the data as a const array for flash.
+Transparent pixels are blended over --background. Prints the compression
+ratio against raw RGB565.
+
+    python tools/st7789_img_encode.py splash.png -o splash.s7q
+    python tools/st7789_img_encode.py icon.png --c-array icon_wifi -o icon_wifi.c
+    python tools/st7789_img_encode.py splash.png --check     # round-trip only
+
+The op layout is documented in components/st7789/st7789_image.c.
+"""
+
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+MAGIC = b"S7Q1"
+OP_INDEX, OP_DIFF, OP_LUMA, OP_RUN, OP_LONG, OP_RGB = 0x00, 0x40, 0x80, 0xC0, 0xE0, 0xFE
+RUN_MAX, LONG_MAX = 32, 33 + 0xFFF
+
+
+# --- RGB565 helpers ---------------------------------------------------------
+
+def to565(r, g, b):
+    return ((r * 31 + 127) // 255) << 11 | ((g * 63 + 127) // 255) << 5 | (b * 31 + 127) // 255
+
+
+def split(c):
+    return c >> 11, (c >> 5) & 0x3F, c & 0x1F
+
+
+def color_hash(c):
+    r, g, b = split(c)
+    return (r * 3 + g * 5 + b * 7) & 0x3F
+
+
+def wrap(v, bits):
+    """Signed representative of v modulo 2**bits."""
+    half = 1 << (bits - 1)
+    return (v + half) % (1 << bits) - half
+
+
+# --- Codec --------------------------------------------------------------------
+
+def encode(pixels, width, height):
+    """Return the S7Q bytes for width*height RGB565 values in raster order."""
+    out = bytearray(MAGIC + struct.pack("<HH", width, height))
+    index = [0] * 64
+    prev, run = 0, 0
+
+    def flush_run():
+        if run <= RUN_MAX:
+            out.append(OP_RUN | (run - 1))
+        else:
+            n = run - 33
+            out.extend((OP_LONG | n >> 8, n & 0xFF))
+
+    for c in pixels:
+        if c == prev:
+            run += 1
+            if run == LONG_MAX:
+                flush_run()
+                run = 0
+            continue
+        if run:
+            flush_run()
+            run = 0
+
+        h = color_hash(c)
+        if index[h] == c:
+            out.append(OP_INDEX | h)
+        else:
+            index[h] = c
+            (r, g, b), (pr, pg, pb) = split(c), split(prev)
+            dr, dg, db = wrap(r - pr, 5), wrap(g - pg, 6), wrap(b - pb, 5)
+            half = dg >> 1
+            lr, lb = wrap(dr - half, 5), wrap(db - half, 5)
+            if -2 <= dr <= 1 and -2 <= dg <= 1 and -2 <= db <= 1:
+                out.append(OP_DIFF | (dr + 2) << 4 | (dg + 2) << 2 | (db + 2))
+            elif -8 <= lr <= 7 and -8 <= lb <= 7:
+                out.extend((OP_LUMA | (dg + 32), (lr + 8) << 4 | (lb + 8)))
+            else:
+                out.extend((OP_RGB, c >> 8, c & 0xFF))
+        prev = c
+    if run:
+        flush_run()
+    return bytes(out)
+
+
+def decode(data):
+    """Return (width, height, pixels) from S7Q bytes; the reference decoder."""
+    if data[:4] != MAGIC or len(data) < 8:
+        raise ValueError("not an S7Q image")
+    width, height = struct.unpack("<HH", data[4:8])
+    index, prev, pixels, p = [0] * 64, 0, [], 8
+    while len(pixels) < width * height:
+        op = data[p]
+        p += 1
+        if op == OP_RGB:
+            c = data[p] << 8 | data[p + 1]
+            p += 2
+        elif op & 0xC0 == OP_INDEX:
+            c = index[op & 0x3F]
+        elif op & 0xC0 == OP_DIFF:
+            r, g, b = split(prev)
+            c = ((r + (op >> 4 & 3) - 2) & 0x1F) << 11 | ((g + (op >> 2 & 3) - 2) & 0x3F) << 5 \
+                | ((b + (op & 3) - 2) & 0x1F)
+        elif op & 0xC0 == OP_LUMA:
+            rb, half = data[p], ((op & 0x3F) >> 1) - 16
+            p += 1
+            r, g, b = split(prev)
+            c = ((r + (rb >> 4) - 8 + half) & 0x1F) << 11 | ((g + (op & 0x3F) - 32) & 0x3F) << 5 \
+                | ((b + (rb & 0x0F) - 8 + half) & 0x1F)
+        elif op & 0xE0 == OP_RUN:
+            pixels.extend([prev] * ((op & 0x1F) + 1))
+            continue
+        elif op & 0xF0 == OP_LONG:
+            pixels.extend([prev] * (((op & 0x0F) << 8 | data[p]) + 33))
+            p += 1
+            continue
+        else:
+            raise ValueError("reserved op 0x%02X at byte %d" % (op, p - 1))
+        prev = c
+        index[color_hash(c)] = c
+        pixels.append(c)
+    return width, height, pixels[:width * height]
+
+
+# --- Image readers ------------------------------------------------------------
+
+def read_ppm(data):
+    fields, pos = [], 2
+    while len(fields) < 3:
+        while data[pos:pos + 1].isspace():
+            pos += 1
+        if data[pos:pos + 1] == b"#":
+            pos = data.index(b"\n", pos)
+            continue
+        end = pos
+        while not data[end:end + 1].isspace():
+            end += 1
+        fields.append(int(data[pos:end]))
+        pos = end
+    width, height, maxval = fields
+    if maxval != 255:
+        sys.exit("only 8-bit PPM is supported")
+    raw = data[pos + 1:pos + 1 + width * height * 3]
+    return width, height, [tuple(raw[i:i + 3]) + (255,) for i in range(0, len(raw), 3)]
+
+
+def read_png(data):
+    width = height = depth = ctype = None
+    palette, trns, idat, pos = [], b"", bytearray(), 8
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b"IHDR":
+            width, height, depth, ctype, _, _, interlace = struct.unpack(">IIBBBBB", body)
+            if depth != 8 or interlace:
+                sys.exit("only 8-bit, non-interlaced PNG is supported")
+        elif kind == b"PLTE":
+            palette = [tuple(body[i:i + 3]) for i in range(0, len(body), 3)]
+        elif kind == b"tRNS":
+            trns = body
+        elif kind == b"IDAT":
+            idat += body
+        elif kind == b"IEND":
+            break
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[ctype]
+    raw, stride = zlib.decompress(bytes(idat)), width * channels
+    rows, prior, p = [], bytearray(stride), 0
+    for _ in range(height):
+        ftype, line = raw[p], bytearray(raw[p + 1:p + 1 + stride])
+        p += 1 + stride
+        for i in range(stride):
+            a = line[i - channels] if i >= channels else 0
+            b, c = prior[i], prior[i - channels] if i >= channels else 0
+            if ftype == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif ftype == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif ftype == 3:
+                line[i] = (line[i] + (a + b) // 2) & 0xFF
+            elif ftype == 4:
+                pa, pb, pc = abs(b - c), abs(a - c), abs(a + b - 2 * c)
+                pred = a if pa <= pb and pa <= pc else b if pb <= pc else c
+                line[i] = (line[i] + pred) & 0xFF
+        rows.append(line)
+        prior = line
+    pixels = []
+    for line in rows:
+        for i in range(0, stride, channels):
+            v = line[i:i + channels]
+            if ctype == 0:
+                pixels.append((v[0], v[0], v[0], 255))
+            elif ctype == 2:
+                pixels.append((v[0], v[1], v[2], 255))
+            elif ctype == 3:
+                alpha = trns[v[0]] if v[0] < len(trns) else 255
+                pixels.append(palette[v[0]] + (alpha,))
+            elif ctype == 4:
+                pixels.append((v[0], v[0], v[0], v[1]))
+            else:
+                pixels.append(tuple(v))
+    return width, height, pixels
+
+
+def load(path, background):
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] == b"\x89PNG\r\n\x1a\n":
+        width, height, rgba = read_png(data)
+    elif data[:2] == b"P6":
+        width, height, rgba = read_ppm(data)
+    else:
+        sys.exit("%s: not a PNG or binary PPM file" % path)
+    br, bg, bb = background
+    blend = lambda v, a, back: (v * a + back * (255 - a) + 127) // 255
+    pixels = [to565(blend(r, a, br), blend(g, a, bg), blend(b, a, bb)) for r, g, b, a in rgba]
+    return width, height, pixels
+
+
+# --- Output -------------------------------------------------------------------
+
+def c_source(name, data, source):
+    lines = [
+        "// Generated by tools/st7789_img_encode.py from %s. Do not edit." % os.path.basename(source),
+        "",
+        "#include <stddef.h>",
+        "#include <stdint.h>",
+        "",
+        "const uint8_t %s[] = {" % name,
+    ]
+    for i in range(0, len(data), 16):
+        lines.append("    " + " ".join("0x%02X," % b for b in data[i:i + 16]))
+    lines += ["};", "", "const size_t %s_size = sizeof(%s);" % (name, name), ""]
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("input", help="PNG or binary PPM image")
+    parser.add_argument("-o", "--output", help="output file (default: input name with .s7q or .c)")
+    parser.add_argument("--c-array", metavar="NAME", help="write C source defining NAME and NAME_size")
+    parser.add_argument("--background", default="000000",
+                        help="RRGGBB hex color behind transparent pixels (default 000000)")
+    parser.add_argument("--check", action="store_true",
+                        help="encode and verify the round trip without writing anything")
+    args = parser.parse_args()
+
+    background = tuple(int(args.background[i:i + 2], 16) for i in (0, 2, 4))
+    width, height, pixels = load(args.input, background)
+    if not (0 < width <= 0xFFFF and 0 < height <= 0xFFFF):
+        sys.exit("image size %dx%d out of range" % (width, height))
+    data = encode(pixels, width, height)
+
+    if decode(data) != (width, height, pixels):
+        sys.exit("internal error: round trip mismatch")
+    raw = width * height * 2
+    print("%s: %dx%d, %d bytes raw RGB565 -> %d bytes S7Q (%.1f:1, %.2f bits/pixel)"
+          % (args.input, width, height, raw, len(data), raw / len(data),
+             len(data) * 8.0 / (width * height)))
+    if args.check:
+        return
+
+    base = os.path.splitext(args.input)[0]
+    if args.c_array:
+        output = args.output or base + ".c"
+        with open(output, "w") as f:
+            f.write(c_source(args.c_array, data, args.input))
+    else:
+        output = args.output or base + ".s7q"
+        with open(output, "wb") as f:
+            f.write(data)
+    print("wrote %s" % output)
+
+
+if __name__ == "__main__":
+    main()
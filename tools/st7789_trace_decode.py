@@ -0,0 +1,120 @@
+#!/usr/bin/env python3
+"""Turn an ST7789 bus trace into a readable command transcript.
+
+Input is either a serial log containing the output of st7789_trace_dump()
+(the default), or a raw binary file of st7789_trace_entry_t records as
+returned by st7789_trace_read() (--raw).
+
+    python tools/st7789_trace_decode.py monitor.log
+    python tools/st7789_trace_decode.py --raw trace.bin
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+ENTRY = struct.Struct("<IIBBH4s")   # Matches st7789_trace_entry_t
+
+CMD, DATA, RUN, RESET = 1, 2, 3, 4
+
+COMMANDS = {
+    0x00: "NOP", 0x01: "SWRESET", 0x04: "RDDID", 0x10: "SLPIN", 0x11: "SLPOUT",
+    0x12: "PTLON", 0x13: "NORON", 0x20: "INVOFF", 0x21: "INVON", 0x26: "GAMSET",
+    0x28: "DISPOFF", 0x29: "DISPON", 0x2A: "CASET", 0x2B: "RASET", 0x2C: "RAMWR",
+    0x30: "PTLAR", 0x33: "VSCRDEF", 0x34: "TEOFF", 0x35: "TEON", 0x36: "MADCTL",
+    0x37: "VSCSAD", 0x38: "IDMOFF", 0x39: "IDMON", 0x3A: "COLMOD", 0x3C: "RAMWRC",
+}
+
+HEX_LINE = re.compile(r"ST7789_TRACE: ([0-9a-f]{%d})\s*$" % (2 * ENTRY.size))
+BEGIN_LINE = re.compile(r"ST7789_TRACE: begin entries=(\d+) lost=(\d+)")
+
+
+def read_log(path):
+    """Collect the entries of the last dump found in a log file."""
+    entries, lost = [], 0
+    with open(path, "r", errors="replace") as f:
+        for line in f:
+            begin = BEGIN_LINE.search(line)
+            if begin:
+                entries, lost = [], int(begin.group(2))
+                continue
+            m = HEX_LINE.search(line)
+            if m:
+                entries.append(ENTRY.unpack(bytes.fromhex(m.group(1))))
+    return entries, lost
+
+
+def read_raw(path):
+    with open(path, "rb") as f:
+        blob = f.read()
+    usable = len(blob) - len(blob) % ENTRY.size
+    return [ENTRY.unpack_from(blob, off) for off in range(0, usable, ENTRY.size)], 0
+
+
+def describe_params(cmd, data, length):
+    """Interpret the parameter block that follows a command."""
+    if cmd in (0x2A, 0x2B) and length == 4:
+        start, end = struct.unpack(">HH", data)
+        axis = "x" if cmd == 0x2A else "y"
+        return "%s=%d..%d" % (axis, start, end)
+    if cmd == 0x3A and length >= 1:
+        return {0x55: "RGB565", 0x53: "RGB444", 0x66: "RGB666"}.get(data[0], "")
+    if cmd == 0x36 and length >= 1:
+        return "MY=%d MX=%d MV=%d ML=%d BGR=%d" % tuple(
+            (data[0] >> bit) & 1 for bit in (7, 6, 5, 4, 3))
+    return ""
+
+
+def decode(entries, lost, out):
+    if lost:
+        out.write("# %d older entries were overwritten\n" % lost)
+    if not entries:
+        out.write("# no entries\n")
+        return
+
+    t0 = entries[0][0]
+    last_cmd = None
+    totals = {"commands": 0, "data_bytes": 0}
+    for ts, length, kind, inline_len, _, data in entries:
+        ms = ((ts - t0) & 0xFFFFFFFF) / 1000.0
+        data = data[:inline_len]
+        if kind == CMD:
+            last_cmd = data[0]
+            totals["commands"] += 1
+            out.write("%10.3f ms  CMD   0x%02X %s\n"
+                      % (ms, last_cmd, COMMANDS.get(last_cmd, "")))
+        elif kind == DATA:
+            totals["data_bytes"] += length
+            shown = " ".join("%02X" % b for b in data)
+            more = " ..." if length > inline_len else ""
+            note = describe_params(last_cmd, data, length) if length <= 4 else ""
+            out.write("%10.3f ms  DATA  %6d bytes  [%s%s] %s\n"
+                      % (ms, length, shown, more, note))
+        elif kind == RUN:
+            totals["data_bytes"] += 2 * length
+            value = (data[0] << 8) | data[1]
+            out.write("%10.3f ms  RUN   %6d x 0x%04X (%d bytes)\n"
+                      % (ms, length, value, 2 * length))
+        elif kind == RESET:
+            out.write("%10.3f ms  RESET %s\n"
+                      % (ms, "asserted" if length == 0 else "released"))
+        else:
+            out.write("%10.3f ms  ?     type %d\n" % (ms, kind))
+    out.write("# %d entries, %d commands, %d data bytes\n"
+              % (len(entries), totals["commands"], totals["data_bytes"]))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("input", help="serial log, or binary dump with --raw")
+    parser.add_argument("--raw", action="store_true",
+                        help="input is raw st7789_trace_entry_t records")
+    args = parser.parse_args()
+
+    entries, lost = read_raw(args.input) if args.raw else read_log(args.input)
+    decode(entries, lost, sys.stdout)
+
+
+if __name__ == "__main__":
+    main()